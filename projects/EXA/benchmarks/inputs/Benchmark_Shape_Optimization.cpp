@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * Benchmark_Shape_Optimization.cpp
+ *
+ */
+
+// Shape optimization benchmark: thermoelastic shape sensitivity sweep in 2D, see optimization/Shape_Sensitivity_Circle_Sweep_Thermoelastic
+// The HMR parameters of the example are wrapped to refine its background mesh.
+#define HMRParameterList EXA_HMRParameterList
+#include "Shape_Sensitivity_Circle_Sweep_Thermoelastic.cpp"
+#undef HMRParameterList
+
+#include "fn_EXA_Benchmark_Input.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//------------------------------------------------------------------------------
+namespace moris
+{
+    void
+    HMRParameterList( moris::Cell< moris::Cell< ParameterList > >& aParameterList )
+    {
+        EXA_HMRParameterList( aParameterList );
+
+        exa::scale_hmr_mesh( aParameterList, MORIS_BENCHMARK_SCALE );
+    }
+}    // namespace moris
+
+//------------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
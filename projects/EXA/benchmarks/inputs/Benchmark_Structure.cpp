@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * Benchmark_Structure.cpp
+ *
+ */
+
+// Structural benchmark: linear elastic immersed thick-walled pressure vessel in 3D, see structure/linear/Thick_Pressure_Vessel
+// The HMR parameters of the example are wrapped to refine its background mesh.
+#define HMRParameterList EXA_HMRParameterList
+#include "Pressure_Vessel_3D_Immersed.cpp"
+#undef HMRParameterList
+
+// interpolation order is defined by the example test case, which is not part of the benchmark
+uint gInterpolationOrder = 1;
+
+#include "fn_EXA_Benchmark_Input.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//------------------------------------------------------------------------------
+namespace moris
+{
+    void
+    HMRParameterList( moris::Cell< moris::Cell< ParameterList > >& aParameterList )
+    {
+        EXA_HMRParameterList( aParameterList );
+
+        exa::scale_hmr_mesh( aParameterList, MORIS_BENCHMARK_SCALE );
+    }
+}    // namespace moris
+
+//------------------------------------------------------------------------------
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,201 @@
+#
+# Copyright (c) 2022 University of Colorado
+# Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+#
+#------------------------------------------------------------------------------------
+#
+
+## Runs the benchmark cases and compares their results against the baseline.
+## Called by the moris_benchmarks targets, see CMakeLists.txt in this directory.
+##
+## Params: BENCHMARK_CASES         comma separated list of name|input file|number of processors
+##         BENCHMARK_DIR           directory with one sub-directory per benchmark case
+##         BENCHMARK_BASELINE_DIR  directory with the baseline results
+##         MORIS_EXECUTE_COMMAND   MPI launcher
+##         MORIS_EXE               moris executable
+##         COMPARE_EXE             benchmark_compare executable
+##         CONTAINERS_EXE          benchmark_containers executable
+##         ENRICHMENT_EXE          benchmark_enrichment executable
+##         ENRICHMENT_ELEMENTS     number of elements per dimension of the enrichment benchmark
+##         ENRICHMENT_THREADS      number of threads of the enrichment benchmark
+##         DECOMPOSITION_EXE       benchmark_decomposition executable
+##         DECOMPOSITION_ELEMENTS  number of elements per dimension of the decomposition benchmark
+##         DECOMPOSITION_THREADS   number of flood fill threads of the decomposition benchmark
+##         RCM_EXE                 benchmark_rcm executable
+##         RCM_ELEMENTS            number of elements per dimension of the adof ordering benchmark
+##         BATCHED_IWG_EXE         benchmark_batched_iwg executable
+##         BATCHED_IWG_ELEMENTS    number of element evaluations of the batched IWG benchmark
+##         TIME_TOLERANCE          relative tolerance of times
+##         MEMORY_TOLERANCE        relative tolerance of memory
+##         MIN_TIME                phases faster than this are not compared
+##         UPDATE_BASELINE         ON to store the results as new baseline instead of comparing
+##         REQUIRE_BASELINE        ON to fail for benchmarks without baseline instead of storing their results as baseline
+
+string(REPLACE "," ";" BENCHMARK_CASES "${BENCHMARK_CASES}")
+
+set(BENCHMARK_RESULT_DIR ${BENCHMARK_DIR}/results)
+file(MAKE_DIRECTORY ${BENCHMARK_RESULT_DIR})
+
+set(BENCHMARK_FAILURES "")
+
+# -------------------------------------------------------------------------
+# compares a result file against its baseline or updates the baseline
+
+function(compare_benchmark BENCHMARK_NAME)
+    set(RESULT_FILE ${BENCHMARK_RESULT_DIR}/${BENCHMARK_NAME}.json)
+    set(BASELINE_FILE ${BENCHMARK_BASELINE_DIR}/${BENCHMARK_NAME}.json)
+
+    if(UPDATE_BASELINE)
+        file(COPY ${RESULT_FILE} DESTINATION ${BENCHMARK_BASELINE_DIR})
+        message(STATUS "Benchmark ${BENCHMARK_NAME}: baseline updated")
+        return()
+    endif()
+
+    if(NOT EXISTS ${BASELINE_FILE})
+        if(REQUIRE_BASELINE)
+            set(BENCHMARK_FAILURES ${BENCHMARK_FAILURES} "${BENCHMARK_NAME} (no baseline in ${BENCHMARK_BASELINE_DIR})" PARENT_SCOPE)
+        else()
+            file(COPY ${RESULT_FILE} DESTINATION ${BENCHMARK_BASELINE_DIR})
+            message(WARNING "Benchmark ${BENCHMARK_NAME}: no baseline found, results stored as baseline in ${BENCHMARK_BASELINE_DIR}")
+        endif()
+        return()
+    endif()
+
+    execute_process(
+        COMMAND ${COMPARE_EXE} ${RESULT_FILE} ${BASELINE_FILE}
+                --tolerance ${TIME_TOLERANCE}
+                --memory-tolerance ${MEMORY_TOLERANCE}
+                --min-time ${MIN_TIME}
+        RESULT_VARIABLE COMPARE_RESULT)
+
+    if(NOT COMPARE_RESULT EQUAL 0)
+        set(BENCHMARK_FAILURES ${BENCHMARK_FAILURES} "${BENCHMARK_NAME} (regression)" PARENT_SCOPE)
+    endif()
+endfunction()
+
+# -------------------------------------------------------------------------
+# benchmark cases built from the examples
+
+foreach(BENCHMARK_CASE ${BENCHMARK_CASES})
+    string(REPLACE "|" ";" BENCHMARK_CASE ${BENCHMARK_CASE})
+    list(GET BENCHMARK_CASE 0 BENCHMARK_NAME)
+    list(GET BENCHMARK_CASE 1 BENCHMARK_INPUT)
+    list(GET BENCHMARK_CASE 2 BENCHMARK_PROCS)
+
+    message(STATUS "Benchmark ${BENCHMARK_NAME}: running on ${BENCHMARK_PROCS} processor(s)")
+
+    execute_process(
+        COMMAND ${MORIS_EXECUTE_COMMAND} -n ${BENCHMARK_PROCS} ${MORIS_EXE} ./${BENCHMARK_INPUT}.so
+                --benchmark ${BENCHMARK_RESULT_DIR}/${BENCHMARK_NAME}.json
+        WORKING_DIRECTORY ${BENCHMARK_DIR}/${BENCHMARK_NAME}
+        OUTPUT_FILE ${BENCHMARK_RESULT_DIR}/${BENCHMARK_NAME}.log
+        ERROR_FILE ${BENCHMARK_RESULT_DIR}/${BENCHMARK_NAME}.log
+        RESULT_VARIABLE RUN_RESULT)
+
+    if(NOT RUN_RESULT EQUAL 0)
+        list(APPEND BENCHMARK_FAILURES "${BENCHMARK_NAME} (run failed, see ${BENCHMARK_NAME}.log)")
+        continue()
+    endif()
+
+    compare_benchmark(${BENCHMARK_NAME})
+endforeach()
+
+# -------------------------------------------------------------------------
+# container micro benchmark
+
+message(STATUS "Benchmark Containers: running on 1 processor")
+
+execute_process(
+    COMMAND ${CONTAINERS_EXE} --benchmark ${BENCHMARK_RESULT_DIR}/Containers.json
+    OUTPUT_FILE ${BENCHMARK_RESULT_DIR}/Containers.log
+    ERROR_FILE ${BENCHMARK_RESULT_DIR}/Containers.log
+    RESULT_VARIABLE RUN_RESULT)
+
+if(RUN_RESULT EQUAL 0)
+    compare_benchmark(Containers)
+else()
+    list(APPEND BENCHMARK_FAILURES "Containers (run failed, see Containers.log)")
+endif()
+
+# -------------------------------------------------------------------------
+# enrichment micro benchmark
+
+message(STATUS "Benchmark Enrichment: running on 1 processor with 1 and ${ENRICHMENT_THREADS} thread(s)")
+
+execute_process(
+    COMMAND ${ENRICHMENT_EXE} --benchmark ${BENCHMARK_RESULT_DIR}/Enrichment.json
+            --elements ${ENRICHMENT_ELEMENTS}
+            --threads ${ENRICHMENT_THREADS}
+    OUTPUT_FILE ${BENCHMARK_RESULT_DIR}/Enrichment.log
+    ERROR_FILE ${BENCHMARK_RESULT_DIR}/Enrichment.log
+    RESULT_VARIABLE RUN_RESULT)
+
+if(RUN_RESULT EQUAL 0)
+    compare_benchmark(Enrichment)
+else()
+    list(APPEND BENCHMARK_FAILURES "Enrichment (run failed, see Enrichment.log)")
+endif()
+
+# -------------------------------------------------------------------------
+# decomposition micro benchmark
+
+message(STATUS "Benchmark Decomposition: running on 1 processor with 1 and ${DECOMPOSITION_THREADS} flood fill thread(s)")
+
+execute_process(
+    COMMAND ${DECOMPOSITION_EXE} --benchmark ${BENCHMARK_RESULT_DIR}/Decomposition.json
+            --elements ${DECOMPOSITION_ELEMENTS}
+            --threads ${DECOMPOSITION_THREADS}
+    OUTPUT_FILE ${BENCHMARK_RESULT_DIR}/Decomposition.log
+    ERROR_FILE ${BENCHMARK_RESULT_DIR}/Decomposition.log
+    RESULT_VARIABLE RUN_RESULT)
+
+if(RUN_RESULT EQUAL 0)
+    compare_benchmark(Decomposition)
+else()
+    list(APPEND BENCHMARK_FAILURES "Decomposition (run failed, see Decomposition.log)")
+endif()
+
+# -------------------------------------------------------------------------
+# adof ordering micro benchmark
+
+message(STATUS "Benchmark RCM: running on 1 processor")
+
+execute_process(
+    COMMAND ${RCM_EXE} --benchmark ${BENCHMARK_RESULT_DIR}/RCM.json
+            --elements ${RCM_ELEMENTS}
+    OUTPUT_FILE ${BENCHMARK_RESULT_DIR}/RCM.log
+    ERROR_FILE ${BENCHMARK_RESULT_DIR}/RCM.log
+    RESULT_VARIABLE RUN_RESULT)
+
+if(RUN_RESULT EQUAL 0)
+    compare_benchmark(RCM)
+else()
+    list(APPEND BENCHMARK_FAILURES "RCM (run failed, see RCM.log)")
+endif()
+
+# -------------------------------------------------------------------------
+# batched IWG micro benchmark
+
+message(STATUS "Benchmark Batched_IWG: running on 1 processor with ${BATCHED_IWG_ELEMENTS} element evaluations")
+
+execute_process(
+    COMMAND ${BATCHED_IWG_EXE} --benchmark ${BENCHMARK_RESULT_DIR}/Batched_IWG.json
+            --elements ${BATCHED_IWG_ELEMENTS}
+    OUTPUT_FILE ${BENCHMARK_RESULT_DIR}/Batched_IWG.log
+    ERROR_FILE ${BENCHMARK_RESULT_DIR}/Batched_IWG.log
+    RESULT_VARIABLE RUN_RESULT)
+
+if(RUN_RESULT EQUAL 0)
+    compare_benchmark(Batched_IWG)
+else()
+    list(APPEND BENCHMARK_FAILURES "Batched_IWG (run failed, see Batched_IWG.log)")
+endif()
+
+# -------------------------------------------------------------------------
+
+if(BENCHMARK_FAILURES)
+    string(REPLACE ";" "\n    " BENCHMARK_FAILURES "${BENCHMARK_FAILURES}")
+    message(FATAL_ERROR "Benchmarks failed:\n    ${BENCHMARK_FAILURES}\nResults are in ${BENCHMARK_RESULT_DIR}")
+endif()
+
+message(STATUS "All benchmarks passed, results are in ${BENCHMARK_RESULT_DIR}")
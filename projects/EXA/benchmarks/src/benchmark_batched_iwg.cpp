@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * benchmark_batched_iwg.cpp
+ *
+ * Benchmark of the batched evaluation of IWGs: the residual and Jacobian of the diffusion and the linear
+ * elasticity bulk IWG on a HEX8 element with 2x2x2 integration points are evaluated for the given number of
+ * elements point by point and batched over all integration points. For each IWG the ratio of the batched
+ * to the pointwise time is reported, the batched path is faster if the ratio is below one.
+ *
+ * usage: benchmark_batched_iwg --benchmark <results.json> [--elements <n>]
+ *
+ */
+
+#include <string>
+
+#include "cl_Communication_Manager.hpp"    // COM/src
+#include "cl_Logger.hpp"                   // MRS/IOS/src
+#include "cl_Tracer.hpp"                   // MRS/IOS/src
+#include "cl_Stopwatch.hpp"                // MRS/CHR/src
+#include "fn_norm.hpp"                     // LINALG/src
+
+// the set of the IWG is set up directly, as in the FEM unit tests
+#define protected public
+#define private   public
+#include "cl_FEM_Field_Interpolator_Manager.hpp"
+#include "cl_FEM_IWG.hpp"
+#include "cl_FEM_Set.hpp"
+#undef protected
+#undef private
+
+#include "cl_MTK_Enums.hpp"
+#include "cl_MTK_Integrator.hpp"
+
+#include "cl_FEM_Enums.hpp"
+#include "cl_FEM_Field_Interpolator.hpp"
+#include "cl_FEM_Integration_Point_Batch.hpp"
+#include "cl_FEM_Property.hpp"
+#include "cl_FEM_CM_Factory.hpp"
+#include "cl_FEM_IWG_Factory.hpp"
+
+moris::Comm_Manager gMorisComm;
+moris::Logger       gLogger;
+
+using namespace moris;
+using namespace fem;
+
+//---------------------------------------------------------------
+
+/**
+ * @brief constant property value given by the first parameter
+ */
+void
+const_value_function(
+        Matrix< DDRMat >&                 aPropMatrix,
+        moris::Cell< Matrix< DDRMat > >& aParameters,
+        Field_Interpolator_Manager*       aFIManager )
+{
+    aPropMatrix = aParameters( 0 );
+}
+
+//---------------------------------------------------------------
+
+/**
+ * @brief evaluates residual and Jacobian of a bulk IWG on a distorted HEX8 element point by point and
+ * batched, checks that both agree and reports the time of both paths
+ * @param[ in ] aName        name of the IWG in the results
+ * @param[ in ] aIWG         IWG to evaluate
+ * @param[ in ] aDofTypes    dof types of the IWG
+ * @param[ in ] aNumFields   number of fields of the residual dof type
+ * @param[ in ] aNumElements number of element evaluations per path
+ */
+void
+benchmark_batched_iwg(
+        const std::string&                                 aName,
+        std::shared_ptr< IWG >&                            aIWG,
+        const moris::Cell< moris::Cell< MSI::Dof_Type > >& aDofTypes,
+        uint                                               aNumFields,
+        uint                                               aNumElements )
+{
+    // set a fem set pointer
+    MSI::Equation_Set* tSet = new fem::Set();
+    static_cast< fem::Set* >( tSet )->set_set_type( fem::Element_Type::BULK );
+    aIWG->set_set_pointer( static_cast< fem::Set* >( tSet ) );
+
+    // set size and populate the set dof type maps
+    aIWG->mSet->mUniqueDofTypeList.resize( 100, MSI::Dof_Type::END_ENUM );
+    aIWG->mSet->mUniqueDofTypeMap.set_size( static_cast< int >( MSI::Dof_Type::END_ENUM ) + 1, 1, -1 );
+    aIWG->mSet->mUniqueDofTypeMap( static_cast< int >( aDofTypes( 0 )( 0 ) ) ) = 0;
+    aIWG->mSet->mLeaderDofTypeMap.set_size( static_cast< int >( MSI::Dof_Type::END_ENUM ) + 1, 1, -1 );
+    aIWG->mSet->mLeaderDofTypeMap( static_cast< int >( aDofTypes( 0 )( 0 ) ) ) = 0;
+
+    // create a space time geometry interpolator for a HEX8
+    mtk::Interpolation_Rule tGIRule( mtk::Geometry_Type::HEX,
+            mtk::Interpolation_Type::LAGRANGE,
+            mtk::Interpolation_Order::LINEAR,
+            mtk::Interpolation_Type::LAGRANGE,
+            mtk::Interpolation_Order::LINEAR );
+
+    Geometry_Interpolator tGI( tGIRule );
+
+    // distorted unit cube
+    Matrix< DDRMat > tTHat = { { 0.0 }, { 1.0 } };
+    Matrix< DDRMat > tXHat = {
+        { 0.0, 0.0, 0.0 },
+        { 1.1, 0.0, 0.1 },
+        { 1.0, 0.9, 0.0 },
+        { 0.1, 1.0, 0.0 },
+        { 0.0, 0.1, 1.0 },
+        { 1.0, 0.0, 1.2 },
+        { 1.1, 1.0, 1.0 },
+        { 0.0, 1.1, 0.9 }
+    };
+    tGI.set_coeff( tXHat, tTHat );
+
+    // create an integration rule and get points and weights
+    mtk::Integration_Rule tIntegrationRule(
+            mtk::Geometry_Type::HEX,
+            mtk::Integration_Type::GAUSS,
+            mtk::Integration_Order::HEX_2x2x2,
+            mtk::Geometry_Type::LINE,
+            mtk::Integration_Type::GAUSS,
+            mtk::Integration_Order::BAR_1 );
+
+    mtk::Integrator tIntegrator( tIntegrationRule );
+
+    Matrix< DDRMat > tIntegPoints;
+    Matrix< DDRMat > tIntegWeights;
+    tIntegrator.get_points( tIntegPoints );
+    tIntegrator.get_weights( tIntegWeights );
+
+    uint tNumGPs = tIntegPoints.n_cols();
+
+    // coefficients of the residual field on both time levels
+    Matrix< DDRMat > tDofHat( 16, aNumFields );
+    for ( uint iNode = 0; iNode < 16; iNode++ )
+    {
+        for ( uint iField = 0; iField < aNumFields; iField++ )
+        {
+            tDofHat( iNode, iField ) = 0.1 * ( iNode + 1 ) * ( iField + 1 ) + 0.01 * iNode * iNode;
+        }
+    }
+
+    uint tNumDofs = tDofHat.numel();
+
+    // create the field interpolator for the residual dof type
+    moris::Cell< Field_Interpolator* > tLeaderFIs( 1 );
+    tLeaderFIs( 0 ) = new Field_Interpolator( aNumFields, tGIRule, &tGI, aDofTypes( 0 ) );
+    tLeaderFIs( 0 )->set_coeff( tDofHat );
+
+    // set size and fill the set residual and jacobian assembly map
+    aIWG->mSet->mResDofAssemblyMap.resize( 1 );
+    aIWG->mSet->mResDofAssemblyMap( 0 ) = { { 0, tNumDofs - 1 } };
+    aIWG->mSet->mJacDofAssemblyMap.resize( 1 );
+    aIWG->mSet->mJacDofAssemblyMap( 0 ) = { { 0, tNumDofs - 1 } };
+
+    // set size and init the set residual and jacobian
+    aIWG->mSet->mResidual.resize( 1 );
+    aIWG->mSet->mResidual( 0 ).set_size( tNumDofs, 1, 0.0 );
+    aIWG->mSet->mJacobian.set_size( tNumDofs, tNumDofs, 0.0 );
+
+    // build global dof type list and populate the requested leader dof type
+    aIWG->get_global_dof_type_list();
+    aIWG->mRequestedLeaderGlobalDofTypes = aDofTypes;
+
+    // create and populate a field interpolator manager
+    moris::Cell< moris::Cell< enum PDV_Type > >        tDummyDv;
+    moris::Cell< moris::Cell< enum mtk::Field_Type > > tDummyField;
+    Field_Interpolator_Manager                         tFIManager( aDofTypes, tDummyDv, tDummyField, tSet );
+
+    tFIManager.mFI                     = tLeaderFIs;
+    tFIManager.mIPGeometryInterpolator = &tGI;
+    tFIManager.mIGGeometryInterpolator = &tGI;
+
+    aIWG->mSet->mLeaderFIManager = &tFIManager;
+    aIWG->set_field_interpolator_manager( &tFIManager );
+
+    MORIS_ERROR( aIWG->supports_batched_evaluation(),
+            "benchmark_batched_iwg - IWG %s does not support batched evaluation.",
+            aName.c_str() );
+
+    // evaluate point by point
+    Matrix< DDRMat > tResidual;
+    Matrix< DDRMat > tJacobian;
+
+    tic tPointwiseTimer;
+    {
+        Tracer tTracer( "Benchmark", aName + "_Pointwise", "Evaluate" );
+
+        for ( uint iElement = 0; iElement < aNumElements; iElement++ )
+        {
+            aIWG->mSet->mResidual( 0 ).fill( 0.0 );
+            aIWG->mSet->mJacobian.fill( 0.0 );
+
+            for ( uint iGP = 0; iGP < tNumGPs; iGP++ )
+            {
+                aIWG->reset_eval_flags();
+
+                tFIManager.set_space_time( tIntegPoints.get_column( iGP ) );
+
+                real tWStar = tIntegWeights( iGP ) * tGI.det_J();
+
+                aIWG->compute_residual( tWStar );
+                aIWG->compute_jacobian( tWStar );
+            }
+        }
+
+        tResidual = aIWG->mSet->mResidual( 0 );
+        tJacobian = aIWG->mSet->mJacobian;
+    }
+    real tPointwiseTime = tPointwiseTimer.toc< moris::chronos::microseconds >().wall;
+
+    // evaluate batched, the batch is reused for all elements as in a set
+    Integration_Point_Batch tBatch;
+
+    tic tBatchedTimer;
+    {
+        Tracer tTracer( "Benchmark", aName + "_Batched", "Evaluate" );
+
+        for ( uint iElement = 0; iElement < aNumElements; iElement++ )
+        {
+            aIWG->mSet->mResidual( 0 ).fill( 0.0 );
+            aIWG->mSet->mJacobian.fill( 0.0 );
+
+            tBatch.initialize( tNumGPs );
+
+            aIWG->register_batched_data( tBatch );
+
+            for ( uint iGP = 0; iGP < tNumGPs; iGP++ )
+            {
+                aIWG->reset_eval_flags();
+
+                tFIManager.set_space_time( tIntegPoints.get_column( iGP ) );
+
+                tBatch.set_weight( iGP, tIntegWeights( iGP ) * tGI.det_J() );
+
+                tBatch.collect( iGP );
+            }
+
+            aIWG->compute_residual_batched( tBatch );
+            aIWG->compute_jacobian_batched( tBatch );
+        }
+    }
+    real tBatchedTime = tBatchedTimer.toc< moris::chronos::microseconds >().wall;
+
+    // both paths have to give the same element matrices
+    MORIS_ERROR( norm( aIWG->mSet->mResidual( 0 ) - tResidual ) < 1.0e-10 * ( 1.0 + norm( tResidual ) )
+                         and norm( aIWG->mSet->mJacobian - tJacobian ) < 1.0e-10 * ( 1.0 + norm( tJacobian ) ),
+            "benchmark_batched_iwg - batched and pointwise evaluation of IWG %s differ.",
+            aName.c_str() );
+
+    // time per element and ratio of batched to pointwise time, a regression increases the ratio
+    {
+        Tracer tTracer( "Benchmark", aName, "Compare" );
+
+        MORIS_LOG_SPEC( "Pointwise time per element (us)", tPointwiseTime / aNumElements );
+        MORIS_LOG_SPEC( "Batched time per element (us)", tBatchedTime / aNumElements );
+
+        gLogger.add_benchmark_value( "batched_time_ratio", tBatchedTime / tPointwiseTime );
+    }
+
+    // clean up
+    delete tLeaderFIs( 0 );
+    delete tSet;
+}
+
+//---------------------------------------------------------------
+
+void
+benchmark_diffusion( uint aNumElements )
+{
+    moris::Cell< moris::Cell< MSI::Dof_Type > > tTempDofTypes = { { MSI::Dof_Type::TEMP } };
+
+    // create the properties
+    std::shared_ptr< Property > tPropConductivity = std::make_shared< Property >();
+    tPropConductivity->set_parameters( { { { 1.2 } } } );
+    tPropConductivity->set_val_function( const_value_function );
+
+    std::shared_ptr< Property > tPropLoad = std::make_shared< Property >();
+    tPropLoad->set_parameters( { { { 2.0 } } } );
+    tPropLoad->set_val_function( const_value_function );
+
+    // define constitutive model
+    CM_Factory tCMFactory;
+
+    std::shared_ptr< Constitutive_Model > tCMDiffLinIso = tCMFactory.create_CM( Constitutive_Type::DIFF_LIN_ISO );
+    tCMDiffLinIso->set_dof_type_list( tTempDofTypes );
+    tCMDiffLinIso->set_property( tPropConductivity, "Conductivity" );
+    tCMDiffLinIso->set_space_dim( 3 );
+    tCMDiffLinIso->set_local_properties();
+
+    // define the IWG
+    IWG_Factory tIWGFactory;
+
+    std::shared_ptr< IWG > tIWG = tIWGFactory.create_IWG( IWG_Type::SPATIALDIFF_BULK );
+    tIWG->set_residual_dof_type( tTempDofTypes );
+    tIWG->set_dof_type_list( tTempDofTypes, mtk::Leader_Follower::LEADER );
+    tIWG->set_constitutive_model( tCMDiffLinIso, "Diffusion" );
+    tIWG->set_property( tPropLoad, "Load" );
+
+    benchmark_batched_iwg( "Diffusion", tIWG, tTempDofTypes, 1, aNumElements );
+}
+
+//---------------------------------------------------------------
+
+void
+benchmark_elasticity( uint aNumElements )
+{
+    moris::Cell< moris::Cell< MSI::Dof_Type > > tDispDofTypes = { { MSI::Dof_Type::UX } };
+
+    // create the properties
+    std::shared_ptr< Property > tPropEMod = std::make_shared< Property >();
+    tPropEMod->set_parameters( { { { 1.0 } } } );
+    tPropEMod->set_val_function( const_value_function );
+
+    std::shared_ptr< Property > tPropNu = std::make_shared< Property >();
+    tPropNu->set_parameters( { { { 0.3 } } } );
+    tPropNu->set_val_function( const_value_function );
+
+    std::shared_ptr< Property > tPropLoad = std::make_shared< Property >();
+    tPropLoad->set_parameters( { { { 1.0 }, { 2.0 }, { 3.0 } } } );
+    tPropLoad->set_val_function( const_value_function );
+
+    // define constitutive model
+    CM_Factory tCMFactory;
+
+    std::shared_ptr< Constitutive_Model > tCMStrucLinIso = tCMFactory.create_CM( Constitutive_Type::STRUC_LIN_ISO );
+    tCMStrucLinIso->set_dof_type_list( { tDispDofTypes } );
+    tCMStrucLinIso->set_property( tPropEMod, "YoungsModulus" );
+    tCMStrucLinIso->set_property( tPropNu, "PoissonRatio" );
+    tCMStrucLinIso->set_model_type( Model_Type::FULL );
+    tCMStrucLinIso->set_space_dim( 3 );
+    tCMStrucLinIso->set_local_properties();
+
+    // define the IWG
+    IWG_Factory tIWGFactory;
+
+    std::shared_ptr< IWG > tIWG = tIWGFactory.create_IWG( IWG_Type::STRUC_LINEAR_BULK );
+    tIWG->set_residual_dof_type( tDispDofTypes );
+    tIWG->set_dof_type_list( tDispDofTypes, mtk::Leader_Follower::LEADER );
+    tIWG->set_constitutive_model( tCMStrucLinIso, "ElastLinIso" );
+    tIWG->set_property( tPropLoad, "Load" );
+
+    benchmark_batched_iwg( "Elasticity", tIWG, tDispDofTypes, 3, aNumElements );
+}
+
+//---------------------------------------------------------------
+
+int
+main( int argc, char* argv[] )
+{
+    gMorisComm = moris::Comm_Manager( &argc, &argv );
+
+    gLogger.initialize( argc, argv );
+
+    uint tNumElements = 10000;
+
+    for ( int k = 1; k + 1 < argc; ++k )
+    {
+        if ( std::string( argv[ k ] ) == "--elements" )
+        {
+            tNumElements = std::stoi( argv[ k + 1 ] );
+        }
+    }
+
+    benchmark_diffusion( tNumElements );
+
+    benchmark_elasticity( tNumElements );
+
+    gMorisComm.finalize();
+
+    return 0;
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * benchmark_compare.cpp
+ *
+ * Compares benchmark results written by the logger ( --benchmark ) against a baseline.
+ *
+ * usage: benchmark_compare <results.json> <baseline.json> [--tolerance <rel>] [--memory-tolerance <rel>] [--min-time <s>]
+ *
+ * Returns 0 if no quantity of any phase exceeds its baseline value by more than the tolerance, 1 otherwise.
+ * Times of phases whose baseline is below the minimal time are not compared, as they are dominated by noise.
+ *
+ */
+
+#include <cstdio>
+#include <string>
+#include <map>
+#include <vector>
+#include <utility>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+//---------------------------------------------------------------
+
+// phases in order of the file and their quantities
+typedef std::vector< std::pair< std::string, std::map< std::string, double > > > Benchmark_Phases;
+
+//---------------------------------------------------------------
+
+Benchmark_Phases
+read_benchmark_file( const std::string& aFileName )
+{
+    boost::property_tree::ptree tTree;
+    boost::property_tree::read_json( aFileName, tTree );
+
+    Benchmark_Phases tPhases;
+
+    for ( auto const & tPhaseNode : tTree.get_child( "phases" ) )
+    {
+        std::map< std::string, double > tQuantities;
+
+        for ( auto const & tQuantity : tPhaseNode.second )
+        {
+            if ( tQuantity.first != "name" )
+            {
+                tQuantities[ tQuantity.first ] = tQuantity.second.get_value< double >();
+            }
+        }
+
+        tPhases.push_back( { tPhaseNode.second.get< std::string >( "name" ), tQuantities } );
+    }
+
+    return tPhases;
+}
+
+//---------------------------------------------------------------
+
+bool
+is_time( const std::string& aQuantity )
+{
+    return aQuantity.size() >= 5 and aQuantity.compare( aQuantity.size() - 5, 5, "_time" ) == 0;
+}
+
+//---------------------------------------------------------------
+
+int
+main( int argc, char* argv[] )
+{
+    if ( argc < 3 )
+    {
+        std::fprintf( stderr, "usage: %s <results.json> <baseline.json> [--tolerance <rel>] [--memory-tolerance <rel>] [--min-time <s>]\n", argv[ 0 ] );
+        return 2;
+    }
+
+    double tTolerance       = 0.1;
+    double tMemoryTolerance = 0.1;
+    double tMinTime         = 0.1;
+
+    for ( int k = 3; k + 1 < argc; k += 2 )
+    {
+        std::string tFlag = argv[ k ];
+
+        if ( tFlag == "--tolerance" )
+        {
+            tTolerance = std::stod( argv[ k + 1 ] );
+        }
+        else if ( tFlag == "--memory-tolerance" )
+        {
+            tMemoryTolerance = std::stod( argv[ k + 1 ] );
+        }
+        else if ( tFlag == "--min-time" )
+        {
+            tMinTime = std::stod( argv[ k + 1 ] );
+        }
+        else
+        {
+            std::fprintf( stderr, "Unknown flag: %s\n", tFlag.c_str() );
+            return 2;
+        }
+    }
+
+    Benchmark_Phases tResults;
+    Benchmark_Phases tBaseline;
+
+    try
+    {
+        tResults  = read_benchmark_file( argv[ 1 ] );
+        tBaseline = read_benchmark_file( argv[ 2 ] );
+    }
+    catch ( const boost::property_tree::ptree_error& aError )
+    {
+        std::fprintf( stderr, "Could not read benchmark files: %s\n", aError.what() );
+        return 2;
+    }
+
+    std::map< std::string, unsigned int > tResultIndices;
+
+    for ( unsigned int iPhase = 0; iPhase < tResults.size(); iPhase++ )
+    {
+        tResultIndices[ tResults[ iPhase ].first ] = iPhase;
+    }
+
+    unsigned int tNumRegressions = 0;
+
+    std::printf( "%-12s %-20s %14s %14s %9s  %s\n", "status", "quantity", "baseline", "result", "change", "phase" );
+
+    for ( auto const & tBaselinePhase : tBaseline )
+    {
+        auto tIter = tResultIndices.find( tBaselinePhase.first );
+
+        if ( tIter == tResultIndices.end() )
+        {
+            std::printf( "%-12s %-20s %14s %14s %9s  %s\n", "missing", "", "", "", "", tBaselinePhase.first.c_str() );
+            continue;
+        }
+
+        std::map< std::string, double > const & tQuantities = tResults[ tIter->second ].second;
+
+        for ( auto const & tBaselineQuantity : tBaselinePhase.second )
+        {
+            auto tQuantityIter = tQuantities.find( tBaselineQuantity.first );
+
+            // the number of calls is reported but not a measure of performance
+            if ( tQuantityIter == tQuantities.end() or tBaselineQuantity.first == "calls" )
+            {
+                continue;
+            }
+
+            double tBaselineValue = tBaselineQuantity.second;
+            double tResultValue   = tQuantityIter->second;
+
+            bool tIsTime = is_time( tBaselineQuantity.first );
+
+            if ( tIsTime and tBaselineValue < tMinTime )
+            {
+                continue;
+            }
+
+            double tChange = tBaselineValue > 0.0 ? ( tResultValue - tBaselineValue ) / tBaselineValue : 0.0;
+
+            double tQuantityTolerance = tIsTime ? tTolerance : tMemoryTolerance;
+
+            const char* tStatus = "ok";
+
+            if ( tChange > tQuantityTolerance )
+            {
+                tStatus = "REGRESSION";
+                tNumRegressions++;
+            }
+            else if ( tChange < -tQuantityTolerance )
+            {
+                tStatus = "improvement";
+            }
+
+            std::printf( "%-12s %-20s %14.6e %14.6e %8.1f%%  %s\n",
+                    tStatus,
+                    tBaselineQuantity.first.c_str(),
+                    tBaselineValue,
+                    tResultValue,
+                    100.0 * tChange,
+                    tBaselinePhase.first.c_str() );
+        }
+    }
+
+    std::printf( "\n%u regression(s) found with tolerances %.1f%% (time) and %.1f%% (memory).\n",
+            tNumRegressions,
+            100.0 * tTolerance,
+            100.0 * tMemoryTolerance );
+
+    return tNumRegressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * benchmark_containers.cpp
+ *
+ * Benchmark of the id to index maps: insertion and lookup of mesh like ids, i.e. ascending ids with gaps
+ * as created by a parallel decomposition, looked up in random order as during assembly.
+ *
+ * usage: benchmark_containers --benchmark <results.json> [--entries <n>] [--lookups <n>]
+ *
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include "cl_Communication_Manager.hpp"    // COM/src
+#include "cl_Logger.hpp"                   // MRS/IOS/src
+#include "cl_Tracer.hpp"                   // MRS/IOS/src
+#include "cl_Map.hpp"                      // MRS/CNT/src
+#include "cl_Hash_Map.hpp"                 // MRS/CNT/src
+#include "cl_Sorted_Map.hpp"               // MRS/CNT/src
+
+moris::Comm_Manager gMorisComm;
+moris::Logger       gLogger;
+
+using namespace moris;
+
+//---------------------------------------------------------------
+
+template< typename Map >
+void
+benchmark_map(
+        const std::string&          aMapName,
+        Map&                        aMap,
+        const std::vector< sint >& aIds,
+        const std::vector< sint >& aLookupIds )
+{
+    {
+        Tracer tTracer( "Benchmark", aMapName, "Insert" );
+
+        for ( uint iEntry = 0; iEntry < aIds.size(); iEntry++ )
+        {
+            aMap[ aIds[ iEntry ] ] = iEntry;
+        }
+    }
+
+    {
+        Tracer tTracer( "Benchmark", aMapName, "Lookup" );
+
+        sint tSum = 0;
+
+        for ( sint tId : aLookupIds )
+        {
+            tSum += aMap.find( tId );
+        }
+
+        // keep the lookups from being optimized out
+        MORIS_ERROR( tSum >= 0, "benchmark_map() - Invalid lookup result." );
+    }
+}
+
+//---------------------------------------------------------------
+
+int
+main( int argc, char* argv[] )
+{
+    gMorisComm = moris::Comm_Manager( &argc, &argv );
+
+    gLogger.initialize( argc, argv );
+
+    uint tNumEntries = 1000000;
+    uint tNumLookups = 10000000;
+
+    for ( int k = 1; k + 1 < argc; ++k )
+    {
+        if ( std::string( argv[ k ] ) == "--entries" )
+        {
+            tNumEntries = std::stoi( argv[ k + 1 ] );
+        }
+
+        if ( std::string( argv[ k ] ) == "--lookups" )
+        {
+            tNumLookups = std::stoi( argv[ k + 1 ] );
+        }
+    }
+
+    // ascending ids with gaps
+    std::mt19937                      tGenerator( 17 );
+    std::uniform_int_distribution<>   tGap( 1, 4 );
+    std::vector< sint >               tIds( tNumEntries );
+
+    sint tId = 0;
+    for ( uint iEntry = 0; iEntry < tNumEntries; iEntry++ )
+    {
+        tId += tGap( tGenerator );
+        tIds[ iEntry ] = tId;
+    }
+
+    // random lookups of existing ids
+    std::uniform_int_distribution< uint > tEntry( 0, tNumEntries - 1 );
+    std::vector< sint >                   tLookupIds( tNumLookups );
+
+    for ( uint iLookup = 0; iLookup < tNumLookups; iLookup++ )
+    {
+        tLookupIds[ iLookup ] = tIds[ tEntry( tGenerator ) ];
+    }
+
+    {
+        moris::map< sint, sint > tMap;
+        benchmark_map( "moris::map", tMap, tIds, tLookupIds );
+    }
+
+    {
+        Hash_Map< sint, sint > tMap;
+        tMap.reserve( tNumEntries );
+        benchmark_map( "moris::Hash_Map", tMap, tIds, tLookupIds );
+
+        Tracer tTracer( "Benchmark", "moris::Hash_Map", "Memory" );
+        gLogger.add_benchmark_value( "map_memory", tMap.get_memory_usage() / 1024.0 / 1024.0 );
+    }
+
+    {
+        Sorted_Map< sint, sint > tMap;
+        tMap.reserve( tNumEntries );
+        benchmark_map( "moris::Sorted_Map", tMap, tIds, tLookupIds );
+
+        Tracer tTracer( "Benchmark", "moris::Sorted_Map", "Memory" );
+        gLogger.add_benchmark_value( "map_memory", tMap.get_memory_usage() / 1024.0 / 1024.0 );
+    }
+
+    gMorisComm.finalize();
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * benchmark_decomposition.cpp
+ *
+ * Benchmark of the XTK decomposition: a 3D background mesh cut by two spheres is decomposed once with a
+ * single flood fill thread and once with the requested number of flood fill threads. The phase of the
+ * subphase identification contains the threaded flood fills, all other decomposition steps are serial.
+ *
+ * usage: benchmark_decomposition --benchmark <results.json> [--elements <n>] [--threads <n>]
+ *
+ */
+
+#include <string>
+
+#include "cl_Communication_Manager.hpp"    // COM/src
+#include "cl_Logger.hpp"                   // MRS/IOS/src
+#include "cl_Tracer.hpp"                   // MRS/IOS/src
+
+#include "cl_HMR.hpp"
+#include "cl_GEN_Geometry_Engine.hpp"
+#include "cl_MTK_Mesh_Manager.hpp"
+#include "cl_XTK_Model.hpp"
+
+#include "fn_PRM_HMR_Parameters.hpp"
+#include "fn_PRM_GEN_Parameters.hpp"
+#include "fn_PRM_XTK_Parameters.hpp"
+
+moris::Comm_Manager gMorisComm;
+moris::Logger       gLogger;
+
+using namespace moris;
+
+//---------------------------------------------------------------
+
+void
+benchmark_decomposition(
+        uint aNumElementsPerDim,
+        sint aNumThreads )
+{
+    std::string tNumElements = std::to_string( aNumElementsPerDim );
+
+    ParameterList tHMRParams = prm::create_hmr_parameter_list();
+    tHMRParams.set( "number_of_elements_per_dimension", tNumElements + "," + tNumElements + "," + tNumElements );
+    tHMRParams.set( "domain_dimensions", std::string( "2.0, 2.0, 2.0" ) );
+    tHMRParams.set( "domain_offset", std::string( "-1.0, -1.0, -1.0" ) );
+    tHMRParams.set( "domain_sidesets", std::string( "1,2,3,4,5,6" ) );
+    tHMRParams.set( "lagrange_output_meshes", std::string( "0" ) );
+    tHMRParams.set( "lagrange_orders", std::string( "1" ) );
+    tHMRParams.set( "lagrange_pattern", std::string( "0" ) );
+    tHMRParams.set( "bspline_orders", std::string( "1" ) );
+    tHMRParams.set( "bspline_pattern", std::string( "0" ) );
+    tHMRParams.set( "lagrange_to_bspline", std::string( "0" ) );
+    tHMRParams.set( "truncate_bsplines", 1 );
+    tHMRParams.set( "refinement_buffer", 1 );
+    tHMRParams.set( "staircase_buffer", 1 );
+    tHMRParams.set( "initial_refinement", std::string( "0" ) );
+    tHMRParams.set( "initial_refinement_pattern", std::string( "0" ) );
+    tHMRParams.set( "use_number_aura", 1 );
+    tHMRParams.set( "use_multigrid", 0 );
+    tHMRParams.set( "severity_level", 0 );
+
+    // two intersecting spheres to get several subphases in some of the background cells
+    Cell< Cell< ParameterList > > tGENParams( 3 );
+    tGENParams( 0 ).resize( 1 );
+    tGENParams( 1 ).resize( 2 );
+    tGENParams( 0 )( 0 ) = prm::create_gen_parameter_list();
+    tGENParams( 1 )( 0 ) = prm::create_geometry_parameter_list();
+    tGENParams( 1 )( 0 ).set( "type", "sphere" );
+    tGENParams( 1 )( 0 ).set( "constant_parameters", "-0.21, 0.0, 0.0, 0.53" );
+    tGENParams( 1 )( 1 ) = prm::create_geometry_parameter_list();
+    tGENParams( 1 )( 1 ).set( "type", "sphere" );
+    tGENParams( 1 )( 1 ).set( "constant_parameters", "0.23, 0.11, 0.0, 0.47" );
+
+    ParameterList tXTKParams = prm::create_xtk_parameter_list();
+    tXTKParams.set( "decompose", true );
+    tXTKParams.set( "decomposition_type", "conformal" );
+    tXTKParams.set( "enrich", false );
+    tXTKParams.set( "ghost_stab", false );
+    tXTKParams.set( "multigrid", false );
+    tXTKParams.set( "flood_fill_threads", aNumThreads );
+
+    std::shared_ptr< hmr::HMR >            tHMR    = std::make_shared< hmr::HMR >( tHMRParams );
+    std::shared_ptr< ge::Geometry_Engine > tGEN    = std::make_shared< ge::Geometry_Engine >( tGENParams, nullptr );
+    std::shared_ptr< mtk::Mesh_Manager >   tBGMTK  = std::make_shared< mtk::Mesh_Manager >();
+    std::shared_ptr< mtk::Mesh_Manager >   tXTKMTK = std::make_shared< mtk::Mesh_Manager >();
+    std::shared_ptr< xtk::Model >          tXTK    = std::make_shared< xtk::Model >( tXTKParams );
+
+    tHMR->set_performer( tBGMTK );
+
+    tXTK->set_geometry_engine( tGEN.get() );
+    tXTK->set_input_performer( tBGMTK );
+    tXTK->set_output_performer( tXTKMTK );
+
+    tHMR->perform_initial_refinement();
+    tHMR->perform();
+
+    tGEN->distribute_advs( tBGMTK->get_mesh_pair( 0 ), {} );
+
+    // only the decomposition is compared, one phase per thread count
+    Tracer tTracer( "Benchmark", "Flood_Fill_Threads_" + std::to_string( aNumThreads ), "Decompose" );
+
+    tXTK->perform_decomposition();
+}
+
+//---------------------------------------------------------------
+
+int
+main( int argc, char* argv[] )
+{
+    gMorisComm = moris::Comm_Manager( &argc, &argv );
+
+    gLogger.initialize( argc, argv );
+
+    uint tNumElementsPerDim = 40;
+    sint tNumThreads        = 4;
+
+    for ( int k = 1; k + 1 < argc; ++k )
+    {
+        if ( std::string( argv[ k ] ) == "--elements" )
+        {
+            tNumElementsPerDim = std::stoi( argv[ k + 1 ] );
+        }
+
+        if ( std::string( argv[ k ] ) == "--threads" )
+        {
+            tNumThreads = std::stoi( argv[ k + 1 ] );
+        }
+    }
+
+    benchmark_decomposition( tNumElementsPerDim, 1 );
+
+    if ( tNumThreads > 1 )
+    {
+        benchmark_decomposition( tNumElementsPerDim, tNumThreads );
+    }
+
+    gMorisComm.finalize();
+
+    return 0;
+}
@@ -0,0 +1,467 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * benchmark_rcm.cpp
+ *
+ * Benchmark of the reverse Cuthill-McKee ordering of the adofs: the nodes of a structured 3D hex mesh are
+ * numbered randomly, as the adofs of a parallel decomposition, and reordered by MSI::reverse_cuthill_mckee().
+ * For both orderings the bandwidth, the fill of an ILU(1) factorization and the iterations and time of a
+ * conjugate gradient solve preconditioned by ILU(0) of a shifted graph Laplacian are reported.
+ *
+ * usage: benchmark_rcm --benchmark <results.json> [--elements <n>]
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cl_Communication_Manager.hpp"    // COM/src
+#include "cl_Logger.hpp"                   // MRS/IOS/src
+#include "cl_Tracer.hpp"                   // MRS/IOS/src
+#include "cl_Cell.hpp"                     // MRS/CNT/src
+
+#include "fn_MSI_reverse_cuthill_mckee.hpp"    // FEM/MSI/src
+
+moris::Comm_Manager gMorisComm;
+moris::Logger       gLogger;
+
+using namespace moris;
+
+//---------------------------------------------------------------
+
+/**
+ * @brief matrix in compressed sparse row format with sorted columns
+ */
+struct Csr_Matrix
+{
+    std::vector< uint > mOffsets;
+    std::vector< uint > mColumns;
+    std::vector< real > mValues;
+    std::vector< uint > mDiagonal;
+};
+
+//---------------------------------------------------------------
+
+/**
+ * @brief assembles the graph Laplacian of the hex mesh with a small shift, i.e. a 27 point stencil,
+ * rows and columns are numbered by the given positions of the node labels
+ */
+Csr_Matrix
+build_matrix(
+        uint                       aNumNodesPerDim,
+        const moris::Cell< uint >& aLabels,
+        const moris::Cell< uint >& aPositions )
+{
+    uint tNumNodes = aLabels.size();
+
+    std::vector< std::vector< uint > > tRows( tNumNodes );
+
+    for ( uint iK = 0; iK < aNumNodesPerDim; iK++ )
+    {
+        for ( uint iJ = 0; iJ < aNumNodesPerDim; iJ++ )
+        {
+            for ( uint iI = 0; iI < aNumNodesPerDim; iI++ )
+            {
+                uint tNode = ( iK * aNumNodesPerDim + iJ ) * aNumNodesPerDim + iI;
+                uint tRow  = aPositions( aLabels( tNode ) );
+
+                for ( uint tK = iK > 0 ? iK - 1 : 0; tK <= std::min( iK + 1, aNumNodesPerDim - 1 ); tK++ )
+                {
+                    for ( uint tJ = iJ > 0 ? iJ - 1 : 0; tJ <= std::min( iJ + 1, aNumNodesPerDim - 1 ); tJ++ )
+                    {
+                        for ( uint tI = iI > 0 ? iI - 1 : 0; tI <= std::min( iI + 1, aNumNodesPerDim - 1 ); tI++ )
+                        {
+                            uint tNeighbor = ( tK * aNumNodesPerDim + tJ ) * aNumNodesPerDim + tI;
+
+                            tRows[ tRow ].push_back( aPositions( aLabels( tNeighbor ) ) );
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    Csr_Matrix tMatrix;
+    tMatrix.mOffsets.assign( tNumNodes + 1, 0 );
+    tMatrix.mDiagonal.resize( tNumNodes );
+
+    for ( uint iRow = 0; iRow < tNumNodes; iRow++ )
+    {
+        std::sort( tRows[ iRow ].begin(), tRows[ iRow ].end() );
+
+        tMatrix.mOffsets[ iRow + 1 ] = tMatrix.mOffsets[ iRow ] + tRows[ iRow ].size();
+
+        for ( uint tColumn : tRows[ iRow ] )
+        {
+            if ( tColumn == iRow )
+            {
+                tMatrix.mDiagonal[ iRow ] = tMatrix.mColumns.size();
+                tMatrix.mValues.push_back( tRows[ iRow ].size() - 1 + 1.0e-2 );
+            }
+            else
+            {
+                tMatrix.mValues.push_back( -1.0 );
+            }
+
+            tMatrix.mColumns.push_back( tColumn );
+        }
+    }
+
+    return tMatrix;
+}
+
+//---------------------------------------------------------------
+
+/**
+ * @brief number of nonzeros of an ILU(1) factorization, computed by a symbolic level of fill factorization
+ */
+real
+compute_ilu_1_nonzeros( const Csr_Matrix& aMatrix )
+{
+    uint tNumRows = aMatrix.mOffsets.size() - 1;
+
+    // upper part of the factorized rows with the levels of their entries
+    std::vector< std::vector< std::pair< uint, uint > > > tUpper( tNumRows );
+
+    std::vector< uint > tLevels( tNumRows, MORIS_UINT_MAX );
+
+    real tNumNonzeros = 0.0;
+
+    for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+    {
+        std::set< uint > tPattern;
+
+        for ( uint iEntry = aMatrix.mOffsets[ iRow ]; iEntry < aMatrix.mOffsets[ iRow + 1 ]; iEntry++ )
+        {
+            tPattern.insert( aMatrix.mColumns[ iEntry ] );
+            tLevels[ aMatrix.mColumns[ iEntry ] ] = 0;
+        }
+
+        // eliminate with the previous rows, fill entries are inserted behind the current column
+        for ( auto tIter = tPattern.begin(); tIter != tPattern.end() and *tIter < iRow; ++tIter )
+        {
+            uint tColumn = *tIter;
+
+            for ( const auto& [ tUpperColumn, tUpperLevel ] : tUpper[ tColumn ] )
+            {
+                uint tLevel = tLevels[ tColumn ] + tUpperLevel + 1;
+
+                if ( tLevel > 1 )
+                {
+                    continue;
+                }
+
+                if ( tPattern.insert( tUpperColumn ).second )
+                {
+                    tLevels[ tUpperColumn ] = tLevel;
+                }
+                else
+                {
+                    tLevels[ tUpperColumn ] = std::min( tLevels[ tUpperColumn ], tLevel );
+                }
+            }
+        }
+
+        for ( uint tColumn : tPattern )
+        {
+            if ( tColumn > iRow )
+            {
+                tUpper[ iRow ].emplace_back( tColumn, tLevels[ tColumn ] );
+            }
+
+            tLevels[ tColumn ] = MORIS_UINT_MAX;
+        }
+
+        tNumNonzeros += tPattern.size();
+    }
+
+    return tNumNonzeros;
+}
+
+//---------------------------------------------------------------
+
+/**
+ * @brief in place ILU(0) factorization, unit lower and upper factor share the pattern of the matrix
+ */
+void
+factorize_ilu_0( Csr_Matrix& aMatrix )
+{
+    uint tNumRows = aMatrix.mOffsets.size() - 1;
+
+    std::vector< uint > tPositions( tNumRows, MORIS_UINT_MAX );
+
+    for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+    {
+        for ( uint iEntry = aMatrix.mOffsets[ iRow ]; iEntry < aMatrix.mOffsets[ iRow + 1 ]; iEntry++ )
+        {
+            tPositions[ aMatrix.mColumns[ iEntry ] ] = iEntry;
+        }
+
+        for ( uint iEntry = aMatrix.mOffsets[ iRow ]; iEntry < aMatrix.mDiagonal[ iRow ]; iEntry++ )
+        {
+            uint tColumn = aMatrix.mColumns[ iEntry ];
+
+            aMatrix.mValues[ iEntry ] /= aMatrix.mValues[ aMatrix.mDiagonal[ tColumn ] ];
+
+            for ( uint iUpper = aMatrix.mDiagonal[ tColumn ] + 1; iUpper < aMatrix.mOffsets[ tColumn + 1 ]; iUpper++ )
+            {
+                uint tPosition = tPositions[ aMatrix.mColumns[ iUpper ] ];
+
+                if ( tPosition != MORIS_UINT_MAX )
+                {
+                    aMatrix.mValues[ tPosition ] -= aMatrix.mValues[ iEntry ] * aMatrix.mValues[ iUpper ];
+                }
+            }
+        }
+
+        for ( uint iEntry = aMatrix.mOffsets[ iRow ]; iEntry < aMatrix.mOffsets[ iRow + 1 ]; iEntry++ )
+        {
+            tPositions[ aMatrix.mColumns[ iEntry ] ] = MORIS_UINT_MAX;
+        }
+    }
+}
+
+//---------------------------------------------------------------
+
+/**
+ * @brief applies the inverse of the ILU(0) factors by forward and backward substitution
+ */
+void
+apply_ilu_0(
+        const Csr_Matrix&          aFactors,
+        const std::vector< real >& aRhs,
+        std::vector< real >&       aSolution )
+{
+    uint tNumRows = aFactors.mOffsets.size() - 1;
+
+    for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+    {
+        real tValue = aRhs[ iRow ];
+
+        for ( uint iEntry = aFactors.mOffsets[ iRow ]; iEntry < aFactors.mDiagonal[ iRow ]; iEntry++ )
+        {
+            tValue -= aFactors.mValues[ iEntry ] * aSolution[ aFactors.mColumns[ iEntry ] ];
+        }
+
+        aSolution[ iRow ] = tValue;
+    }
+
+    for ( uint iRow = tNumRows; iRow-- > 0; )
+    {
+        real tValue = aSolution[ iRow ];
+
+        for ( uint iEntry = aFactors.mDiagonal[ iRow ] + 1; iEntry < aFactors.mOffsets[ iRow + 1 ]; iEntry++ )
+        {
+            tValue -= aFactors.mValues[ iEntry ] * aSolution[ aFactors.mColumns[ iEntry ] ];
+        }
+
+        aSolution[ iRow ] = tValue / aFactors.mValues[ aFactors.mDiagonal[ iRow ] ];
+    }
+}
+
+//---------------------------------------------------------------
+
+/**
+ * @brief conjugate gradient method preconditioned by ILU(0)
+ *
+ * @return number of iterations until the residual is reduced by 1e-8
+ */
+uint
+solve_pcg(
+        const Csr_Matrix&          aMatrix,
+        const Csr_Matrix&          aFactors,
+        const std::vector< real >& aRhs )
+{
+    uint tNumRows = aRhs.size();
+
+    auto tMultiply = [ &aMatrix, tNumRows ]( const std::vector< real >& aVector, std::vector< real >& aResult ) {
+        for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+        {
+            real tValue = 0.0;
+
+            for ( uint iEntry = aMatrix.mOffsets[ iRow ]; iEntry < aMatrix.mOffsets[ iRow + 1 ]; iEntry++ )
+            {
+                tValue += aMatrix.mValues[ iEntry ] * aVector[ aMatrix.mColumns[ iEntry ] ];
+            }
+
+            aResult[ iRow ] = tValue;
+        }
+    };
+
+    auto tDot = []( const std::vector< real >& aA, const std::vector< real >& aB ) {
+        return std::inner_product( aA.begin(), aA.end(), aB.begin(), 0.0 );
+    };
+
+    std::vector< real > tSolution( tNumRows, 0.0 );
+    std::vector< real > tResidual = aRhs;
+    std::vector< real > tPreconditioned( tNumRows );
+    std::vector< real > tDirection( tNumRows );
+    std::vector< real > tProduct( tNumRows );
+
+    apply_ilu_0( aFactors, tResidual, tPreconditioned );
+    tDirection = tPreconditioned;
+
+    real tRho          = tDot( tResidual, tPreconditioned );
+    real tInitialNorm  = std::sqrt( tDot( tResidual, tResidual ) );
+    uint tMaxIteration = 10000;
+
+    for ( uint iIteration = 1; iIteration <= tMaxIteration; iIteration++ )
+    {
+        tMultiply( tDirection, tProduct );
+
+        real tAlpha = tRho / tDot( tDirection, tProduct );
+
+        for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+        {
+            tSolution[ iRow ] += tAlpha * tDirection[ iRow ];
+            tResidual[ iRow ] -= tAlpha * tProduct[ iRow ];
+        }
+
+        if ( std::sqrt( tDot( tResidual, tResidual ) ) < 1.0e-8 * tInitialNorm )
+        {
+            return iIteration;
+        }
+
+        apply_ilu_0( aFactors, tResidual, tPreconditioned );
+
+        real tRhoNew = tDot( tResidual, tPreconditioned );
+
+        for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+        {
+            tDirection[ iRow ] = tPreconditioned[ iRow ] + tRhoNew / tRho * tDirection[ iRow ];
+        }
+
+        tRho = tRhoNew;
+    }
+
+    MORIS_ERROR( false, "solve_pcg() - No convergence within %d iterations.", tMaxIteration );
+
+    return tMaxIteration;
+}
+
+//---------------------------------------------------------------
+
+void
+benchmark_ordering(
+        const std::string&         aOrderingName,
+        uint                       aNumNodesPerDim,
+        const moris::Cell< uint >& aLabels,
+        const moris::Cell< uint >& aCliqueOffsets,
+        const moris::Cell< uint >& aCliqueVertices,
+        const moris::Cell< uint >& aPositions )
+{
+    Csr_Matrix tMatrix = build_matrix( aNumNodesPerDim, aLabels, aPositions );
+
+    // the right hand side is attached to the nodes such that all orderings solve the same system
+    std::vector< real > tRhs( aLabels.size() );
+
+    for ( uint iNode = 0; iNode < aLabels.size(); iNode++ )
+    {
+        tRhs[ aPositions( aLabels( iNode ) ) ] = 1.0 + iNode % 7;
+    }
+
+    {
+        Tracer tTracer( "Benchmark", aOrderingName, "Statistics" );
+
+        gLogger.add_benchmark_value( "bandwidth", MSI::compute_clique_bandwidth( aCliqueOffsets, aCliqueVertices, aPositions ) );
+        gLogger.add_benchmark_value( "ilu_1_fill", compute_ilu_1_nonzeros( tMatrix ) / tMatrix.mColumns.size() );
+    }
+
+    Csr_Matrix tFactors = tMatrix;
+
+    {
+        Tracer tTracer( "Benchmark", aOrderingName, "ILU_Factorization" );
+
+        factorize_ilu_0( tFactors );
+    }
+
+    {
+        Tracer tTracer( "Benchmark", aOrderingName, "Solve" );
+
+        uint tNumIterations = solve_pcg( tMatrix, tFactors, tRhs );
+
+        gLogger.add_benchmark_value( "iterations", tNumIterations );
+
+        MORIS_LOG_SPEC( "Iterations", tNumIterations );
+    }
+}
+
+//---------------------------------------------------------------
+
+int
+main( int argc, char* argv[] )
+{
+    gMorisComm = moris::Comm_Manager( &argc, &argv );
+
+    gLogger.initialize( argc, argv );
+
+    uint tNumElementsPerDim = 40;
+
+    for ( int k = 1; k + 1 < argc; ++k )
+    {
+        if ( std::string( argv[ k ] ) == "--elements" )
+        {
+            tNumElementsPerDim = std::stoi( argv[ k + 1 ] );
+        }
+    }
+
+    uint tNumNodesPerDim = tNumElementsPerDim + 1;
+    uint tNumNodes       = tNumNodesPerDim * tNumNodesPerDim * tNumNodesPerDim;
+
+    // random labels of the nodes
+    moris::Cell< uint > tLabels( tNumNodes );
+    std::iota( tLabels.begin(), tLabels.end(), 0 );
+    std::shuffle( tLabels.begin(), tLabels.end(), std::mt19937( 17 ) );
+
+    // one clique per element as built from the equation objects by the dof manager
+    moris::Cell< uint > tCliqueOffsets( tNumElementsPerDim * tNumElementsPerDim * tNumElementsPerDim + 1, 0 );
+    moris::Cell< uint > tCliqueVertices( 8 * ( tCliqueOffsets.size() - 1 ) );
+
+    uint tNumEntries = 0;
+    uint tNumCliques = 0;
+
+    for ( uint iK = 0; iK < tNumElementsPerDim; iK++ )
+    {
+        for ( uint iJ = 0; iJ < tNumElementsPerDim; iJ++ )
+        {
+            for ( uint iI = 0; iI < tNumElementsPerDim; iI++ )
+            {
+                for ( uint iCorner = 0; iCorner < 8; iCorner++ )
+                {
+                    uint tNode = ( ( iK + iCorner / 4 ) * tNumNodesPerDim + iJ + iCorner / 2 % 2 ) * tNumNodesPerDim + iI + iCorner % 2;
+
+                    tCliqueVertices( tNumEntries++ ) = tLabels( tNode );
+                }
+
+                tCliqueOffsets( ++tNumCliques ) = tNumEntries;
+            }
+        }
+    }
+
+    moris::Cell< uint > tIdentity( tNumNodes );
+    std::iota( tIdentity.begin(), tIdentity.end(), 0 );
+
+    benchmark_ordering( "Shuffled", tNumNodesPerDim, tLabels, tCliqueOffsets, tCliqueVertices, tIdentity );
+
+    moris::Cell< uint > tPositions;
+
+    {
+        Tracer tTracer( "Benchmark", "RCM", "Reorder" );
+
+        tPositions = MSI::reverse_cuthill_mckee( tNumNodes, tCliqueOffsets, tCliqueVertices );
+    }
+
+    benchmark_ordering( "RCM", tNumNodesPerDim, tLabels, tCliqueOffsets, tCliqueVertices, tPositions );
+
+    gMorisComm.finalize();
+
+    return 0;
+}
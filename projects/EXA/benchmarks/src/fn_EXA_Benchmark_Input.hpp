@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * fn_EXA_Benchmark_Input.hpp
+ *
+ */
+
+#ifndef PROJECTS_EXA_BENCHMARKS_SRC_FN_EXA_BENCHMARK_INPUT_HPP_
+#define PROJECTS_EXA_BENCHMARKS_SRC_FN_EXA_BENCHMARK_INPUT_HPP_
+
+#include <string>
+#include <sstream>
+
+#include "typedefs.hpp"
+#include "cl_Cell.hpp"
+#include "cl_Param_List.hpp"
+
+// scale factor of the number of elements per dimension, set by the benchmark CMakeLists
+#ifndef MORIS_BENCHMARK_SCALE
+#define MORIS_BENCHMARK_SCALE 1
+#endif
+
+namespace moris
+{
+    namespace exa
+    {
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief refines the background mesh of an example input by multiplying the
+         * number of elements in every direction with a scale factor
+         *
+         * @param[in,out] aParameterList    HMR parameter list of the example
+         * @param[in] aScale                Scale factor
+         */
+        inline void
+        scale_hmr_mesh(
+                moris::Cell< moris::Cell< ParameterList > >& aParameterList,
+                uint                                         aScale )
+        {
+            std::string tNumElemsPerDim = aParameterList( 0 )( 0 ).get< std::string >( "number_of_elements_per_dimension" );
+
+            std::stringstream tInput( tNumElemsPerDim );
+            std::string       tScaledNumElemsPerDim;
+            std::string       tNumElems;
+
+            while ( std::getline( tInput, tNumElems, ',' ) )
+            {
+                if ( !tScaledNumElemsPerDim.empty() )
+                {
+                    tScaledNumElemsPerDim += ",";
+                }
+
+                tScaledNumElemsPerDim += std::to_string( std::stoi( tNumElems ) * aScale );
+            }
+
+            aParameterList( 0 )( 0 ).set( "number_of_elements_per_dimension", tScaledNumElemsPerDim );
+        }
+
+        //------------------------------------------------------------------------------
+    }    // namespace exa
+}    // namespace moris
+
+#endif /* PROJECTS_EXA_BENCHMARKS_SRC_FN_EXA_BENCHMARK_INPUT_HPP_ */
@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_FEM_Integration_Point_Batch.cpp
+ *
+ */
+
+#include "cl_FEM_Integration_Point_Batch.hpp"
+// FEM/INT/src
+#include "cl_FEM_Field_Interpolator.hpp"
+#include "cl_FEM_Property.hpp"
+#include "cl_FEM_Constitutive_Model.hpp"
+// MRS/COR/src
+#include "assert.hpp"
+
+namespace moris
+{
+    namespace fem
+    {
+        //------------------------------------------------------------------------------
+
+        void
+        Integration_Point_Batch::initialize(
+                uint aNumPoints,
+                bool aCollectTangent )
+        {
+            // set number of points and reset weights
+            mNumPoints      = aNumPoints;
+            mCollectTangent = aCollectTangent;
+            mWStar.set_size( aNumPoints, 1, 0.0 );
+
+            // mark all stored data as outdated, memory is reused for the next element
+            for ( Field_Data& tData : mFieldData )
+            {
+                tData.mIsRegistered = false;
+                tData.mLastPoint    = MORIS_UINT_MAX;
+            }
+
+            for ( Property_Data& tData : mPropertyData )
+            {
+                tData.mIsRegistered = false;
+                tData.mLastPoint    = MORIS_UINT_MAX;
+            }
+
+            for ( Constitutive_Data& tData : mConstitutiveData )
+            {
+                tData.mIsRegistered = false;
+                tData.mLastPoint    = MORIS_UINT_MAX;
+            }
+
+            mRegisteredFields.clear();
+            mRegisteredProperties.clear();
+            mRegisteredConstitutiveModels.clear();
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Integration_Point_Batch::register_field( Field_Interpolator* aFI )
+        {
+            // get index of data, add data if field interpolator is new to the batch
+            auto tIter = mFieldIndices.find( aFI );
+
+            uint tIndex;
+
+            if ( tIter == mFieldIndices.end() )
+            {
+                tIndex               = mFieldData.size();
+                mFieldIndices[ aFI ] = tIndex;
+
+                mFieldData.push_back( Field_Data() );
+                mFieldData( tIndex ).mFI = aFI;
+            }
+            else
+            {
+                tIndex = tIter->second;
+            }
+
+            // skip if already registered, e.g. by another IWG
+            if ( mFieldData( tIndex ).mIsRegistered )
+            {
+                return;
+            }
+
+            mFieldData( tIndex ).mIsRegistered = true;
+            mRegisteredFields.push_back( tIndex );
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Integration_Point_Batch::register_property( const std::shared_ptr< Property >& aProperty )
+        {
+            // get index of data, add data if property is new to the batch
+            auto tIter = mPropertyIndices.find( aProperty.get() );
+
+            uint tIndex;
+
+            if ( tIter == mPropertyIndices.end() )
+            {
+                tIndex                              = mPropertyData.size();
+                mPropertyIndices[ aProperty.get() ] = tIndex;
+
+                mPropertyData.push_back( Property_Data() );
+                mPropertyData( tIndex ).mProperty = aProperty.get();
+            }
+            else
+            {
+                tIndex = tIter->second;
+            }
+
+            // skip if already registered
+            if ( mPropertyData( tIndex ).mIsRegistered )
+            {
+                return;
+            }
+
+            mPropertyData( tIndex ).mIsRegistered = true;
+            mRegisteredProperties.push_back( tIndex );
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Integration_Point_Batch::register_constitutive_model( const std::shared_ptr< Constitutive_Model >& aCM )
+        {
+            // get index of data, add data if constitutive model is new to the batch
+            auto tIter = mConstitutiveIndices.find( aCM.get() );
+
+            uint tIndex;
+
+            if ( tIter == mConstitutiveIndices.end() )
+            {
+                tIndex                            = mConstitutiveData.size();
+                mConstitutiveIndices[ aCM.get() ] = tIndex;
+
+                mConstitutiveData.push_back( Constitutive_Data() );
+                mConstitutiveData( tIndex ).mCM = aCM.get();
+            }
+            else
+            {
+                tIndex = tIter->second;
+            }
+
+            // skip if already registered
+            if ( mConstitutiveData( tIndex ).mIsRegistered )
+            {
+                return;
+            }
+
+            mConstitutiveData( tIndex ).mIsRegistered = true;
+            mRegisteredConstitutiveModels.push_back( tIndex );
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Integration_Point_Batch::collect( uint aPoint )
+        {
+            for ( uint iData : mRegisteredFields )
+            {
+                this->collect_field( mFieldData( iData ), aPoint );
+            }
+
+            for ( uint iData : mRegisteredProperties )
+            {
+                this->collect_property( mPropertyData( iData ), aPoint );
+            }
+
+            for ( uint iData : mRegisteredConstitutiveModels )
+            {
+                this->collect_constitutive_model( mConstitutiveData( iData ), aPoint );
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Integration_Point_Batch::collect_field(
+                Field_Data& aData,
+                uint        aPoint )
+        {
+            const Matrix< DDRMat >& tN   = aData.mFI->N();
+            const Matrix< DDRMat >& tVal = aData.mFI->val();
+
+            uint tBlockSize = tN.n_rows();
+            uint tNumCols   = tN.n_cols();
+
+            // size storage for first point of element, skipped points remain zero
+            if ( aData.mLastPoint == MORIS_UINT_MAX )
+            {
+                aData.mN.set_size( mNumPoints * tBlockSize, tNumCols, 0.0 );
+                aData.mVal.set_size( mNumPoints * tBlockSize, 1, 0.0 );
+            }
+
+            uint tOffset = aPoint * tBlockSize;
+
+            for ( uint iRow = 0; iRow < tBlockSize; iRow++ )
+            {
+                for ( uint iCol = 0; iCol < tNumCols; iCol++ )
+                {
+                    aData.mN( tOffset + iRow, iCol ) = tN( iRow, iCol );
+                }
+
+                aData.mVal( tOffset + iRow ) = tVal( iRow );
+            }
+
+            aData.mLastPoint = aPoint;
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Integration_Point_Batch::collect_property(
+                Property_Data& aData,
+                uint           aPoint )
+        {
+            const Matrix< DDRMat >& tVal = aData.mProperty->val();
+
+            uint tBlockSize = tVal.numel();
+
+            // size storage for first point of element
+            if ( aData.mLastPoint == MORIS_UINT_MAX )
+            {
+                aData.mVal.set_size( mNumPoints * tBlockSize, 1, 0.0 );
+            }
+
+            for ( uint iVal = 0; iVal < tBlockSize; iVal++ )
+            {
+                aData.mVal( aPoint * tBlockSize + iVal ) = tVal( iVal );
+            }
+
+            aData.mLastPoint = aPoint;
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Integration_Point_Batch::collect_constitutive_model(
+                Constitutive_Data& aData,
+                uint               aPoint )
+        {
+            const Matrix< DDRMat >& tTestStrain = aData.mCM->testStrain();
+            const Matrix< DDRMat >& tFlux       = aData.mCM->flux();
+
+            uint tBlockSize = tFlux.numel();
+            uint tNumDofs   = tTestStrain.n_cols();
+
+            MORIS_ASSERT( tTestStrain.n_rows() == tBlockSize,
+                    "Integration_Point_Batch::collect_constitutive_model - inconsistent test strain and flux sizes." );
+
+            // size storage for first point of element
+            if ( aData.mLastPoint == MORIS_UINT_MAX )
+            {
+                aData.mTestStrain.set_size( mNumPoints * tBlockSize, tNumDofs, 0.0 );
+                aData.mFlux.set_size( mNumPoints * tBlockSize, 1, 0.0 );
+
+                if ( mCollectTangent )
+                {
+                    aData.mConst.set_size( mNumPoints * tBlockSize, tBlockSize, 0.0 );
+                }
+            }
+
+            uint tOffset = aPoint * tBlockSize;
+
+            for ( uint iRow = 0; iRow < tBlockSize; iRow++ )
+            {
+                for ( uint iCol = 0; iCol < tNumDofs; iCol++ )
+                {
+                    aData.mTestStrain( tOffset + iRow, iCol ) = tTestStrain( iRow, iCol );
+                }
+
+                aData.mFlux( tOffset + iRow ) = tFlux( iRow );
+            }
+
+            // constitutive matrix is only needed for the Jacobian
+            if ( mCollectTangent )
+            {
+                const Matrix< DDRMat >& tConst = aData.mCM->constitutive();
+
+                MORIS_ASSERT( tConst.n_rows() == tBlockSize,
+                        "Integration_Point_Batch::collect_constitutive_model - inconsistent flux and constitutive matrix sizes." );
+
+                for ( uint iRow = 0; iRow < tBlockSize; iRow++ )
+                {
+                    for ( uint iCol = 0; iCol < tBlockSize; iCol++ )
+                    {
+                        aData.mConst( tOffset + iRow, iCol ) = tConst( iRow, iCol );
+                    }
+                }
+            }
+
+            aData.mLastPoint = aPoint;
+        }
+
+        //------------------------------------------------------------------------------
+
+        const Matrix< DDRMat >&
+        Integration_Point_Batch::N( Field_Interpolator* aFI ) const
+        {
+            auto tIter = mFieldIndices.find( aFI );
+
+            MORIS_ASSERT( tIter != mFieldIndices.end() and mFieldData( tIter->second ).mLastPoint != MORIS_UINT_MAX,
+                    "Integration_Point_Batch::N - field interpolator has not been collected." );
+
+            return mFieldData( tIter->second ).mN;
+        }
+
+        //------------------------------------------------------------------------------
+
+        const Matrix< DDRMat >&
+        Integration_Point_Batch::val( Field_Interpolator* aFI ) const
+        {
+            auto tIter = mFieldIndices.find( aFI );
+
+            MORIS_ASSERT( tIter != mFieldIndices.end() and mFieldData( tIter->second ).mLastPoint != MORIS_UINT_MAX,
+                    "Integration_Point_Batch::val - field interpolator has not been collected." );
+
+            return mFieldData( tIter->second ).mVal;
+        }
+
+        //------------------------------------------------------------------------------
+
+        const Matrix< DDRMat >&
+        Integration_Point_Batch::property_values( const std::shared_ptr< Property >& aProperty ) const
+        {
+            auto tIter = mPropertyIndices.find( aProperty.get() );
+
+            MORIS_ASSERT( tIter != mPropertyIndices.end() and mPropertyData( tIter->second ).mLastPoint != MORIS_UINT_MAX,
+                    "Integration_Point_Batch::property_values - property has not been collected." );
+
+            return mPropertyData( tIter->second ).mVal;
+        }
+
+        //------------------------------------------------------------------------------
+
+        const Matrix< DDRMat >&
+        Integration_Point_Batch::test_strain( const std::shared_ptr< Constitutive_Model >& aCM ) const
+        {
+            auto tIter = mConstitutiveIndices.find( aCM.get() );
+
+            MORIS_ASSERT( tIter != mConstitutiveIndices.end() and mConstitutiveData( tIter->second ).mLastPoint != MORIS_UINT_MAX,
+                    "Integration_Point_Batch::test_strain - constitutive model has not been collected." );
+
+            return mConstitutiveData( tIter->second ).mTestStrain;
+        }
+
+        //------------------------------------------------------------------------------
+
+        const Matrix< DDRMat >&
+        Integration_Point_Batch::flux( const std::shared_ptr< Constitutive_Model >& aCM ) const
+        {
+            auto tIter = mConstitutiveIndices.find( aCM.get() );
+
+            MORIS_ASSERT( tIter != mConstitutiveIndices.end() and mConstitutiveData( tIter->second ).mLastPoint != MORIS_UINT_MAX,
+                    "Integration_Point_Batch::flux - constitutive model has not been collected." );
+
+            return mConstitutiveData( tIter->second ).mFlux;
+        }
+
+        //------------------------------------------------------------------------------
+
+        const Matrix< DDRMat >&
+        Integration_Point_Batch::constitutive( const std::shared_ptr< Constitutive_Model >& aCM ) const
+        {
+            auto tIter = mConstitutiveIndices.find( aCM.get() );
+
+            MORIS_ASSERT( tIter != mConstitutiveIndices.end() and mConstitutiveData( tIter->second ).mLastPoint != MORIS_UINT_MAX,
+                    "Integration_Point_Batch::constitutive - constitutive model has not been collected." );
+
+            MORIS_ASSERT( mCollectTangent,
+                    "Integration_Point_Batch::constitutive - constitutive matrices have not been collected." );
+
+            return mConstitutiveData( tIter->second ).mConst;
+        }
+
+        //------------------------------------------------------------------------------
+
+        Matrix< DDRMat >
+        Integration_Point_Batch::get_weights(
+                const std::shared_ptr< Property >& aProperty,
+                const std::shared_ptr< Property >& aSecondProperty ) const
+        {
+            // copy weights
+            Matrix< DDRMat > tWeights = mWStar;
+
+            // multiply by first property value at each point
+            for ( const std::shared_ptr< Property >& tProperty : { aProperty, aSecondProperty } )
+            {
+                if ( tProperty == nullptr )
+                {
+                    continue;
+                }
+
+                const Matrix< DDRMat >& tValues = this->property_values( tProperty );
+
+                uint tBlockSize = tValues.numel() / mNumPoints;
+
+                for ( uint iPoint = 0; iPoint < mNumPoints; iPoint++ )
+                {
+                    tWeights( iPoint ) *= tValues( iPoint * tBlockSize );
+                }
+            }
+
+            return tWeights;
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Integration_Point_Batch::scale_blocks(
+                Matrix< DDRMat >&       aStacked,
+                const Matrix< DDRMat >& aPointFactors ) const
+        {
+            uint tBlockSize = aStacked.n_rows() / mNumPoints;
+            uint tNumCols   = aStacked.n_cols();
+
+            for ( uint iPoint = 0; iPoint < mNumPoints; iPoint++ )
+            {
+                for ( uint iRow = iPoint * tBlockSize; iRow < ( iPoint + 1 ) * tBlockSize; iRow++ )
+                {
+                    for ( uint iCol = 0; iCol < tNumCols; iCol++ )
+                    {
+                        aStacked( iRow, iCol ) *= aPointFactors( iPoint );
+                    }
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        Matrix< DDRMat >
+        Integration_Point_Batch::weighted_tangent(
+                const std::shared_ptr< Constitutive_Model >& aCM,
+                const Matrix< DDRMat >&                      aPointFactors ) const
+        {
+            const Matrix< DDRMat >& tTestStrain = this->test_strain( aCM );
+            const Matrix< DDRMat >& tConst      = this->constitutive( aCM );
+
+            uint tBlockSize = tConst.n_cols();
+            uint tNumDofs   = tTestStrain.n_cols();
+
+            Matrix< DDRMat > tWeightedTangent( tTestStrain.n_rows(), tNumDofs, 0.0 );
+
+            for ( uint iPoint = 0; iPoint < mNumPoints; iPoint++ )
+            {
+                // skip inactive points
+                if ( aPointFactors( iPoint ) == 0.0 )
+                {
+                    continue;
+                }
+
+                uint tOffset = iPoint * tBlockSize;
+
+                // w_i * D_i * B_i for this point
+                for ( uint iRow = 0; iRow < tBlockSize; iRow++ )
+                {
+                    for ( uint iFlux = 0; iFlux < tBlockSize; iFlux++ )
+                    {
+                        real tFactor = aPointFactors( iPoint ) * tConst( tOffset + iRow, iFlux );
+
+                        if ( tFactor == 0.0 )
+                        {
+                            continue;
+                        }
+
+                        for ( uint iCol = 0; iCol < tNumDofs; iCol++ )
+                        {
+                            tWeightedTangent( tOffset + iRow, iCol ) += tFactor * tTestStrain( tOffset + iFlux, iCol );
+                        }
+                    }
+                }
+            }
+
+            return tWeightedTangent;
+        }
+
+        //------------------------------------------------------------------------------
+    } /* namespace fem */
+} /* namespace moris */
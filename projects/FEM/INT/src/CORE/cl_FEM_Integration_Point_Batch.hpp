@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_FEM_Integration_Point_Batch.hpp
+ *
+ */
+
+#ifndef SRC_FEM_CL_FEM_INTEGRATION_POINT_BATCH_HPP_
+#define SRC_FEM_CL_FEM_INTEGRATION_POINT_BATCH_HPP_
+
+#include <map>
+#include <memory>
+// MRS/COR/src
+#include "typedefs.hpp"
+// MRS/CNT/src
+#include "cl_Cell.hpp"
+// LINALG/src
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+
+namespace moris
+{
+    namespace fem
+    {
+        class Field_Interpolator;
+        class Property;
+        class Constitutive_Model;
+
+        //------------------------------------------------------------------------------
+        /**
+         * Storage for quantities evaluated at all integration points of an element.
+         *
+         * Field interpolators, properties and constitutive models are registered once per
+         * element, their interpolation functions, values and fluxes are then collected
+         * point by point and stored in structure-of-arrays form, i.e. the per-point
+         * blocks of a quantity are stacked row-wise in one matrix. IWGs
+         * supporting batched evaluation then form the element residual and Jacobian
+         * with a few matrix-matrix products instead of one small product per point.
+         */
+        class Integration_Point_Batch
+        {
+          private:
+            // stacked field interpolator data, row block size is the number of fields
+            struct Field_Data
+            {
+                // field interpolator the data is collected from
+                Field_Interpolator* mFI = nullptr;
+
+                // test functions N, ( nPoints * nFields ) x ( nFields * nBases )
+                Matrix< DDRMat > mN;
+
+                // field values, ( nPoints * nFields ) x 1
+                Matrix< DDRMat > mVal;
+
+                // flag if registered for the current element
+                bool mIsRegistered = false;
+
+                // index of last collected point
+                uint mLastPoint = MORIS_UINT_MAX;
+            };
+
+            // stacked property values, row block size is the number of property values
+            struct Property_Data
+            {
+                // property the data is collected from
+                Property* mProperty = nullptr;
+
+                // property values, ( nPoints * nValues ) x 1
+                Matrix< DDRMat > mVal;
+
+                // flag if registered for the current element
+                bool mIsRegistered = false;
+
+                // index of last collected point
+                uint mLastPoint = MORIS_UINT_MAX;
+            };
+
+            // stacked constitutive model data, row block size is the flux size
+            struct Constitutive_Data
+            {
+                // constitutive model the data is collected from
+                Constitutive_Model* mCM = nullptr;
+
+                // test strain, ( nPoints * nFlux ) x nDofs
+                Matrix< DDRMat > mTestStrain;
+
+                // flux, ( nPoints * nFlux ) x 1
+                Matrix< DDRMat > mFlux;
+
+                // constitutive matrix, ( nPoints * nFlux ) x nFlux, only collected for the Jacobian
+                Matrix< DDRMat > mConst;
+
+                // flag if registered for the current element
+                bool mIsRegistered = false;
+
+                // index of last collected point
+                uint mLastPoint = MORIS_UINT_MAX;
+            };
+
+            // number of integration points in batch
+            uint mNumPoints = 0;
+
+            // flag to collect the constitutive matrices, only needed for the Jacobian
+            bool mCollectTangent = true;
+
+            // integration weights times detJ, zero for skipped points
+            Matrix< DDRMat > mWStar;
+
+            // data per field interpolator, property and constitutive model,
+            // kept over all elements of a set to reuse the allocated memory
+            moris::Cell< Field_Data >        mFieldData;
+            moris::Cell< Property_Data >     mPropertyData;
+            moris::Cell< Constitutive_Data > mConstitutiveData;
+
+            // map from field interpolator, property and constitutive model to data index
+            std::map< const Field_Interpolator*, uint > mFieldIndices;
+            std::map< const Property*, uint >           mPropertyIndices;
+            std::map< const Constitutive_Model*, uint > mConstitutiveIndices;
+
+            // indices of the data registered for the current element
+            moris::Cell< uint > mRegisteredFields;
+            moris::Cell< uint > mRegisteredProperties;
+            moris::Cell< uint > mRegisteredConstitutiveModels;
+
+            //------------------------------------------------------------------------------
+            /**
+             * store test functions and field values at the current evaluation point
+             * @param[ in ] aData  field data to fill
+             * @param[ in ] aPoint index of integration point
+             */
+            void collect_field(
+                    Field_Data& aData,
+                    uint        aPoint );
+
+            //------------------------------------------------------------------------------
+            /**
+             * store property values at the current evaluation point
+             * @param[ in ] aData  property data to fill
+             * @param[ in ] aPoint index of integration point
+             */
+            void collect_property(
+                    Property_Data& aData,
+                    uint           aPoint );
+
+            //------------------------------------------------------------------------------
+            /**
+             * store test strain, flux and constitutive matrix at the current evaluation point
+             * @param[ in ] aData  constitutive model data to fill
+             * @param[ in ] aPoint index of integration point
+             */
+            void collect_constitutive_model(
+                    Constitutive_Data& aData,
+                    uint               aPoint );
+
+            //------------------------------------------------------------------------------
+
+          public:
+            //------------------------------------------------------------------------------
+            /**
+             * trivial constructor
+             */
+            Integration_Point_Batch(){};
+
+            //------------------------------------------------------------------------------
+            /**
+             * trivial destructor
+             */
+            ~Integration_Point_Batch(){};
+
+            //------------------------------------------------------------------------------
+            /**
+             * prepare batch for a new element, keeps allocated memory
+             * and clears the registered quantities
+             * @param[ in ] aNumPoints      number of integration points
+             * @param[ in ] aCollectTangent flag to collect the constitutive matrices
+             */
+            void initialize(
+                    uint aNumPoints,
+                    bool aCollectTangent = true );
+
+            //------------------------------------------------------------------------------
+            /**
+             * register a field interpolator to be collected at each integration point
+             * @param[ in ] aFI field interpolator pointer
+             */
+            void register_field( Field_Interpolator* aFI );
+
+            //------------------------------------------------------------------------------
+            /**
+             * register a property to be collected at each integration point
+             * @param[ in ] aProperty property pointer
+             */
+            void register_property( const std::shared_ptr< Property >& aProperty );
+
+            //------------------------------------------------------------------------------
+            /**
+             * register a constitutive model to be collected at each integration point
+             * @param[ in ] aCM constitutive model pointer
+             */
+            void register_constitutive_model( const std::shared_ptr< Constitutive_Model >& aCM );
+
+            //------------------------------------------------------------------------------
+            /**
+             * store all registered quantities at the point the interpolators
+             * are currently evaluated at
+             * @param[ in ] aPoint index of integration point
+             */
+            void collect( uint aPoint );
+
+            //------------------------------------------------------------------------------
+            /**
+             * get number of integration points in batch
+             */
+            uint
+            get_number_of_points() const
+            {
+                return mNumPoints;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * set integration weight times detJ for an integration point
+             * @param[ in ] aPoint index of integration point
+             * @param[ in ] aWStar weight associated to the integration point
+             */
+            void
+            set_weight( uint aPoint, real aWStar )
+            {
+                mWStar( aPoint ) = aWStar;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * get integration weights times detJ for all integration points
+             */
+            const Matrix< DDRMat >&
+            get_weights() const
+            {
+                return mWStar;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * get stacked test functions of a field interpolator
+             */
+            const Matrix< DDRMat >& N( Field_Interpolator* aFI ) const;
+
+            //------------------------------------------------------------------------------
+            /**
+             * get stacked values of a field interpolator
+             */
+            const Matrix< DDRMat >& val( Field_Interpolator* aFI ) const;
+
+            //------------------------------------------------------------------------------
+            /**
+             * get stacked values of a property
+             */
+            const Matrix< DDRMat >& property_values( const std::shared_ptr< Property >& aProperty ) const;
+
+            //------------------------------------------------------------------------------
+            /**
+             * get stacked test strain, flux and constitutive matrix of a constitutive model
+             */
+            const Matrix< DDRMat >& test_strain( const std::shared_ptr< Constitutive_Model >& aCM ) const;
+            const Matrix< DDRMat >& flux( const std::shared_ptr< Constitutive_Model >& aCM ) const;
+            const Matrix< DDRMat >& constitutive( const std::shared_ptr< Constitutive_Model >& aCM ) const;
+
+            //------------------------------------------------------------------------------
+            /**
+             * get integration weights multiplied by the first value of one or two properties
+             * at each point, e.g. thickness; properties which are not set are ignored
+             * @param[ in ] aProperty       property pointer, can be nullptr
+             * @param[ in ] aSecondProperty second property pointer, can be nullptr
+             */
+            Matrix< DDRMat > get_weights(
+                    const std::shared_ptr< Property >& aProperty,
+                    const std::shared_ptr< Property >& aSecondProperty = nullptr ) const;
+
+            //------------------------------------------------------------------------------
+            /**
+             * scale each row block of a stacked matrix by a point factor
+             * @param[ in ] aStacked      stacked matrix with one row block per point
+             * @param[ in ] aPointFactors factor per integration point
+             */
+            void scale_blocks(
+                    Matrix< DDRMat >&       aStacked,
+                    const Matrix< DDRMat >& aPointFactors ) const;
+
+            //------------------------------------------------------------------------------
+            /**
+             * compute the stacked weighted tangent w_i * D_i * B_i of a constitutive model,
+             * such that the Jacobian is B^T * ( w D B )
+             * @param[ in ] aCM           constitutive model pointer
+             * @param[ in ] aPointFactors factor per integration point
+             */
+            Matrix< DDRMat > weighted_tangent(
+                    const std::shared_ptr< Constitutive_Model >& aCM,
+                    const Matrix< DDRMat >&                      aPointFactors ) const;
+        };
+
+        //------------------------------------------------------------------------------
+    } /* namespace fem */
+} /* namespace moris */
+
+#endif /* SRC_FEM_CL_FEM_INTEGRATION_POINT_BATCH_HPP_ */
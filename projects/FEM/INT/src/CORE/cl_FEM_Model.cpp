@@ -957,6 +957,9 @@ namespace moris
                     mProperties( iProp )->set_val_function( tValFunction );
                 }
 
+                // set time dependency of the value function
+                mProperties( iProp )->set_time_dependent( tPropParameter.get< bool >( "time_dependent" ) );
+
                 // set dof derivative function for property
                 moris::Cell< std::string > tDofDerFuncNames;
                 string_to_cell(
@@ -2119,6 +2122,14 @@ namespace moris
             fem::Perturbation_Type tPerturbationStrategy = static_cast< fem::Perturbation_Type >(
                     tComputationParameterList.get< uint >( "finite_difference_perturbation_strategy" ) );
 
+            // get bool for batched evaluation of integration points
+            bool tUseBatchedEvaluation =
+                    tComputationParameterList.get< bool >( "use_batched_evaluation" );
+
+            // get bool for caching the element matrices of linear sets
+            bool tCacheLinearElementMatrices =
+                    tComputationParameterList.get< bool >( "cache_linear_element_matrices" );
+
             // create a map of the set
             std::map< std::tuple< std::string, bool, bool >, uint > tMeshToFemSet;
 
@@ -2225,6 +2236,12 @@ namespace moris
                         // set its perturbation strategy for finite difference
                         aSetUserInfo.set_perturbation_strategy( tPerturbationStrategy );
 
+                        // set its batched evaluation flag
+                        aSetUserInfo.set_use_batched_evaluation( tUseBatchedEvaluation );
+
+                        // set its element matrix caching flag
+                        aSetUserInfo.set_cache_linear_element_matrices( tCacheLinearElementMatrices );
+
                         // set the IWG
                         aSetUserInfo.set_IWG( mIWGs( iIWG ) );
 
@@ -2337,6 +2354,12 @@ namespace moris
                         // set its perturbation strategy for finite difference
                         aSetUserInfo.set_perturbation_strategy( tPerturbationStrategy );
 
+                        // set its batched evaluation flag
+                        aSetUserInfo.set_use_batched_evaluation( tUseBatchedEvaluation );
+
+                        // set its element matrix caching flag
+                        aSetUserInfo.set_cache_linear_element_matrices( tCacheLinearElementMatrices );
+
                         // set the IQI
                         aSetUserInfo.set_IQI( mIQIs( iIQI ) );
 
@@ -100,6 +100,9 @@ namespace moris
             // property name
             std::string mName;
 
+            // flag if a user defined value function depends on time
+            bool mTimeDependent = true;
+
           private:
             // flag for evaluation
             bool                    mPropEval = true;
@@ -348,6 +351,28 @@ namespace moris
              */
             void build_dv_type_map();
 
+            //------------------------------------------------------------------------------
+            /**
+             * set if the value function depends on time
+             * @param[ in ] aTimeDependent bool false if the value function is constant in time
+             */
+            void
+            set_time_dependent( bool aTimeDependent )
+            {
+                mTimeDependent = aTimeDependent;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * check if the property may depend on time, i.e. if a value function was set
+             * which was not declared time independent
+             */
+            bool
+            is_time_dependent() const
+            {
+                return mSetValFunction and mTimeDependent;
+            }
+
             //------------------------------------------------------------------------------
             /**
              * get a dv type map
@@ -46,6 +46,8 @@ namespace moris
                 , mFDSchemeForSA( aSetInfo.get_finite_difference_scheme_for_sensitivity_analysis() )
                 , mFDPerturbation( aSetInfo.get_finite_difference_perturbation_size() )
                 , mPerturbationStrategy( aSetInfo.get_perturbation_strategy() )
+                , mUseBatchedEvaluation( aSetInfo.get_use_batched_evaluation() )
+                , mCacheLinearElementMatrices( aSetInfo.get_cache_linear_element_matrices() )
         {
             // get the set type (BULK, SIDESET, DOUBLE_SIDESET, TIME_SIDESET)
             this->determine_set_type();
@@ -190,6 +192,10 @@ namespace moris
             {
                 // std::cout << "Initialize FEM Set with Name: " << mMeshSet->get_set_name() << std::endl;
 
+                // keep the current configuration to check the validity of the cached element matrices
+                bool                                  tWasStaggered          = mIsStaggered;
+                moris::Cell< std::shared_ptr< IWG > > tPreviousRequestedIWGs = mRequestedIWGs;
+
                 mIsStaggered = aIsStaggered;
 
                 this->create_residual_dof_assembly_map();
@@ -208,6 +214,12 @@ namespace moris
 
                 this->build_requested_IQI_dof_type_list();
 
+                // cached element matrices are only valid for the same requested IWGs and dof types
+                if ( tWasStaggered != mIsStaggered or tPreviousRequestedIWGs.data() != mRequestedIWGs.data() )
+                {
+                    this->invalidate_element_matrix_cache();
+                }
+
                 // set fem set pointer to IWGs FIXME still needed done in constructor?
                 for ( const std::shared_ptr< IWG >& tIWG : mRequestedIWGs )
                 {
@@ -2324,6 +2336,25 @@ namespace moris
 
             // reduce the size of requested IWG list to fit
             mRequestedIWGs.shrink_to_fit();
+
+            // check if requested IWGs can be evaluated for all integration points at once
+            mRequestedIWGsBatched =
+                    mUseBatchedEvaluation and mIsAnalyticalFA and mNumEigenVectors == 0 and mRequestedIWGs.size() > 0;
+
+            for ( const std::shared_ptr< IWG >& tIWG : mRequestedIWGs )
+            {
+                mRequestedIWGsBatched = mRequestedIWGsBatched and tIWG->supports_batched_evaluation();
+            }
+
+            // check if the element matrices of the requested IWGs can be reused,
+            // residuals on time continuity sets depend on the previous time step and are excluded
+            mRequestedIWGsLinear =
+                    mCacheLinearElementMatrices and mIsAnalyticalFA and mNumEigenVectors == 0 and !mTimeContinuity and mRequestedIWGs.size() > 0;
+
+            for ( const std::shared_ptr< IWG >& tIWG : mRequestedIWGs )
+            {
+                mRequestedIWGsLinear = mRequestedIWGsLinear and tIWG->is_linear_in_dofs();
+            }
         }
 
         //------------------------------------------------------------------------------
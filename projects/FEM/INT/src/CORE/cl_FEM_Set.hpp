@@ -26,6 +26,7 @@
 #include "cl_FEM_Constitutive_Model.hpp"
 #include "cl_FEM_Stabilization_Parameter.hpp"
 #include "cl_FEM_Set_User_Info.hpp"
+#include "cl_FEM_Integration_Point_Batch.hpp"
 #include "cl_FEM_IQI.hpp"
 // FEM/MSI/src
 #include "cl_MSI_Equation_Set.hpp"
@@ -179,6 +180,24 @@ namespace moris
             // enum for perturbation strategy used for FD (FA and SA)
             fem::Perturbation_Type mPerturbationStrategy = fem::Perturbation_Type::RELATIVE;
 
+            // bool for batched evaluation of integration points, requested by user
+            bool mUseBatchedEvaluation = false;
+
+            // bool true if all requested IWGs support batched evaluation
+            bool mRequestedIWGsBatched = false;
+
+            // storage for batched evaluation of integration points, reused across elements
+            Integration_Point_Batch mIntegrationPointBatch;
+
+            // bool for caching the element matrices, requested by user
+            bool mCacheLinearElementMatrices = false;
+
+            // bool true if all requested IWGs are linear in the dofs
+            bool mRequestedIWGsLinear = false;
+
+            // version of the cached element matrices, increased whenever they become invalid
+            uint mElementMatrixCacheVersion = 0;
+
             friend class MSI::Equation_Object;
             friend class Cluster;
             friend class Element_Bulk;
@@ -467,6 +486,62 @@ namespace moris
                 return mPerturbationStrategy;
             }
 
+            //------------------------------------------------------------------------------
+            /**
+             * check if the integration points of the elements are evaluated in a batch,
+             * i.e. if requested by the user and supported by all requested IWGs,
+             * staggered sets need the off-diagonal Jacobian with the residual and are evaluated pointwise
+             */
+            bool
+            use_batched_evaluation() const
+            {
+                return mUseBatchedEvaluation and mRequestedIWGsBatched and !mIsStaggered;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * check if the element matrices are cached and reused,
+             * i.e. if requested by the user and all requested IWGs are linear in the dofs
+             */
+            bool
+            use_element_matrix_cache() const
+            {
+                return mCacheLinearElementMatrices and mRequestedIWGsLinear and !mIsStaggered;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * get the version of the cached element matrices,
+             * element matrices cached for another version are recomputed
+             */
+            uint
+            get_element_matrix_cache_version() const
+            {
+                return mElementMatrixCacheVersion;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * invalidate the cached element matrices of all elements on the set,
+             * called by initialize_set() if the requested IWGs or the staggered flag change;
+             * the sets are rebuilt for every new design, so pdv changes need no invalidation
+             */
+            void
+            invalidate_element_matrix_cache()
+            {
+                mElementMatrixCacheVersion++;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * get storage for batched evaluation of integration points
+             */
+            Integration_Point_Batch&
+            get_integration_point_batch()
+            {
+                return mIntegrationPointBatch;
+            }
+
             //------------------------------------------------------------------------------
             /**
              * get the clusters on the set
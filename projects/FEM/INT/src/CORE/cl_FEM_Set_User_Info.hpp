@@ -71,6 +71,12 @@ namespace moris
                // enum for perturbation strategy used for FD (FA and SA)
                 fem::Perturbation_Type mPerturbationStrategy = fem::Perturbation_Type::RELATIVE;
 
+                // bool for batched evaluation of all integration points of an element
+                bool mUseBatchedEvaluation = false;
+
+                // bool for caching the element matrices of sets with linear IWGs
+                bool mCacheLinearElementMatrices = false;
+
                 //------------------------------------------------------------------------------
             public :
 
@@ -342,6 +348,46 @@ namespace moris
                     return mPerturbationStrategy;
                 }
 
+                //------------------------------------------------------------------------------
+                /**
+                 * set flag for batched evaluation of the integration points on the set
+                 * @param[ in ] aUseBatchedEvaluation bool true if batched evaluation
+                 */
+                void set_use_batched_evaluation( bool aUseBatchedEvaluation )
+                {
+                    mUseBatchedEvaluation = aUseBatchedEvaluation;
+                }
+
+                //------------------------------------------------------------------------------
+                /**
+                 * get flag for batched evaluation of the integration points on the set
+                 * @param[ out ] mUseBatchedEvaluation bool true if batched evaluation
+                 */
+                bool get_use_batched_evaluation() const
+                {
+                    return mUseBatchedEvaluation;
+                }
+
+                //------------------------------------------------------------------------------
+                /**
+                 * set flag for caching the element matrices on the set
+                 * @param[ in ] aCacheLinearElementMatrices bool true if element matrices are cached
+                 */
+                void set_cache_linear_element_matrices( bool aCacheLinearElementMatrices )
+                {
+                    mCacheLinearElementMatrices = aCacheLinearElementMatrices;
+                }
+
+                //------------------------------------------------------------------------------
+                /**
+                 * get flag for caching the element matrices on the set
+                 * @param[ out ] mCacheLinearElementMatrices bool true if element matrices are cached
+                 */
+                bool get_cache_linear_element_matrices() const
+                {
+                    return mCacheLinearElementMatrices;
+                }
+
                 //------------------------------------------------------------------------------
                 /**
                  * set IWGs
@@ -144,6 +144,13 @@ namespace moris
                 return;
             }
 
+            // evaluate all integration points at once if supported by the IWGs
+            if ( mSet->use_batched_evaluation() )
+            {
+                this->compute_batched( true, false );
+                return;
+            }
+
             // set physical and parametric space and time coefficients for IG element
             this->init_ig_geometry_interpolator();
 
@@ -207,6 +214,13 @@ namespace moris
                 return;
             }
 
+            // evaluate all integration points at once if supported by the IWGs
+            if ( mSet->use_batched_evaluation() )
+            {
+                this->compute_batched( false, true );
+                return;
+            }
+
             // set physical and parametric space and time coefficients for IG element
             this->init_ig_geometry_interpolator();
 
@@ -271,6 +285,14 @@ namespace moris
                 return;
             }
 
+            // evaluate all integration points at once if supported by the IWGs,
+            // IQIs are only evaluated in sensitivity analysis
+            if ( mSet->use_batched_evaluation() and mSet->mEquationModel->get_is_forward_analysis() )
+            {
+                this->compute_batched( true, true );
+                return;
+            }
+
             // set physical and parametric space and time coefficients for IG element
             this->init_ig_geometry_interpolator();
 
@@ -944,5 +966,98 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        void
+        Element_Bulk::compute_batched(
+                bool aComputeResidual,
+                bool aComputeJacobian )
+        {
+            // get number of IWGs
+            uint tNumIWGs = mSet->get_number_of_requested_IWGs();
+
+            // set physical and parametric space and time coefficients for IG element
+            this->init_ig_geometry_interpolator();
+
+            // get number of integration points
+            uint tNumIntegPoints = mSet->get_number_of_integration_points();
+
+            // get batch storage, reused for all elements of the set
+            Integration_Point_Batch& tBatch = mSet->get_integration_point_batch();
+            tBatch.initialize( tNumIntegPoints, aComputeJacobian );
+
+            // register quantities of all IWGs once for the element
+            for ( uint iIWG = 0; iIWG < tNumIWGs; iIWG++ )
+            {
+                // get requested IWG
+                const std::shared_ptr< IWG >& tReqIWG = mSet->get_requested_IWGs()( iIWG );
+
+                // FIXME set nodal weak BCs
+                tReqIWG->set_nodal_weak_bcs(
+                        mCluster->mInterpolationElement->get_weak_bcs() );
+
+                tReqIWG->register_batched_data( tBatch );
+            }
+
+            // number of points with valid integration domain
+            uint tNumActivePoints = 0;
+
+            // loop over integration points and collect point quantities
+            for ( uint iGP = 0; iGP < tNumIntegPoints; iGP++ )
+            {
+                // get the ith integration point in the IG param space
+                const Matrix< DDRMat >& tLocalIntegPoint =
+                        mSet->get_integration_points().get_column( iGP );
+
+                // set evaluation point for interpolators (FIs and GIs)
+                mSet->get_field_interpolator_manager()->set_space_time_from_local_IG_point( tLocalIntegPoint );
+
+                // compute detJ of integration domain
+                real tDetJ = mSet->get_field_interpolator_manager()->get_IG_geometry_interpolator()->det_J();
+
+                // skip if detJ smaller than threshold, weight of point remains zero
+                if ( tDetJ < Geometry_Interpolator::sDetJInvJacLowerLimit )
+                {
+                    continue;
+                }
+
+                // set integration point weight
+                tBatch.set_weight( iGP, mSet->get_integration_weights()( iGP ) * tDetJ );
+                tNumActivePoints++;
+
+                // reset IWGs such that their properties and CMs are evaluated at the new point
+                for ( uint iIWG = 0; iIWG < tNumIWGs; iIWG++ )
+                {
+                    mSet->get_requested_IWGs()( iIWG )->reset_eval_flags();
+                }
+
+                // store point quantities of all registered field interpolators, properties and CMs
+                tBatch.collect( iGP );
+            }
+
+            // skip if no point was collected
+            if ( tNumActivePoints == 0 )
+            {
+                return;
+            }
+
+            // loop over the IWGs and assemble contributions of all points
+            for ( uint iIWG = 0; iIWG < tNumIWGs; iIWG++ )
+            {
+                // get requested IWG
+                const std::shared_ptr< IWG >& tReqIWG = mSet->get_requested_IWGs()( iIWG );
+
+                if ( aComputeResidual )
+                {
+                    tReqIWG->compute_residual_batched( tBatch );
+                }
+
+                if ( aComputeJacobian )
+                {
+                    tReqIWG->compute_jacobian_batched( tBatch );
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
     } /* namespace fem */
 } /* namespace moris */
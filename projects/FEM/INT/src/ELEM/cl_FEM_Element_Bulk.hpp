@@ -154,6 +154,17 @@ namespace moris
              * using the mesh only
              */
             void init_ig_geometry_interpolator();
+
+            //------------------------------------------------------------------------------
+            /**
+             * compute the residual and/or the Jacobian for all integration points
+             * at once, requires all requested IWGs to support batched evaluation
+             * @param[ in ] aComputeResidual flag to compute the residual
+             * @param[ in ] aComputeJacobian flag to compute the Jacobian
+             */
+            void compute_batched(
+                    bool aComputeResidual,
+                    bool aComputeJacobian );
         };
 
         //------------------------------------------------------------------------------
@@ -450,6 +450,21 @@ namespace moris
         void
         Interpolation_Element::compute_jacobian()
         {
+            // reuse the element Jacobian of a set with linear IWGs
+            if ( this->has_valid_element_matrix_cache() )
+            {
+                // initialize the residual
+                mSet->initialize_mResidual();
+
+                // initialize the jacobian
+                mSet->initialize_mJacobian();
+
+                // copy the cached jacobian
+                mSet->get_jacobian() = mCachedJacobian;
+
+                return;
+            }
+
             // compute pdof values
             // FIXME do this only once
             this->compute_my_pdof_values();
@@ -479,6 +494,12 @@ namespace moris
 
             // ask cluster to compute jacobian
             mFemCluster( 0 )->compute_jacobian();
+
+            // store the jacobian for reuse
+            if ( mSet->use_element_matrix_cache() )
+            {
+                this->cache_element_jacobian();
+            }
         }
 
         //------------------------------------------------------------------------------
@@ -486,6 +507,15 @@ namespace moris
         void
         Interpolation_Element::compute_residual()
         {
+            // compute the residual of a set with linear IWGs from the cached element matrices
+            if ( mSet->mEquationModel->get_is_forward_analysis()
+                    and this->has_valid_residual_offset() )
+            {
+                this->compute_residual_from_element_matrix_cache();
+
+                return;
+            }
+
             // Fixme do this only once
             this->compute_my_pdof_values();
 
@@ -522,6 +552,12 @@ namespace moris
 
                 // ask cluster to compute residual
                 mFemCluster( 0 )->compute_residual();
+
+                // store the residual offset of this time slab once the jacobian has been cached
+                if ( this->has_valid_element_matrix_cache() and !this->has_valid_residual_offset() )
+                {
+                    this->cache_element_residual_offset();
+                }
             }
             else if ( ( !mSet->mEquationModel->get_is_forward_analysis() ) && ( mSet->get_number_of_requested_IQIs() > 0 ) )
             {
@@ -541,6 +577,18 @@ namespace moris
         void
         Interpolation_Element::compute_jacobian_and_residual()
         {
+            // reuse the element matrices of a set with linear IWGs
+            if ( mSet->mEquationModel->get_is_forward_analysis()
+                    and this->has_valid_residual_offset() )
+            {
+                this->compute_residual_from_element_matrix_cache();
+
+                // copy the cached jacobian
+                mSet->get_jacobian() = mCachedJacobian;
+
+                return;
+            }
+
             // Fixme do this only once
             this->compute_my_pdof_values();
 
@@ -578,6 +626,162 @@ namespace moris
 
             // ask cluster to compute Jacobian and residual
             mFemCluster( 0 )->compute_jacobian_and_residual();
+
+            // store the jacobian and the residual offset for reuse
+            if ( mSet->use_element_matrix_cache() )
+            {
+                if ( !this->has_valid_element_matrix_cache() )
+                {
+                    this->cache_element_jacobian();
+                }
+
+                if ( mSet->mEquationModel->get_is_forward_analysis() )
+                {
+                    this->cache_element_residual_offset();
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        bool
+        Interpolation_Element::has_valid_element_matrix_cache()
+        {
+            return mSet->use_element_matrix_cache()
+               and mCacheVersion == mSet->get_element_matrix_cache_version()
+               and mCacheTimeStep == this->get_time_step_size();
+        }
+
+        //------------------------------------------------------------------------------
+
+        bool
+        Interpolation_Element::has_valid_residual_offset()
+        {
+            // the offset contains the loads and prescribed values of a time slab and is recomputed for every time slab
+            return this->has_valid_element_matrix_cache()
+               and mCachedResidualOffset.numel() > 0
+               and mCacheResidualOffsetTime == this->get_time()( 0 );
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Interpolation_Element::cache_element_jacobian()
+        {
+            // store the jacobian with the cache version and time step size it was computed for
+            mCachedJacobian = mSet->get_jacobian();
+            mCacheVersion   = mSet->get_element_matrix_cache_version();
+            mCacheTimeStep  = this->get_time_step_size();
+
+            // the residual offset has to be recomputed for the new jacobian
+            mCachedResidualOffset.set_size( 0, 0 );
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Interpolation_Element::cache_element_residual_offset()
+        {
+            // only a single residual vector is reconstructed from the cached matrices
+            if ( mSet->mEquationModel->get_num_rhs() != 1 )
+            {
+                return;
+            }
+
+            // get the element solution vector the residual was computed for
+            Matrix< DDRMat > tSolution;
+            this->get_element_solution_vector( tSolution );
+
+            MORIS_ASSERT( tSolution.numel() == mCachedJacobian.n_cols() and tSolution.numel() == mSet->get_residual()( 0 ).numel(),
+                    "Interpolation_Element::cache_element_residual_offset - size of cached jacobian does not match residual." );
+
+            // R(0) = R(u) - K * u
+            mCachedResidualOffset = mSet->get_residual()( 0 ) - mCachedJacobian * tSolution;
+
+            // store the start of the time slab the offset was computed for
+            mCacheResidualOffsetTime = this->get_time()( 0 );
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Interpolation_Element::compute_residual_from_element_matrix_cache()
+        {
+            // compute pdof values
+            this->compute_my_pdof_values();
+
+            // initialize the residual
+            mSet->initialize_mResidual();
+
+            // initialize the jacobian
+            mSet->initialize_mJacobian();
+
+            // set the field interpolators coefficients
+            this->set_field_interpolators_coefficients();
+
+            // get the element solution vector
+            Matrix< DDRMat > tSolution;
+            this->get_element_solution_vector( tSolution );
+
+            // R(u) = K * u + R(0)
+            mSet->get_residual()( 0 ) = mCachedJacobian * tSolution + mCachedResidualOffset;
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Interpolation_Element::get_element_solution_vector( Matrix< DDRMat >& aSolution )
+        {
+            // get the dof types requested by the solver
+            const moris::Cell< enum MSI::Dof_Type >& tRequestedDofTypes = mSet->get_requested_dof_types();
+
+            // set size for the solution vector
+            aSolution.set_size( mSet->get_residual()( 0 ).numel(), 1, 0.0 );
+
+            // loop over leader and follower
+            for ( const mtk::Leader_Follower tSide : { mtk::Leader_Follower::LEADER, mtk::Leader_Follower::FOLLOWER } )
+            {
+                for ( uint iDof = 0; iDof < tRequestedDofTypes.size(); iDof++ )
+                {
+                    // get the set index for the requested dof type
+                    sint tDofIndex = mSet->get_dof_index_for_type( tRequestedDofTypes( iDof ), tSide );
+
+                    // if the dof type is not active on this side
+                    if ( tDofIndex == -1 )
+                    {
+                        continue;
+                    }
+
+                    // get the coefficients of the field interpolator, one column per field
+                    const Matrix< DDRMat >& tCoeff =
+                            mSet->get_field_interpolator_manager( tSide )
+                                    ->get_field_interpolators_for_type( tRequestedDofTypes( iDof ) )
+                                    ->get_coeff();
+
+                    // get the first row of the dof type in the residual
+                    uint tStartIndex = mSet->get_res_dof_assembly_map()( tDofIndex )( 0 );
+
+                    // copy the coefficients field by field
+                    for ( uint iField = 0; iField < tCoeff.n_cols(); iField++ )
+                    {
+                        for ( uint iCoeff = 0; iCoeff < tCoeff.n_rows(); iCoeff++ )
+                        {
+                            aSolution( tStartIndex++ ) = tCoeff( iCoeff, iField );
+                        }
+                    }
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        real
+        Interpolation_Element::get_time_step_size()
+        {
+            // get the time of the equation object
+            const Matrix< DDRMat >& tTime = this->get_time();
+
+            return tTime.numel() > 1 ? tTime( tTime.numel() - 1 ) - tTime( 0 ) : 0.0;
         }
 
         //------------------------------------------------------------------------------
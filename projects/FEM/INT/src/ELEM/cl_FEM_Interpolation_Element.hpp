@@ -59,6 +59,17 @@ namespace moris
             // element type
             Element_Type mElementType;
 
+            // element Jacobian and residual offset R(0) = R(u) - K * u cached for sets with linear IWGs
+            Matrix< DDRMat > mCachedJacobian;
+            Matrix< DDRMat > mCachedResidualOffset;
+
+            // cache version of the set and time step size the cached element matrices were computed for
+            uint mCacheVersion  = MORIS_UINT_MAX;
+            real mCacheTimeStep = 0.0;
+
+            // start time of the time slab the cached residual offset was computed for
+            real mCacheResidualOffsetTime = MORIS_REAL_MAX;
+
             friend class Element_Bulk;
             friend class Element_Sideset;
             friend class Element_Double_Sideset;
@@ -256,6 +267,54 @@ namespace moris
             void set_field_interpolators_coefficients();
 
             //------------------------------------------------------------------------------
+            /**
+             * check if the cached element matrices can be reused, i.e. if caching is used
+             * on the set and the matrices were computed for the current cache version of
+             * the set and the current time step size
+             */
+            bool has_valid_element_matrix_cache();
+
+            //------------------------------------------------------------------------------
+            /**
+             * check if the cached residual offset can be reused, i.e. if the element matrix
+             * cache is valid and the offset was computed for the current time slab
+             */
+            bool has_valid_residual_offset();
+
+            //------------------------------------------------------------------------------
+            /**
+             * store the element Jacobian of the set in the element matrix cache
+             */
+            void cache_element_jacobian();
+
+            //------------------------------------------------------------------------------
+            /**
+             * store the residual offset R(0) = R(u) - K * u in the element matrix cache
+             * based on the residual of the set and the cached element Jacobian
+             */
+            void cache_element_residual_offset();
+
+            //------------------------------------------------------------------------------
+            /**
+             * compute the residual of the set from the cached element matrices, R(u) = K * u + R(0)
+             */
+            void compute_residual_from_element_matrix_cache();
+
+            //------------------------------------------------------------------------------
+            /**
+             * get the element solution vector ordered as the residual of the set,
+             * i.e. the leader and then the follower coefficients of the requested dof types
+             * @param[ out ] aSolution element solution vector
+             */
+            void get_element_solution_vector( Matrix< DDRMat >& aSolution );
+
+            //------------------------------------------------------------------------------
+            /**
+             * get the size of the current time step
+             */
+            real get_time_step_size();
+
+            //------------------------------------------------------------------------------
 
         };    // class FEM::Interpolation_Element
 
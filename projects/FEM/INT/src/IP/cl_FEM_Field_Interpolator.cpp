@@ -23,8 +23,9 @@
 #include "op_less_equal.hpp"
 #include "op_greater_equal.hpp"
 
-#include "cl_FEM_Field_Interpolator.hpp"    //FEM/INT/src
-#include "cl_MTK_Enums.hpp"                 //MTK/src
+#include "cl_FEM_Field_Interpolator.hpp"             //FEM/INT/src
+#include "cl_MTK_Enums.hpp"                          //MTK/src
+#include "cl_MTK_Space_Interpolator_Kernel.hpp"    //MTK/src
 
 #include <iostream>
 
@@ -74,6 +75,9 @@ namespace moris
             mdNdx.set_size( mNSpaceDim, mNFieldBases, 0.0 );
             mdNdt.set_size( mNTimeDim, mNFieldBases, 0.0 );
             md2Ndxt.set_size( mNSpaceDim, mNFieldBases, 0.0 );
+
+            // select fixed-size kernels
+            this->set_fixed_size_function_pointers();
         }
 
         //------------------------------------------------------------------------------
@@ -117,6 +121,9 @@ namespace moris
             mdNdx.set_size( mNSpaceDim, mNFieldBases, 0.0 );
             mdNdt.set_size( mNTimeDim, mNFieldBases, 0.0 );
             md2Ndxt.set_size( mNSpaceDim, mNFieldBases, 0.0 );
+
+            // select fixed-size kernels
+            this->set_fixed_size_function_pointers();
         }
 
         //------------------------------------------------------------------------------
@@ -160,6 +167,9 @@ namespace moris
             mdNdx.set_size( mNSpaceDim, mNFieldBases, 0.0 );
             mdNdt.set_size( mNTimeDim, mNFieldBases, 0.0 );
             md2Ndxt.set_size( mNSpaceDim, mNFieldBases, 0.0 );
+
+            // select fixed-size kernels
+            this->set_fixed_size_function_pointers();
         }
 
         //------------------------------------------------------------------------------
@@ -469,19 +479,25 @@ namespace moris
                     "Field_Interpolator::eval_d1Ndx1 - mTau is not set." );
 
             // evaluate dNSpacedXi for the space interpolation
-            Matrix< DDRMat > tdNSpacedXi;
-            mSpaceInterpolation->eval_dNdXi( mXi, tdNSpacedXi );
+            mSpaceInterpolation->eval_dNdXi( mXi, mdNSpacedXi );
 
             // evaluate the space Jacobian from the geometry interpolator
             const Matrix< DDRMat >& tInvJGeot = mGeometryInterpolator->inverse_space_jacobian();
 
-            // compute first derivative of the space shape function wrt x
-            auto tdNSpacedX = tInvJGeot * tdNSpacedXi;
-
             // evaluate NTime for the time interpolation
             Matrix< DDRMat > tNTime;
             mTimeInterpolation->eval_N( mTau, tNTime );
 
+            // use fixed-size kernel if available
+            if ( mSpaceTimedNdxFunc != nullptr )
+            {
+                mSpaceTimedNdxFunc( tInvJGeot, mdNSpacedXi, tNTime, mdNdx );
+                return;
+            }
+
+            // compute first derivative of the space shape function wrt x
+            auto tdNSpacedX = tInvJGeot * mdNSpacedXi;
+
             // build the space time dNFielddXi row by row
             for ( moris::uint Ik = 0; Ik < mNTimeBases; Ik++ )
             {
@@ -494,6 +510,62 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        void
+        Field_Interpolator::set_fixed_size_function_pointers()
+        {
+            // fixed-size kernels require square space Jacobian
+            if ( mNSpaceParamDim != mNSpaceDim )
+            {
+                return;
+            }
+
+            switch ( mNSpaceDim )
+            {
+                case 2:
+                {
+                    switch ( mNSpaceBases )
+                    {
+                        // TRI3
+                        case 3:
+                            mSpaceTimedNdxFunc = &mtk::Space_Interpolator_Kernel< 2, 3 >::eval_space_time_dNdx;
+                            break;
+                        // QUAD4
+                        case 4:
+                            mSpaceTimedNdxFunc = &mtk::Space_Interpolator_Kernel< 2, 4 >::eval_space_time_dNdx;
+                            break;
+                        default:
+                            break;
+                    }
+                    break;
+                }
+                case 3:
+                {
+                    switch ( mNSpaceBases )
+                    {
+                        // TET4
+                        case 4:
+                            mSpaceTimedNdxFunc = &mtk::Space_Interpolator_Kernel< 3, 4 >::eval_space_time_dNdx;
+                            break;
+                        // HEX8
+                        case 8:
+                            mSpaceTimedNdxFunc = &mtk::Space_Interpolator_Kernel< 3, 8 >::eval_space_time_dNdx;
+                            break;
+                        // HEX27
+                        case 27:
+                            mSpaceTimedNdxFunc = &mtk::Space_Interpolator_Kernel< 3, 27 >::eval_space_time_dNdx;
+                            break;
+                        default:
+                            break;
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
         void
         Field_Interpolator::eval_d2Ndx2()
         {
@@ -131,6 +131,16 @@ namespace moris
 
             Matrix< DDRMat > mGradxt;
 
+            // storage for space shape function derivatives wrt xi
+            Matrix< DDRMat > mdNSpacedXi;
+
+            // pointer to fixed-size kernel for first space derivatives, if available
+            void ( *mSpaceTimedNdxFunc )(
+                    const Matrix< DDRMat >& aInvSpaceJt,
+                    const Matrix< DDRMat >& adNdXi,
+                    const Matrix< DDRMat >& aNTime,
+                    Matrix< DDRMat >&       adNdx ) = nullptr;
+
             //------------------------------------------------------------------------------
 
           public:
@@ -419,6 +429,13 @@ namespace moris
              */
             void eval_d1Ndx1();
 
+            //------------------------------------------------------------------------------
+            /**
+             * selects fixed-size kernel for first space derivatives
+             * for TRI3, QUAD4, TET4, HEX8 and HEX27 space interpolations
+             */
+            void set_fixed_size_function_pointers();
+
             //------------------------------------------------------------------------------
             /**
              * evaluates the second derivatives of the space time shape functions
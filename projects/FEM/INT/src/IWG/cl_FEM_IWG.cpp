@@ -1869,6 +1869,126 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        bool
+        IWG::check_batched_dof_dependencies()
+        {
+            // no follower dof dependencies
+            if ( this->get_global_dof_type_list( mtk::Leader_Follower::FOLLOWER ).size() > 0 )
+            {
+                return false;
+            }
+
+            // only the residual dof type on leader side
+            const moris::Cell< moris::Cell< MSI::Dof_Type > >& tLeaderDofTypes =
+                    this->get_global_dof_type_list( mtk::Leader_Follower::LEADER );
+
+            if ( tLeaderDofTypes.size() != 1 or tLeaderDofTypes( 0 )( 0 ) != mResidualDofType( 0 )( 0 ) )
+            {
+                return false;
+            }
+
+            // leader properties have to be dof independent
+            for ( const std::shared_ptr< Property >& tProperty : mLeaderProp )
+            {
+                if ( tProperty != nullptr and tProperty->get_dof_type_list().size() > 0 )
+                {
+                    return false;
+                }
+            }
+
+            // properties of leader constitutive models have to be dof independent
+            for ( const std::shared_ptr< Constitutive_Model >& tCM : mLeaderCM )
+            {
+                if ( tCM == nullptr )
+                {
+                    continue;
+                }
+
+                for ( const std::shared_ptr< Property >& tProperty : tCM->get_properties() )
+                {
+                    if ( tProperty != nullptr and tProperty->get_dof_type_list().size() > 0 )
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        //------------------------------------------------------------------------------
+
+        bool
+        IWG::check_linear_dof_dependencies()
+        {
+            // only the residual dof type on leader and follower side
+            for ( const mtk::Leader_Follower tSide : { mtk::Leader_Follower::LEADER, mtk::Leader_Follower::FOLLOWER } )
+            {
+                for ( const moris::Cell< MSI::Dof_Type >& tDofType : this->get_global_dof_type_list( tSide ) )
+                {
+                    if ( tDofType( 0 ) != mResidualDofType( 0 )( 0 ) )
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            // check that a list of properties is dof, dv and time independent, as the cached
+            // element matrices are neither updated for a new design nor for a new time step
+            auto tDofIndependent = []( const moris::Cell< std::shared_ptr< Property > >& aProperties ) -> bool {
+                for ( const std::shared_ptr< Property >& tProperty : aProperties )
+                {
+                    if ( tProperty != nullptr
+                            and ( tProperty->get_dof_type_list().size() > 0
+                                    or tProperty->get_dv_type_list().size() > 0
+                                    or tProperty->is_time_dependent() ) )
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            };
+
+            // leader and follower properties have to be dof independent
+            if ( !tDofIndependent( mLeaderProp ) or !tDofIndependent( mFollowerProp ) )
+            {
+                return false;
+            }
+
+            // properties of leader and follower constitutive models have to be dof independent
+            for ( const moris::Cell< std::shared_ptr< Constitutive_Model > >* tCMs : { &mLeaderCM, &mFollowerCM } )
+            {
+                for ( const std::shared_ptr< Constitutive_Model >& tCM : *tCMs )
+                {
+                    if ( tCM != nullptr and !tDofIndependent( tCM->get_properties() ) )
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            // stabilization parameters must not depend on any dof
+            for ( const std::shared_ptr< Stabilization_Parameter >& tSP : mStabilizationParam )
+            {
+                if ( tSP == nullptr )
+                {
+                    continue;
+                }
+
+                if ( tSP->get_global_dof_type_list( mtk::Leader_Follower::LEADER ).size() > 0
+                        or tSP->get_global_dof_type_list( mtk::Leader_Follower::FOLLOWER ).size() > 0
+                        or !tDofIndependent( tSP->get_properties( mtk::Leader_Follower::LEADER ) )
+                        or !tDofIndependent( tSP->get_properties( mtk::Leader_Follower::FOLLOWER ) ) )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        //------------------------------------------------------------------------------
+
         const moris::Cell< moris::Cell< MSI::Dof_Type > >&
         IWG::get_global_dof_type_list(
                 mtk::Leader_Follower aIsLeader )
@@ -25,6 +25,7 @@
 #include "cl_FEM_Constitutive_Model.hpp"
 #include "cl_FEM_Stabilization_Parameter.hpp"
 #include "cl_FEM_Enums.hpp"
+#include "cl_FEM_Integration_Point_Batch.hpp"
 #include "fn_FEM_FD_Scheme.hpp"
 // FEM/MSI/src
 #include "cl_MSI_Dof_Type_Enums.hpp"
@@ -556,6 +557,24 @@ namespace moris
             void check_field_interpolators(
                     mtk::Leader_Follower aIsLeader = mtk::Leader_Follower::LEADER );
 
+            //------------------------------------------------------------------------------
+            /**
+             * check that the IWG only depends on its residual dof type through its
+             * field interpolator and constitutive models, i.e. that leader properties
+             * and constitutive model properties are dof independent and that there are
+             * no follower dof dependencies; required for batched evaluation
+             */
+            bool check_batched_dof_dependencies();
+
+            //------------------------------------------------------------------------------
+            /**
+             * check that the leader and follower properties, the properties of the
+             * constitutive models and stabilization parameters are dof, dv and time
+             * independent and that the IWG only depends on its residual dof type;
+             * required for an IWG that is linear in the dofs
+             */
+            bool check_linear_dof_dependencies();
+
             //------------------------------------------------------------------------------
             /**
              * set property
@@ -744,6 +763,62 @@ namespace moris
              */
             virtual void compute_jacobian_and_residual( real aWStar ) = 0;
 
+            //------------------------------------------------------------------------------
+            /**
+             * check if the IWG can be evaluated for all integration points of an element at once
+             * with its current properties and constitutive models
+             */
+            virtual bool
+            supports_batched_evaluation()
+            {
+                return false;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * check if the residual of the IWG is linear in the dofs with a Jacobian that does not
+             * change over Newton iterations and time steps, so that element matrices can be reused
+             */
+            virtual bool
+            is_linear_in_dofs()
+            {
+                return false;
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * register the quantities required for batched evaluation with the batch,
+             * called once per element before the integration points are collected
+             * @param[ in ] aBatch storage for all integration points of the element
+             */
+            virtual void
+            register_batched_data( Integration_Point_Batch& aBatch )
+            {
+                MORIS_ERROR( false, "IWG::register_batched_data - Not implemented for this IWG." );
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * evaluate the residual for all integration points of an element
+             * @param[ in ] aBatch storage for all integration points of the element
+             */
+            virtual void
+            compute_residual_batched( Integration_Point_Batch& aBatch )
+            {
+                MORIS_ERROR( false, "IWG::compute_residual_batched - Not implemented for this IWG." );
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * evaluate the Jacobian for all integration points of an element
+             * @param[ in ] aBatch storage for all integration points of the element
+             */
+            virtual void
+            compute_jacobian_batched( Integration_Point_Batch& aBatch )
+            {
+                MORIS_ERROR( false, "IWG::compute_jacobian_batched - Not implemented for this IWG." );
+            }
+
             //------------------------------------------------------------------------------
             /**
              * check the Jacobian with FD
@@ -238,6 +238,146 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        bool
+        IWG_Diffusion_Bulk::supports_batched_evaluation()
+        {
+            // get the diffusion CM
+            const std::shared_ptr< Constitutive_Model >& tCMDiffusion =
+                    mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::DIFFUSION ) );
+
+            // only linear isotropic diffusion
+            if ( tCMDiffusion == nullptr or tCMDiffusion->get_constitutive_type() != Constitutive_Type::DIFF_LIN_ISO )
+            {
+                return false;
+            }
+
+            // no GGLS stabilization
+            if ( mStabilizationParam( static_cast< uint >( IWG_Stabilization_Type::GGLS_DIFFUSION ) ) != nullptr )
+            {
+                return false;
+            }
+
+            // no transient term and no eigen strain
+            if ( ( tCMDiffusion->get_property( "Density" ) != nullptr and tCMDiffusion->get_property( "HeatCapacity" ) != nullptr )
+                    or tCMDiffusion->get_property( "EigenStrain" ) != nullptr )
+            {
+                return false;
+            }
+
+            // properties and CM only depend on the temperature field through the CM flux
+            return this->check_batched_dof_dependencies();
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        IWG_Diffusion_Bulk::register_batched_data( Integration_Point_Batch& aBatch )
+        {
+            // get residual dof type field interpolator (here temperature)
+            Field_Interpolator* tFITemp = mLeaderFIManager->get_field_interpolators_for_type( mResidualDofType( 0 )( 0 ) );
+
+            aBatch.register_field( tFITemp );
+
+            // register diffusion CM
+            aBatch.register_constitutive_model( mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::DIFFUSION ) ) );
+
+            // register body load and thickness properties if set
+            for ( const std::shared_ptr< Property >& tProperty : mLeaderProp )
+            {
+                if ( tProperty != nullptr )
+                {
+                    aBatch.register_property( tProperty );
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        IWG_Diffusion_Bulk::compute_residual_batched( Integration_Point_Batch& aBatch )
+        {
+            // get leader index for residual dof type, indices for assembly
+            uint tLeaderDofIndex      = mSet->get_dof_index_for_type( mResidualDofType( 0 )( 0 ), mtk::Leader_Follower::LEADER );
+            uint tLeaderResStartIndex = mSet->get_res_dof_assembly_map()( tLeaderDofIndex )( 0, 0 );
+            uint tLeaderResStopIndex  = mSet->get_res_dof_assembly_map()( tLeaderDofIndex )( 0, 1 );
+
+            // get residual dof type field interpolator (here temperature)
+            Field_Interpolator* tFITemp = mLeaderFIManager->get_field_interpolators_for_type( mResidualDofType( 0 )( 0 ) );
+
+            // get body load property
+            const std::shared_ptr< Property >& tPropLoad =
+                    mLeaderProp( static_cast< uint >( IWG_Property_Type::BODY_LOAD ) );
+
+            // get the diffusion CM
+            const std::shared_ptr< Constitutive_Model >& tCMDiffusion =
+                    mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::DIFFUSION ) );
+
+            // integration weights multiplied by user defined thickness
+            Matrix< DDRMat > tWeights = aBatch.get_weights( mLeaderProp( static_cast< uint >( IWG_Property_Type::THICKNESS ) ) );
+
+            // get sub-matrix
+            auto tRes = mSet->get_residual()( 0 )(
+                    { tLeaderResStartIndex, tLeaderResStopIndex } );
+
+            // weighted flux at all points
+            Matrix< DDRMat > tWeightedFlux = aBatch.flux( tCMDiffusion );
+            aBatch.scale_blocks( tWeightedFlux, tWeights );
+
+            // compute the residual
+            tRes += trans( aBatch.test_strain( tCMDiffusion ) ) * tWeightedFlux;
+
+            // if body load
+            if ( tPropLoad != nullptr )
+            {
+                // weighted body load at all points
+                Matrix< DDRMat > tWeightedLoad = aBatch.property_values( tPropLoad );
+                aBatch.scale_blocks( tWeightedLoad, tWeights );
+
+                // compute contribution of body load to residual
+                tRes -= trans( aBatch.N( tFITemp ) ) * tWeightedLoad;
+            }
+
+            // check for nan, infinity
+            MORIS_ASSERT( isfinite( mSet->get_residual()( 0 ) ),
+                    "IWG_Diffusion_Bulk::compute_residual_batched - Residual contains NAN or INF, exiting!" );
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        IWG_Diffusion_Bulk::compute_jacobian_batched( Integration_Point_Batch& aBatch )
+        {
+            // get leader index for residual dof type, indices for assembly
+            uint tLeaderDofIndex      = mSet->get_dof_index_for_type( mResidualDofType( 0 )( 0 ), mtk::Leader_Follower::LEADER );
+            uint tLeaderResStartIndex = mSet->get_res_dof_assembly_map()( tLeaderDofIndex )( 0, 0 );
+            uint tLeaderResStopIndex  = mSet->get_res_dof_assembly_map()( tLeaderDofIndex )( 0, 1 );
+            uint tLeaderDepStartIndex = mSet->get_jac_dof_assembly_map()( tLeaderDofIndex )( tLeaderDofIndex, 0 );
+            uint tLeaderDepStopIndex  = mSet->get_jac_dof_assembly_map()( tLeaderDofIndex )( tLeaderDofIndex, 1 );
+
+            // get the diffusion CM
+            const std::shared_ptr< Constitutive_Model >& tCMDiffusion =
+                    mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::DIFFUSION ) );
+
+            // integration weights multiplied by user defined thickness
+            Matrix< DDRMat > tWeights = aBatch.get_weights( mLeaderProp( static_cast< uint >( IWG_Property_Type::THICKNESS ) ) );
+
+            // get sub-matrix
+            auto tJac = mSet->get_jacobian()(
+                    { tLeaderResStartIndex, tLeaderResStopIndex },
+                    { tLeaderDepStartIndex, tLeaderDepStopIndex } );
+
+            // compute the Jacobian, sum over points of B_i^T * w_i * D_i * B_i
+            Matrix< DDRMat > tWeightedTangent = aBatch.weighted_tangent( tCMDiffusion, tWeights );
+
+            tJac += trans( aBatch.test_strain( tCMDiffusion ) ) * tWeightedTangent;
+
+            // check for nan, infinity
+            MORIS_ASSERT( isfinite( mSet->get_jacobian() ),
+                    "IWG_Diffusion_Bulk::compute_jacobian_batched - Jacobian contains NAN or INF, exiting!" );
+        }
+
+        //------------------------------------------------------------------------------
+
         void
         IWG_Diffusion_Bulk::compute_dRdp( real aWStar )
         {
@@ -313,5 +453,22 @@ namespace moris
         }
 
         //------------------------------------------------------------------------------
+
+        bool
+        IWG_Diffusion_Bulk::is_linear_in_dofs()
+        {
+            // only linear isotropic diffusion
+            const std::shared_ptr< Constitutive_Model >& tLeaderCM = mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::DIFFUSION ) );
+
+            if ( tLeaderCM == nullptr or tLeaderCM->get_constitutive_type() != Constitutive_Type::DIFF_LIN_ISO )
+            {
+                return false;
+            }
+
+            // properties, CMs and stabilization parameters only depend on the residual dof type
+            return this->check_linear_dof_dependencies();
+        }
+
+        //------------------------------------------------------------------------------
     } /* namespace fem */
 } /* namespace moris */
@@ -250,5 +250,22 @@ namespace moris
         }
 
         //------------------------------------------------------------------------------
+
+        bool
+        IWG_Diffusion_Dirichlet_Nitsche::is_linear_in_dofs()
+        {
+            // only linear isotropic diffusion
+            const std::shared_ptr< Constitutive_Model >& tLeaderCM = mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::DIFF_LIN_ISO ) );
+
+            if ( tLeaderCM == nullptr or tLeaderCM->get_constitutive_type() != Constitutive_Type::DIFF_LIN_ISO )
+            {
+                return false;
+            }
+
+            // properties, CMs and stabilization parameters only depend on the residual dof type
+            return this->check_linear_dof_dependencies();
+        }
+
+        //------------------------------------------------------------------------------
     } /* namespace fem */
 } /* namespace moris */
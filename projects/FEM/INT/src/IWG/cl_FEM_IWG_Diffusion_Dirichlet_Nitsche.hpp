@@ -97,6 +97,13 @@ namespace moris
              */
             void compute_dRdp( real aWStar );
 
+            //------------------------------------------------------------------------------
+            /**
+             * check if the IWG is linear in the dofs, i.e. linear isotropic diffusion with
+             * dof independent properties and stabilization parameters
+             */
+            bool is_linear_in_dofs();
+
             //------------------------------------------------------------------------------
         };
         //------------------------------------------------------------------------------
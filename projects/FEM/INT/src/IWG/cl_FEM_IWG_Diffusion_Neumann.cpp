@@ -151,5 +151,14 @@ namespace moris
         }
 
         //------------------------------------------------------------------------------
+
+        bool
+        IWG_Diffusion_Neumann::is_linear_in_dofs()
+        {
+            // properties, CMs and stabilization parameters only depend on the residual dof type
+            return this->check_linear_dof_dependencies();
+        }
+
+        //------------------------------------------------------------------------------
     } /* namespace fem */
 } /* namespace moris */
@@ -248,6 +248,14 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        bool IWG_Ghost_Normal_Field::is_linear_in_dofs()
+        {
+            // properties, CMs and stabilization parameters only depend on the residual dof type
+            return this->check_linear_dof_dependencies();
+        }
+
+        //------------------------------------------------------------------------------
+
         void IWG_Ghost_Normal_Field::get_flat_normal_matrix(
                 Matrix< DDRMat > & aFlatNormal,
                 uint               aOrder )
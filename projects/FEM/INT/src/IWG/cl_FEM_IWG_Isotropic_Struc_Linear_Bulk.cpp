@@ -217,12 +217,201 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        bool IWG_Isotropic_Struc_Linear_Bulk::supports_batched_evaluation()
+        {
+            // get elasticity CM
+            const std::shared_ptr< Constitutive_Model > & tCMElasticity =
+                    mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::ELAST_LIN_ISO ) );
+
+            // only linear isotropic elasticity
+            if ( tCMElasticity == nullptr or tCMElasticity->get_constitutive_type() != Constitutive_Type::STRUC_LIN_ISO )
+            {
+                return false;
+            }
+
+            // thickness is a function of the radius for axisymmetric formulation
+            if ( tCMElasticity->get_plane_type() == Model_Type::AXISYMMETRIC )
+            {
+                return false;
+            }
+
+            // properties and CM only depend on the displacement field through the CM flux
+            return this->check_batched_dof_dependencies();
+        }
+
+        //------------------------------------------------------------------------------
+
+        void IWG_Isotropic_Struc_Linear_Bulk::register_batched_data( Integration_Point_Batch & aBatch )
+        {
+            // get field interpolator for residual dof type
+            Field_Interpolator * tDisplacementFI =
+                    mLeaderFIManager->get_field_interpolators_for_type( mResidualDofType( 0 )( 0 ) );
+
+            aBatch.register_field( tDisplacementFI );
+
+            // register elasticity CM
+            aBatch.register_constitutive_model( mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::ELAST_LIN_ISO ) ) );
+
+            // register load, bedding and thickness properties if set
+            for ( const std::shared_ptr< Property > & tProperty : mLeaderProp )
+            {
+                if ( tProperty != nullptr )
+                {
+                    aBatch.register_property( tProperty );
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        void IWG_Isotropic_Struc_Linear_Bulk::compute_residual_batched( Integration_Point_Batch & aBatch )
+        {
+            // get leader index for residual dof type (here displacement), indices for assembly
+            uint tLeaderDofIndex      = mSet->get_dof_index_for_type( mResidualDofType( 0 )( 0 ), mtk::Leader_Follower::LEADER );
+            uint tLeaderResStartIndex = mSet->get_res_dof_assembly_map()( tLeaderDofIndex )( 0, 0 );
+            uint tLeaderResStopIndex  = mSet->get_res_dof_assembly_map()( tLeaderDofIndex )( 0, 1 );
+
+            // get field interpolator for residual dof type
+            Field_Interpolator * tDisplacementFI =
+                    mLeaderFIManager->get_field_interpolators_for_type( mResidualDofType( 0 )( 0 ) );
+
+            // get body load property
+            const std::shared_ptr< Property > & tPropLoad =
+                    mLeaderProp( static_cast< uint >( IWG_Property_Type::LOAD ) );
+
+            // get bedding property
+            const std::shared_ptr< Property > & tPropBedding =
+                    mLeaderProp( static_cast< uint >( IWG_Property_Type::BEDDING ) );
+
+            // get elasticity CM
+            const std::shared_ptr< Constitutive_Model > & tCMElasticity =
+                    mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::ELAST_LIN_ISO ) );
+
+            // get thickness property
+            const std::shared_ptr< Property > & tPropThickness =
+                    mLeaderProp( static_cast< uint >( IWG_Property_Type::THICKNESS ) );
+
+            // integration weights multiplied by user defined thickness
+            Matrix< DDRMat > tWeights = aBatch.get_weights( tPropThickness );
+
+            // get sub-matrix
+            auto tRes = mSet->get_residual()( 0 )(
+                    { tLeaderResStartIndex, tLeaderResStopIndex } );
+
+            // weighted stress at all points
+            Matrix< DDRMat > tWeightedFlux = aBatch.flux( tCMElasticity );
+            aBatch.scale_blocks( tWeightedFlux, tWeights );
+
+            // compute the residual
+            tRes += trans( aBatch.test_strain( tCMElasticity ) ) * tWeightedFlux;
+
+            // if body load
+            if ( tPropLoad != nullptr )
+            {
+                // weighted body load at all points
+                Matrix< DDRMat > tWeightedLoad = aBatch.property_values( tPropLoad );
+                aBatch.scale_blocks( tWeightedLoad, tWeights );
+
+                // compute body load contribution
+                tRes -= trans( aBatch.N( tDisplacementFI ) ) * tWeightedLoad;
+            }
+
+            // if bedding
+            if ( tPropBedding != nullptr )
+            {
+                // weighted displacement at all points, scaled by bedding parameter
+                Matrix< DDRMat > tWeightedDispl = aBatch.val( tDisplacementFI );
+                aBatch.scale_blocks( tWeightedDispl, aBatch.get_weights( tPropThickness, tPropBedding ) );
+
+                // compute bedding contribution
+                tRes += trans( aBatch.N( tDisplacementFI ) ) * tWeightedDispl;
+            }
+
+            // check for nan, infinity
+            MORIS_ASSERT( isfinite( mSet->get_residual()( 0 ) ),
+                    "IWG_Isotropic_Struc_Linear_Bulk::compute_residual_batched - Residual contains NAN or INF, exiting!");
+        }
+
+        //------------------------------------------------------------------------------
+
+        void IWG_Isotropic_Struc_Linear_Bulk::compute_jacobian_batched( Integration_Point_Batch & aBatch )
+        {
+            // get leader index for residual dof type (here displacement), indices for assembly
+            uint tLeaderDofIndex      = mSet->get_dof_index_for_type( mResidualDofType( 0 )( 0 ), mtk::Leader_Follower::LEADER );
+            uint tLeaderResStartIndex = mSet->get_res_dof_assembly_map()( tLeaderDofIndex )( 0, 0 );
+            uint tLeaderResStopIndex  = mSet->get_res_dof_assembly_map()( tLeaderDofIndex )( 0, 1 );
+            uint tLeaderDepStartIndex = mSet->get_jac_dof_assembly_map()( tLeaderDofIndex )( tLeaderDofIndex, 0 );
+            uint tLeaderDepStopIndex  = mSet->get_jac_dof_assembly_map()( tLeaderDofIndex )( tLeaderDofIndex, 1 );
+
+            // get field interpolator for residual dof type
+            Field_Interpolator * tDisplacementFI =
+                    mLeaderFIManager->get_field_interpolators_for_type( mResidualDofType( 0 )( 0 ) );
+
+            // get bedding property
+            const std::shared_ptr< Property > & tPropBedding =
+                    mLeaderProp( static_cast< uint >( IWG_Property_Type::BEDDING ) );
+
+            // get elasticity CM
+            const std::shared_ptr< Constitutive_Model > & tCMElasticity =
+                    mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::ELAST_LIN_ISO ) );
+
+            // get thickness property
+            const std::shared_ptr< Property > & tPropThickness =
+                    mLeaderProp( static_cast< uint >( IWG_Property_Type::THICKNESS ) );
+
+            // integration weights multiplied by user defined thickness
+            Matrix< DDRMat > tWeights = aBatch.get_weights( tPropThickness );
+
+            // get sub-matrix
+            auto tJac = mSet->get_jacobian()(
+                    { tLeaderResStartIndex, tLeaderResStopIndex },
+                    { tLeaderDepStartIndex, tLeaderDepStopIndex } );
+
+            // compute the Jacobian, sum over points of B_i^T * w_i * D_i * B_i
+            Matrix< DDRMat > tWeightedTangent = aBatch.weighted_tangent( tCMElasticity, tWeights );
+
+            tJac += trans( aBatch.test_strain( tCMElasticity ) ) * tWeightedTangent;
+
+            // if bedding
+            if ( tPropBedding != nullptr )
+            {
+                // weighted test functions at all points, scaled by bedding parameter
+                Matrix< DDRMat > tWeightedN = aBatch.N( tDisplacementFI );
+                aBatch.scale_blocks( tWeightedN, aBatch.get_weights( tPropThickness, tPropBedding ) );
+
+                // add bedding contribution
+                tJac += trans( aBatch.N( tDisplacementFI ) ) * tWeightedN;
+            }
+
+            // check for nan, infinity
+            MORIS_ASSERT( isfinite( mSet->get_jacobian() ) ,
+                    "IWG_Isotropic_Struc_Linear_Bulk::compute_jacobian_batched - Jacobian contains NAN or INF, exiting!");
+        }
+
+        //------------------------------------------------------------------------------
+
         void IWG_Isotropic_Struc_Linear_Bulk::compute_dRdp( real aWStar )
         {
             MORIS_ERROR( false, "IWG_Isotropic_Struc_Linear_Bulk::compute_dRdp - This function does nothing.");
         }
 
         //------------------------------------------------------------------------------
+
+        bool IWG_Isotropic_Struc_Linear_Bulk::is_linear_in_dofs()
+        {
+            // only linear isotropic elasticity
+            const std::shared_ptr< Constitutive_Model >& tLeaderCM = mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::ELAST_LIN_ISO ) );
+
+            if ( tLeaderCM == nullptr or tLeaderCM->get_constitutive_type() != Constitutive_Type::STRUC_LIN_ISO )
+            {
+                return false;
+            }
+
+            // properties, CMs and stabilization parameters only depend on the residual dof type
+            return this->check_linear_dof_dependencies();
+        }
+
+        //------------------------------------------------------------------------------
     } /* namespace fem */
 } /* namespace moris */
 
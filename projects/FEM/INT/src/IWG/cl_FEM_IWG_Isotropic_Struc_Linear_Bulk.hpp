@@ -88,6 +88,41 @@ namespace moris
                  */
                 void compute_dRdp( real aWStar );
 
+                //------------------------------------------------------------------------------
+                /**
+                 * check if the IWG is linear in the dofs, i.e. linear isotropic elasticity with
+                 * dof independent properties and stabilization parameters
+                 */
+                bool is_linear_in_dofs();
+
+                //------------------------------------------------------------------------------
+                /**
+                 * check if batched evaluation is supported, i.e. linear isotropic elasticity
+                 * without axisymmetry and dof dependent properties
+                 */
+                bool supports_batched_evaluation();
+
+                //------------------------------------------------------------------------------
+                /**
+                 * register quantities required for batched evaluation, called once per element
+                 * @param[ in ] aBatch storage for all integration points of the element
+                 */
+                void register_batched_data( Integration_Point_Batch& aBatch );
+
+                //------------------------------------------------------------------------------
+                /**
+                 * compute the residual for all integration points of the element
+                 * @param[ in ] aBatch storage for all integration points of the element
+                 */
+                void compute_residual_batched( Integration_Point_Batch& aBatch );
+
+                //------------------------------------------------------------------------------
+                /**
+                 * compute the jacobian for all integration points of the element
+                 * @param[ in ] aBatch storage for all integration points of the element
+                 */
+                void compute_jacobian_batched( Integration_Point_Batch& aBatch );
+
                 //------------------------------------------------------------------------------
         };
         //------------------------------------------------------------------------------
@@ -258,6 +258,23 @@ namespace moris
         }
 
         //------------------------------------------------------------------------------
+
+        bool
+        IWG_Isotropic_Struc_Linear_Dirichlet::is_linear_in_dofs()
+        {
+            // only linear isotropic elasticity
+            const std::shared_ptr< Constitutive_Model >& tLeaderCM = mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::ELAST_LIN_ISO ) );
+
+            if ( tLeaderCM == nullptr or tLeaderCM->get_constitutive_type() != Constitutive_Type::STRUC_LIN_ISO )
+            {
+                return false;
+            }
+
+            // properties, CMs and stabilization parameters only depend on the residual dof type
+            return this->check_linear_dof_dependencies();
+        }
+
+        //------------------------------------------------------------------------------
     } /* namespace fem */
 } /* namespace moris */
 
@@ -81,6 +81,13 @@ namespace moris
                  */
                 void compute_dRdp( real aWStar );
 
+                //------------------------------------------------------------------------------
+                /**
+                 * check if the IWG is linear in the dofs, i.e. with dof independent properties
+                 * and stabilization parameters
+                 */
+                bool is_linear_in_dofs();
+
                 //------------------------------------------------------------------------------
         };
         //------------------------------------------------------------------------------
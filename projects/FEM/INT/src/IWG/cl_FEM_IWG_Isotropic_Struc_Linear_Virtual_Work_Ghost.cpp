@@ -261,6 +261,29 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        bool IWG_Isotropic_Struc_Linear_Virtual_Work_Ghost::is_linear_in_dofs()
+        {
+            // only linear isotropic elasticity
+            const std::shared_ptr< Constitutive_Model >& tLeaderCM = mLeaderCM( static_cast< uint >( IWG_Constitutive_Type::ELAST_LIN_ISO ) );
+
+            if ( tLeaderCM == nullptr or tLeaderCM->get_constitutive_type() != Constitutive_Type::STRUC_LIN_ISO )
+            {
+                return false;
+            }
+
+            const std::shared_ptr< Constitutive_Model >& tFollowerCM = mFollowerCM( static_cast< uint >( IWG_Constitutive_Type::ELAST_LIN_ISO ) );
+
+            if ( tFollowerCM == nullptr or tFollowerCM->get_constitutive_type() != Constitutive_Type::STRUC_LIN_ISO )
+            {
+                return false;
+            }
+
+            // properties, CMs and stabilization parameters only depend on the residual dof type
+            return this->check_linear_dof_dependencies();
+        }
+
+        //------------------------------------------------------------------------------
+
         void IWG_Isotropic_Struc_Linear_Virtual_Work_Ghost::get_flat_normal_matrix(
                        Matrix< DDRMat > & aFlatNormal,
                        uint               aOrder )
@@ -10,6 +10,9 @@
 
 #include "catch.hpp"
 #include "fn_equal_to.hpp"
+#include "fn_norm.hpp"
+#include "fn_inv.hpp"
+#include "op_minus.hpp"
 
 #include "cl_FEM_Geometry_Interpolator.hpp"
 
@@ -62,5 +65,61 @@ namespace moris
             //print( tParamCoordinates, "tParamCoordinates" );
 
         }/* END_TEST_CASE */
+
+        TEST_CASE( "GI_Fixed_Size_Kernels", "[moris],[fem],[GI_fixed_size]" )
+        {
+            // time coefficients
+            Matrix< DDRMat > tTHat = { { 0.0 }, { 1.0 } };
+
+            // distorted QUAD4, TRI3, HEX8 and TET4 cells
+            Cell< mtk::Geometry_Type > tGeometryTypes = {
+                mtk::Geometry_Type::QUAD,
+                mtk::Geometry_Type::TRI,
+                mtk::Geometry_Type::HEX,
+                mtk::Geometry_Type::TET
+            };
+
+            Cell< Matrix< DDRMat > > tXHats = {
+                { { 0.0, 0.0 }, { 1.2, 0.1 }, { 1.0, 0.9 }, { -0.1, 1.1 } },
+                { { 0.0, 0.0 }, { 1.2, 0.1 }, { 0.2, 0.9 } },
+                { { 0.0, 0.0, 0.0 }, { 1.1, 0.1, 0.0 }, { 1.0, 1.2, 0.1 }, { 0.0, 1.0, -0.1 },
+                        { 0.1, 0.0, 1.0 }, { 1.0, 0.0, 1.1 }, { 1.2, 1.1, 0.9 }, { 0.0, 1.0, 1.0 } },
+                { { 0.0, 0.0, 0.0 }, { 1.1, 0.1, 0.0 }, { 0.2, 1.2, 0.1 }, { 0.1, 0.1, 0.9 } }
+            };
+
+            Cell< Matrix< DDRMat > > tParamPoints = {
+                { { 0.3 }, { -0.2 }, { 0.0 } },
+                { { 0.2 }, { 0.3 }, { 0.0 } },
+                { { 0.3 }, { -0.2 }, { 0.1 }, { 0.0 } },
+                { { 0.2 }, { 0.3 }, { 0.1 }, { 0.0 } }
+            };
+
+            for ( uint iCell = 0; iCell < tGeometryTypes.size(); iCell++ )
+            {
+                // create a space time geometry interpolator
+                mtk::Interpolation_Rule tGIRule(
+                        tGeometryTypes( iCell ),
+                        mtk::Interpolation_Type::LAGRANGE,
+                        mtk::Interpolation_Order::LINEAR,
+                        mtk::Interpolation_Type::LAGRANGE,
+                        mtk::Interpolation_Order::LINEAR );
+
+                Geometry_Interpolator tGI( tGIRule );
+
+                tGI.set_coeff( tXHats( iCell ), tTHat );
+                tGI.set_space_time( tParamPoints( iCell ) );
+
+                // reference values from generic matrix operations
+                Matrix< DDRMat > tSpaceJacRef    = tGI.dNdXi() * tXHats( iCell );
+                Matrix< DDRMat > tInvSpaceJacRef = inv( tSpaceJacRef );
+
+                // check space Jacobian and its inverse
+                Matrix< DDRMat > tSpaceJac    = tGI.space_jacobian();
+                Matrix< DDRMat > tInvSpaceJac = tGI.inverse_space_jacobian();
+
+                CHECK( norm( tSpaceJac - tSpaceJacRef ) < 1e-12 * norm( tSpaceJacRef ) );
+                CHECK( norm( tInvSpaceJac - tInvSpaceJacRef ) < 1e-12 * norm( tInvSpaceJacRef ) );
+            }
+        }/* END_TEST_CASE */
     }
 }
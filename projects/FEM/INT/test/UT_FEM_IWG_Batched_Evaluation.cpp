@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * UT_FEM_IWG_Batched_Evaluation.cpp
+ *
+ */
+
+#include <string>
+#include <catch.hpp>
+#include <memory>
+#include "assert.hpp"
+
+#define protected public
+#define private   public
+//FEM//INT//src
+#include "cl_FEM_Field_Interpolator_Manager.hpp"
+#include "cl_FEM_IWG.hpp"
+#include "cl_FEM_Set.hpp"
+#undef protected
+#undef private
+//MTK/src
+#include "cl_MTK_Enums.hpp"
+#include "cl_MTK_Integrator.hpp"
+//LINALG/src
+#include "op_equal_equal.hpp"
+#include "fn_norm.hpp"
+//FEM//INT//src
+#include "cl_FEM_Enums.hpp"
+#include "cl_FEM_Field_Interpolator.hpp"
+#include "cl_FEM_Integration_Point_Batch.hpp"
+#include "cl_FEM_Property.hpp"
+#include "cl_FEM_CM_Factory.hpp"
+#include "cl_FEM_IWG_Factory.hpp"
+#include "FEM_Test_Proxy/cl_FEM_Inputs_for_Elasticity_UT.cpp"
+
+using namespace moris;
+using namespace fem;
+
+/**
+ * evaluates residual and Jacobian of a bulk IWG on a HEX8 element point by point
+ * and batched over all integration points and checks that both agree
+ * @param[ in ] aIWG      IWG to evaluate
+ * @param[ in ] aDofTypes dof types of the IWG
+ * @param[ in ] aDofHat   coefficients of the residual field
+ */
+inline void
+test_IWG_batched_evaluation(
+        std::shared_ptr< IWG >&                           aIWG,
+        const moris::Cell< moris::Cell< MSI::Dof_Type > >& aDofTypes,
+        const Matrix< DDRMat >&                            aDofHat )
+{
+    // define an epsilon environment
+    real tEpsilon = 1.0E-10;
+
+    // space dimension
+    uint tSpaceDim = 3;
+
+    // number of fields of residual dof type
+    uint tNumFields = aDofHat.n_cols();
+
+    // number of dofs of residual dof type
+    int tNumDofs = aDofHat.numel();
+
+    // set a fem set pointer
+    MSI::Equation_Set* tSet = new fem::Set();
+    static_cast< fem::Set* >( tSet )->set_set_type( fem::Element_Type::BULK );
+    aIWG->set_set_pointer( static_cast< fem::Set* >( tSet ) );
+
+    // set size for the set EqnObjDofTypeList
+    aIWG->mSet->mUniqueDofTypeList.resize( 100, MSI::Dof_Type::END_ENUM );
+
+    // set size and populate the set dof type map
+    aIWG->mSet->mUniqueDofTypeMap.set_size( static_cast< int >( MSI::Dof_Type::END_ENUM ) + 1, 1, -1 );
+    aIWG->mSet->mUniqueDofTypeMap( static_cast< int >( aDofTypes( 0 )( 0 ) ) ) = 0;
+
+    // set size and populate the set leader dof type map
+    aIWG->mSet->mLeaderDofTypeMap.set_size( static_cast< int >( MSI::Dof_Type::END_ENUM ) + 1, 1, -1 );
+    aIWG->mSet->mLeaderDofTypeMap( static_cast< int >( aDofTypes( 0 )( 0 ) ) ) = 0;
+
+    // create a space time geometry interpolator for a HEX8
+    mtk::Interpolation_Rule tGIRule( mtk::Geometry_Type::HEX,
+            mtk::Interpolation_Type::LAGRANGE,
+            mtk::Interpolation_Order::LINEAR,
+            mtk::Interpolation_Type::LAGRANGE,
+            mtk::Interpolation_Order::LINEAR );
+
+    Geometry_Interpolator tGI = Geometry_Interpolator( tGIRule );
+
+    // set the coefficients xHat, tHat
+    Matrix< DDRMat > tTHat = { { 0.0 }, { 1.0 } };
+    Matrix< DDRMat > tXHat;
+    fill_xhat_Elast( tXHat, tSpaceDim, 1 );
+    tGI.set_coeff( tXHat, tTHat );
+
+    // create an integration rule and get points and weights
+    mtk::Integration_Rule tIntegrationRule(
+            mtk::Geometry_Type::HEX,
+            mtk::Integration_Type::GAUSS,
+            mtk::Integration_Order::HEX_2x2x2,
+            mtk::Geometry_Type::LINE,
+            mtk::Integration_Type::GAUSS,
+            mtk::Integration_Order::BAR_1 );
+
+    mtk::Integrator tIntegrator( tIntegrationRule );
+
+    Matrix< DDRMat > tIntegPoints;
+    Matrix< DDRMat > tIntegWeights;
+    tIntegrator.get_points( tIntegPoints );
+    tIntegrator.get_weights( tIntegWeights );
+
+    // create the field interpolator for the residual dof type
+    Cell< Field_Interpolator* > tLeaderFIs( 1 );
+    tLeaderFIs( 0 ) = new Field_Interpolator( tNumFields, tGIRule, &tGI, aDofTypes( 0 ) );
+    tLeaderFIs( 0 )->set_coeff( aDofHat );
+
+    // set size and fill the set residual and jacobian assembly map
+    aIWG->mSet->mResDofAssemblyMap.resize( 1 );
+    aIWG->mSet->mResDofAssemblyMap( 0 ) = { { 0, tNumDofs - 1 } };
+    aIWG->mSet->mJacDofAssemblyMap.resize( 1 );
+    aIWG->mSet->mJacDofAssemblyMap( 0 ) = { { 0, tNumDofs - 1 } };
+
+    // set size and init the set residual and jacobian
+    aIWG->mSet->mResidual.resize( 1 );
+    aIWG->mSet->mResidual( 0 ).set_size( tNumDofs, 1, 0.0 );
+    aIWG->mSet->mJacobian.set_size( tNumDofs, tNumDofs, 0.0 );
+
+    // build global dof type list
+    aIWG->get_global_dof_type_list();
+
+    // populate the requested leader dof type
+    aIWG->mRequestedLeaderGlobalDofTypes = aDofTypes;
+
+    // create a field interpolator manager
+    moris::Cell< moris::Cell< enum PDV_Type > >        tDummyDv;
+    moris::Cell< moris::Cell< enum mtk::Field_Type > > tDummyField;
+    Field_Interpolator_Manager                         tFIManager( aDofTypes, tDummyDv, tDummyField, tSet );
+
+    // populate the field interpolator manager
+    tFIManager.mFI                     = tLeaderFIs;
+    tFIManager.mIPGeometryInterpolator = &tGI;
+    tFIManager.mIGGeometryInterpolator = &tGI;
+
+    // set the interpolator manager to the set and the IWG
+    aIWG->mSet->mLeaderFIManager = &tFIManager;
+    aIWG->set_field_interpolator_manager( &tFIManager );
+
+    // check that the IWG can be batched
+    REQUIRE( aIWG->supports_batched_evaluation() );
+
+    uint tNumGPs = tIntegPoints.n_cols();
+
+    // evaluate point by point
+    //------------------------------------------------------------------------------
+    aIWG->mSet->mResidual( 0 ).fill( 0.0 );
+    aIWG->mSet->mJacobian.fill( 0.0 );
+
+    for ( uint iGP = 0; iGP < tNumGPs; iGP++ )
+    {
+        aIWG->reset_eval_flags();
+
+        tFIManager.set_space_time( tIntegPoints.get_column( iGP ) );
+
+        real tWStar = tIntegWeights( iGP ) * tGI.det_J();
+
+        aIWG->compute_residual( tWStar );
+        aIWG->compute_jacobian( tWStar );
+    }
+
+    Matrix< DDRMat > tResidual = aIWG->mSet->mResidual( 0 );
+    Matrix< DDRMat > tJacobian = aIWG->mSet->mJacobian;
+
+    // evaluate batched
+    //------------------------------------------------------------------------------
+    Integration_Point_Batch tBatch;
+
+    aIWG->mSet->mResidual( 0 ).fill( 0.0 );
+    aIWG->mSet->mJacobian.fill( 0.0 );
+
+    tBatch.initialize( tNumGPs );
+
+    aIWG->register_batched_data( tBatch );
+
+    for ( uint iGP = 0; iGP < tNumGPs; iGP++ )
+    {
+        aIWG->reset_eval_flags();
+
+        tFIManager.set_space_time( tIntegPoints.get_column( iGP ) );
+
+        tBatch.set_weight( iGP, tIntegWeights( iGP ) * tGI.det_J() );
+
+        tBatch.collect( iGP );
+    }
+
+    aIWG->compute_residual_batched( tBatch );
+    aIWG->compute_jacobian_batched( tBatch );
+
+    // check that batched and pointwise evaluation agree
+    REQUIRE( norm( aIWG->mSet->mResidual( 0 ) - tResidual ) < tEpsilon * ( 1.0 + norm( tResidual ) ) );
+    REQUIRE( norm( aIWG->mSet->mJacobian - tJacobian ) < tEpsilon * ( 1.0 + norm( tJacobian ) ) );
+
+    // evaluate batched residual only, constitutive matrices are not collected
+    //------------------------------------------------------------------------------
+    aIWG->mSet->mResidual( 0 ).fill( 0.0 );
+
+    tBatch.initialize( tNumGPs, false );
+
+    aIWG->register_batched_data( tBatch );
+
+    for ( uint iGP = 0; iGP < tNumGPs; iGP++ )
+    {
+        aIWG->reset_eval_flags();
+
+        tFIManager.set_space_time( tIntegPoints.get_column( iGP ) );
+
+        tBatch.set_weight( iGP, tIntegWeights( iGP ) * tGI.det_J() );
+
+        tBatch.collect( iGP );
+    }
+
+    aIWG->compute_residual_batched( tBatch );
+
+    REQUIRE( norm( aIWG->mSet->mResidual( 0 ) - tResidual ) < tEpsilon * ( 1.0 + norm( tResidual ) ) );
+
+    // clean up
+    delete tLeaderFIs( 0 );
+    delete tSet;
+}
+
+//------------------------------------------------------------------------------
+
+TEST_CASE( "IWG_Diffusion_Bulk_Batched", "[moris],[fem],[IWG_Diffusion_Bulk_Batched]" )
+{
+    // dof type list
+    moris::Cell< moris::Cell< MSI::Dof_Type > > tTempDofTypes = { { MSI::Dof_Type::TEMP } };
+
+    // create the properties
+    std::shared_ptr< fem::Property > tPropConductivity = std::make_shared< fem::Property >();
+    tPropConductivity->set_parameters( { { { 1.2 } } } );
+    tPropConductivity->set_val_function( tConstValFunc_Elast );
+
+    std::shared_ptr< fem::Property > tPropLoad = std::make_shared< fem::Property >();
+    tPropLoad->set_parameters( { { { 2.0 } } } );
+    tPropLoad->set_val_function( tConstValFunc_Elast );
+
+    // define constitutive model
+    fem::CM_Factory tCMFactory;
+
+    std::shared_ptr< fem::Constitutive_Model > tCMDiffLinIso =
+            tCMFactory.create_CM( fem::Constitutive_Type::DIFF_LIN_ISO );
+    tCMDiffLinIso->set_dof_type_list( tTempDofTypes );
+    tCMDiffLinIso->set_property( tPropConductivity, "Conductivity" );
+    tCMDiffLinIso->set_space_dim( 3 );
+    tCMDiffLinIso->set_local_properties();
+
+    // define the IWG
+    fem::IWG_Factory tIWGFactory;
+
+    std::shared_ptr< fem::IWG > tIWG = tIWGFactory.create_IWG( fem::IWG_Type::SPATIALDIFF_BULK );
+    tIWG->set_residual_dof_type( tTempDofTypes );
+    tIWG->set_dof_type_list( tTempDofTypes, mtk::Leader_Follower::LEADER );
+    tIWG->set_constitutive_model( tCMDiffLinIso, "Diffusion" );
+    tIWG->set_property( tPropLoad, "Load" );
+
+    // temperature coefficients from first displacement component
+    Matrix< DDRMat > tDispHat;
+    fill_uhat_Elast( tDispHat, 3, 1 );
+    Matrix< DDRMat > tTempHat = tDispHat.get_column( 0 );
+
+    test_IWG_batched_evaluation( tIWG, tTempDofTypes, tTempHat );
+}
+
+//------------------------------------------------------------------------------
+
+TEST_CASE( "IWG_Elasticity_Bulk_Batched", "[moris],[fem],[IWG_Elasticity_Bulk_Batched]" )
+{
+    // dof type list
+    moris::Cell< moris::Cell< MSI::Dof_Type > > tDispDofTypes = { { MSI::Dof_Type::UX } };
+
+    // create the properties
+    std::shared_ptr< fem::Property > tPropEMod = std::make_shared< fem::Property >();
+    tPropEMod->set_parameters( { { { 1.0 } } } );
+    tPropEMod->set_val_function( tConstValFunc_Elast );
+
+    std::shared_ptr< fem::Property > tPropNu = std::make_shared< fem::Property >();
+    tPropNu->set_parameters( { { { 0.3 } } } );
+    tPropNu->set_val_function( tConstValFunc_Elast );
+
+    std::shared_ptr< fem::Property > tPropLoad = std::make_shared< fem::Property >();
+    tPropLoad->set_parameters( { { { 1.0 }, { 2.0 }, { 3.0 } } } );
+    tPropLoad->set_val_function( tConstValFunc_Elast );
+
+    std::shared_ptr< fem::Property > tPropBedding = std::make_shared< fem::Property >();
+    tPropBedding->set_parameters( { { { 0.5 } } } );
+    tPropBedding->set_val_function( tConstValFunc_Elast );
+
+    // define constitutive model
+    fem::CM_Factory tCMFactory;
+
+    std::shared_ptr< fem::Constitutive_Model > tCMStrucLinIso =
+            tCMFactory.create_CM( fem::Constitutive_Type::STRUC_LIN_ISO );
+    tCMStrucLinIso->set_dof_type_list( { tDispDofTypes } );
+    tCMStrucLinIso->set_property( tPropEMod, "YoungsModulus" );
+    tCMStrucLinIso->set_property( tPropNu, "PoissonRatio" );
+    tCMStrucLinIso->set_model_type( fem::Model_Type::FULL );
+    tCMStrucLinIso->set_space_dim( 3 );
+    tCMStrucLinIso->set_local_properties();
+
+    // define the IWG
+    fem::IWG_Factory tIWGFactory;
+
+    std::shared_ptr< fem::IWG > tIWG = tIWGFactory.create_IWG( fem::IWG_Type::STRUC_LINEAR_BULK );
+    tIWG->set_residual_dof_type( tDispDofTypes );
+    tIWG->set_dof_type_list( tDispDofTypes, mtk::Leader_Follower::LEADER );
+    tIWG->set_constitutive_model( tCMStrucLinIso, "ElastLinIso" );
+    tIWG->set_property( tPropLoad, "Load" );
+    tIWG->set_property( tPropBedding, "Bedding" );
+
+    // displacement coefficients
+    Matrix< DDRMat > tDispHat;
+    fill_uhat_Elast( tDispHat, 3, 1 );
+
+    test_IWG_batched_evaluation( tIWG, tDispDofTypes, tDispHat );
+}/*END_TEST_CASE*/
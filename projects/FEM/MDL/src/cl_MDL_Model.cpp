@@ -375,7 +375,12 @@ namespace moris
 
                     mSolverWarehouse->set_parameterlist( mSOLParameterList );
 
+                    // pass eigen solver warm starts which persist across iterations
+                    mSolverWarehouse->set_eigen_solver_warm_starts( mEigenSolverWarmStarts );
+
                     mSolverWarehouse->initialize();
+
+                    mEigenSolverWarmStarts = mSolverWarehouse->get_eigen_solver_warm_starts();
                 }
 
                 // set the solver warehouse pointer
@@ -398,6 +403,14 @@ namespace moris
             mOutputManager = new vis::Output_Manager( mVISParameterList( 0 ) );
 
             mOutputManagerOwned = true;
+
+            // pass output file records which persist across iterations
+            if ( mVisFileRecords == nullptr )
+            {
+                mVisFileRecords = std::make_shared< Cell< vis::Output_File_Record > >();
+            }
+
+            mOutputManager->set_file_records( mVisFileRecords );
         }
 
         //------------------------------------------------------------------------------
@@ -34,6 +34,7 @@ namespace moris
     namespace vis
     {
         class Output_Manager;
+        struct Output_File_Record;
     }
 
     namespace fem
@@ -50,6 +51,7 @@ namespace moris
     {
         class Linear_Solver;
         class Linear_Solver_Algorithm;
+        struct Eigen_Solver_Warm_Start;
     }
 
     namespace MSI
@@ -104,6 +106,12 @@ namespace moris
                 vis::Output_Manager * mOutputManager = nullptr;
                 bool mOutputManagerOwned = false;
 
+                // records of vis output files, kept across iterations to append to files with unchanged topology
+                std::shared_ptr< Cell< vis::Output_File_Record > > mVisFileRecords = nullptr;
+
+                // eigenvectors of the eigen solvers, kept across iterations to warm start the rebuilt solvers
+                Cell< std::shared_ptr< dla::Eigen_Solver_Warm_Start > > mEigenSolverWarmStarts;
+
                 // bool for multigrid use
                 bool mUseMultigrid = false;
 
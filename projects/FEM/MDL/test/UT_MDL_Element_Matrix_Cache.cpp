@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * UT_MDL_Element_Matrix_Cache.cpp
+ *
+ */
+
+#include "catch.hpp"
+
+#include "typedefs.hpp"
+#include "cl_Communication_Tools.hpp"
+
+#include "cl_MTK_Mesh_Manager.hpp"
+
+#include "cl_Matrix.hpp"    //LINALG
+#include "linalg_typedefs.hpp"
+#include "fn_norm.hpp"
+#include "op_minus.hpp"
+
+#include "cl_FEM_IWG_Factory.hpp"                   //FEM/INT/src
+#include "cl_FEM_IQI_Factory.hpp"                   //FEM/INT/src
+#include "cl_FEM_CM_Factory.hpp"                    //FEM/INT/src
+#include "cl_FEM_Set_User_Info.hpp"                 //FEM/INT/src
+#include "cl_FEM_Set.hpp"                           //FEM/INT/src
+#include "cl_FEM_Field_Interpolator_Manager.hpp"    //FEM/INT/src
+#include "cl_FEM_Geometry_Interpolator.hpp"         //FEM/INT/src
+
+#include "cl_MDL_Model.hpp"
+
+#include "cl_HMR.hpp"
+#include "cl_HMR_Mesh_Interpolation.hpp"
+#include "cl_HMR_Mesh_Integration.hpp"
+#include "cl_HMR_Parameters.hpp"
+
+#include "cl_DLA_Solver_Factory.hpp"
+#include "cl_DLA_Linear_Solver.hpp"
+
+#include "cl_NLA_Nonlinear_Solver_Factory.hpp"
+#include "cl_NLA_Nonlinear_Solver.hpp"
+#include "cl_NLA_Nonlinear_Algorithm.hpp"
+#include "cl_MSI_Solver_Interface.hpp"
+#include "cl_MSI_Equation_Model.hpp"
+
+#include "cl_TSA_Time_Solver_Factory.hpp"
+#include "cl_TSA_Monolithic_Time_Solver.hpp"
+#include "cl_TSA_Time_Solver.hpp"
+#include "cl_SOL_Warehouse.hpp"
+#include "cl_SOL_Dist_Vector.hpp"
+
+namespace moris
+{
+    // constant property
+    inline void
+    tPropConstFunc_MDLCache(
+            moris::Matrix< moris::DDRMat >&                aPropMatrix,
+            moris::Cell< moris::Matrix< moris::DDRMat > >& aParameters,
+            moris::fem::Field_Interpolator_Manager*        aFIManager )
+    {
+        aPropMatrix = aParameters( 0 );
+    }
+
+    // property growing linearly in time
+    inline void
+    tPropTimeFunc_MDLCache(
+            moris::Matrix< moris::DDRMat >&                aPropMatrix,
+            moris::Cell< moris::Matrix< moris::DDRMat > >& aParameters,
+            moris::fem::Field_Interpolator_Manager*        aFIManager )
+    {
+        real tTime  = aFIManager->get_IP_geometry_interpolator()->valt()( 0 );
+        aPropMatrix = aParameters( 0 ) * tTime;
+    }
+
+    /**
+     * solves two time steps of a transient diffusion problem with a time dependent Neumann load
+     * and returns the solution vectors of both time steps and the number of sets using the cache
+     */
+    void
+    solve_transient_diffusion_MDLCache(
+            bool                             aCacheElementMatrices,
+            moris::Cell< Matrix< DDRMat > >& aSolutions,
+            uint&                            aNumCachedSets )
+    {
+        // 4x4 elements on the unit square
+        moris::hmr::Parameters tParameters;
+
+        tParameters.set_number_of_elements_per_dimension( { { 1 }, { 1 } } );
+        tParameters.set_domain_dimensions( 1, 1 );
+        tParameters.set_domain_offset( 0.0, 0.0 );
+        tParameters.set_side_sets( { { 1 }, { 2 }, { 3 }, { 4 } } );
+
+        tParameters.set_bspline_truncation( true );
+        tParameters.set_lagrange_orders( { { 1 } } );
+        tParameters.set_lagrange_patterns( { { 0 } } );
+        tParameters.set_bspline_orders( { { 1 } } );
+        tParameters.set_bspline_patterns( { { 0 } } );
+
+        tParameters.set_output_meshes( { { { 0 } } } );
+
+        tParameters.set_staircase_buffer( 1 );
+        tParameters.set_initial_refinement( { { 2 } } );
+        tParameters.set_initial_refinement_patterns( { { 0 } } );
+        tParameters.set_number_aura( true );
+
+        Cell< Matrix< DDSMat > > tLagrangeToBSplineMesh( 1 );
+        tLagrangeToBSplineMesh( 0 ) = { { 0 } };
+
+        tParameters.set_lagrange_to_bspline_mesh( tLagrangeToBSplineMesh );
+
+        moris::hmr::HMR tHMR( tParameters );
+
+        tHMR.perform_initial_refinement();
+
+        tHMR.finalize();
+
+        moris::hmr::Interpolation_Mesh_HMR* tIPMesh = tHMR.create_interpolation_mesh( 0 );
+        moris::hmr::Integration_Mesh_HMR*   tIGMesh = tHMR.create_integration_mesh( 1, 0, tIPMesh );
+
+        std::shared_ptr< mtk::Mesh_Manager > tMeshManager = std::make_shared< mtk::Mesh_Manager >();
+        tMeshManager->register_mesh_pair( tIPMesh, tIGMesh );
+
+        //------------------------------------------------------------------------------
+        // bulk properties are declared constant in time, the Neumann load is not
+        std::shared_ptr< fem::Property > tPropConductivity = std::make_shared< fem::Property >();
+        tPropConductivity->set_parameters( { { { 1.0 } } } );
+        tPropConductivity->set_val_function( tPropConstFunc_MDLCache );
+        tPropConductivity->set_time_dependent( false );
+
+        std::shared_ptr< fem::Property > tPropDensity = std::make_shared< fem::Property >();
+        tPropDensity->set_parameters( { { { 1.0 } } } );
+        tPropDensity->set_val_function( tPropConstFunc_MDLCache );
+        tPropDensity->set_time_dependent( false );
+
+        std::shared_ptr< fem::Property > tPropHeatCapacity = std::make_shared< fem::Property >();
+        tPropHeatCapacity->set_parameters( { { { 1.0 } } } );
+        tPropHeatCapacity->set_val_function( tPropConstFunc_MDLCache );
+        tPropHeatCapacity->set_time_dependent( false );
+
+        std::shared_ptr< fem::Property > tPropNeumann = std::make_shared< fem::Property >();
+        tPropNeumann->set_parameters( { { { 100.0 } } } );
+        tPropNeumann->set_val_function( tPropTimeFunc_MDLCache );
+
+        std::shared_ptr< fem::Property > tPropInitCondition = std::make_shared< fem::Property >();
+        tPropInitCondition->set_parameters( { { { 0.0 } } } );
+
+        std::shared_ptr< fem::Property > tPropWeightCurrent = std::make_shared< fem::Property >();
+        tPropWeightCurrent->set_parameters( { { { 100.0 } } } );
+
+        std::shared_ptr< fem::Property > tPropWeightPrevious = std::make_shared< fem::Property >();
+        tPropWeightPrevious->set_parameters( { { { 100.0 } } } );
+
+        fem::CM_Factory tCMFactory;
+
+        std::shared_ptr< fem::Constitutive_Model > tCMDiffusion =
+                tCMFactory.create_CM( fem::Constitutive_Type::DIFF_LIN_ISO );
+        tCMDiffusion->set_dof_type_list( { { MSI::Dof_Type::TEMP } } );
+        tCMDiffusion->set_property( tPropConductivity, "Conductivity" );
+        tCMDiffusion->set_space_dim( 2 );
+        tCMDiffusion->set_local_properties();
+
+        fem::IWG_Factory tIWGFactory;
+
+        std::shared_ptr< fem::IWG > tIWGDiffusionBulk =
+                tIWGFactory.create_IWG( fem::IWG_Type::SPATIALDIFF_BULK );
+        tIWGDiffusionBulk->set_residual_dof_type( { { MSI::Dof_Type::TEMP } } );
+        tIWGDiffusionBulk->set_dof_type_list( { { MSI::Dof_Type::TEMP } } );
+        tIWGDiffusionBulk->set_constitutive_model( tCMDiffusion, "Diffusion", mtk::Leader_Follower::LEADER );
+        tIWGDiffusionBulk->set_property( tPropDensity, "Density", mtk::Leader_Follower::LEADER );
+        tIWGDiffusionBulk->set_property( tPropHeatCapacity, "HeatCapacity", mtk::Leader_Follower::LEADER );
+
+        std::shared_ptr< fem::IWG > tIWGNeumann =
+                tIWGFactory.create_IWG( fem::IWG_Type::SPATIALDIFF_NEUMANN );
+        tIWGNeumann->set_residual_dof_type( { { MSI::Dof_Type::TEMP } } );
+        tIWGNeumann->set_dof_type_list( { { MSI::Dof_Type::TEMP } } );
+        tIWGNeumann->set_property( tPropNeumann, "Neumann", mtk::Leader_Follower::LEADER );
+
+        std::shared_ptr< fem::IWG > tIWGTimeContinuity =
+                tIWGFactory.create_IWG( fem::IWG_Type::TIME_CONTINUITY_DOF );
+        tIWGTimeContinuity->set_residual_dof_type( { { MSI::Dof_Type::TEMP } } );
+        tIWGTimeContinuity->set_dof_type_list( { { MSI::Dof_Type::TEMP } } );
+        tIWGTimeContinuity->set_property( tPropWeightCurrent, "WeightCurrent", mtk::Leader_Follower::LEADER );
+        tIWGTimeContinuity->set_property( tPropWeightPrevious, "WeightPrevious", mtk::Leader_Follower::LEADER );
+        tIWGTimeContinuity->set_property( tPropInitCondition, "InitialCondition", mtk::Leader_Follower::LEADER );
+
+        moris::Cell< fem::Set_User_Info > tSetInfo( 3 );
+
+        tSetInfo( 0 ).set_mesh_index( 0 );
+        tSetInfo( 0 ).set_IWGs( { tIWGDiffusionBulk } );
+
+        tSetInfo( 1 ).set_mesh_index( 2 );
+        tSetInfo( 1 ).set_IWGs( { tIWGNeumann } );
+
+        tSetInfo( 2 ).set_mesh_index( 0 );
+        tSetInfo( 2 ).set_time_continuity( true );
+        tSetInfo( 2 ).set_IWGs( { tIWGTimeContinuity } );
+
+        for ( fem::Set_User_Info& tInfo : tSetInfo )
+        {
+            tInfo.set_cache_linear_element_matrices( aCacheElementMatrices );
+        }
+
+        mdl::Model* tModel = new mdl::Model( tMeshManager, 0, tSetInfo );
+
+        //------------------------------------------------------------------------------
+        dla::Solver_Factory tSolFactory;
+
+        std::shared_ptr< dla::Linear_Solver_Algorithm > tLinearSolverAlgorithm =
+                tSolFactory.create_solver( sol::SolverType::AMESOS_IMPL );
+
+        dla::Linear_Solver tLinSolver;
+        tLinSolver.set_linear_algorithm( 0, tLinearSolverAlgorithm );
+
+        NLA::Nonlinear_Solver_Factory tNonlinFactory;
+
+        std::shared_ptr< NLA::Nonlinear_Algorithm > tNonlinearSolverAlgorithm =
+                tNonlinFactory.create_nonlinear_solver( NLA::NonlinearSolverType::NEWTON_SOLVER );
+        tNonlinearSolverAlgorithm->set_linear_solver( &tLinSolver );
+
+        // a second Newton iteration evaluates the residual from the cached element matrices
+        tNonlinearSolverAlgorithm->set_param( "NLA_max_iter" )          = 2;
+        tNonlinearSolverAlgorithm->set_param( "NLA_rel_res_norm_drop" ) = 1e-14;
+
+        NLA::Nonlinear_Solver tNonlinearSolver;
+        tNonlinearSolver.set_nonlinear_algorithm( tNonlinearSolverAlgorithm, 0 );
+
+        tsa::Time_Solver_Factory tTimeSolverFactory;
+
+        std::shared_ptr< tsa::Time_Solver_Algorithm > tTimeSolverAlgorithm =
+                tTimeSolverFactory.create_time_solver( tsa::TimeSolverType::MONOLITHIC );
+
+        tTimeSolverAlgorithm->set_nonlinear_solver( &tNonlinearSolver );
+        tTimeSolverAlgorithm->set_param( "TSA_Num_Time_Steps" ) = 2;
+        tTimeSolverAlgorithm->set_param( "TSA_Time_Frame" )     = 1.0;
+
+        tsa::Time_Solver tTimeSolver;
+        tTimeSolver.set_time_solver_algorithm( tTimeSolverAlgorithm );
+        tTimeSolver.set_param( "TSA_Initialize_Sol_Vec" )  = "TEMP,0.0";
+        tTimeSolver.set_param( "TSA_time_level_per_type" ) = "TEMP,2";
+
+        sol::SOL_Warehouse tSolverWarehouse;
+        tSolverWarehouse.set_solver_interface( tModel->get_solver_interface() );
+
+        tNonlinearSolver.set_solver_warehouse( &tSolverWarehouse );
+        tTimeSolver.set_solver_warehouse( &tSolverWarehouse );
+
+        tNonlinearSolver.set_dof_type_list( { { MSI::Dof_Type::TEMP } } );
+        tTimeSolver.set_dof_type_list( { { MSI::Dof_Type::TEMP } } );
+
+        tTimeSolver.solve();
+
+        // solution vectors of the initial condition and the two time steps
+        moris::Cell< sol::Dist_Vector* >& tSolutionVectors = tTimeSolver.get_solution_vectors();
+
+        REQUIRE( tSolutionVectors.size() >= 3 );
+
+        aSolutions.resize( 2 );
+        tSolutionVectors( 1 )->extract_copy( aSolutions( 0 ) );
+        tSolutionVectors( 2 )->extract_copy( aSolutions( 1 ) );
+
+        // count the sets reusing their element matrices
+        aNumCachedSets = 0;
+
+        for ( MSI::Equation_Set* tEquationSet : tModel->get_fem_model()->get_equation_sets() )
+        {
+            aNumCachedSets += static_cast< fem::Set* >( tEquationSet )->use_element_matrix_cache() ? 1 : 0;
+        }
+
+        // only the bulk IWG qualifies, the Neumann load depends on time
+        CHECK( tIWGDiffusionBulk->is_linear_in_dofs() );
+        CHECK( !tIWGNeumann->is_linear_in_dofs() );
+
+        delete tModel;
+        delete tIPMesh;
+        delete tIGMesh;
+    }
+
+    TEST_CASE( "MDL Element Matrix Cache", "[MDL_Element_Matrix_Cache]" )
+    {
+        if ( par_size() == 1 )
+        {
+            moris::Cell< Matrix< DDRMat > > tSolutions;
+            moris::Cell< Matrix< DDRMat > > tCachedSolutions;
+
+            uint tNumCachedSets       = 0;
+            uint tNumCachedSetsCached = 0;
+
+            solve_transient_diffusion_MDLCache( false, tSolutions, tNumCachedSets );
+            solve_transient_diffusion_MDLCache( true, tCachedSolutions, tNumCachedSetsCached );
+
+            // the cache is only used if requested and then only on the bulk set
+            CHECK( tNumCachedSets == 0 );
+            CHECK( tNumCachedSetsCached == 1 );
+
+            // residuals and jacobians from the cache give the same solution in both time steps
+            for ( uint iStep = 0; iStep < 2; iStep++ )
+            {
+                REQUIRE( tSolutions( iStep ).numel() == tCachedSolutions( iStep ).numel() );
+
+                CHECK( norm( tSolutions( iStep ) - tCachedSolutions( iStep ) ) < 1e-12 * std::max( norm( tSolutions( iStep ) ), 1.0 ) );
+            }
+
+            // the time dependent load changes the solution between the time steps
+            CHECK( norm( tSolutions( 1 ) - tSolutions( 0 ) ) > 1e-6 );
+        }
+    }
+}    // namespace moris
@@ -16,6 +16,7 @@
 #include "cl_MSI_Pdof_Host.hpp"
 
 #include "fn_sort.hpp"
+#include "fn_MSI_reverse_cuthill_mckee.hpp"
 
 extern moris::Comm_Manager gMorisComm;
 
@@ -683,7 +684,20 @@ namespace moris
         {
             ParameterList& tParameterlist = mModelSolverInterface->get_msi_parameterlist();
 
-            if ( tParameterlist.get< bool >( "order_adofs_by_host" ) )
+            std::string tAdofOrdering = tParameterlist.get< std::string >( "adof_ordering" );
+
+            MORIS_ERROR( tAdofOrdering.empty() or tAdofOrdering == "rcm",
+                    "Dof_Manager::set_owned_adofs_ids(), unknown adof ordering '%s'",
+                    tAdofOrdering.c_str() );
+
+            mSortOwnedAdofIds = false;
+
+            if ( tAdofOrdering == "rcm" )
+            {
+                MORIS_LOG_INFO( "Setting adofs in reverse Cuthill-McKee order" );
+                this->set_owned_adofs_ids_by_rcm( aAdofListofTypes, aAdofOffsets );
+            }
+            else if ( tParameterlist.get< bool >( "order_adofs_by_host" ) )
             {
                 MORIS_LOG_INFO( "Setting adofs by host" );
                 this->set_owned_adofs_ids_by_host( aAdofListofTypes, aAdofOffsets );
@@ -786,6 +800,106 @@ namespace moris
             }
         }
 
+        //-----------------------------------------------------------------------------------------------------------
+        void
+        Dof_Manager::set_owned_adofs_ids_by_rcm(
+                const moris::Cell< moris::Cell< Adof* > >& aAdofListofTypes,
+                const uint&                                aAdofOffsets )
+        {
+            // fill adof lists by type. The ids are used as local indices of the owned adofs until they are reordered
+            this->set_owned_adofs_ids_by_type( aAdofListofTypes, 0 );
+
+            uint tNumEqnObjs = mModelSolverInterface->get_num_eqn_objs();
+
+            // calls aFunction for every owned adof of an equation object
+            auto tForEachOwnedAdof = [ & ]( uint aEqnObj, auto&& aFunction ) {
+                const moris::Cell< moris::Cell< Pdof_Host* > >& tPdofHosts =
+                        mModelSolverInterface->get_eqn_obj( aEqnObj )->get_pdof_hosts();
+
+                for ( uint Ia = 0; Ia < tPdofHosts.size(); Ia++ )
+                {
+                    for ( uint Ib = 0; Ib < tPdofHosts( Ia ).size(); Ib++ )
+                    {
+                        moris::Cell< moris::Cell< Pdof* > >& tPdofs = tPdofHosts( Ia )( Ib )->get_pdof_hosts_pdof_list();
+
+                        for ( uint Ic = 0; Ic < tPdofs.size(); Ic++ )
+                        {
+                            for ( uint Id = 0; Id < tPdofs( Ic ).size(); Id++ )
+                            {
+                                Pdof* tPdof     = tPdofs( Ic )( Id );
+                                uint  tNumAdofs = tPdof->get_num_adofs();
+
+                                if ( tNumAdofs == 0 )
+                                {
+                                    continue;
+                                }
+
+                                Adof* const* tAdofs = tPdof->mAdofMap->get_adofs( tPdof->mAdofMapRow );
+
+                                for ( uint Ie = 0; Ie < tNumAdofs; Ie++ )
+                                {
+                                    if ( tAdofs[ Ie ]->get_adof_owning_processor() == par_rank() )
+                                    {
+                                        aFunction( tAdofs[ Ie ]->get_adof_id() );
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            };
+
+            // every equation object couples its owned adofs
+            moris::Cell< uint > tCliqueOffsets( tNumEqnObjs + 1, 0 );
+
+            for ( uint Ii = 0; Ii < tNumEqnObjs; Ii++ )
+            {
+                uint tNumEntries = 0;
+
+                tForEachOwnedAdof( Ii, [ &tNumEntries ]( uint ) { tNumEntries++; } );
+
+                tCliqueOffsets( Ii + 1 ) = tCliqueOffsets( Ii ) + tNumEntries;
+            }
+
+            moris::Cell< uint > tCliqueAdofs( tCliqueOffsets( tNumEqnObjs ) );
+
+            for ( uint Ii = 0; Ii < tNumEqnObjs; Ii++ )
+            {
+                uint tEntry = tCliqueOffsets( Ii );
+
+                tForEachOwnedAdof( Ii, [ &tCliqueAdofs, &tEntry ]( uint aAdof ) { tCliqueAdofs( tEntry++ ) = aAdof; } );
+            }
+
+            // compute new position of every owned adof
+            moris::Cell< uint > tPositions = reverse_cuthill_mckee( mNumOwnedAdofs, tCliqueOffsets, tCliqueAdofs );
+
+            // report local bandwidth before and after reordering
+            moris::Cell< uint > tInitialPositions( mNumOwnedAdofs );
+
+            for ( uint Ii = 0; Ii < mNumOwnedAdofs; Ii++ )
+            {
+                tInitialPositions( Ii ) = Ii;
+            }
+
+            MORIS_LOG_INFO( "Local adof bandwidth: %u by type, %u reverse Cuthill-McKee",
+                    compute_clique_bandwidth( tCliqueOffsets, tCliqueAdofs, tInitialPositions ),
+                    compute_clique_bandwidth( tCliqueOffsets, tCliqueAdofs, tPositions ) );
+
+            // set final adof ids
+            for ( uint Ij = 0; Ij < mAdofListOwned.size(); Ij++ )
+            {
+                for ( uint Ib = 0; Ib < mAdofListOwned( Ij ).size(); Ib++ )
+                {
+                    Adof* tAdof = mAdofListOwned( Ij )( Ib );
+
+                    tAdof->set_adof_id( aAdofOffsets + tPositions( tAdof->get_adof_id() ) );
+                }
+            }
+
+            // solver maps follow the new ordering
+            mSortOwnedAdofIds = true;
+        }
+
         //-----------------------------------------------------------------------------------------------------------
 
         void
@@ -846,10 +960,22 @@ namespace moris
                 tAdofListofTypes( Ik ).resize( tMaxNodeAdofId, nullptr );
             }
 
+            // count pdofs and their adofs to allocate the pdof-adof map at once
+            uint tNumPdofs       = 0;
+            uint tNumPdofEntries = 0;
+
+            for ( uint Ii = 0; Ii < tNumPdofHosts; Ii++ )
+            {
+                tNumPdofs += mPdofHostList( Ii )->get_num_pdofs();
+                tNumPdofEntries += mPdofHostList( Ii )->count_adofs( mModelSolverInterface, mUseHMR );
+            }
+
+            mPdofAdofMap.initialize( tNumPdofs, tNumPdofEntries );
+
             // Loop over all pdof hosts and get the adofs
             for ( uint Ii = 0; Ii < tNumPdofHosts; Ii++ )
             {
-                mPdofHostList( Ii )->get_adofs( mTimeLevelOffsets, tAdofListofTypes, mModelSolverInterface, mUseHMR );
+                mPdofHostList( Ii )->get_adofs( mTimeLevelOffsets, tAdofListofTypes, mModelSolverInterface, mUseHMR, mPdofAdofMap );
             }
 
             // Check if shared adof exists
@@ -965,15 +1091,8 @@ namespace moris
                 }
             }
 
-            // Tell pdofs to get adof Ids
-            for ( uint Ij = 0; Ij < tNumPdofHosts; Ij++ )
-            {
-                // all pdofs of this pdof host will ask for their adof Ids
-                mPdofHostList( Ij )->get_adofs_ids();
-
-                // create unique adof list for this pdof host
-                // mPdofHostList(Ij)->create_unique_adof_list();
-            }
+            // replace adof pointers of all pdofs by adof Ids
+            mPdofAdofMap.set_adof_ids_from_adofs();
         }
 
         //-----------------------------------------------------------------------------------------------------------
@@ -989,6 +1108,22 @@ namespace moris
                 // all pdofs of this pdof host will ask for their t matrix
                 mPdofHostList( Ij )->set_t_matrix( mUseHMR, mModelSolverInterface );
             }
+
+            // memory of the pdof-adof map compared to storing ids and weights in separate matrices per pdof
+            uint tNumPdofs   = mPdofAdofMap.get_num_rows();
+            uint tNumEntries = mPdofAdofMap.get_num_entries();
+
+            real tMapMemory = mPdofAdofMap.get_memory_usage() / 1.0e6;
+            real tPerPdofMemory =
+                    ( tNumPdofs * ( sizeof( Matrix< DDSMat > ) + sizeof( Matrix< DDRMat > ) + sizeof( moris::Cell< Adof* > ) )
+                            + tNumEntries * ( sizeof( moris_id ) + sizeof( real ) ) )
+                    / 1.0e6;
+
+            MORIS_LOG_INFO( "Pdof-adof map: %u pdofs, %u entries, %.3f MB ( %.3f MB with per pdof storage )",
+                    tNumPdofs,
+                    tNumEntries,
+                    tMapMemory,
+                    tPerPdofMemory );
         }
 
         //-----------------------------------------------------------------------------------------------------------
@@ -1014,6 +1149,16 @@ namespace moris
                         "Dof_Manager::get_local_adof_ids(): Adof Id list not initialized correctly " );
             }
 
+            // owned adofs have been reordered, the local order of the solver maps follows the ids
+            if ( mSortOwnedAdofIds )
+            {
+                Matrix< DDSMat > tLocalAdofIdsSorted;
+
+                sort( tLocalAdofIds, tLocalAdofIdsSorted );
+
+                return tLocalAdofIdsSorted;
+            }
+
             return tLocalAdofIds;
         }
 
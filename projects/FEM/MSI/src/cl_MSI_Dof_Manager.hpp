@@ -15,7 +15,9 @@
 #include "cl_Communication_Tools.hpp"
 #include "cl_Communication_Manager.hpp"
 #include "cl_MSI_Equation_Object.hpp"
+#include "cl_MSI_Pdof_Adof_Map.hpp"
 #include "cl_Map.hpp"
+#include "cl_Sorted_Map.hpp"
 #include "fn_sum.hpp"
 
 namespace moris
@@ -31,6 +33,9 @@ namespace moris
             moris::Cell< Pdof_Host* >           mPdofHostList;              // List of all pdof hosts
             moris::Cell< Adof* >                mAdofList;                  // List of all adofs
 
+            // adof ids and T-matrix weights of all pdofs, one row per pdof
+            Pdof_Adof_Map mPdofAdofMap;
+
             // outer cell : type-time identifier of adof, inner cell: local index of the adof
             moris::Cell< moris::Cell< Adof* > > mAdofListOwned;    // List of all owned adofs
             // outer cell : type-time identifier of adof, inner cell: local index of the adof
@@ -48,7 +53,8 @@ namespace moris
             // outer cell : discretization mesh index
             // inner map: key[first] : adof external id,  value[second] adof id 
             // note: adof external id is "one-based" index system while adof id is zero-based
-            Cell< moris::map< moris::moris_id, moris::moris_index > > mAdofGlobaltoLocalMap;
+            // the maps are built once and stored as sorted arrays for the lookups during communication
+            Cell< moris::Sorted_Map< moris::moris_id, moris::moris_index > > mAdofGlobaltoLocalMap;
 
             moris::sint mNumMaxAdofs   = -1;
             moris::uint mNumOwnedAdofs = 0;
@@ -57,6 +63,9 @@ namespace moris
 
             bool mUseHMR = false;
 
+            // owned adof ids are sorted for the solver maps if they have been reordered
+            bool mSortOwnedAdofIds = false;
+
             // List containing the number of time levels per dof type.
             // FIXME
             Matrix< DDUMat > mTimePerDofType;
@@ -155,7 +164,7 @@ namespace moris
 
             //------------------------------------------------------------------------------
             /**
-             * @brief Function calling the routine to set the owned Adof Ids. Options are ordered by type or ordered by host
+             * @brief Function calling the routine to set the owned Adof Ids. Options are ordered by type, ordered by host or reverse Cuthill-McKee
              *
              * @param[in] tAdofListofTypes A temporary list containing a list of adofs for every doftype and timelevel.
              * @param[in] aAdofOffsets     Adof offsets for this processor.
@@ -190,6 +199,19 @@ namespace moris
                     const moris::Cell< moris::Cell< Adof* > >& aAdofListofTypes,
                     const uint&                                aAdofOffsets );
 
+            //------------------------------------------------------------------------------
+            /**
+             * @brief Function setting the Adof Ids in reverse Cuthill-McKee order of the owned adofs coupled by the equation objects.
+             *        Reduces the bandwidth of the system matrix on this processor. Adof lists are filled as by type.
+             *
+             * @param[in] tAdofListofTypes A temporary list containing a list of adofs for every doftype and timelevel.
+             * @param[in] aAdofOffsets     Adof offsets for this processor.
+             *
+             */
+            void set_owned_adofs_ids_by_rcm(
+                    const moris::Cell< moris::Cell< Adof* > >& aAdofListofTypes,
+                    const uint&                                aAdofOffsets );
+
             //------------------------------------------------------------------------------
 
             void get_descretization_index_for_adof_list_of_types(
@@ -222,11 +244,42 @@ namespace moris
             set_adof_map( const moris::map< moris::moris_id, moris::moris_index >* aAdofLocaltoGlobalMap )
             {
                 mAdofGlobaltoLocalMap.resize( 1 );
-                mAdofGlobaltoLocalMap( 0 ) = *aAdofLocaltoGlobalMap;
+                this->set_adof_map( 0, *aAdofLocaltoGlobalMap );
+            }
+
+            //-----------------------------------------------------------------------------------------------------------
+            /**
+             * @brief sets the adof id to index map of a discretization
+             *
+             * @param[in] aDiscretizationIndex  Discretization mesh index
+             * @param[in] aAdofMap              Map from adof external ids to adof ids
+             */
+            void
+            set_adof_map(
+                    const moris::uint                                        aDiscretizationIndex,
+                    const moris::map< moris::moris_id, moris::moris_index >& aAdofMap )
+            {
+                if ( mAdofGlobaltoLocalMap.size() <= aDiscretizationIndex )
+                {
+                    mAdofGlobaltoLocalMap.resize( aDiscretizationIndex + 1 );
+                }
+
+                moris::Sorted_Map< moris::moris_id, moris::moris_index >& tAdofMap = mAdofGlobaltoLocalMap( aDiscretizationIndex );
+
+                tAdofMap.clear();
+                tAdofMap.reserve( aAdofMap.size() );
+
+                // keys of moris::map are sorted, thus every entry is appended
+                for ( const auto& tPair : aAdofMap )
+                {
+                    tAdofMap[ tPair.first ] = tPair.second;
+                }
+
+                tAdofMap.shrink_to_fit();
             }
 
             //-----------------------------------------------------------------------------------------------------------
-            Cell< moris::map< moris::moris_id, moris::moris_index > >&
+            Cell< moris::Sorted_Map< moris::moris_id, moris::moris_index > >&
             get_adof_map()
             {
                 return mAdofGlobaltoLocalMap;
@@ -17,6 +17,7 @@
 #include "cl_MSI_Equation_Model.hpp"
 #include "cl_FEM_Node_Base.hpp"
 #include "cl_SOL_Dist_Vector.hpp"
+#include "cl_SOL_Dist_Map.hpp"
 
 #include "fn_isfinite.hpp"
 
@@ -208,7 +209,7 @@ namespace moris
                 for ( uint Ij = 0; Ij < tNumMyPdofs; Ij++ )
                 {
                     // Get Number of adofs corresponding to this pdof
-                    uint tNumAdofForThisPdof = ( mFreePdofs( Ij )->mAdofIds ).numel();
+                    uint tNumAdofForThisPdof = mFreePdofs( Ij )->get_num_adofs();
                     tNumMyAdofs              = tNumMyAdofs + tNumAdofForThisPdof;
                 }
 
@@ -220,15 +221,20 @@ namespace moris
                 // Loop over all pdofs to get their adofs and put them into a unique list
                 for ( uint Ij = 0; Ij < tNumMyPdofs; Ij++ )
                 {
-                    tNonUniqueAdofIds( { tAdofPosCounter, tAdofPosCounter + ( mFreePdofs( Ij )->mAdofIds ).numel() - 1 }, { 0, 0 } ) =
-                            mFreePdofs( Ij )->mAdofIds.matrix_data();
+                    uint            tNumAdofForThisPdof = mFreePdofs( Ij )->get_num_adofs();
+                    const moris_id* tAdofIds            = mFreePdofs( Ij )->get_adof_ids();
 
-                    // Add number if these adofs to number of assembled adofs
-                    tAdofPosCounter = tAdofPosCounter + ( mFreePdofs( Ij )->mAdofIds ).numel();
+                    for ( uint Ik = 0; Ik < tNumAdofForThisPdof; Ik++ )
+                    {
+                        tNonUniqueAdofIds( tAdofPosCounter++ ) = tAdofIds[ Ik ];
+                    }
                 }
 
                 // make list of unique Ids
                 moris::unique( tNonUniqueAdofIds, mUniqueAdofList );
+
+                // local indices have to be recomputed
+                mUniqueAdofLocalIndices.clear();
             }
 
             //---------------------------------------------------------------------------
@@ -252,7 +258,7 @@ namespace moris
                     for ( uint Ij = 0; Ij < tNumMyPdofs; Ij++ )
                     {
                         // Get Number of adofs corresponding to this pdof
-                        uint tNumAdofForThisPdof = ( mFreePdofList( Ia )( Ik )( Ij )->mAdofIds ).numel();
+                        uint tNumAdofForThisPdof = mFreePdofList( Ia )( Ik )( Ij )->get_num_adofs();
                         tNumMyAdofs += tNumAdofForThisPdof;
                     }
 
@@ -264,13 +270,13 @@ namespace moris
                     // Loop over all pdofs to get their adofs and put them into a unique list
                     for ( uint Ij = 0; Ij < tNumMyPdofs; Ij++ )
                     {
-                        uint tEndAddress = tAdofPosCounter + ( mFreePdofList( Ia )( Ik )( Ij )->mAdofIds ).numel() - 1;
-
-                        tNonUniqueAdofIds( { tAdofPosCounter, tEndAddress } ) =
-                                mFreePdofList( Ia )( Ik )( Ij )->mAdofIds.matrix_data();
+                        uint            tNumAdofForThisPdof = mFreePdofList( Ia )( Ik )( Ij )->get_num_adofs();
+                        const moris_id* tAdofIds            = mFreePdofList( Ia )( Ik )( Ij )->get_adof_ids();
 
-                        // Add number if these adofs to number of assembled adofs
-                        tAdofPosCounter += ( mFreePdofList( Ia )( Ik )( Ij )->mAdofIds ).numel();
+                        for ( uint Ib = 0; Ib < tNumAdofForThisPdof; Ib++ )
+                        {
+                            tNonUniqueAdofIds( tAdofPosCounter++ ) = tAdofIds[ Ib ];
+                        }
                     }
 
                     // make list of unique Ids
@@ -287,6 +293,8 @@ namespace moris
         void
         Equation_Object::set_unique_adof_map()
         {
+            mUniqueAdofMap.reserve( mUniqueAdofList.numel() );
+
             // Loop over all unique adofs of this equation object
             for ( uint Ii = 0; Ii < mUniqueAdofList.numel(); Ii++ )
             {
@@ -311,6 +319,8 @@ namespace moris
                 {
                     uint tNumUniqueAdofs = mUniqueAdofTypeList( Ij )( Ii ).numel();
 
+                    mUniqueAdofMapList( Ij )( Ii ).reserve( tNumUniqueAdofs );
+
                     for ( uint Ik = 0; Ik < tNumUniqueAdofs; Ik++ )
                     {
                         mUniqueAdofMapList( Ij )( Ii )[ mUniqueAdofTypeList( Ij )( Ii )( Ik, 0 ) ] = Ik;
@@ -343,14 +353,19 @@ namespace moris
             {
                 auto tPdof = mFreePdofs( iPDOF );
 
+                // Get adof ids and T-matrix weights of this pdof from the pdof-adof map
+                uint            tNumAdofs = tPdof->get_num_adofs();
+                const moris_id* tAdofIds  = tPdof->get_adof_ids();
+                const real*     tWeights  = tPdof->get_t_matrix_weights();
+
                 // Loop over all adof Ids of this pdof
-                for ( uint Ik = 0; Ik < tPdof->mAdofIds.numel(); Ik++ )
+                for ( uint Ik = 0; Ik < tNumAdofs; Ik++ )
                 {
                     // Getting tPADofMap column entry for the corresponding value
-                    uint tColumnPos = mUniqueAdofMap[ tPdof->mAdofIds( Ik, 0 ) ];
+                    uint tColumnPos = mUniqueAdofMap[ tAdofIds[ Ik ] ];
 
                     // Insert value into pdof-adof-map
-                    aPADofMap( iPDOF, tColumnPos ) = ( mFreePdofs( iPDOF )->mTmatrix )( Ik, 0 );
+                    aPADofMap( iPDOF, tColumnPos ) = tWeights[ Ik ];
                 }
             }
         }
@@ -399,14 +414,19 @@ namespace moris
                     {
                         auto tPdof = mFreePdofList( Ik )( Ij )( Ii );
 
+                        // Get adof ids and T-matrix weights of this pdof from the pdof-adof map
+                        uint            tNumAdofs = tPdof->get_num_adofs();
+                        const moris_id* tAdofIds  = tPdof->get_adof_ids();
+                        const real*     tWeights  = tPdof->get_t_matrix_weights();
+
                         // Loop over all adof Ids of this pdof
-                        for ( uint Ib = 0; Ib < tPdof->mAdofIds.numel(); Ib++ )
+                        for ( uint Ib = 0; Ib < tNumAdofs; Ib++ )
                         {
                             // Getting tPADofMap column entry for the corresponding value
-                            uint tColumnPos = mUniqueAdofMapList( Ik )( Ij )[ tPdof->mAdofIds( Ib, 0 ) ];
+                            uint tColumnPos = mUniqueAdofMapList( Ik )( Ij )[ tAdofIds[ Ib ] ];
 
                             // Insert value into pdof-adof-map
-                            aPADofMap( Ik )( Ij )( Ii, tColumnPos ) = ( mFreePdofList( Ik )( Ij )( Ii )->mTmatrix )( Ib, 0 );
+                            aPADofMap( Ik )( Ij )( Ii, tColumnPos ) = tWeights[ Ib ];
                         }
                     }
                 }
@@ -1089,6 +1109,37 @@ namespace moris
 
         //-------------------------------------------------------------------------------------------------
 
+        void
+        Equation_Object::extract_unique_adof_values(
+                sol::Dist_Vector*                aSolutionVector,
+                moris::Cell< Matrix< DDRMat > >& aAdofValues )
+        {
+            moris::uint tMapId = aSolutionVector->get_map()->get_map_id();
+
+            // compute local indices once per map
+            bool tIsComputed = mUniqueAdofLocalIndices.key_exists( tMapId );
+
+            Adof_Local_Indices& tLocalIndices = mUniqueAdofLocalIndices[ tMapId ];
+
+            if ( not tIsComputed )
+            {
+                tLocalIndices.mIsValid = aSolutionVector->compute_local_indices(
+                        mUniqueAdofList,
+                        tLocalIndices.mIndices );
+            }
+
+            if ( tLocalIndices.mIsValid )
+            {
+                aSolutionVector->extract_local_values( tLocalIndices.mIndices, aAdofValues );
+            }
+            else
+            {
+                aSolutionVector->extract_my_values( mUniqueAdofList.numel(), mUniqueAdofList, 0, aAdofValues );
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         void
         Equation_Object::compute_my_pdof_values()
         {
@@ -1100,12 +1151,9 @@ namespace moris
             moris::Cell< Matrix< DDRMat > > tMyValues;
 
             // Extract this equation objects adof values from solution vector
-            mEquationSet->mEquationModel->get_solution_vector()->    //
-                    extract_my_values(
-                            tTMatrix.n_cols(),
-                            mUniqueAdofList,
-                            0,
-                            tMyValues );
+            this->extract_unique_adof_values(
+                    mEquationSet->mEquationModel->get_solution_vector(),
+                    tMyValues );
 
             if ( mEquationSet->mPdofValues.size() != tMyValues.size() )
             {
@@ -1134,9 +1182,9 @@ namespace moris
             moris::Cell< Matrix< DDRMat > > tMyValues;
 
             // Extract this equation objects adof values from solution vector
-            mEquationSet->mEquationModel
-                    ->get_previous_solution_vector()
-                    ->extract_my_values( tTMatrix.n_cols(), mUniqueAdofList, 0, tMyValues );
+            this->extract_unique_adof_values(
+                    mEquationSet->mEquationModel->get_previous_solution_vector(),
+                    tMyValues );
 
             if ( mEquationSet->mPreviousPdofValues.size() != tMyValues.size() )
             {
@@ -1166,9 +1214,9 @@ namespace moris
             moris::Cell< Matrix< DDRMat > > tMyValues;
 
             // Extract this equation objects adof values from solution vector
-            mEquationSet->mEquationModel
-                    ->get_eigen_solution_vector()
-                    ->extract_my_values( tTMatrix.n_cols(), mUniqueAdofList, 0, tMyValues );
+            this->extract_unique_adof_values(
+                    mEquationSet->mEquationModel->get_eigen_solution_vector(),
+                    tMyValues );
 
             if ( mEquationSet->mEigenVectorPdofValues.size() != tMyValues.size() )
             {
@@ -1198,9 +1246,9 @@ namespace moris
             moris::Cell< Matrix< DDRMat > > tMyValues;
 
             // Extract this equation objects adof values from solution vector
-            mEquationSet->mEquationModel
-                    ->get_adjoint_solution_vector()
-                    ->extract_my_values( tTMatrix.n_cols(), mUniqueAdofList, 0, tMyValues );
+            this->extract_unique_adof_values(
+                    mEquationSet->mEquationModel->get_adjoint_solution_vector(),
+                    tMyValues );
 
             if ( mEquationSet->mAdjointPdofValues.size() != tMyValues.size() )
             {
@@ -1230,7 +1278,9 @@ namespace moris
             moris::Cell< Matrix< DDRMat > > tMyValues;
 
             // Extract this equation objects adof values from solution vector
-            mEquationSet->mEquationModel->get_previous_adjoint_solution_vector()->extract_my_values( tTMatrix.n_cols(), mUniqueAdofList, 0, tMyValues );
+            this->extract_unique_adof_values(
+                    mEquationSet->mEquationModel->get_previous_adjoint_solution_vector(),
+                    tMyValues );
 
             if ( mEquationSet->mPreviousAdjointPdofValues.size() != tMyValues.size() )
             {
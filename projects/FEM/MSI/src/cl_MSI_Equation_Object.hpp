@@ -22,9 +22,15 @@
 #include "op_times.hpp"
 
 #include "cl_MSI_Pdof_Host.hpp"
+#include "cl_Hash_Map.hpp"
+
 namespace moris
 {
     class Dist_Vector;
+    namespace sol
+    {
+        class Dist_Vector;
+    }
     namespace mtk
     {
         class Set;
@@ -67,10 +73,22 @@ namespace moris
             moris::Cell< moris::Cell< moris::Cell< Pdof* > > > mFreePdofList;    // FIXME list of free pdofs ordered after their dof type . mFreePdofs or mFreePdofList should be deleted
 
             Matrix< DDSMat >                               mUniqueAdofList;    // Unique adof list for this equation object
+
+            // local indices of the unique adofs in a solution vector map; flag is false if the map
+            // does not provide local indices
+            struct Adof_Local_Indices
+            {
+                Matrix< DDSMat > mIndices;
+                bool             mIsValid = false;
+            };
+
+            // local indices of the unique adofs per map id. Solution, previous solution, eigen and
+            // adjoint vectors may live on different maps, such that each keeps its own indices.
+            moris::map< moris::uint, Adof_Local_Indices > mUniqueAdofLocalIndices;
             moris::Cell< moris::Cell< Matrix< DDSMat > > > mUniqueAdofTypeList;
-            moris::map< uint, uint >                       mUniqueAdofMap;    // Map to
+            moris::Hash_Map< uint, uint >                  mUniqueAdofMap;    // Map to
 
-            moris::Cell< moris::Cell< moris::map< uint, uint > > > mUniqueAdofMapList;    // Map to
+            moris::Cell< moris::Cell< moris::Hash_Map< uint, uint > > > mUniqueAdofMapList;    // Map to
 
             //! weak BCs of element FIXME
             Matrix< DDRMat > mNodalWeakBCs;
@@ -226,6 +244,17 @@ namespace moris
 
             void build_PADofMap_1( Matrix< DDRMat >& aPADofMap );
 
+            //------------------------------------------------------------------------------
+            /**
+             * @brief extracts the values of the unique adofs from a solution vector. Local indices
+             * are computed once per vector map, such that global IDs are not translated on every call.
+             * @param[ in ] aSolutionVector  solution vector
+             * @param[ out ] aAdofValues     adof values per vector
+             */
+            void extract_unique_adof_values(
+                    sol::Dist_Vector*                aSolutionVector,
+                    moris::Cell< Matrix< DDRMat > >& aAdofValues );
+
             //------------------------------------------------------------------------------
             /**
              * @brief compute function for the pdof values of this particular equation object
@@ -54,21 +54,22 @@ namespace moris
         void
         Model_Solver_Interface::finalize()
         {
-            // get map from mesh
-            Cell< moris::map< moris::moris_id, moris::moris_index > >& tCoefficientsIdtoIndexMap = mDofMgn.get_adof_map();
-
             if ( mMesh != nullptr )    // FIXME fix all constructors to be able to get rid of this if statement
             {
                 // get num discretizations
                 uint tNumDiscretizations = mMesh->get_num_interpolations();
 
                 // resize container for id to index maps
-                tCoefficientsIdtoIndexMap.resize( tNumDiscretizations );
+                mDofMgn.get_adof_map().resize( tNumDiscretizations );
 
-                // let mesh fill id to index maps
+                // let mesh fill id to index maps and pass them to the dof manager
                 for ( uint Ik = 0; Ik < tNumDiscretizations; Ik++ )
                 {
-                    mMesh->get_adof_map( Ik, tCoefficientsIdtoIndexMap( Ik ) );
+                    moris::map< moris::moris_id, moris::moris_index > tCoefficientsIdtoIndexMap;
+
+                    mMesh->get_adof_map( Ik, tCoefficientsIdtoIndexMap );
+
+                    mDofMgn.set_adof_map( Ik, tCoefficientsIdtoIndexMap );
                 }
             }
 
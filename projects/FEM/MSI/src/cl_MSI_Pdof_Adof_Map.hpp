@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_MSI_Pdof_Adof_Map.hpp
+ *
+ */
+
+#ifndef SRC_FEM_CL_MSI_PDOF_ADOF_MAP_HPP_
+#define SRC_FEM_CL_MSI_PDOF_ADOF_MAP_HPP_
+
+#include "typedefs.hpp"
+#include "cl_Cell.hpp"
+#include "assert.hpp"
+
+#include "cl_MSI_Adof.hpp"
+
+namespace moris
+{
+    namespace MSI
+    {
+        /**
+         * @brief Compressed row storage of the adofs and T-matrix weights of all pdofs of a dof manager.
+         * Every pdof owns one row, the entries of row i are stored at positions mRowOffsets( i ) to
+         * mRowOffsets( i + 1 ) - 1 of the contiguous adof and weight arrays.
+         */
+        class Pdof_Adof_Map
+        {
+          private:
+            // row pointer, one entry more than number of rows
+            moris::Cell< moris::uint > mRowOffsets = { 0 };
+
+            // adof pointers, only needed until the adof ids are known
+            moris::Cell< Adof* > mAdofs;
+
+            // adof ids and T-matrix weights
+            moris::Cell< moris_id > mAdofIds;
+            moris::Cell< real >     mWeights;
+
+          public:
+            //-------------------------------------------------------------------------------------------------
+
+            Pdof_Adof_Map(){};
+
+            //-------------------------------------------------------------------------------------------------
+
+            ~Pdof_Adof_Map(){};
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * @brief removes all rows and allocates the entries for the rows to be added
+             *
+             * @param[in] aNumRows      Number of rows to be added
+             * @param[in] aNumEntries   Total number of entries of these rows
+             */
+            void
+            initialize(
+                    const moris::uint aNumRows,
+                    const moris::uint aNumEntries )
+            {
+                mRowOffsets.clear();
+                mRowOffsets.reserve( aNumRows + 1 );
+                mRowOffsets.push_back( 0 );
+
+                mAdofs.clear();
+                mAdofIds.clear();
+                mWeights.clear();
+
+                mAdofs.resize( aNumEntries, nullptr );
+                mAdofIds.resize( aNumEntries, gNoID );
+                mWeights.resize( aNumEntries, 0.0 );
+            }
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * @brief appends a row for a pdof
+             *
+             * @param[in] aNumEntries   Number of adofs of this pdof
+             * @return Index of the new row
+             */
+            moris::uint
+            add_row( const moris::uint aNumEntries )
+            {
+                moris::uint tOffset = mRowOffsets( mRowOffsets.size() - 1 ) + aNumEntries;
+
+                MORIS_ASSERT( tOffset <= mAdofIds.size(),
+                        "Pdof_Adof_Map::add_row(), number of entries exceeds number of initialized entries" );
+
+                mRowOffsets.push_back( tOffset );
+
+                return mRowOffsets.size() - 2;
+            }
+
+            //-------------------------------------------------------------------------------------------------
+
+            moris::uint
+            get_num_rows() const
+            {
+                return mRowOffsets.size() - 1;
+            }
+
+            //-------------------------------------------------------------------------------------------------
+
+            moris::uint
+            get_num_entries() const
+            {
+                return mRowOffsets( mRowOffsets.size() - 1 );
+            }
+
+            //-------------------------------------------------------------------------------------------------
+
+            moris::uint
+            get_num_entries( const moris::uint aRow ) const
+            {
+                MORIS_ASSERT( aRow < this->get_num_rows(), "Pdof_Adof_Map::get_num_entries(), row does not exist" );
+
+                return mRowOffsets( aRow + 1 ) - mRowOffsets( aRow );
+            }
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * @brief sets the adof of an entry. Only valid until set_adof_ids_from_adofs() has been called.
+             */
+            void
+            set_adof(
+                    const moris::uint aRow,
+                    const moris::uint aEntry,
+                    Adof*             aAdof )
+            {
+                MORIS_ASSERT( aEntry < this->get_num_entries( aRow ), "Pdof_Adof_Map::set_adof(), entry does not exist" );
+
+                mAdofs( mRowOffsets( aRow ) + aEntry ) = aAdof;
+            }
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * @brief returns pointer to the first adof of a row. Only valid until set_adof_ids_from_adofs() has been called.
+             */
+            Adof* const*
+            get_adofs( const moris::uint aRow ) const
+            {
+                MORIS_ASSERT( mAdofs.size() == mAdofIds.size(),
+                        "Pdof_Adof_Map::get_adofs(), adof pointers have already been released" );
+
+                return mAdofs.memptr() + mRowOffsets( aRow );
+            }
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * @brief copies the ids of all adofs into the id array and releases the adof pointers
+             */
+            void
+            set_adof_ids_from_adofs()
+            {
+                MORIS_ASSERT( mAdofs.size() == mAdofIds.size(),
+                        "Pdof_Adof_Map::set_adof_ids_from_adofs(), adof pointers have already been released" );
+
+                for ( moris::uint iEntry = 0; iEntry < mAdofs.size(); iEntry++ )
+                {
+                    mAdofIds( iEntry ) = mAdofs( iEntry )->get_adof_id();
+                }
+
+                mAdofs.clear();
+                mAdofs.shrink_to_fit();
+            }
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * @brief returns pointer to the first adof id of a row
+             */
+            moris_id*
+            get_adof_ids( const moris::uint aRow )
+            {
+                return mAdofIds.memptr() + mRowOffsets( aRow );
+            }
+
+            //-------------------------------------------------------------------------------------------------
+
+            const moris_id*
+            get_adof_ids( const moris::uint aRow ) const
+            {
+                return mAdofIds.memptr() + mRowOffsets( aRow );
+            }
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * @brief returns pointer to the first T-matrix weight of a row
+             */
+            real*
+            get_weights( const moris::uint aRow )
+            {
+                return mWeights.memptr() + mRowOffsets( aRow );
+            }
+
+            //-------------------------------------------------------------------------------------------------
+
+            const real*
+            get_weights( const moris::uint aRow ) const
+            {
+                return mWeights.memptr() + mRowOffsets( aRow );
+            }
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * @brief returns the number of bytes allocated by this map
+             */
+            std::size_t
+            get_memory_usage() const
+            {
+                return mRowOffsets.capacity() * sizeof( moris::uint )
+                     + mAdofs.capacity() * sizeof( Adof* )
+                     + mAdofIds.capacity() * sizeof( moris_id )
+                     + mWeights.capacity() * sizeof( real );
+            }
+        };
+    }    // namespace MSI
+}    // namespace moris
+
+#endif /* SRC_FEM_CL_MSI_PDOF_ADOF_MAP_HPP_ */
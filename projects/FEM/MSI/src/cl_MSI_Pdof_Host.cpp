@@ -96,16 +96,48 @@ namespace moris
 
         //-----------------------------------------------------------------------------------------------------------
 
+        uint
+        Pdof_Host::count_adofs(
+                Model_Solver_Interface* aModelSolverInterface,
+                const bool&             aUseHMR )
+        {
+            // adofs are only created based on the T-matrix
+            if ( !aUseHMR )
+            {
+                return 0;
+            }
+
+            uint tNumAdofs = 0;
+
+            // Loop over all pdof types
+            for ( uint Ii = 0; Ii < mListOfPdofTimePerType.size(); Ii++ )
+            {
+                if ( mListOfPdofTimePerType( Ii ).size() != 0 )
+                {
+                    // Ask for adof mesh index for this dof type
+                    uint tAdofMeshIndex = (uint)aModelSolverInterface->get_adof_index_for_type( Ii );
+
+                    // every time level of this type uses the same adofs
+                    tNumAdofs += mListOfPdofTimePerType( Ii ).size() * mNodeObj->get_adof_indices( tAdofMeshIndex ).numel();
+                }
+            }
+
+            return tNumAdofs;
+        }
+
+        //-----------------------------------------------------------------------------------------------------------
+
         void
         Pdof_Host::get_adofs(
                 const Matrix< DDUMat >&              aTimeLevelOffsets,
                 moris::Cell< moris::Cell< Adof* > >& aAdofList,
                 Model_Solver_Interface*              aModelSolverInterface,
-                const bool&                          aUseHMR )
+                const bool&                          aUseHMR,
+                Pdof_Adof_Map&                       aPdofAdofMap )
         {
             if ( aUseHMR )
             {
-                this->create_adofs_based_on_Tmatrix( aTimeLevelOffsets, aAdofList, aModelSolverInterface );
+                this->create_adofs_based_on_Tmatrix( aTimeLevelOffsets, aAdofList, aModelSolverInterface, aPdofAdofMap );
             }
             else
             {
@@ -119,7 +151,8 @@ namespace moris
         Pdof_Host::create_adofs_based_on_Tmatrix(
                 const Matrix< DDUMat >&              aTimeLevelOffsets,
                 moris::Cell< moris::Cell< Adof* > >& aAdofList,
-                Model_Solver_Interface*              aModelSolverInterface )
+                Model_Solver_Interface*              aModelSolverInterface,
+                Pdof_Adof_Map&                       aPdofAdofMap )
         {
             // Get number of DoF Types (i.e. number of PDofs created on this node/host per DoF in time direction)
             uint tNumPdofTypes = mListOfPdofTimePerType.size();
@@ -142,8 +175,10 @@ namespace moris
 
                     for ( uint Ij = 0; Ij < mListOfPdofTimePerType( Ii ).size(); Ij++ )
                     {
-                        // Set size of vector with adof pointer
-                        mListOfPdofTimePerType( Ii )( Ij )->mAdofPtrList.resize( tAdofMeshInd.numel() );
+                        // Add row for this pdof/time to pdof-adof map
+                        Pdof* tPdof        = mListOfPdofTimePerType( Ii )( Ij );
+                        tPdof->mAdofMap    = &aPdofAdofMap;
+                        tPdof->mAdofMapRow = aPdofAdofMap.add_row( tAdofMeshInd.numel() );
 
                         // Get pdof type Index
                         uint tPdofTypeIndex = mListOfPdofTimePerType( Ii )( Ij )->mDofTypeIndex;
@@ -172,7 +207,7 @@ namespace moris
                             }
 
                             // set pointer to adof on corresponding pdof/time
-                            mListOfPdofTimePerType( Ii )( Ij )->mAdofPtrList( Ik ) = aAdofList( tADofTypeWithTime )( tCurrentADofMeshIndex );
+                            aPdofAdofMap.set_adof( tPdof->mAdofMapRow, Ik, aAdofList( tADofTypeWithTime )( tCurrentADofMeshIndex ) );
                         }
                     }
                 }
@@ -232,35 +267,6 @@ namespace moris
             //        }
         }
 
-        //-----------------------------------------------------------------------------------------------------------
-        void
-        Pdof_Host::get_adofs_ids()
-        {
-            // Get number of pdof Types in this pdof host
-            uint tNumPdofTypes = mListOfPdofTimePerType.size();
-
-            // Loop over all pdof types
-            for ( uint Ii = 0; Ii < tNumPdofTypes; Ii++ )
-            {
-                // Loop over all timelevel
-                for ( uint Ij = 0; Ij < mListOfPdofTimePerType( Ii ).size(); Ij++ )
-                {
-                    // Get number of adofs ptr on this pdof/time
-                    uint tNumAdofPtr = mListOfPdofTimePerType( Ii )( Ij )->mAdofPtrList.size();
-
-                    // Set size of matrix containing this pdof/time adof Ids
-                    mListOfPdofTimePerType( Ii )( Ij )->mAdofIds.set_size( tNumAdofPtr, 1 );
-
-                    // loop over all adof ptr of this pdof/time and add the adof Ids to this pdof
-                    for ( uint Ik = 0; Ik < tNumAdofPtr; Ik++ )
-                    {
-                        auto tPointer                                         = mListOfPdofTimePerType( Ii )( Ij )->mAdofPtrList( Ik );
-                        mListOfPdofTimePerType( Ii )( Ij )->mAdofIds( Ik, 0 ) = tPointer->get_adof_id();
-                    }
-                }
-            }
-        }
-
         //-----------------------------------------------------------------------------------------------------------
 
         //        void Pdof_Host::create_unique_adof_list()
@@ -317,16 +323,34 @@ namespace moris
 
                 for ( uint Ij = 0; Ij < mListOfPdofTimePerType( Ii ).size(); Ij++ )
                 {
+                    Pdof* tPdof = mListOfPdofTimePerType( Ii )( Ij );
+
+                    // pdofs without adofs do not have a row in the pdof-adof map
+                    uint tNumAdofs = tPdof->get_num_adofs();
+
+                    if ( tNumAdofs == 0 )
+                    {
+                        continue;
+                    }
+
+                    real* tWeights = tPdof->mAdofMap->get_weights( tPdof->mAdofMapRow );
+
                     if ( aUseHMR )
                     {
-                        // Get TMatrix. Add Tmatrix to type and time list
-                        const Matrix< DDRMat >* tTmatrix             = mNodeObj->get_t_matrix( tAdofMeshIndex );
-                        mListOfPdofTimePerType( Ii )( Ij )->mTmatrix = tTmatrix->matrix_data();
+                        // Get TMatrix. Copy weights into row of this type and time
+                        const Matrix< DDRMat >* tTmatrix = mNodeObj->get_t_matrix( tAdofMeshIndex );
+
+                        MORIS_ASSERT( tTmatrix->numel() == tNumAdofs,
+                                "Pdof_Host::set_t_matrix(), T-matrix size does not match number of adofs" );
+
+                        for ( uint Ik = 0; Ik < tNumAdofs; Ik++ )
+                        {
+                            tWeights[ Ik ] = ( *tTmatrix )( Ik );
+                        }
                     }
                     else
                     {
-                        mListOfPdofTimePerType( Ii )( Ij )->mTmatrix.resize( 1, 1 );
-                        mListOfPdofTimePerType( Ii )( Ij )->mTmatrix( 0, 0 ) = 1.0;
+                        tWeights[ 0 ] = 1.0;
                     }
                 }
             }
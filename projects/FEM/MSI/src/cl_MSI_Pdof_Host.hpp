@@ -20,6 +20,7 @@
 
 #include "cl_MSI_Dof_Type_Enums.hpp"
 #include "cl_MSI_Adof.hpp"
+#include "cl_MSI_Pdof_Adof_Map.hpp"
 
 namespace moris
 {
@@ -35,14 +36,32 @@ namespace moris
     {
         struct Pdof
         {
-            uint             mDofTypeIndex;
-            uint             mTimeStepIndex;
-            Matrix< DDSMat > mAdofIds;
-            Matrix< DDRMat > mTmatrix;
+            uint mDofTypeIndex;
+            uint mTimeStepIndex;
 
             uint mElementalSolVecEntry;
 
-            moris::Cell< Adof* > mAdofPtrList;    // FIXME: delete this list after call to get adof ids or replace it
+            // adof ids and T-matrix weights are stored in a row of the pdof-adof map of the dof manager
+            Pdof_Adof_Map* mAdofMap    = nullptr;
+            uint           mAdofMapRow = 0;
+
+            uint
+            get_num_adofs() const
+            {
+                return mAdofMap == nullptr ? 0 : mAdofMap->get_num_entries( mAdofMapRow );
+            }
+
+            const moris_id*
+            get_adof_ids() const
+            {
+                return mAdofMap == nullptr ? nullptr : mAdofMap->get_adof_ids( mAdofMapRow );
+            }
+
+            const real*
+            get_t_matrix_weights() const
+            {
+                return mAdofMap == nullptr ? nullptr : mAdofMap->get_weights( mAdofMapRow );
+            }
         };
 
         //-------------------------------------------------------------------------------------------------
@@ -56,7 +75,8 @@ namespace moris
             void create_adofs_based_on_Tmatrix(
                     const Matrix< DDUMat >&              aTimeLevelOffsets,
                     moris::Cell< moris::Cell< Adof* > >& aAdofListz,
-                    Model_Solver_Interface*              aModelSolverInterface );
+                    Model_Solver_Interface*              aModelSolverInterface,
+                    Pdof_Adof_Map&                       aPdofAdofMap );
 
             void create_adofs_based_on_pdofs(
                     const Matrix< DDUMat >&              aTimeLevelOffsets,
@@ -91,29 +111,31 @@ namespace moris
                     const uint              aNumUsedDofTypes,
                     const Matrix< DDSMat >& aPdofTypeMap );
 
+            /**
+             * @brief Counts the adofs of all pdofs in this pdof host, i.e. the number of entries in the pdof-adof map.
+             *
+             * @param[in] aModelSolverInterface   Pointer to the model solver interface
+             * @param[in] aUseHMR                 Bolean which indicates if HMR is used and thus, multiple adofs per pdof.
+             *
+             */
+            uint count_adofs(
+                    Model_Solver_Interface* aModelSolverInterface,
+                    const bool&             aUseHMR );
+
             /**
              * @brief Gets the adofs for all the pdofs in this pdof host. This function is tested by the test [Pdof_Host_Get_Adofs]
              *
              * @param[in] aTimeLevelOffsets  Offsets for this doftype and time      FIXME
              * @param[in] aAdofList          List containing all the adofs.
+             * @param[in] aPdofAdofMap       Pdof-adof map. One row is added for every pdof of this pdof host.
              *
              */
             void get_adofs(
                     const Matrix< DDUMat >&              aTimeLevelOffsets,
                     moris::Cell< moris::Cell< Adof* > >& aAdofList,
                     Model_Solver_Interface*              aModelSolverInterface,
-                    const bool&                          aUseHMR );
-
-            /**
-             * @brief Gets the adofs Ids for all the pdofs in this pdof host. This function is tested by the test [Pdof_Host_Get_Adofs]
-             *
-             * @param[in] aTimeLevelOffsets       Offsets for this doftype and time
-             * @param[in] aAdofList               List containing all the adofs.
-             * @param[in] aModelSolverInterface   Pointer to the model solver interface
-             * @param[in] aUseHMR                 Bolean which indicates if HMR is used and thus, multiple adofs per pdof.
-             *
-             */
-            void get_adofs_ids();
+                    const bool&                          aUseHMR,
+                    Pdof_Adof_Map&                       aPdofAdofMap );
 
             /**
              * @brief Set the t-matrix values for all the pdofs. This function is tested by the test [Pdof_Host_Get_Adofs]
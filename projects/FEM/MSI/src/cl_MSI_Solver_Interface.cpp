@@ -83,6 +83,32 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        void
+        MSI_Solver_Interface::set_is_sensitivity_analysis()
+        {
+            Solver_Interface::set_is_sensitivity_analysis();
+
+            if ( mMSI != nullptr and mMSI->mEquationModel != nullptr )
+            {
+                mMSI->mEquationModel->set_is_sensitivity_analysis();
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        MSI_Solver_Interface::set_is_forward_analysis()
+        {
+            Solver_Interface::set_is_forward_analysis();
+
+            if ( mMSI != nullptr and mMSI->mEquationModel != nullptr )
+            {
+                mMSI->mEquationModel->set_is_forward_analysis();
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
         void
         MSI_Solver_Interface::postmultiply_implicit_dQds()
         {
@@ -82,10 +82,32 @@ namespace moris
 
             //------------------------------------------------------------------------------
 
+            /**
+             * indicate that the solver interface and the equation model are used for the sensitivity analysis
+             */
+            void set_is_sensitivity_analysis() override;
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * indicate that the solver interface and the equation model are used for the forward analysis
+             */
+            void set_is_forward_analysis() override;
+
+            //------------------------------------------------------------------------------
+
             void set_solution_vector( sol::Dist_Vector* aSolutionVector );
 
             //------------------------------------------------------------------------------
 
+            sol::Dist_Vector*
+            get_solution_vector()
+            {
+                return mSolutionVector;
+            }
+
+            //------------------------------------------------------------------------------
+
             void set_solution_vector_prev_time_step( sol::Dist_Vector* aSolutionVector );
 
             //------------------------------------------------------------------------------
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ * ------------------------------------------------------------------------------------
+ *
+ * fn_MSI_reverse_cuthill_mckee.cpp
+ *
+ */
+
+#include "fn_MSI_reverse_cuthill_mckee.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "assert.hpp"
+
+namespace moris
+{
+    namespace MSI
+    {
+        //------------------------------------------------------------------------------
+
+        moris::Cell< uint >
+        reverse_cuthill_mckee(
+                const uint                 aNumVertices,
+                const moris::Cell< uint >& aCliqueOffsets,
+                const moris::Cell< uint >& aCliqueVertices )
+        {
+            MORIS_ASSERT( aCliqueOffsets.size() > 0 and aCliqueOffsets( aCliqueOffsets.size() - 1 ) == aCliqueVertices.size(),
+                    "reverse_cuthill_mckee(), clique offsets do not match number of clique vertices" );
+
+            uint tNumCliques = aCliqueOffsets.size() - 1;
+
+            // build cliques per vertex
+            moris::Cell< uint > tVertexOffsets( aNumVertices + 1, 0 );
+
+            for ( uint iEntry = 0; iEntry < aCliqueVertices.size(); iEntry++ )
+            {
+                MORIS_ASSERT( aCliqueVertices( iEntry ) < aNumVertices, "reverse_cuthill_mckee(), vertex out of range" );
+
+                tVertexOffsets( aCliqueVertices( iEntry ) + 1 )++;
+            }
+
+            for ( uint iVertex = 0; iVertex < aNumVertices; iVertex++ )
+            {
+                tVertexOffsets( iVertex + 1 ) += tVertexOffsets( iVertex );
+            }
+
+            moris::Cell< uint > tVertexCliques( aCliqueVertices.size() );
+            moris::Cell< uint > tFillCounter( aNumVertices );
+
+            for ( uint iVertex = 0; iVertex < aNumVertices; iVertex++ )
+            {
+                tFillCounter( iVertex ) = tVertexOffsets( iVertex );
+            }
+
+            for ( uint iClique = 0; iClique < tNumCliques; iClique++ )
+            {
+                for ( uint iEntry = aCliqueOffsets( iClique ); iEntry < aCliqueOffsets( iClique + 1 ); iEntry++ )
+                {
+                    tVertexCliques( tFillCounter( aCliqueVertices( iEntry ) )++ ) = iClique;
+                }
+            }
+
+            // build the adjacency of the clique graph, duplicate neighbors are removed through a marker;
+            // the first pass counts the neighbors, the second pass fills them in
+            moris::Cell< uint > tAdjacencyOffsets( aNumVertices + 1, 0 );
+            moris::Cell< uint > tAdjacency;
+            moris::Cell< uint > tMarker( aNumVertices, MORIS_UINT_MAX );
+
+            for ( uint iPass = 0; iPass < 2; iPass++ )
+            {
+                if ( iPass == 1 )
+                {
+                    for ( uint iVertex = 0; iVertex < aNumVertices; iVertex++ )
+                    {
+                        tAdjacencyOffsets( iVertex + 1 ) += tAdjacencyOffsets( iVertex );
+                        tMarker( iVertex ) = MORIS_UINT_MAX;
+                    }
+
+                    tAdjacency.resize( tAdjacencyOffsets( aNumVertices ) );
+                }
+
+                for ( uint iVertex = 0; iVertex < aNumVertices; iVertex++ )
+                {
+                    // the vertex itself is not its own neighbor
+                    tMarker( iVertex ) = iVertex;
+
+                    uint tCounter = iPass == 0 ? 0 : tAdjacencyOffsets( iVertex );
+
+                    for ( uint iClique = tVertexOffsets( iVertex ); iClique < tVertexOffsets( iVertex + 1 ); iClique++ )
+                    {
+                        uint tClique = tVertexCliques( iClique );
+
+                        for ( uint iEntry = aCliqueOffsets( tClique ); iEntry < aCliqueOffsets( tClique + 1 ); iEntry++ )
+                        {
+                            uint tNeighbor = aCliqueVertices( iEntry );
+
+                            if ( tMarker( tNeighbor ) != iVertex )
+                            {
+                                tMarker( tNeighbor ) = iVertex;
+
+                                if ( iPass == 1 )
+                                {
+                                    tAdjacency( tCounter ) = tNeighbor;
+                                }
+
+                                tCounter++;
+                            }
+                        }
+                    }
+
+                    if ( iPass == 0 )
+                    {
+                        tAdjacencyOffsets( iVertex + 1 ) = tCounter;
+                    }
+                }
+            }
+
+            // the degree is the number of distinct neighbors
+            auto tDegree = [ &tAdjacencyOffsets ]( uint aVertex ) { return tAdjacencyOffsets( aVertex + 1 ) - tAdjacencyOffsets( aVertex ); };
+
+            auto tCompareDegree = [ &tDegree ]( uint aA, uint aB ) { return tDegree( aA ) < tDegree( aB ); };
+
+            // start vertices of the connected components are chosen by minimal degree
+            moris::Cell< uint > tStartCandidates( aNumVertices );
+            std::iota( tStartCandidates.begin(), tStartCandidates.end(), 0 );
+            std::stable_sort( tStartCandidates.begin(), tStartCandidates.end(), tCompareDegree );
+
+            moris::Cell< uint > tVisitedVertices( aNumVertices, 0 );
+
+            moris::Cell< uint > tOrder( aNumVertices );
+            uint                tNumOrdered = 0;
+
+            for ( uint iCandidate = 0; iCandidate < aNumVertices; iCandidate++ )
+            {
+                uint tStart = tStartCandidates( iCandidate );
+
+                if ( tVisitedVertices( tStart ) or tDegree( tStart ) == 0 )
+                {
+                    continue;
+                }
+
+                tVisitedVertices( tStart ) = 1;
+                tOrder( tNumOrdered++ )    = tStart;
+
+                // breadth first search through the adjacency, tOrder is used as queue
+                for ( uint iHead = tNumOrdered - 1; iHead < tNumOrdered; iHead++ )
+                {
+                    uint tVertex     = tOrder( iHead );
+                    uint tBatchStart = tNumOrdered;
+
+                    for ( uint iEntry = tAdjacencyOffsets( tVertex ); iEntry < tAdjacencyOffsets( tVertex + 1 ); iEntry++ )
+                    {
+                        uint tNeighbor = tAdjacency( iEntry );
+
+                        if ( !tVisitedVertices( tNeighbor ) )
+                        {
+                            tVisitedVertices( tNeighbor ) = 1;
+                            tOrder( tNumOrdered++ )       = tNeighbor;
+                        }
+                    }
+
+                    // new neighbors are ordered by increasing degree
+                    std::stable_sort( tOrder.begin() + tBatchStart, tOrder.begin() + tNumOrdered, tCompareDegree );
+                }
+            }
+
+            // reverse Cuthill-McKee order
+            std::reverse( tOrder.begin(), tOrder.begin() + tNumOrdered );
+
+            // append isolated vertices
+            for ( uint iVertex = 0; iVertex < aNumVertices; iVertex++ )
+            {
+                if ( !tVisitedVertices( iVertex ) )
+                {
+                    tOrder( tNumOrdered++ ) = iVertex;
+                }
+            }
+
+            moris::Cell< uint > tPositions( aNumVertices );
+
+            for ( uint iPos = 0; iPos < aNumVertices; iPos++ )
+            {
+                tPositions( tOrder( iPos ) ) = iPos;
+            }
+
+            return tPositions;
+        }
+
+        //------------------------------------------------------------------------------
+
+        uint
+        compute_clique_bandwidth(
+                const moris::Cell< uint >& aCliqueOffsets,
+                const moris::Cell< uint >& aCliqueVertices,
+                const moris::Cell< uint >& aPositions )
+        {
+            uint tBandwidth = 0;
+
+            for ( uint iClique = 0; iClique + 1 < aCliqueOffsets.size(); iClique++ )
+            {
+                if ( aCliqueOffsets( iClique ) == aCliqueOffsets( iClique + 1 ) )
+                {
+                    continue;
+                }
+
+                uint tMin = MORIS_UINT_MAX;
+                uint tMax = 0;
+
+                for ( uint iEntry = aCliqueOffsets( iClique ); iEntry < aCliqueOffsets( iClique + 1 ); iEntry++ )
+                {
+                    tMin = std::min( tMin, aPositions( aCliqueVertices( iEntry ) ) );
+                    tMax = std::max( tMax, aPositions( aCliqueVertices( iEntry ) ) );
+                }
+
+                tBandwidth = std::max( tBandwidth, tMax - tMin );
+            }
+
+            return tBandwidth;
+        }
+
+        //------------------------------------------------------------------------------
+    }    // namespace MSI
+}    // namespace moris
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ * ------------------------------------------------------------------------------------
+ *
+ * fn_MSI_reverse_cuthill_mckee.hpp
+ *
+ */
+#ifndef SRC_fn_MSI_reverse_cuthill_mckee
+#define SRC_fn_MSI_reverse_cuthill_mckee
+
+#include "typedefs.hpp"
+#include "cl_Cell.hpp"
+
+namespace moris
+{
+    namespace MSI
+    {
+        //------------------------------------------------------------------------------
+        /**
+         * @brief Computes a reverse Cuthill-McKee ordering of a graph given as a list of cliques, e.g. the adofs
+         * of every equation object. The adjacency of the clique graph is assembled without duplicates and
+         * the number of distinct neighbors of a vertex is used as its degree.
+         * Vertices which are not part of any clique are appended in their original order.
+         *
+         * @param[in] aNumVertices     Number of vertices
+         * @param[in] aCliqueOffsets   Offsets of the cliques in aCliqueVertices, one entry more than number of cliques
+         * @param[in] aCliqueVertices  Vertices of all cliques, may contain duplicates
+         *
+         * @return New position of every vertex
+         */
+        moris::Cell< uint > reverse_cuthill_mckee(
+                const uint                 aNumVertices,
+                const moris::Cell< uint >& aCliqueOffsets,
+                const moris::Cell< uint >& aCliqueVertices );
+
+        //------------------------------------------------------------------------------
+        /**
+         * @brief Computes the bandwidth of the clique graph for given vertex positions,
+         * i.e. the maximal distance between the positions of two vertices of the same clique.
+         *
+         * @param[in] aCliqueOffsets   Offsets of the cliques in aCliqueVertices, one entry more than number of cliques
+         * @param[in] aCliqueVertices  Vertices of all cliques
+         * @param[in] aPositions       Position of every vertex
+         *
+         * @return Bandwidth
+         */
+        uint compute_clique_bandwidth(
+                const moris::Cell< uint >& aCliqueOffsets,
+                const moris::Cell< uint >& aCliqueVertices,
+                const moris::Cell< uint >& aPositions );
+
+        //------------------------------------------------------------------------------
+    }    // namespace MSI
+}    // namespace moris
+
+#endif /* SRC_fn_MSI_reverse_cuthill_mckee */
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * UT_MSI_Reverse_Cuthill_McKee.cpp
+ *
+ */
+
+#include "catch.hpp"
+#include "typedefs.hpp"
+#include "cl_Cell.hpp"
+
+#include "fn_MSI_reverse_cuthill_mckee.hpp"
+
+namespace moris::MSI
+{
+    TEST_CASE( "Reverse_Cuthill_McKee", "[MSI],[Reverse_Cuthill_McKee]" )
+    {
+        // chain of 6 vertices 0-4-2-5-1-3 given as two-vertex cliques, vertex 6 is isolated
+        Cell< uint > tCliqueOffsets = { 0, 2, 4, 6, 8, 10 };
+        Cell< uint > tCliqueVertices = { 0, 4, 4, 2, 2, 5, 5, 1, 1, 3 };
+
+        Cell< uint > tInitialPositions = { 0, 1, 2, 3, 4, 5, 6 };
+
+        CHECK( compute_clique_bandwidth( tCliqueOffsets, tCliqueVertices, tInitialPositions ) == 4 );
+
+        Cell< uint > tPositions = reverse_cuthill_mckee( 7, tCliqueOffsets, tCliqueVertices );
+
+        // every position is used once
+        Cell< uint > tCount( 7, 0 );
+        for ( uint iVertex = 0; iVertex < 7; iVertex++ )
+        {
+            REQUIRE( tPositions( iVertex ) < 7 );
+            tCount( tPositions( iVertex ) )++;
+        }
+
+        for ( uint iPos = 0; iPos < 7; iPos++ )
+        {
+            CHECK( tCount( iPos ) == 1 );
+        }
+
+        // chain is numbered consecutively, isolated vertex is last
+        CHECK( compute_clique_bandwidth( tCliqueOffsets, tCliqueVertices, tPositions ) == 1 );
+        CHECK( tPositions( 6 ) == 6 );
+    }
+
+    TEST_CASE( "Reverse_Cuthill_McKee_Quad_Mesh", "[MSI],[Reverse_Cuthill_McKee]" )
+    {
+        // 4x4 quad mesh with randomly numbered nodes; corner nodes are in one clique but have 3 neighbors,
+        // interior nodes are in 4 cliques and have 8 neighbors
+        Cell< uint > tLabels = { 6, 16, 22, 14, 1, 5, 20, 10, 9, 13, 24, 12, 3, 8, 21, 23, 0, 2, 15, 19, 11, 4, 17, 18, 7 };
+
+        Cell< uint > tCliqueOffsets  = { 0 };
+        Cell< uint > tCliqueVertices = {};
+
+        for ( uint iJ = 0; iJ < 4; iJ++ )
+        {
+            for ( uint iI = 0; iI < 4; iI++ )
+            {
+                uint tNode = iJ * 5 + iI;
+
+                tCliqueVertices.append( { tLabels( tNode ), tLabels( tNode + 1 ), tLabels( tNode + 5 ), tLabels( tNode + 6 ) } );
+                tCliqueOffsets.push_back( tCliqueVertices.size() );
+            }
+        }
+
+        Cell< uint > tInitialPositions( 25 );
+        Cell< uint > tMeshPositions( 25 );
+
+        for ( uint iNode = 0; iNode < 25; iNode++ )
+        {
+            tInitialPositions( iNode )          = iNode;
+            tMeshPositions( tLabels( iNode ) ) = iNode;
+        }
+
+        Cell< uint > tPositions = reverse_cuthill_mckee( 25, tCliqueOffsets, tCliqueVertices );
+
+        // every position is used once
+        Cell< uint > tCount( 25, 0 );
+        for ( uint iVertex = 0; iVertex < 25; iVertex++ )
+        {
+            REQUIRE( tPositions( iVertex ) < 25 );
+            tCount( tPositions( iVertex ) )++;
+        }
+
+        for ( uint iPos = 0; iPos < 25; iPos++ )
+        {
+            CHECK( tCount( iPos ) == 1 );
+        }
+
+        uint tInitialBandwidth = compute_clique_bandwidth( tCliqueOffsets, tCliqueVertices, tInitialPositions );
+        uint tMeshBandwidth    = compute_clique_bandwidth( tCliqueOffsets, tCliqueVertices, tMeshPositions );
+        uint tBandwidth        = compute_clique_bandwidth( tCliqueOffsets, tCliqueVertices, tPositions );
+
+        CHECK( tMeshBandwidth == 6 );
+        CHECK( tBandwidth < tInitialBandwidth );
+        CHECK( tBandwidth <= 9 );
+    }
+}
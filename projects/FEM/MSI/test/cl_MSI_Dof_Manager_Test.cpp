@@ -342,10 +342,6 @@ namespace moris
             (tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 ))->mDofTypeIndex = 1;
             (tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 ))->mDofTypeIndex = 0;
 
-            tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->mAdofIds = tAdofsId1;
-            tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->mAdofIds = tAdofsId1;
-            tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 )->mAdofIds = tAdofsId2;
-
             moris::Cell < Equation_Object* >tListEqnObj;
             moris::ParameterList tMSIParameters = prm::create_msi_parameter_list();
             tDofMgn.mModelSolverInterface = new Model_Solver_Interface( tMSIParameters, tListEqnObj );
@@ -359,12 +355,12 @@ namespace moris
             CHECK( equal_to( tDofMgn.mAdofList( 0 )->mAdofId, 0 ) );
             CHECK( equal_to( tDofMgn.mAdofList( 4 )->mAdofId, 4 ) );
 
-            CHECK( equal_to( tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->mAdofIds( 0 ), 0 ) );
-            CHECK( equal_to( tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->mAdofIds( 1 ), 2 ) );
-            CHECK( equal_to( tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->mAdofIds( 0 ), 3 ) );
-            CHECK( equal_to( tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->mAdofIds( 1 ), 4 ) );
-            CHECK( equal_to( tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 )->mAdofIds( 0 ), 1 ) );
-            CHECK( equal_to( tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 )->mAdofIds( 1 ), 0 ) );
+            CHECK( equal_to( tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->get_adof_ids()[ 0 ], 0 ) );
+            CHECK( equal_to( tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->get_adof_ids()[ 1 ], 2 ) );
+            CHECK( equal_to( tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->get_adof_ids()[ 0 ], 3 ) );
+            CHECK( equal_to( tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->get_adof_ids()[ 1 ], 4 ) );
+            CHECK( equal_to( tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 )->get_adof_ids()[ 0 ], 1 ) );
+            CHECK( equal_to( tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 )->get_adof_ids()[ 1 ], 0 ) );
 
             delete Node1;
             delete Node2;
@@ -446,6 +442,19 @@ namespace moris
         (tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )) = new Pdof;
         (tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 )) = new Pdof;
 
+        // add rows for the two adofs of every pdof to the pdof-adof map
+        tDofMgn.mPdofAdofMap.initialize( 3, 6 );
+
+        for ( uint Ii = 0; Ii < 2; Ii++ )
+        {
+            for ( uint Ij = 0; Ij < tDofMgn.mPdofHostList( Ii )->mListOfPdofTimePerType.size(); Ij++ )
+            {
+                Pdof* tPdof        = tDofMgn.mPdofHostList( Ii )->mListOfPdofTimePerType( Ij )( 0 );
+                tPdof->mAdofMap    = &tDofMgn.mPdofAdofMap;
+                tPdof->mAdofMapRow = tDofMgn.mPdofAdofMap.add_row( 2 );
+            }
+        }
+
         moris::Cell < Equation_Object* >tListEqnObj;
         moris::ParameterList tMSIParameters = prm::create_msi_parameter_list();
         tDofMgn.mModelSolverInterface = new Model_Solver_Interface( tMSIParameters, tListEqnObj );
@@ -455,12 +464,12 @@ namespace moris
         // Create adofs and build adof lists
         tDofMgn.set_pdof_t_matrix();
 
-        CHECK( equal_to( (tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->mTmatrix)( 0, 0 ),  1 ) );
-        CHECK( equal_to( (tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->mTmatrix)( 1, 0 ), -4 ) );
-        CHECK( equal_to( (tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->mTmatrix)( 0, 0 ),  1 ) );
-        CHECK( equal_to( (tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->mTmatrix)( 1, 0 ), -4 ) );
-        CHECK( equal_to( (tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 )->mTmatrix)( 0, 0 ),  2 ) );
-        CHECK( equal_to( (tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 )->mTmatrix)( 1, 0 ), -2 ) );
+        CHECK( equal_to( tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->get_t_matrix_weights()[ 0 ],  1 ) );
+        CHECK( equal_to( tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->get_t_matrix_weights()[ 1 ], -4 ) );
+        CHECK( equal_to( tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->get_t_matrix_weights()[ 0 ],  1 ) );
+        CHECK( equal_to( tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->get_t_matrix_weights()[ 1 ], -4 ) );
+        CHECK( equal_to( tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 )->get_t_matrix_weights()[ 0 ],  2 ) );
+        CHECK( equal_to( tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 )->get_t_matrix_weights()[ 1 ], -2 ) );
 
         delete Node1;
         delete Node2;
@@ -723,10 +732,6 @@ namespace moris
                 (tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 ))->mDofTypeIndex = 1;
                 (tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 ))->mDofTypeIndex = 0;
 
-                tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->mAdofIds = tAdofsId1;
-                tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->mAdofIds = tAdofsId1;
-                tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 )->mAdofIds = tAdofsId2;
-
                 tDofMgn.mCommTable.set_size( 2, 1, 0);
                 tDofMgn.mCommTable( 1, 0 ) = 1;
 
@@ -749,9 +754,6 @@ namespace moris
                 (tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 ))->mDofTypeIndex = 0;
                 (tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 ))->mDofTypeIndex = 1;
 
-                tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->mAdofIds = tAdofsId1;
-                tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->mAdofIds = tAdofsId1;
-
                 tDofMgn.mCommTable.set_size( 2, 1, 1);
                 tDofMgn.mCommTable( 1, 0 ) = 0;
 
@@ -915,10 +917,6 @@ namespace moris
                 (tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 ))->mDofTypeIndex = 1;
                 (tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 ))->mDofTypeIndex = 0;
 
-                tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->mAdofIds = tAdofsId1;
-                tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->mAdofIds = tAdofsId1;
-                tDofMgn.mPdofHostList( 1 )->mListOfPdofTimePerType( 0 )( 0 )->mAdofIds = tAdofsId2;
-
                 tDofMgn.mCommTable.set_size( 2, 1, 0);
                 tDofMgn.mCommTable( 1, 0 ) = 1;
 
@@ -942,9 +940,6 @@ namespace moris
                 (tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 ))->mDofTypeIndex = 0;
                 (tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 ))->mDofTypeIndex = 1;
 
-                tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 0 )( 0 )->mAdofIds = tAdofsId1;
-                tDofMgn.mPdofHostList( 0 )->mListOfPdofTimePerType( 1 )( 0 )->mAdofIds = tAdofsId1;
-
                 tDofMgn.mCommTable.set_size( 2, 1, 1);
                 tDofMgn.mCommTable( 1, 0 ) = 0;
 
@@ -414,20 +414,27 @@ namespace moris
         EquObj.mFreePdofs( 2 ) = new Pdof;
         EquObj.mFreePdofs( 3 ) = new Pdof;
 
-        EquObj.mFreePdofs( 0 )->mAdofIds.set_size( 2, 1 );
-        EquObj.mFreePdofs( 1 )->mAdofIds.set_size( 1, 1 );
-        EquObj.mFreePdofs( 2 )->mAdofIds.set_size( 4, 1 );
-        EquObj.mFreePdofs( 3 )->mAdofIds.set_size( 2, 1 );
-
-        EquObj.mFreePdofs( 0 )->mAdofIds( 0, 0 ) = 0;
-        EquObj.mFreePdofs( 0 )->mAdofIds( 1, 0 ) = 1;
-        EquObj.mFreePdofs( 1 )->mAdofIds( 0, 0 ) = 3;
-        EquObj.mFreePdofs( 2 )->mAdofIds( 0, 0 ) = 0;
-        EquObj.mFreePdofs( 2 )->mAdofIds( 1, 0 ) = 2;
-        EquObj.mFreePdofs( 2 )->mAdofIds( 2, 0 ) = 6;
-        EquObj.mFreePdofs( 2 )->mAdofIds( 3, 0 ) = 7;
-        EquObj.mFreePdofs( 3 )->mAdofIds( 0, 0 ) = 1;
-        EquObj.mFreePdofs( 3 )->mAdofIds( 1, 0 ) = 5;
+        // Add rows for these pdofs to a pdof-adof map
+        Pdof_Adof_Map tPdofAdofMap;
+        tPdofAdofMap.initialize( 4, 9 );
+
+        uint tNumAdofsPerPdof[ 4 ] = { 2, 1, 4, 2 };
+
+        for ( uint Ii = 0; Ii < 4; Ii++ )
+        {
+            EquObj.mFreePdofs( Ii )->mAdofMap    = &tPdofAdofMap;
+            EquObj.mFreePdofs( Ii )->mAdofMapRow = tPdofAdofMap.add_row( tNumAdofsPerPdof[ Ii ] );
+        }
+
+        tPdofAdofMap.get_adof_ids( 0 )[ 0 ] = 0;
+        tPdofAdofMap.get_adof_ids( 0 )[ 1 ] = 1;
+        tPdofAdofMap.get_adof_ids( 1 )[ 0 ] = 3;
+        tPdofAdofMap.get_adof_ids( 2 )[ 0 ] = 0;
+        tPdofAdofMap.get_adof_ids( 2 )[ 1 ] = 2;
+        tPdofAdofMap.get_adof_ids( 2 )[ 2 ] = 6;
+        tPdofAdofMap.get_adof_ids( 2 )[ 3 ] = 7;
+        tPdofAdofMap.get_adof_ids( 3 )[ 0 ] = 1;
+        tPdofAdofMap.get_adof_ids( 3 )[ 1 ] = 5;
 
         EquObj.create_my_list_of_adof_ids();
 
@@ -496,42 +503,40 @@ namespace moris
         EquObj.mFreePdofs( 2 ) = new Pdof;
         EquObj.mFreePdofs( 3 ) = new Pdof;
 
-        // Set values into mAdofIds of these pdofs
-        EquObj.mFreePdofs( 0 )->mAdofIds.set_size( 2, 1 );
-        EquObj.mFreePdofs( 1 )->mAdofIds.set_size( 1, 1 );
-        EquObj.mFreePdofs( 2 )->mAdofIds.set_size( 4, 1 );
-        EquObj.mFreePdofs( 3 )->mAdofIds.set_size( 2, 1 );
-
-        EquObj.mFreePdofs( 0 )->mAdofIds( 0, 0 ) = 0;
-        EquObj.mFreePdofs( 0 )->mAdofIds( 1, 0 ) = 5;
-        EquObj.mFreePdofs( 1 )->mAdofIds( 0, 0 ) = 15;
-        EquObj.mFreePdofs( 2 )->mAdofIds( 0, 0 ) = 0;
-        EquObj.mFreePdofs( 2 )->mAdofIds( 1, 0 ) = 16;
-        EquObj.mFreePdofs( 2 )->mAdofIds( 2, 0 ) = 19;
-        EquObj.mFreePdofs( 2 )->mAdofIds( 3, 0 ) = 10;
-        EquObj.mFreePdofs( 3 )->mAdofIds( 0, 0 ) = 19;
-        EquObj.mFreePdofs( 3 )->mAdofIds( 1, 0 ) = 5;
-
-        // Set values into mTmatrix of these pdofs
-        Matrix< DDRMat > tTmatrix_1( 2, 1 );
-        Matrix< DDRMat > tTmatrix_2( 1, 1 );
-        Matrix< DDRMat > tTmatrix_3( 4, 1 );
-        Matrix< DDRMat > tTmatrix_4( 2, 1 );
-
-        tTmatrix_1( 0, 0 ) = 1.0;
-        tTmatrix_1( 1, 0 ) = 0.5;
-        tTmatrix_2( 0, 0 ) = 2.0;
-        tTmatrix_3( 0, 0 ) = 5.0;
-        tTmatrix_3( 1, 0 ) = 6.5;
-        tTmatrix_3( 2, 0 ) = 0.2;
-        tTmatrix_3( 3, 0 ) = 0.1;
-        tTmatrix_4( 0, 0 ) = 3.0;
-        tTmatrix_4( 1, 0 ) = 10.1;
-
-        EquObj.mFreePdofs( 0 )->mTmatrix = tTmatrix_1;
-        EquObj.mFreePdofs( 1 )->mTmatrix = tTmatrix_2;
-        EquObj.mFreePdofs( 2 )->mTmatrix = tTmatrix_3;
-        EquObj.mFreePdofs( 3 )->mTmatrix = tTmatrix_4;
+        // Add rows for these pdofs to a pdof-adof map
+        Pdof_Adof_Map tPdofAdofMap;
+        tPdofAdofMap.initialize( 4, 9 );
+
+        uint tNumAdofsPerPdof[ 4 ] = { 2, 1, 4, 2 };
+
+        for ( uint Ii = 0; Ii < 4; Ii++ )
+        {
+            EquObj.mFreePdofs( Ii )->mAdofMap    = &tPdofAdofMap;
+            EquObj.mFreePdofs( Ii )->mAdofMapRow = tPdofAdofMap.add_row( tNumAdofsPerPdof[ Ii ] );
+        }
+
+        // Set adof ids of these pdofs
+
+        tPdofAdofMap.get_adof_ids( 0 )[ 0 ] = 0;
+        tPdofAdofMap.get_adof_ids( 0 )[ 1 ] = 5;
+        tPdofAdofMap.get_adof_ids( 1 )[ 0 ] = 15;
+        tPdofAdofMap.get_adof_ids( 2 )[ 0 ] = 0;
+        tPdofAdofMap.get_adof_ids( 2 )[ 1 ] = 16;
+        tPdofAdofMap.get_adof_ids( 2 )[ 2 ] = 19;
+        tPdofAdofMap.get_adof_ids( 2 )[ 3 ] = 10;
+        tPdofAdofMap.get_adof_ids( 3 )[ 0 ] = 19;
+        tPdofAdofMap.get_adof_ids( 3 )[ 1 ] = 5;
+
+        // Set T-matrix weights of these pdofs
+        tPdofAdofMap.get_weights( 0 )[ 0 ] = 1.0;
+        tPdofAdofMap.get_weights( 0 )[ 1 ] = 0.5;
+        tPdofAdofMap.get_weights( 1 )[ 0 ] = 2.0;
+        tPdofAdofMap.get_weights( 2 )[ 0 ] = 5.0;
+        tPdofAdofMap.get_weights( 2 )[ 1 ] = 6.5;
+        tPdofAdofMap.get_weights( 2 )[ 2 ] = 0.2;
+        tPdofAdofMap.get_weights( 2 )[ 3 ] = 0.1;
+        tPdofAdofMap.get_weights( 3 )[ 0 ] = 3.0;
+        tPdofAdofMap.get_weights( 3 )[ 1 ] = 10.1;
 
         // Bulding PADofMap
         Matrix< DDRMat > tPADofMap;
@@ -166,13 +166,26 @@ namespace moris
 
         tMSI.mDofMgn = tDofMgn;
 
-        tPdofHost.get_adofs( tTimeLevelOffsets, tAdofList, &tMSI, true );
+        // Create pdof-adof map
+        Pdof_Adof_Map tPdofAdofMap;
+        tPdofAdofMap.initialize( tPdofHost.get_num_pdofs(), tPdofHost.count_adofs( &tMSI, true ) );
+
+        CHECK( equal_to( tPdofAdofMap.mAdofIds.size(), 2 ) );
+
+        tPdofHost.get_adofs( tTimeLevelOffsets, tAdofList, &tMSI, true, tPdofAdofMap );
 
         // Check if adofs are set to right spot
         REQUIRE( tAdofList( 0 )( 0 ) != NULL );
         REQUIRE( tAdofList( 0 )( 2 ) != NULL );
         REQUIRE( tAdofList( 0 )( 1 ) == NULL );
 
+        // Check if adofs are stored in the row of the pdof
+        Pdof* tPdof = tPdofHost.get_pdof_time_list( 0 )( 0 );
+
+        CHECK( equal_to( tPdof->get_num_adofs(), 2 ) );
+        CHECK( tPdofAdofMap.mAdofs( tPdofAdofMap.mRowOffsets( tPdof->mAdofMapRow ) ) == tAdofList( 0 )( 0 ) );
+        CHECK( tPdofAdofMap.mAdofs( tPdofAdofMap.mRowOffsets( tPdof->mAdofMapRow ) + 1 ) == tAdofList( 0 )( 2 ) );
+
         delete tNode;
     }
 
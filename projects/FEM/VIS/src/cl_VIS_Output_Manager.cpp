@@ -11,6 +11,7 @@
 #include "cl_VIS_Output_Manager.hpp"
 
 #include <set>
+#include <functional>
 
 #include "cl_VIS_Factory.hpp"
 #include "cl_MDL_Model.hpp"
@@ -103,6 +104,7 @@ namespace moris
 
             tOutputData.mSaveFrequency = aParameterlist.get< moris::sint >( "Save_Frequency" );
             tOutputData.mTimeOffset    = aParameterlist.get< moris::real >( "Time_Offset" );
+            tOutputData.mReuseTopology = aParameterlist.get< bool >( "Reuse_Topology" );
 
             // read and check mesh set names
             moris::Cell< std::string > tSetNames;
@@ -214,7 +216,15 @@ namespace moris
 
                 this->set_visualization_sets( aVisMeshIndex, aEquationModel );
 
-                this->write_mesh( aVisMeshIndex );
+                // append to output file of previous iteration if topology has not changed, otherwise write new file
+                if ( mOutputData( aVisMeshIndex ).mReuseTopology and this->topology_unchanged( aVisMeshIndex ) )
+                {
+                    this->append_to_mesh( aVisMeshIndex );
+                }
+                else
+                {
+                    this->write_mesh( aVisMeshIndex );
+                }
 
                 mVisMeshCreatedAndOpen( aVisMeshIndex ) = true;
             }
@@ -359,6 +369,203 @@ namespace moris
 
             // reset field write counter
             mOutputData( aVisMeshIndex ).mFieldWriteCounter = 0;
+
+            // store topology and coordinates written to file such that following iterations can append to it
+            if ( mOutputData( aVisMeshIndex ).mReuseTopology )
+            {
+                mFileRecords->resize( std::max( (uint)mFileRecords->size(), aVisMeshIndex + 1 ) );
+
+                Output_File_Record& tRecord = ( *mFileRecords )( aVisMeshIndex );
+
+                tRecord.mTopologyHash = mTopologyHash( aVisMeshIndex );
+                tRecord.mMeshFileName = tMeshFileName;
+                tRecord.mFileClosed   = false;
+
+                // get vertices of vis mesh
+                moris::Cell< moris::mtk::Vertex const * > tVertices = mVisMesh( aVisMeshIndex )->get_all_vertices();
+
+                tRecord.mReferenceCoordinates.set_size( tVertices.size(), mVisMesh( aVisMeshIndex )->get_spatial_dim() );
+
+                for ( uint iVert = 0; iVert < tVertices.size(); iVert++ )
+                {
+                    Matrix< DDRMat > tCoords = tVertices( iVert )->get_coords();
+
+                    for ( uint iDim = 0; iDim < tCoords.numel(); iDim++ )
+                    {
+                        tRecord.mReferenceCoordinates( tVertices( iVert )->get_index(), iDim ) = tCoords( iDim );
+                    }
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------------------------
+
+        std::size_t
+        Output_Manager::compute_topology_hash( const uint aVisMeshIndex )
+        {
+            mtk::Mesh* tMesh = mVisMesh( aVisMeshIndex );
+
+            std::size_t tHash = 0;
+
+            // combines value with hash
+            auto tCombine = [ &tHash ]( const std::size_t aValue ) {
+                tHash ^= std::hash< std::size_t >{}( aValue ) + 0x9e3779b9 + ( tHash << 6 ) + ( tHash >> 2 );
+            };
+
+            tCombine( tMesh->get_num_nodes() );
+            tCombine( tMesh->get_num_elems() );
+
+            // vertex IDs on the integration mesh in order of the vis mesh
+            moris::Cell< moris::mtk::Vertex const * > tVertices = tMesh->get_all_vertices();
+
+            for ( uint iVert = 0; iVert < tVertices.size(); iVert++ )
+            {
+                tCombine( tVertices( iVert )->get_index() );
+                tCombine( static_cast< const vis::Vertex_Visualization* >( tVertices( iVert ) )->get_integration_id() );
+            }
+
+            // cell IDs and connectivity per block
+            moris::Cell< std::string > tBlockNames = tMesh->get_set_names( EntityRank::ELEMENT );
+
+            for ( uint iBlock = 0; iBlock < tBlockNames.size(); iBlock++ )
+            {
+                tCombine( std::hash< std::string >{}( tBlockNames( iBlock ) ) );
+
+                Matrix< IndexMat > tElementIndices = tMesh->get_element_indices_in_block_set( iBlock );
+                Matrix< IdMat >    tElementIDs     = tMesh->get_element_ids_in_block_set( iBlock );
+
+                for ( uint iElem = 0; iElem < tElementIndices.numel(); iElem++ )
+                {
+                    tCombine( tElementIDs( iElem ) );
+
+                    Matrix< IndexMat > tNodeIndices = tMesh->get_nodes_connected_to_element_loc_inds( tElementIndices( iElem ) );
+
+                    for ( uint iNode = 0; iNode < tNodeIndices.numel(); iNode++ )
+                    {
+                        tCombine( tNodeIndices( iNode ) );
+                    }
+                }
+            }
+
+            // element indices and ordinals per side set
+            moris::Cell< std::string > tSideSetNames = tMesh->get_set_names( tMesh->get_facet_rank() );
+
+            for ( uint iSideSet = 0; iSideSet < tSideSetNames.size(); iSideSet++ )
+            {
+                tCombine( std::hash< std::string >{}( tSideSetNames( iSideSet ) ) );
+
+                Matrix< IndexMat > tSideSetElements;
+                Matrix< IndexMat > tSideSetOrdinals;
+                tMesh->get_sideset_elems_loc_inds_and_ords(
+                        tSideSetNames( iSideSet ),
+                        tSideSetElements,
+                        tSideSetOrdinals );
+
+                for ( uint iElem = 0; iElem < tSideSetElements.numel(); iElem++ )
+                {
+                    tCombine( tSideSetElements( iElem ) );
+                    tCombine( tSideSetOrdinals( iElem ) );
+                }
+            }
+
+            return tHash;
+        }
+
+        //-----------------------------------------------------------------------------------------------------------
+
+        bool
+        Output_Manager::topology_unchanged( const uint aVisMeshIndex )
+        {
+            Tracer tTracer( "Output_Manager", "VisMesh", "CompareTopology" );
+
+            // compute and store hash of current vis mesh
+            mTopologyHash.resize( mOutputData.size(), 0 );
+
+            mTopologyHash( aVisMeshIndex ) = this->compute_topology_hash( aVisMeshIndex );
+
+            // check whether a file with the same topology exists and has been closed
+            bool tUnchanged = aVisMeshIndex < mFileRecords->size();
+
+            if ( tUnchanged )
+            {
+                Output_File_Record const & tRecord = ( *mFileRecords )( aVisMeshIndex );
+
+                tUnchanged = tRecord.mFileClosed
+                         and tRecord.mTopologyHash == mTopologyHash( aVisMeshIndex )
+                         and tRecord.mReferenceCoordinates.n_rows() == mVisMesh( aVisMeshIndex )->get_num_nodes();
+            }
+
+            // all processors need to either append or write a new file
+            return all_land( tUnchanged );
+        }
+
+        //-----------------------------------------------------------------------------------------------------------
+
+        void
+        Output_Manager::append_to_mesh( const uint aVisMeshIndex )
+        {
+            Tracer tTracer( "Output_Manager", "VisMesh", "AppendVisMesh" );
+
+            Output_File_Record& tRecord = ( *mFileRecords )( aVisMeshIndex );
+
+            // determine time shift
+            if ( mOutputData( aVisMeshIndex ).mTimeOffset > 0 )
+            {
+                mTimeShift = gLogger.get_opt_iteration() * mOutputData( aVisMeshIndex ).mTimeOffset;
+            }
+
+            // Log mesh writing message
+            MORIS_LOG( "Topology unchanged, appending to %s in %s.",
+                    tRecord.mMeshFileName.c_str(),
+                    mOutputData( aVisMeshIndex ).mMeshPath.c_str() );
+
+            // reopen file and restore writer state
+            mWriter( aVisMeshIndex )->append_to_mesh_file(
+                    mOutputData( aVisMeshIndex ).mMeshPath,
+                    tRecord.mMeshFileName,
+                    mOutputData( aVisMeshIndex ).mTempPath,
+                    mOutputData( aVisMeshIndex ).mTempName );
+
+            tRecord.mFileClosed = false;
+
+            // reset field write counter
+            mOutputData( aVisMeshIndex ).mFieldWriteCounter = 0;
+        }
+
+        //-----------------------------------------------------------------------------------------------------------
+
+        void
+        Output_Manager::write_shape_displacements( const uint aVisMeshIndex )
+        {
+            Output_File_Record const & tRecord = ( *mFileRecords )( aVisMeshIndex );
+
+            // getting the vertices on the vis mesh
+            moris::Cell< moris::mtk::Vertex const * > tVertices = mVisMesh( aVisMeshIndex )->get_all_vertices();
+
+            uint tSpatialDim = mVisMesh( aVisMeshIndex )->get_spatial_dim();
+
+            Matrix< DDRMat > tDisplacements( tVertices.size(), tSpatialDim );
+
+            for ( uint iVert = 0; iVert < tVertices.size(); iVert++ )
+            {
+                moris_index tIndex = tVertices( iVert )->get_index();
+
+                Matrix< DDRMat > tCoords = tVertices( iVert )->get_coords();
+
+                for ( uint iDim = 0; iDim < tSpatialDim; iDim++ )
+                {
+                    tDisplacements( tIndex, iDim ) = tCoords( iDim ) - tRecord.mReferenceCoordinates( tIndex, iDim );
+                }
+            }
+
+            moris::Cell< std::string > tDisplacementNames = { "Displ_Shape_X", "Displ_Shape_Y", "Displ_Shape_Z" };
+
+            for ( uint iDim = 0; iDim < tSpatialDim; iDim++ )
+            {
+                Matrix< DDRMat > tFieldValues = tDisplacements.get_column( iDim );
+
+                mWriter( aVisMeshIndex )->write_nodal_field( tDisplacementNames( iDim ), tFieldValues );
+            }
         }
 
         //-----------------------------------------------------------------------------------------------------------
@@ -378,6 +585,21 @@ namespace moris
 
             uint tCounter = 2;
 
+            // add shape displacements with respect to the coordinates written to the file
+            if ( mOutputData( aVisMeshIndex ).mReuseTopology )
+            {
+                moris::Cell< std::string > tDisplacementNames = { "Displ_Shape_X", "Displ_Shape_Y", "Displ_Shape_Z" };
+
+                uint tSpatialDim = mVisMesh( aVisMeshIndex )->get_spatial_dim();
+
+                tNodalFieldNames.resize( tNodalFieldNames.size() + tSpatialDim );
+
+                for ( uint iDim = 0; iDim < tSpatialDim; iDim++ )
+                {
+                    tNodalFieldNames( tCounter++ ) = tDisplacementNames( iDim );
+                }
+            }
+
             // loop over field names and check if fields are nodal fields
             for ( uint iField = 0; iField < tFieldNames.size(); iField++ )
             {
@@ -508,11 +730,11 @@ namespace moris
 
                 // get the moris ID
                 moris_id tVertId =
-                        reinterpret_cast< const vis::Vertex_Visualization* >( tVertices( iVert ) )->get_integration_id();
+                        static_cast< const vis::Vertex_Visualization* >( tVertices( iVert ) )->get_integration_id();
 
                 // get the moris index
                 moris_index tVertIndex =
-                        reinterpret_cast< const vis::Vertex_Visualization* >( tVertices( iVert ) )->get_integration_index();
+                        static_cast< const vis::Vertex_Visualization* >( tVertices( iVert ) )->get_integration_index();
 
                 // assign moris ID and index
                 tVertIdIndex( 0 )( tIndex ) = tVertId;
@@ -613,10 +835,10 @@ namespace moris
                         moris_index tIndex = tPrimaryCells( iPrimaryCell )->get_index();
 
                         moris_id tMeshId =
-                                reinterpret_cast< const vis::Cell_Visualization* >( tPrimaryCells( iPrimaryCell ) )->get_mesh_cell_id();
+                                static_cast< const vis::Cell_Visualization* >( tPrimaryCells( iPrimaryCell ) )->get_mesh_cell_id();
 
                         moris_index tMeshIndex =
-                                reinterpret_cast< const vis::Cell_Visualization* >( tPrimaryCells( iPrimaryCell ) )->get_mesh_cell_index();
+                                static_cast< const vis::Cell_Visualization* >( tPrimaryCells( iPrimaryCell ) )->get_mesh_cell_index();
 
                         tIdIndex( 0 )( tCellAssemblyMap( tIndex ) ) = tMeshId;
                         tIdIndex( 1 )( tCellAssemblyMap( tIndex ) ) = tMeshIndex;
@@ -630,10 +852,10 @@ namespace moris
                         moris_index tIndex = tVoidCells( iVoidCell )->get_index();
 
                         moris_id tMeshId =
-                                reinterpret_cast< const vis::Cell_Visualization* >( tVoidCells( iVoidCell ) )->get_mesh_cell_id();
+                                static_cast< const vis::Cell_Visualization* >( tVoidCells( iVoidCell ) )->get_mesh_cell_id();
 
                         moris_index tMeshIndex =
-                                reinterpret_cast< const vis::Cell_Visualization* >( tVoidCells( iVoidCell ) )->get_mesh_cell_index();
+                                static_cast< const vis::Cell_Visualization* >( tVoidCells( iVoidCell ) )->get_mesh_cell_index();
 
                         tIdIndex( 0 )( tCellAssemblyMap( tIndex ) ) = tMeshId;
                         tIdIndex( 1 )( tCellAssemblyMap( tIndex ) ) = tMeshIndex;
@@ -680,6 +902,12 @@ namespace moris
             // write time to file
             mWriter( aVisMeshIndex )->set_time( aTime + mTimeShift );
 
+            // write vertex displacements with respect to coordinates stored in file
+            if ( mOutputData( aVisMeshIndex ).mReuseTopology )
+            {
+                this->write_shape_displacements( aVisMeshIndex );
+            }
+
             // get mesh set to fem set index map
             map< std::tuple< moris_index, bool, bool >, moris_index >& tMeshSetToFemSetMap =
                     aEquationModel->get_mesh_set_to_fem_set_index_map();
@@ -11,6 +11,8 @@
 #ifndef SRC_FEM_CL_VIS_OUTPUT_DATA_HPP_
 #define SRC_FEM_CL_VIS_OUTPUT_DATA_HPP_
 
+#include <memory>
+
 #include "cl_Cell.hpp"
 #include "cl_Communication_Tools.hpp"
 #include "cl_Communication_Manager.hpp"
@@ -86,6 +88,31 @@ namespace moris
 
             //! Quantity of interest names
             moris::Cell< std::string > mQINames;
+
+            //! Append to the output file of the previous optimization iteration if the topology is unchanged.
+            //! Only the exodus topology output is skipped, the VIS mesh itself is still rebuilt for every output.
+            bool mReuseTopology = false;
+        };
+
+        //-----------------------------------------------------------------------------------------------------------
+
+        /**
+         * information about the output file of a VIS mesh which is kept across optimization iterations,
+         * used to append time steps to an existing file if the topology of the VIS mesh does not change
+         */
+        struct Output_File_Record
+        {
+            //! hash of the VIS mesh topology written to the file
+            std::size_t mTopologyHash = 0;
+
+            //! name of the file the topology has been written to
+            std::string mMeshFileName;
+
+            //! flag whether the file has been closed and can be reopened
+            bool mFileClosed = false;
+
+            //! vertex coordinates written to the file, used to output shape displacements
+            Matrix< DDRMat > mReferenceCoordinates;
         };
 
         //-----------------------------------------------------------------------------------------------------------
@@ -108,6 +135,13 @@ namespace moris
 
             moris::real mTimeShift = 0.0;
 
+            //! topology hash of each VIS mesh computed in the current iteration
+            moris::Cell< std::size_t > mTopologyHash;
+
+            //! records of output files, may be shared across optimization iterations
+            std::shared_ptr< moris::Cell< Output_File_Record > > mFileRecords =
+                    std::make_shared< moris::Cell< Output_File_Record > >();
+
           protected:
 
           public:
@@ -165,6 +199,12 @@ namespace moris
                 if ( mWriter( aVisMeshIndex ) != nullptr )
                 {
                     mWriter( aVisMeshIndex )->close_file();
+
+                    // mark file as complete such that it can be appended to
+                    if ( aVisMeshIndex < mFileRecords->size() )
+                    {
+                        ( *mFileRecords )( aVisMeshIndex ).mFileClosed = true;
+                    }
                 }
 
                 this->delete_pointers( aVisMeshIndex );
@@ -213,10 +253,60 @@ namespace moris
 
             //-----------------------------------------------------------------------------------------------------------
 
+            /**
+             * set the output file records, used to keep them alive across optimization iterations
+             *
+             * @param[ in ] aFileRecords pointer to list of output file records
+             */
+            void
+            set_file_records( std::shared_ptr< moris::Cell< Output_File_Record > > aFileRecords )
+            {
+                mFileRecords = aFileRecords;
+            }
+
+            //-----------------------------------------------------------------------------------------------------------
+
+            /**
+             * computes a hash of the VIS mesh topology, i.e. vertex IDs, cell IDs, cell connectivity and side sets
+             *
+             * @param[ in ] aVisMeshIndex index of VIS mesh
+             */
+            std::size_t compute_topology_hash( const uint aVisMeshIndex );
+
+            //-----------------------------------------------------------------------------------------------------------
+
+            /**
+             * checks on all processors whether the topology of the VIS mesh matches the one written to the output file
+             * of the previous iteration
+             *
+             * @param[ in ] aVisMeshIndex index of VIS mesh
+             */
+            bool topology_unchanged( const uint aVisMeshIndex );
+
+            //-----------------------------------------------------------------------------------------------------------
+
             void write_mesh( const uint aVisMeshIndex );
 
             //-----------------------------------------------------------------------------------------------------------
 
+            /**
+             * reopens the output file of the previous iteration and appends the following time steps to it
+             *
+             * @param[ in ] aVisMeshIndex index of VIS mesh
+             */
+            void append_to_mesh( const uint aVisMeshIndex );
+
+            //-----------------------------------------------------------------------------------------------------------
+
+            /**
+             * writes the displacement of the vertices with respect to the coordinates stored in the output file
+             *
+             * @param[ in ] aVisMeshIndex index of VIS mesh
+             */
+            void write_shape_displacements( const uint aVisMeshIndex );
+
+            //-----------------------------------------------------------------------------------------------------------
+
             void write_mesh_indices( const uint aVisMeshIndex );
 
             //-----------------------------------------------------------------------------------------------------------
@@ -719,5 +719,169 @@ namespace moris
                 delete tInterpMesh;
             }
         }
+        TEST_CASE( " Output Data reuse topology", "[VIS],[Output_Data_Reuse_Topology]" )
+        {
+            if ( par_size() == 1 )
+            {
+                moris::hmr::Parameters tParameters;
+
+                tParameters.set_number_of_elements_per_dimension( { { 4 }, { 2 } } );
+                tParameters.set_domain_dimensions( { { 2 }, { 1 } } );
+                tParameters.set_domain_offset( { { -1.0 }, { -0.0 } } );
+                tParameters.set_bspline_truncation( true );
+
+                tParameters.set_lagrange_orders( { { 1 } } );
+                tParameters.set_lagrange_patterns( { { 0 } } );
+
+                tParameters.set_bspline_orders( { { 1 } } );
+                tParameters.set_bspline_patterns( { { 0 } } );
+
+                tParameters.set_side_sets( { { 1 }, { 2 }, { 3 }, { 4 } } );
+
+                Cell< Matrix< DDSMat > > tLagrangeToBSplineMesh( 1 );
+                tLagrangeToBSplineMesh( 0 ) = { { 0 } };
+
+                tParameters.set_lagrange_to_bspline_mesh( tLagrangeToBSplineMesh );
+
+                hmr::HMR tHMR( tParameters );
+
+                tHMR.finalize();
+
+                hmr::Interpolation_Mesh_HMR* tInterpMesh = tHMR.create_interpolation_mesh( 0 );
+
+                moris::Cell< std::shared_ptr< moris::ge::Geometry > > tGeometryVector( 1 );
+                tGeometryVector( 0 ) = std::make_shared< moris::ge::Plane >( 0.11, 0.11, 1.0, 0.0 );
+
+                moris::ge::Geometry_Engine_Parameters tGeometryEngineParameters;
+                tGeometryEngineParameters.mGeometries = tGeometryVector;
+                moris::ge::Geometry_Engine tGeometryEngine( tInterpMesh, tGeometryEngineParameters );
+
+                xtk::Model tXTKModel( 2, tInterpMesh, &tGeometryEngine );
+                tXTKModel.mVerbose = false;
+
+                Cell< enum Subdivision_Method > tDecompositionMethods = { Subdivision_Method::NC_REGULAR_SUBDIVISION_QUAD4, Subdivision_Method::C_TRI3 };
+                tXTKModel.decompose( tDecompositionMethods );
+
+                tXTKModel.perform_basis_enrichment( EntityRank::BSPLINE, 0 );
+
+                xtk::Enriched_Interpolation_Mesh& tEnrInterpMesh = tXTKModel.get_enriched_interp_mesh();
+                xtk::Enriched_Integration_Mesh&   tEnrIntegMesh  = tXTKModel.get_enriched_integ_mesh();
+
+                std::shared_ptr< mtk::Mesh_Manager > tMeshManager = std::make_shared< mtk::Mesh_Manager >();
+                tMeshManager->register_mesh_pair( &tEnrInterpMesh, &tEnrIntegMesh );
+
+                //------------------------------------------------------------------------------
+                // create a model with bulk sets only, no solve is needed to write the topology
+
+                std::shared_ptr< fem::Property > tPropEMod = std::make_shared< fem::Property >();
+                tPropEMod->set_parameters( { { { 1.0 } } } );
+                tPropEMod->set_val_function( tConstValFunction_VISOutputManager );
+
+                std::shared_ptr< fem::Property > tPropNu = std::make_shared< fem::Property >();
+                tPropNu->set_parameters( { { { 0.3 } } } );
+                tPropNu->set_val_function( tConstValFunction_VISOutputManager );
+
+                fem::CM_Factory tCMFactory;
+
+                std::shared_ptr< fem::Constitutive_Model > tCMElastLinIso =
+                        tCMFactory.create_CM( fem::Constitutive_Type::STRUC_LIN_ISO );
+                tCMElastLinIso->set_dof_type_list( { { MSI::Dof_Type::UX, MSI::Dof_Type::UY } } );
+                tCMElastLinIso->set_property( tPropEMod, "YoungsModulus" );
+                tCMElastLinIso->set_property( tPropNu, "PoissonRatio" );
+                tCMElastLinIso->set_space_dim( 2 );
+                tCMElastLinIso->set_local_properties();
+
+                fem::IQI_Factory tIQIFactory;
+
+                std::shared_ptr< fem::IQI > tIQI = tIQIFactory.create_IQI( fem::IQI_Type::STRAIN_ENERGY );
+                tIQI->set_constitutive_model( tCMElastLinIso, "Elast", mtk::Leader_Follower::LEADER );
+                tIQI->set_name( "IQI" );
+
+                fem::IWG_Factory tIWGFactory;
+
+                std::shared_ptr< fem::IWG > tIWGBulk = tIWGFactory.create_IWG( fem::IWG_Type::STRUC_LINEAR_BULK );
+                tIWGBulk->set_residual_dof_type( { { MSI::Dof_Type::UX, MSI::Dof_Type::UY } } );
+                tIWGBulk->set_dof_type_list( { { MSI::Dof_Type::UX, MSI::Dof_Type::UY } } );
+                tIWGBulk->set_constitutive_model( tCMElastLinIso, "ElastLinIso", mtk::Leader_Follower::LEADER );
+
+                moris::Cell< std::string >        tBulkSetNames = { "HMR_dummy_c_p0", "HMR_dummy_n_p0", "HMR_dummy_c_p1", "HMR_dummy_n_p1" };
+                moris::Cell< fem::Set_User_Info > tSetInfo( tBulkSetNames.size() );
+
+                for ( uint iSet = 0; iSet < tBulkSetNames.size(); iSet++ )
+                {
+                    tSetInfo( iSet ).set_mesh_set_name( tBulkSetNames( iSet ) );
+                    tSetInfo( iSet ).set_IWGs( { tIWGBulk } );
+                    tSetInfo( iSet ).set_IQIs( { tIQI } );
+                }
+
+                mdl::Model* tModel = new mdl::Model( tMeshManager, 0, tSetInfo );
+
+                //------------------------------------------------------------------------------
+                // output parameters
+
+                std::string tMorisOutput = std::getenv( "MORISOUTPUT" );
+
+                MORIS_ERROR( tMorisOutput.size() > 0,
+                        "Environment variable MORISOUTPUT not set." );
+
+                moris::ParameterList tParameterList = moris::prm::create_vis_parameter_list();
+
+                tParameterList.set( "File_Name", std::pair< std::string, std::string >( tMorisOutput, "Vis_Reuse_Topology_Test.exo" ) );
+                tParameterList.set( "Set_Names", std::string( "HMR_dummy_c_p0,HMR_dummy_c_p1,HMR_dummy_n_p0,HMR_dummy_n_p1" ) );
+                tParameterList.set( "Field_Names", std::string( "strain_energy_nodal_IP" ) );
+                tParameterList.set( "Field_Type", std::string( "NODAL" ) );
+                tParameterList.set( "IQI_Names", std::string( "IQI" ) );
+                tParameterList.set( "Reuse_Topology", true );
+
+                // records of written files shared by all output managers, as done by the model across iterations
+                std::shared_ptr< moris::Cell< Output_File_Record > > tFileRecords =
+                        std::make_shared< moris::Cell< Output_File_Record > >();
+
+                // writes the VIS mesh and one time step with a new output manager, returns the number of
+                // time steps in the file before the new one has been added
+                auto tWriteOutput = [ & ]( moris::ParameterList& aParameterList, std::size_t& aTopologyHash ) -> uint {
+                    Output_Manager tOutputManager( aParameterList );
+                    tOutputManager.set_file_records( tFileRecords );
+
+                    tOutputManager.setup_vis_mesh_for_output( 0, tMeshManager, 0, tModel->get_fem_model() );
+
+                    aTopologyHash = tOutputManager.compute_topology_hash( 0 );
+
+                    uint tNumTimeSteps = tOutputManager.mWriter( 0 )->mTimeStep;
+
+                    tOutputManager.mWriter( 0 )->set_time( 0.0 );
+
+                    tOutputManager.end_writing( 0 );
+
+                    return tNumTimeSteps;
+                };
+
+                std::size_t tHashFirst  = 0;
+                std::size_t tHashSecond = 0;
+                std::size_t tHashThird  = 0;
+
+                // first output writes the topology
+                CHECK( tWriteOutput( tParameterList, tHashFirst ) == 0 );
+
+                REQUIRE( tFileRecords->size() == 1 );
+                CHECK( ( *tFileRecords )( 0 ).mFileClosed );
+                CHECK( ( *tFileRecords )( 0 ).mTopologyHash == tHashFirst );
+
+                // second output with the same topology appends to the file, i.e. the connectivity is not written again
+                // note: the VIS mesh itself is rebuilt nonetheless, only the exodus topology output is skipped
+                CHECK( tWriteOutput( tParameterList, tHashSecond ) == 1 );
+                CHECK( tHashSecond == tHashFirst );
+
+                // fewer sets change the topology, such that the file is rewritten
+                tParameterList.set( "Set_Names", std::string( "HMR_dummy_c_p0,HMR_dummy_n_p0" ) );
+
+                CHECK( tWriteOutput( tParameterList, tHashThird ) == 0 );
+                CHECK( tHashThird != tHashFirst );
+                CHECK( ( *tFileRecords )( 0 ).mTopologyHash == tHashThird );
+
+                delete tModel;
+                delete tInterpMesh;
+            }
+        }
     }    // namespace vis
 }    // namespace moris
@@ -305,6 +305,33 @@ namespace moris
             return &mPDVHostManager;
         }
 
+        //--------------------------------------------------------------------------------------------------------------
+
+        bool
+        Geometry_Engine::requires_shape_sensitivities()
+        {
+            // same logic as in distribute_advs()
+            for ( uint tGeometryIndex = 0; tGeometryIndex < mGeometries.size(); tGeometryIndex++ )
+            {
+                if ( mGeometries( tGeometryIndex )->depends_on_advs() or mGeometries( tGeometryIndex )->intended_discretization() )
+                {
+                    return true;
+                }
+            }
+
+            for ( uint tPropertyIndex = 0; tPropertyIndex < mProperties.size(); tPropertyIndex++ )
+            {
+                if ( mProperties( tPropertyIndex )->intended_discretization() )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         bool
         Geometry_Engine::geometric_query( Geometric_Query_Interface* aGeometricQuery )
         {
@@ -505,10 +532,48 @@ namespace moris
                 const Matrix< DDRMat >&         aSecondNodeGlobalCoordinates,
                 const Matrix< DDUMat >&         aBackgroundElementNodeIndices,
                 const Cell< Matrix< DDRMat > >& aBackgroundElementNodeCoordinates )
+        {
+            std::shared_ptr< Intersection_Node > tIntersectionNode = this->create_intersection_node(
+                    aFirstNodeIndex,
+                    aSecondNodeIndex,
+                    aFirstNodeLocalCoordinates,
+                    aSecondNodeLocalCoordinates,
+                    aFirstNodeGlobalCoordinates,
+                    aSecondNodeGlobalCoordinates,
+                    aBackgroundElementNodeIndices,
+                    aBackgroundElementNodeCoordinates );
+
+            // colored edges which are not intersected do not queue a node
+            if ( tIntersectionNode == nullptr )
+            {
+                return false;
+            }
+
+            // Queue the intersection node
+            mQueuedIntersectionNode = tIntersectionNode;
+
+            return mQueuedIntersectionNode->parent_edge_is_intersected();
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        std::shared_ptr< Intersection_Node >
+        Geometry_Engine::create_intersection_node(
+                uint                            aFirstNodeIndex,
+                uint                            aSecondNodeIndex,
+                const Matrix< DDRMat >&         aFirstNodeLocalCoordinates,
+                const Matrix< DDRMat >&         aSecondNodeLocalCoordinates,
+                const Matrix< DDRMat >&         aFirstNodeGlobalCoordinates,
+                const Matrix< DDRMat >&         aSecondNodeGlobalCoordinates,
+                const Matrix< DDUMat >&         aBackgroundElementNodeIndices,
+                const Cell< Matrix< DDRMat > >& aBackgroundElementNodeCoordinates )
         {
             // Get the current geometries intersection mode
             Intersection_Mode tIntersectionMode = mGeometries( mActiveGeometryIndex )->get_intersection_mode();
-            // Queue an intersection node
+
+            std::shared_ptr< Intersection_Node > tIntersectionNode;
+
+            // Create an intersection node
             switch ( tIntersectionMode )
             {
                 case Intersection_Mode::LEVEL_SET:
@@ -517,7 +582,7 @@ namespace moris
                     {
                         case Intersection_Interpolation::LINEAR:
                         {
-                            mQueuedIntersectionNode = std::make_shared< Intersection_Node_Linear >(
+                            tIntersectionNode = std::make_shared< Intersection_Node_Linear >(
                                     mPDVHostManager.get_intersection_node( aFirstNodeIndex ),
                                     mPDVHostManager.get_intersection_node( aSecondNodeIndex ),
                                     aFirstNodeIndex,
@@ -532,7 +597,7 @@ namespace moris
                             Element_Intersection_Type tInterpolationType =
                                     mNumSpatialDimensions == 2 ? Element_Intersection_Type::Linear_2D : Element_Intersection_Type::Linear_3D;
 
-                            mQueuedIntersectionNode = std::make_shared< Intersection_Node_Bilinear >(
+                            tIntersectionNode = std::make_shared< Intersection_Node_Bilinear >(
                                     mPDVHostManager.get_intersection_node( aFirstNodeIndex ),
                                     mPDVHostManager.get_intersection_node( aSecondNodeIndex ),
                                     aFirstNodeIndex,
@@ -557,7 +622,7 @@ namespace moris
                     // Determine if edge is intersected
                     if ( mGeometries( mActiveGeometryIndex )->get_field_value( aFirstNodeIndex, aFirstNodeGlobalCoordinates ) != mGeometries( mActiveGeometryIndex )->get_field_value( aSecondNodeIndex, aSecondNodeGlobalCoordinates ) )
                     {
-                        mQueuedIntersectionNode = std::make_shared< Intersection_Node_Linear >(
+                        tIntersectionNode = std::make_shared< Intersection_Node_Linear >(
                                 mPDVHostManager.get_intersection_node( aFirstNodeIndex ),
                                 mPDVHostManager.get_intersection_node( aSecondNodeIndex ),
                                 aFirstNodeIndex,
@@ -568,18 +633,18 @@ namespace moris
                     }
                     else
                     {
-                        return false;
+                        return nullptr;
                     }
 
                     break;
                 }
                 default:
                 {
-                    MORIS_ERROR( false, "Geometry_Engine::queue_intersection(), unknown intersection type." );
+                    MORIS_ERROR( false, "Geometry_Engine::create_intersection_node(), unknown intersection type." );
                 }
             }
 
-            return mQueuedIntersectionNode->parent_edge_is_intersected();
+            return tIntersectionNode;
         }
 
         //--------------------------------------------------------------------------------------------------------------
@@ -650,6 +715,109 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        Edge_Intersections
+        Geometry_Engine::compute_edge_intersections(
+                moris_index                                        aGeometryIndex,
+                const Matrix< IndexMat >&                          aEdgeVertices,
+                const Cell< moris::mtk::Cell* >&                   aEdgeParentCells,
+                const Cell< std::shared_ptr< Matrix< DDRMat > > >& aEdgeVertexLocalCoordinates,
+                const Cell< std::shared_ptr< Matrix< DDRMat > > >& aVertexCoordinates )
+        {
+            uint tNumEdges = aEdgeVertices.n_rows();
+
+            MORIS_ASSERT( aEdgeParentCells.size() == tNumEdges and aEdgeVertexLocalCoordinates.size() == 2 * tNumEdges,
+                    "Geometry_Engine::compute_edge_intersections(), edge data has inconsistent sizes." );
+
+            mActiveGeometryIndex = aGeometryIndex;
+
+            // allocate output for all edges
+            Edge_Intersections tEdgeIntersections;
+            tEdgeIntersections.mIntersectionNodes.resize( tNumEdges, nullptr );
+            tEdgeIntersections.mIsIntersected.resize( tNumEdges, 0 );
+            tEdgeIntersections.mFirstParentOnInterface.resize( tNumEdges, 0 );
+            tEdgeIntersections.mSecondParentOnInterface.resize( tNumEdges, 0 );
+            tEdgeIntersections.mLocalCoordinates.resize( tNumEdges, 0.0 );
+            tEdgeIntersections.mGlobalCoordinates.resize( tNumEdges );
+
+            // node indices and coordinates of the current parent cell
+            moris::mtk::Cell*        tParentCell = nullptr;
+            Matrix< DDUMat >         tParentCellNodeIndices;
+            Cell< Matrix< DDRMat > > tParentCellNodeCoordinates;
+
+            for ( uint iEdge = 0; iEdge < tNumEdges; iEdge++ )
+            {
+                // consecutive edges mostly share their parent cell, only copy its data when it changes
+                if ( aEdgeParentCells( iEdge ) != tParentCell )
+                {
+                    tParentCell = aEdgeParentCells( iEdge );
+
+                    Matrix< IndexMat > tVertexIndices = tParentCell->get_vertex_inds();
+
+                    tParentCellNodeIndices.set_size( tVertexIndices.numel(), 1 );
+                    tParentCellNodeCoordinates.resize( tVertexIndices.numel() );
+
+                    for ( uint iVertex = 0; iVertex < tVertexIndices.numel(); iVertex++ )
+                    {
+                        tParentCellNodeIndices( iVertex )     = (uint)tVertexIndices( iVertex );
+                        tParentCellNodeCoordinates( iVertex ) = *aVertexCoordinates( tVertexIndices( iVertex ) );
+                    }
+                }
+
+                moris_index tFirstVertex  = aEdgeVertices( iEdge, 0 );
+                moris_index tSecondVertex = aEdgeVertices( iEdge, 1 );
+
+                std::shared_ptr< Intersection_Node > tIntersectionNode = this->create_intersection_node(
+                        tFirstVertex,
+                        tSecondVertex,
+                        *aEdgeVertexLocalCoordinates( 2 * iEdge ),
+                        *aEdgeVertexLocalCoordinates( 2 * iEdge + 1 ),
+                        *aVertexCoordinates( tFirstVertex ),
+                        *aVertexCoordinates( tSecondVertex ),
+                        tParentCellNodeIndices,
+                        tParentCellNodeCoordinates );
+
+                if ( tIntersectionNode == nullptr or not tIntersectionNode->parent_edge_is_intersected() )
+                {
+                    continue;
+                }
+
+                tEdgeIntersections.mIntersectionNodes( iEdge )       = tIntersectionNode;
+                tEdgeIntersections.mIsIntersected( iEdge )           = 1;
+                tEdgeIntersections.mFirstParentOnInterface( iEdge )  = tIntersectionNode->first_parent_on_interface();
+                tEdgeIntersections.mSecondParentOnInterface( iEdge ) = tIntersectionNode->second_parent_on_interface();
+                tEdgeIntersections.mLocalCoordinates( iEdge )        = tIntersectionNode->get_local_coordinate();
+                tEdgeIntersections.mGlobalCoordinates( iEdge )       = tIntersectionNode->get_global_coordinates();
+            }
+
+            return tEdgeIntersections;
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void
+        Geometry_Engine::admit_edge_intersections(
+                const Edge_Intersections&  aEdgeIntersections,
+                const Cell< moris_index >& aEdgeIndices,
+                const Cell< moris_index >& aNodeIndices )
+        {
+            MORIS_ASSERT( aEdgeIndices.size() == aNodeIndices.size(),
+                    "Geometry_Engine::admit_edge_intersections(), number of edges and node indices do not match." );
+
+            for ( uint iNode = 0; iNode < aEdgeIndices.size(); iNode++ )
+            {
+                MORIS_ASSERT( aEdgeIntersections.mIsIntersected( aEdgeIndices( iNode ) ),
+                        "Geometry_Engine::admit_edge_intersections(), edge %i is not intersected.",
+                        aEdgeIndices( iNode ) );
+
+                // admission and proximity computation work on the queued node
+                mQueuedIntersectionNode = aEdgeIntersections.mIntersectionNodes( aEdgeIndices( iNode ) );
+
+                this->admit_queued_intersection( aNodeIndices( iNode ) );
+            }
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         void
         Geometry_Engine::update_queued_intersection(
                 const moris_index& aNodeIndex,
@@ -18,6 +18,7 @@
 
 // GEN
 #include "st_GEN_Geometry_Engine_Parameters.hpp"
+#include "st_GEN_Edge_Intersections.hpp"
 #include "cl_GEN_Phase_Table.hpp"
 #include "cl_GEN_Pdv_Host_Manager.hpp"
 #include "cl_GEN_Geometric_Proximity.hpp"
@@ -253,6 +254,16 @@ namespace moris
              */
             MSI::Design_Variable_Interface* get_design_variable_interface();
 
+            //-------------------------------------------------------------------------------
+
+            /**
+             * Determines if shape sensitivities are needed, i.e. if a geometry depends on ADVs or if a geometry or
+             * property is discretized. Unlike the flag set in distribute_advs(), this does not require a mesh.
+             *
+             * @return if shape sensitivities are needed
+             */
+            bool requires_shape_sensitivities();
+
             //-------------------------------------------------------------------------------
             
             /**
@@ -347,6 +358,43 @@ namespace moris
 
             //-------------------------------------------------------------------------------
             
+            /**
+             * Determines the intersections of all given edges with a geometry in one call. Unlike queue_intersection(),
+             * the results are returned instead of being stored in the engine, so that the edges do not need to be
+             * processed one after the other. The intersections are made permanent with admit_edge_intersections().
+             *
+             * @param aGeometryIndex Index of the geometry to intersect with, becomes the active geometry
+             * @param aEdgeVertices Vertex indices of all edges, one row per edge
+             * @param aEdgeParentCells Background cell of every edge
+             * @param aEdgeVertexLocalCoordinates Local coordinates of the edge vertices inside the background cell,
+             *        entries 2 * i and 2 * i + 1 belong to edge i
+             * @param aVertexCoordinates Global coordinates of all vertices, indexed by vertex index
+             * @return Intersection data of all edges
+             */
+            Edge_Intersections compute_edge_intersections(
+                    moris_index                                        aGeometryIndex,
+                    const Matrix< IndexMat >&                          aEdgeVertices,
+                    const Cell< moris::mtk::Cell* >&                   aEdgeParentCells,
+                    const Cell< std::shared_ptr< Matrix< DDRMat > > >& aEdgeVertexLocalCoordinates,
+                    const Cell< std::shared_ptr< Matrix< DDRMat > > >& aVertexCoordinates );
+
+            //-------------------------------------------------------------------------------
+
+            /**
+             * Admits intersections computed by compute_edge_intersections() as permanent nodes, see admit_queued_intersection().
+             * Nodes are admitted in the given order, so node indices have to be increasing.
+             *
+             * @param aEdgeIntersections Intersection data of all edges
+             * @param aEdgeIndices Edges whose intersections are admitted
+             * @param aNodeIndices Node index of every admitted intersection
+             */
+            void admit_edge_intersections(
+                    const Edge_Intersections&  aEdgeIntersections,
+                    const Cell< moris_index >& aEdgeIndices,
+                    const Cell< moris_index >& aNodeIndices );
+
+            //-------------------------------------------------------------------------------
+            
             /**
              * Update the queued intersection node with its node ID and node owner.
              *
@@ -599,6 +647,23 @@ namespace moris
           
             //-------------------------------------------------------------------------------
             
+            /**
+             * Creates the intersection node of an edge with the active geometry, see queue_intersection().
+             *
+             * @return Intersection node, nullptr if a colored edge is not intersected
+             */
+            std::shared_ptr< Intersection_Node > create_intersection_node(
+                    uint                            aFirstNodeIndex,
+                    uint                            aSecondNodeIndex,
+                    const Matrix< DDRMat >&         aFirstNodeLocalCoordinates,
+                    const Matrix< DDRMat >&         aSecondNodeLocalCoordinates,
+                    const Matrix< DDRMat >&         aFirstNodeGlobalCoordinates,
+                    const Matrix< DDRMat >&         aSecondNodeGlobalCoordinates,
+                    const Matrix< DDUMat >&         aBackgroundElementNodeIndices,
+                    const Cell< Matrix< DDRMat > >& aBackgroundElementNodeCoordinates );
+
+            //-------------------------------------------------------------------------------
+            
             void communicate_missing_owned_coefficients(
                     mtk::Mesh_Pair&  aMeshPair,
                     Matrix< IdMat >& aAllCoefIds,
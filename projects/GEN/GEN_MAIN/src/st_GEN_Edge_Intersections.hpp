@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * st_GEN_Edge_Intersections.hpp
+ *
+ */
+
+#ifndef MORIS_ST_GEN_EDGE_INTERSECTIONS_HPP
+#define MORIS_ST_GEN_EDGE_INTERSECTIONS_HPP
+
+#include "cl_Cell.hpp"
+#include "cl_Matrix.hpp"
+#include "cl_GEN_Intersection_Node.hpp"
+
+namespace moris
+{
+    namespace ge
+    {
+        struct Edge_Intersections
+        {
+            /**
+             * Result of intersecting a list of edges with one geometry, one entry per edge. Flags are stored
+             * as uint instead of bool so that different edges can be written concurrently.
+             *
+             * @var mIntersectionNodes Intersection node of the edge, nullptr if the edge is not intersected
+             * @var mIsIntersected If the edge is intersected
+             * @var mFirstParentOnInterface If the first vertex of the edge is on the interface
+             * @var mSecondParentOnInterface If the second vertex of the edge is on the interface
+             * @var mLocalCoordinates Local coordinate of the intersection on the edge (between -1 and 1)
+             * @var mGlobalCoordinates Global coordinates of the intersection
+             */
+            Cell< std::shared_ptr< Intersection_Node > > mIntersectionNodes;
+            Cell< uint >                                 mIsIntersected;
+            Cell< uint >                                 mFirstParentOnInterface;
+            Cell< uint >                                 mSecondParentOnInterface;
+            Cell< real >                                 mLocalCoordinates;
+            Cell< Matrix< DDRMat > >                     mGlobalCoordinates;
+        };
+    }
+}
+
+#endif //MORIS_ST_GEN_EDGE_INTERSECTIONS_HPP
@@ -278,7 +278,8 @@ namespace moris::hmr
 
         // create file on disk
         tHDF5.create(
-                "HMR_Background_Refinement_Iter_" + std::to_string( tOptIter ) + ".hdf5" );
+                "HMR_Background_Refinement_Iter_" + std::to_string( tOptIter ) + ".hdf5",
+                mParameters->use_shared_hdf5_file() );
 
         tHDF5.save_refinement_pattern(
                 mDatabase->get_background_mesh(),
@@ -397,7 +398,7 @@ namespace moris::hmr
         File tHDF5;
 
         // create file on disk
-        tHDF5.create( aPath );
+        tHDF5.create( aPath, mParameters->use_shared_hdf5_file() );
 
         // store settings object
         tHDF5.save_settings( mParameters );
@@ -810,6 +811,19 @@ namespace moris::hmr
 
     // -----------------------------------------------------------------------------
 
+    bool
+    HMR::perform_load_balancing()
+    {
+        if ( !mParameters->use_load_balancing() )
+        {
+            return false;
+        }
+
+        return mDatabase->perform_load_balancing();
+    }
+
+    // -----------------------------------------------------------------------------
+
     void
     HMR::update_refinement_pattern( const uint aPattern )
     {
@@ -1102,12 +1116,6 @@ namespace moris::hmr
             const uint         aLagrangeIndex,
             const uint         aBSpineIndex )
     {
-        // opens an existing file with read and write access
-        hid_t tFileID = open_hdf5_file( aFilePath );
-
-        // error handler
-        herr_t tStatus = 0;
-
         std::shared_ptr< moris::hmr::Mesh > tMesh = this->create_mesh( aLagrangeIndex );
 
         uint tFieldIndex = mFields.size();
@@ -1118,17 +1126,31 @@ namespace moris::hmr
         // get a pointer to this field
         std::shared_ptr< Field > aField = mFields( tFieldIndex );
 
-        load_matrix_from_hdf5_file( tFileID, aLabel, aField->get_coefficients(), tStatus );
+        if ( mParameters->use_shared_hdf5_file() )
+        {
+            // coefficients are matched by the HMR IDs of their basis
+            aField->load_field_from_shared_hdf5( aFilePath );
+        }
+        else
+        {
+            // opens an existing file with read and write access
+            hid_t tFileID = open_hdf5_file( aFilePath );
+
+            // error handler
+            herr_t tStatus = 0;
 
-        // close hdf5 file
-        close_hdf5_file( tFileID );
+            load_matrix_from_hdf5_file( tFileID, aLabel, aField->get_coefficients(), tStatus );
 
-        uint tNumberOfCoeffs = aField->get_coefficients().length();
+            // close hdf5 file
+            close_hdf5_file( tFileID );
 
-        uint tNumberOfCoeffs_BSpline = tMesh->get_lagrange_mesh()->get_bspline_mesh( aBSpineIndex )->get_number_of_active_basis_on_proc();
+            uint tNumberOfCoeffs = aField->get_coefficients().length();
 
-        MORIS_ERROR( tNumberOfCoeffs == tNumberOfCoeffs_BSpline,
-                "load_field_from_hdf5_file(), file and BSpline number of coefficients does not match. Check BSpline Mesh Index" );
+            uint tNumberOfCoeffs_BSpline = tMesh->get_lagrange_mesh()->get_bspline_mesh( aBSpineIndex )->get_number_of_active_basis_on_proc();
+
+            MORIS_ERROR( tNumberOfCoeffs == tNumberOfCoeffs_BSpline,
+                    "load_field_from_hdf5_file(), file and BSpline number of coefficients does not match. Check BSpline Mesh Index" );
+        }
 
         // get pointer to B-Spline mesh
         uint tBSplineOrder = tMesh->get_lagrange_mesh()->get_bspline_mesh( aBSpineIndex )->get_min_order();
@@ -261,10 +261,25 @@ namespace moris::hmr
                     uint aPattern,
                     bool aResetPattern = false );
 
+            /**
+             * refines the flagged elements of a pattern. Does not rebalance the mesh,
+             * see perform_load_balancing()
+             */
             void perform_refinement( uint aPattern );
 
             // -----------------------------------------------------------------------------
 
+            /**
+             * rebalances the coarsest elements over the procs if enabled in the parameters.
+             * Call once after all patterns have been refined and before meshes or fields
+             * are created, since all meshes of the database are rebuilt.
+             *
+             * @return true if the mesh has been repartitioned
+             */
+            bool perform_load_balancing();
+
+            // -----------------------------------------------------------------------------
+
             void put_elements_on_refinment_queue( Cell< hmr::Element* > & aElements);
 
             // -----------------------------------------------------------------------------
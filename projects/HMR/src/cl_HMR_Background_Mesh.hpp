@@ -71,6 +71,13 @@ namespace moris::hmr
                 : Background_Mesh_Base( aParameters )
                 , mDomain( aParameters->get_domain_ijk(), mPaddingSize )
         {
+            // use proc grid and slabs of a previous load balancing instead of uniform decomposition
+            if ( aParameters->get_balanced_processor_splits().size() > 0 )
+            {
+                mProcDims   = aParameters->get_balanced_processor_dimensions();
+                mProcSplits = aParameters->get_balanced_processor_splits();
+            }
+
             // create mesh decomposition
             this->decompose_mesh();
 
@@ -197,6 +204,61 @@ namespace moris::hmr
 
         //--------------------------------------------------------------------------------
 
+        /**
+         * Returns the number of active descendants of each coarsest element owned by
+         * this proc. The matrix covers all coarsest elements of the global domain,
+         * without padding, numbered lexicographically; entries of elements owned by
+         * other procs are zero, such that the global weights are the sum over all procs.
+         *
+         * @param[in] aPattern   pattern the active elements are counted on
+         *
+         * @return Matrix< DDRMat >
+         */
+        Matrix< DDRMat >
+        get_coarsest_element_weights( uint aPattern ) const
+        {
+            // number of coarsest elements per direction without padding
+            const Matrix< DDLUMat >& tNumberOfElementsPerDimension = mParameters->get_number_of_elements_per_dimension();
+
+            luint tNumberOfElements = 1;
+
+            for ( uint k = 0; k < N; ++k )
+            {
+                tNumberOfElements *= tNumberOfElementsPerDimension( k );
+            }
+
+            Matrix< DDRMat > tWeights( tNumberOfElements, 1, 0.0 );
+
+            for ( Background_Element_Base* tElement : mCoarsestElements )
+            {
+                if ( tElement->get_owner() != mMyRank )
+                {
+                    continue;
+                }
+
+                const luint* tIJK = tElement->get_ijk();
+
+                // lexicographic index of global position without padding
+                luint tIndex  = 0;
+                luint tStride = 1;
+
+                for ( uint k = 0; k < N; ++k )
+                {
+                    tIndex += tStride * ( tIJK[ k ] + mMySubDomain.mAuraIJK[ 0 ][ k ][ 0 ] - mDomain.mDomainIJK[ 0 ][ k ][ 0 ] );
+                    tStride *= tNumberOfElementsPerDimension( k );
+                }
+
+                luint tCount = 0;
+                tElement->get_number_of_active_descendants( aPattern, tCount );
+
+                tWeights( tIndex ) = tCount;
+            }
+
+            return tWeights;
+        }
+
+        //--------------------------------------------------------------------------------
+
         /**
          * Returns the ijk-offset of domain of current proc.
          * This value is needed to transform global IDs to local ones and
@@ -643,8 +705,11 @@ namespace moris::hmr
                 barrier();
             }
 
+            // proc grid and slabs are given, e.g. by load balancing
+            bool tUseProcSplits = mProcSplits.size() > 0;
+
             // Processor decomposition method 0=UserDefined, 1=MPI (original) 2=min mesh interface 3=manual
-            uint tDecompMethod = mParameters->get_processor_decomp_method();
+            uint tDecompMethod = tUseProcSplits ? 0 : mParameters->get_processor_decomp_method();
 
             // Pulling mesh dimensions from parameters
             Matrix< DDLUMat > tNumberOfElementsPerDimension = mParameters->get_number_of_elements_per_dimension();
@@ -654,7 +719,16 @@ namespace moris::hmr
                 // User defined processor grid
                 case 0:
                 {
-                    mProcDims = mParameters->get_processor_dimensions();
+                    // given proc grid is checked the same way
+                    if ( tUseProcSplits )
+                    {
+                        MORIS_ERROR( mProcSplits.size() == N,
+                                "decompose_mesh(): Given processor splits incompatible with mesh dimensions." );
+                    }
+                    else
+                    {
+                        mProcDims = mParameters->get_processor_dimensions();
+                    }
 
                     // Checking if user defined processor dimensions matches mesh dimensions, N.
                     if ( (uint)std::max( mProcDims.n_rows(), mProcDims.n_cols() ) != N )
@@ -745,8 +819,21 @@ namespace moris::hmr
             // multiple of mProcDims(k).
             Matrix< DDLUMat > tRemainder( N, 1 );
 
+            // first element of proc domain, not counting padding
+            Matrix< DDLUMat > tFirstElementOnProc( N, 1 );
+
             for ( uint k = 0; k < N; ++k )
             {
+                if ( tUseProcSplits )
+                {
+                    tFirstElementOnProc( k ) = mProcSplits( k )( mMyProcCoords( k ) );
+
+                    tNumberOfElementsPerDimensionOnProc( k ) =
+                            mProcSplits( k )( mMyProcCoords( k ) + 1 ) - tFirstElementOnProc( k );
+
+                    continue;
+                }
+
                 /*
                  * This conditional determines whether a remainder element
                  * is added to the processor dimension.  This will only
@@ -772,6 +859,11 @@ namespace moris::hmr
                 // assigning number of elements on this direction of the processor
                 tNumberOfElementsPerDimensionOnProc( k ) =
                         ( tNumberOfElementsPerDimension( k ) - ( tNumberOfElementsPerDimension( k ) % mProcDims( k ) ) ) / mProcDims( k ) + tRemainder( k );
+
+                // calculates domain start taking into account remainder elements
+                tFirstElementOnProc( k ) =
+                        tNumberOfElementsPerDimensionOnProc( k ) * mMyProcCoords( k ) +    //
+                        ( 1 - tRemainder( k ) ) * ( tNumberOfElementsPerDimension( k ) % mProcDims( k ) );
             }
 
             // calculate decomposition domain
@@ -783,10 +875,7 @@ namespace moris::hmr
 
             for ( uint k = 0; k < N; ++k )
             {
-                // calculates domain start taking into account remainder elements
-                tDomainIJK( 0, k ) =
-                        mPaddingSize + tNumberOfElementsPerDimensionOnProc( k ) * mMyProcCoords( k ) +    //
-                        ( 1 - tRemainder( k ) ) * ( tNumberOfElementsPerDimension( k ) % mProcDims( k ) );
+                tDomainIJK( 0, k ) = mPaddingSize + tFirstElementOnProc( k );
 
                 tDomainIJK( 1, k ) = tDomainIJK( 0, k ) + tNumberOfElementsPerDimensionOnProc( k ) - 1;
 
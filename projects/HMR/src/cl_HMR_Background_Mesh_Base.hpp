@@ -76,6 +76,10 @@ namespace moris::hmr
         //! i-j-k coordinate of current proc
         Matrix< DDUMat > mMyProcCoords;
 
+        //! first coarsest element of each proc slab per direction, followed by the
+        //! number of elements. Empty if the mesh is decomposed uniformly
+        Cell< Matrix< DDLUMat > > mProcSplits;
+
         //! Mat containing IDs of neighbors and the proc itself
         //! if there is no neighbor, value is MORIS_UINT_MAX
         Matrix< IdMat > mMyProcNeighbors;
@@ -548,6 +552,20 @@ namespace moris::hmr
 
         //--------------------------------------------------------------------------------
 
+        /**
+         * Returns the number of active descendants of each coarsest element owned by
+         * this proc. The matrix covers all coarsest elements of the global domain,
+         * without padding, numbered lexicographically; entries of elements owned by
+         * other procs are zero, such that the global weights are the sum over all procs.
+         *
+         * @param[in] aPattern   pattern the active elements are counted on
+         *
+         * @return Matrix< DDRMat >
+         */
+        virtual Matrix< DDRMat > get_coarsest_element_weights( uint aPattern ) const = 0;
+
+        //--------------------------------------------------------------------------------
+
         /**
          * Returns the number of active elements in the cell mActiveElements.
          * Needs to be called after collect_active_elements()
@@ -646,6 +664,20 @@ namespace moris::hmr
 
         //--------------------------------------------------------------------------------
 
+        /**
+         * Returns the first coarsest element of each proc slab per direction,
+         * followed by the number of elements. Empty for uniform decomposition.
+         *
+         * @return Cell< Matrix< DDLUMat > >
+         */
+        const Cell< Matrix< DDLUMat > >&
+        get_proc_splits() const
+        {
+            return mProcSplits;
+        }
+
+        //--------------------------------------------------------------------------------
+
         /**
          * Protected funcition that adds neighbors to elements.
          * Internally calls collect_active_elements_including_aura()
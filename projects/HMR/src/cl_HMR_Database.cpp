@@ -13,6 +13,7 @@
 #include "cl_HMR_Field.hpp"
 #include "cl_HMR_File.hpp"
 #include "cl_HMR_Mesh.hpp"
+#include "fn_HMR_Load_Balancing.hpp"
 #include "MTK_Tools.hpp"
 
 #include "op_times.hpp"
@@ -24,6 +25,62 @@ namespace moris::hmr
 {
     // -----------------------------------------------------------------------------
 
+    namespace
+    {
+        /**
+         * collects the values of all procs for each entry of the given vector
+         *
+         * @param[ in ] aLocalValues values of this proc
+         *
+         * @return matrix with one row per entry and one column per proc, ordered by rank
+         */
+        Matrix< DDLUMat >
+        gather_values_of_all_procs( const Matrix< DDLUMat >& aLocalValues )
+        {
+            Matrix< DDLUMat > tValues( aLocalValues.numel(), par_size() );
+
+            for ( uint k = 0; k < aLocalValues.numel(); ++k )
+            {
+                Matrix< DDLUMat > tValuesOfProcs;
+
+                comm_gather_and_broadcast( aLocalValues( k ), tValuesOfProcs );
+
+                for ( uint r = 0; r < tValuesOfProcs.numel(); ++r )
+                {
+                    tValues( k, r ) = tValuesOfProcs( r );
+                }
+            }
+
+            return tValues;
+        }
+
+        // -----------------------------------------------------------------------------
+
+        /**
+         * tests if two boxes of coarsest element positions overlap
+         *
+         * @param[ in ] aBoxA first and last position per direction ( 2 x number of dimensions )
+         * @param[ in ] aBoxB first and last position per direction ( 2 x number of dimensions )
+         */
+        bool
+        boxes_overlap(
+                const Matrix< DDLUMat >& aBoxA,
+                const Matrix< DDLUMat >& aBoxB )
+        {
+            for ( uint k = 0; k < aBoxA.n_cols(); ++k )
+            {
+                if ( aBoxA( 0, k ) > aBoxB( 1, k ) || aBoxB( 0, k ) > aBoxA( 1, k ) )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }    // namespace
+
+    // -----------------------------------------------------------------------------
+
     Database::Database( Parameters* aParameters )
             : mParameters( aParameters )
     {
@@ -164,7 +221,7 @@ namespace moris::hmr
         File tHDF5;
 
         // open file on disk
-        tHDF5.open( aPath );
+        tHDF5.open( aPath, mParameters->use_shared_hdf5_file() );
 
         // load input pattern into file
         tHDF5.load_refinement_pattern( mBackgroundMesh, aMode );
@@ -1041,6 +1098,559 @@ namespace moris::hmr
 
     // -----------------------------------------------------------------------------
 
+    bool
+    Database::perform_load_balancing()
+    {
+        MORIS_ERROR( !mFinalizedCalled,
+                "Database::perform_load_balancing(), mesh cannot be rebalanced after finalize() has been called." );
+
+        moris_id tParSize = par_size();
+
+        // nothing to balance in serial
+        if ( tParSize == 1 )
+        {
+            return false;
+        }
+
+        // start timer
+        tic tTimer;
+
+        // remember active pattern
+        auto tActivePattern = mBackgroundMesh->get_activation_pattern();
+
+        // active elements are counted on all patterns used by Lagrange meshes
+        Cell< uint > tPatterns;
+
+        for ( Lagrange_Mesh_Base* tMesh : mLagrangeMeshes )
+        {
+            uint tPattern = tMesh->get_activation_pattern();
+
+            bool tIsNew = true;
+
+            for ( uint tOtherPattern : tPatterns )
+            {
+                tIsNew = tIsNew && tOtherPattern != tPattern;
+            }
+
+            if ( tIsNew )
+            {
+                tPatterns.push_back( tPattern );
+            }
+        }
+
+        real tImbalance = this->compute_imbalance_factor( tPatterns );
+
+        // global weights of coarsest elements
+        Matrix< DDRMat > tWeights;
+
+        for ( uint tPattern : tPatterns )
+        {
+            Matrix< DDRMat > tPatternWeights = sum_all_matrix( mBackgroundMesh->get_coarsest_element_weights( tPattern ) );
+
+            if ( tWeights.numel() == 0 )
+            {
+                tWeights = tPatternWeights;
+            }
+            else
+            {
+                tWeights = tWeights + tPatternWeights;
+            }
+        }
+
+        mBackgroundMesh->set_activation_pattern( tActivePattern );
+
+        Matrix< DDLUMat > tNumberOfElementsPerDimension = mParameters->get_number_of_elements_per_dimension();
+
+        // best possible imbalance of a partition along the Morton curve, for reference
+        real tCurveImbalance = compute_sfc_imbalance( tWeights, tNumberOfElementsPerDimension, tParSize );
+
+        MORIS_LOG_INFO( "Load balancing: imbalance factor %5.3f (space-filling curve bound %5.3f, tolerance %5.3f).",
+                tImbalance,
+                tCurveImbalance,
+                mParameters->get_load_balancing_tolerance() );
+
+        if ( tImbalance <= mParameters->get_load_balancing_tolerance() )
+        {
+            return false;
+        }
+
+        // proc slabs must be wide enough for the aura, see Background_Mesh::decompose_mesh()
+        luint tPaddingSize = mParameters->get_padding_size();
+        luint tMinWidth    = mParameters->use_number_aura() ? 2 * tPaddingSize + 1 : tPaddingSize;
+
+        // balance slabs of existing proc grid
+        Cell< Matrix< DDLUMat > > tProcSplits = compute_balanced_proc_splits(
+                tWeights,
+                tNumberOfElementsPerDimension,
+                mBackgroundMesh->get_proc_dims(),
+                tMinWidth );
+
+        real tPredictedImbalance = compute_cartesian_imbalance( tWeights, tNumberOfElementsPerDimension, tProcSplits );
+
+        // only repartition if this improves the balance
+        if ( tPredictedImbalance >= tImbalance )
+        {
+            MORIS_LOG_INFO( "Load balancing: proc grid cannot be improved, keeping decomposition." );
+            return false;
+        }
+
+        this->repartition_background_mesh( tProcSplits );
+
+        real tNewImbalance = this->compute_imbalance_factor( tPatterns );
+
+        mBackgroundMesh->set_activation_pattern( tActivePattern );
+
+        // stop timer
+        real tElapsedTime = tTimer.toc< moris::chronos::milliseconds >().wall;
+
+        MORIS_LOG_INFO( "Load balancing: imbalance factor %5.3f before and %5.3f after rebalancing.",
+                tImbalance,
+                tNewImbalance );
+
+        MORIS_LOG_INFO( "Rebalancing took %5.3f seconds.",
+                (double)tElapsedTime / 1000 );
+        MORIS_LOG_INFO( " " );
+
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    real
+    Database::compute_imbalance_factor( const Cell< uint >& aPatterns )
+    {
+        real tNumberOfElements = 0.0;
+
+        for ( uint tPattern : aPatterns )
+        {
+            mBackgroundMesh->set_activation_pattern( tPattern );
+
+            tNumberOfElements += mBackgroundMesh->get_number_of_active_elements_on_proc();
+        }
+
+        real tMax  = max_all( tNumberOfElements );
+        real tMean = sum_all( tNumberOfElements ) / par_size();
+
+        return tMean > 0.0 ? tMax / tMean : 1.0;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    void
+    Database::repartition_background_mesh( const Cell< Matrix< DDLUMat > >& aProcSplits )
+    {
+        // remember active pattern
+        auto tActivePattern = mBackgroundMesh->get_activation_pattern();
+
+        uint tMaxLevel = max_all( mBackgroundMesh->get_max_level() );
+
+        uint     tNumberOfDimensions = mParameters->get_number_of_dimensions();
+        moris_id tMyRank             = par_rank();
+        moris_id tParSize            = par_size();
+        luint    tPaddingSize        = mParameters->get_padding_size();
+
+        // keep proc grid, only slabs are moved
+        Matrix< DDUMat > tProcDims = mBackgroundMesh->get_proc_dims();
+
+        // level zero offset of the aura and owned frame of this proc
+        Matrix< DDLUMat > tOffset = mBackgroundMesh->get_subdomain_offset_of_proc();
+        Matrix< DDLUMat > tFrame  = mBackgroundMesh->get_subdomain_ijk();
+
+        Matrix< DDUMat > tProcCoords = mBackgroundMesh->get_proc_coords();
+
+        // owned coarsest elements and proc coordinates of all procs
+        Matrix< DDLUMat > tLocalValues( 3 * tNumberOfDimensions, 1 );
+
+        for ( uint k = 0; k < tNumberOfDimensions; ++k )
+        {
+            tLocalValues( k )                           = tOffset( k, 0 ) + tFrame( 0, k );
+            tLocalValues( tNumberOfDimensions + k )     = tOffset( k, 0 ) + tFrame( 1, k );
+            tLocalValues( 2 * tNumberOfDimensions + k ) = tProcCoords( k );
+        }
+
+        Matrix< DDLUMat > tValuesOfProcs = gather_values_of_all_procs( tLocalValues );
+
+        // Coarsest element positions ( global ijk including padding ) of each proc. Old boxes are owned
+        // elements, widened by one for nodes on their upper faces. New boxes include the aura.
+        Cell< Matrix< DDLUMat > > tOldBoxes( tParSize, Matrix< DDLUMat >( 2, tNumberOfDimensions ) );
+        Cell< Matrix< DDLUMat > > tNewBoxes( tParSize, Matrix< DDLUMat >( 2, tNumberOfDimensions ) );
+
+        for ( moris_id r = 0; r < tParSize; ++r )
+        {
+            for ( uint k = 0; k < tNumberOfDimensions; ++k )
+            {
+                tOldBoxes( r )( 0, k ) = tValuesOfProcs( k, r );
+                tOldBoxes( r )( 1, k ) = tValuesOfProcs( tNumberOfDimensions + k, r ) + 1;
+
+                luint tCoord = tValuesOfProcs( 2 * tNumberOfDimensions + k, r );
+
+                tNewBoxes( r )( 0, k ) = aProcSplits( k )( tCoord );
+                tNewBoxes( r )( 1, k ) = aProcSplits( k )( tCoord + 1 ) + 2 * tPaddingSize - 1;
+            }
+        }
+
+        // procs data is exchanged with. The list is symmetric since all procs evaluate the same boxes.
+        Cell< moris_id > tCommProcs;
+
+        for ( moris_id r = 0; r < tParSize; ++r )
+        {
+            if ( r != tMyRank
+                    && ( boxes_overlap( tOldBoxes( tMyRank ), tNewBoxes( r ) )
+                            || boxes_overlap( tOldBoxes( r ), tNewBoxes( tMyRank ) ) ) )
+            {
+                tCommProcs.push_back( r );
+            }
+        }
+
+        uint tNumberOfCommProcs = tCommProcs.size();
+
+        Matrix< IdMat > tCommList( tNumberOfCommProcs, 1 );
+
+        for ( uint j = 0; j < tNumberOfCommProcs; ++j )
+        {
+            tCommList( j ) = tCommProcs( j );
+        }
+
+        // refined elements per pattern and level which are needed on this proc after repartitioning
+        Cell< Cell< Cell< luint > > > tRefinedElements( gNumberOfPatterns, Cell< Cell< luint > >( tMaxLevel ) );
+
+        // pattern, level and ID of refined elements sent to each proc
+        Cell< Cell< luint > > tElementsToSend( tNumberOfCommProcs );
+
+        Matrix< DDLUMat > tBox( 2, tNumberOfDimensions );
+
+        for ( uint l = 0; l < tMaxLevel; ++l )
+        {
+            // cell which contains elements
+            Cell< Background_Element_Base* > tElements;
+
+            // collect elements from this level
+            mBackgroundMesh->collect_elements_on_level_within_proc_domain( l, tElements );
+
+            for ( Background_Element_Base* tElement : tElements )
+            {
+                if ( tElement->get_owner() != tMyRank )
+                {
+                    continue;
+                }
+
+                // position of coarsest ancestor
+                const luint* tIJK = tElement->get_ijk();
+
+                for ( uint k = 0; k < tNumberOfDimensions; ++k )
+                {
+                    tBox( 0, k ) = ( tIJK[ k ] >> l ) + tOffset( k, 0 );
+                    tBox( 1, k ) = tBox( 0, k );
+                }
+
+                for ( uint p = 0; p < gNumberOfPatterns; ++p )
+                {
+                    if ( !tElement->is_refined( p ) )
+                    {
+                        continue;
+                    }
+
+                    if ( boxes_overlap( tBox, tNewBoxes( tMyRank ) ) )
+                    {
+                        tRefinedElements( p )( l ).push_back( tElement->get_hmr_id() );
+                    }
+
+                    for ( uint j = 0; j < tNumberOfCommProcs; ++j )
+                    {
+                        if ( boxes_overlap( tBox, tNewBoxes( tCommProcs( j ) ) ) )
+                        {
+                            tElementsToSend( j ).push_back( p );
+                            tElementsToSend( j ).push_back( l );
+                            tElementsToSend( j ).push_back( tElement->get_hmr_id() );
+                        }
+                    }
+                }
+            }
+        }
+
+        // exchange refined elements with procs which need them
+        Cell< Matrix< DDLUMat > > tSendElements( tNumberOfCommProcs );
+        Cell< Matrix< DDLUMat > > tReceivedElements;
+
+        for ( uint j = 0; j < tNumberOfCommProcs; ++j )
+        {
+            tSendElements( j ).set_size( tElementsToSend( j ).size(), 1 );
+
+            for ( uint i = 0; i < tElementsToSend( j ).size(); ++i )
+            {
+                tSendElements( j )( i ) = tElementsToSend( j )( i );
+            }
+        }
+
+        communicate_mats( tCommList, tSendElements, tReceivedElements );
+
+        for ( uint j = 0; j < tNumberOfCommProcs; ++j )
+        {
+            for ( uint i = 0; i < tReceivedElements( j ).numel(); i += 3 )
+            {
+                tRefinedElements( tReceivedElements( j )( i ) )( tReceivedElements( j )( i + 1 ) ).push_back( tReceivedElements( j )( i + 2 ) );
+            }
+        }
+
+        // nodal fields on Lagrange meshes, identified by node IDs
+        uint tNumberOfLagrangeMeshes = mLagrangeMeshes.size();
+
+        Cell< Cell< Matrix< DDLUMat > > > tNodeIDs( tNumberOfLagrangeMeshes );
+        Cell< Cell< Matrix< DDRMat > > >  tNodeValues( tNumberOfLagrangeMeshes );
+        Cell< Cell< bool > >              tFieldIsNodal( tNumberOfLagrangeMeshes );
+        Cell< Cell< std::string > >       tFieldLabels( tNumberOfLagrangeMeshes );
+        Cell< Cell< EntityRank > >        tFieldRanks( tNumberOfLagrangeMeshes );
+        Cell< Cell< uint > >              tFieldOrders( tNumberOfLagrangeMeshes );
+
+        for ( uint m = 0; m < tNumberOfLagrangeMeshes; ++m )
+        {
+            Lagrange_Mesh_Base* tMesh = mLagrangeMeshes( m );
+
+            luint tNumberOfNodes  = tMesh->get_number_of_nodes_on_proc();
+            uint  tNumberOfFields = tMesh->get_number_of_real_scalar_fields();
+
+            tFieldIsNodal( m ).resize( tNumberOfFields, false );
+            tFieldLabels( m ).resize( tNumberOfFields );
+            tFieldRanks( m ).resize( tNumberOfFields );
+            tFieldOrders( m ).resize( tNumberOfFields );
+
+            if ( sum_all( tNumberOfFields ) == 0 )
+            {
+                continue;
+            }
+
+            for ( uint f = 0; f < tNumberOfFields; ++f )
+            {
+                tFieldLabels( m )( f ) = tMesh->get_real_scalar_field_label( f );
+                tFieldRanks( m )( f )  = tMesh->get_real_scalar_field_rank( f );
+                tFieldOrders( m )( f ) = tMesh->get_real_scalar_field_bspline_order( f );
+
+                // values which are not defined on all nodes are not migrated
+                tFieldIsNodal( m )( f ) = all_land( tFieldRanks( m )( f ) == EntityRank::NODE
+                                                    && tMesh->get_real_scalar_field_data( f ).numel() == tNumberOfNodes );
+            }
+
+            // indices of owned nodes sent to each proc, last entry is this proc
+            Cell< Cell< luint > > tNodesToSend( tNumberOfCommProcs + 1 );
+
+            luint tOrder = tMesh->get_order();
+
+            for ( luint n = 0; n < tNumberOfNodes; ++n )
+            {
+                Basis* tNode = tMesh->get_node_by_index( n );
+
+                if ( tNode->get_owner() != tMyRank )
+                {
+                    continue;
+                }
+
+                // coarsest elements the node belongs to
+                const luint* tIJK = tNode->get_ijk();
+
+                luint tStep = tOrder << tNode->get_level();
+
+                for ( uint k = 0; k < tNumberOfDimensions; ++k )
+                {
+                    luint tPosition = tIJK[ k ] / tStep;
+
+                    tBox( 0, k ) = tOffset( k, 0 ) + ( ( tIJK[ k ] % tStep == 0 && tPosition > 0 ) ? tPosition - 1 : tPosition );
+                    tBox( 1, k ) = tOffset( k, 0 ) + tPosition;
+                }
+
+                for ( uint j = 0; j < tNumberOfCommProcs; ++j )
+                {
+                    if ( boxes_overlap( tBox, tNewBoxes( tCommProcs( j ) ) ) )
+                    {
+                        tNodesToSend( j ).push_back( n );
+                    }
+                }
+
+                if ( boxes_overlap( tBox, tNewBoxes( tMyRank ) ) )
+                {
+                    tNodesToSend( tNumberOfCommProcs ).push_back( n );
+                }
+            }
+
+            // node IDs and field values, one row per field
+            Cell< Matrix< DDLUMat > > tSendIDs( tNumberOfCommProcs + 1 );
+            Cell< Matrix< DDRMat > >  tSendValues( tNumberOfCommProcs + 1 );
+
+            for ( uint j = 0; j <= tNumberOfCommProcs; ++j )
+            {
+                luint tNumberOfNodesToSend = tNodesToSend( j ).size();
+
+                tSendIDs( j ).set_size( tNumberOfNodesToSend, 1 );
+                tSendValues( j ).set_size( tNumberOfFields, tNumberOfNodesToSend, 0.0 );
+
+                for ( luint i = 0; i < tNumberOfNodesToSend; ++i )
+                {
+                    luint tIndex = tNodesToSend( j )( i );
+
+                    tSendIDs( j )( i ) = tMesh->get_node_by_index( tIndex )->get_hmr_id();
+
+                    for ( uint f = 0; f < tNumberOfFields; ++f )
+                    {
+                        if ( tFieldIsNodal( m )( f ) )
+                        {
+                            tSendValues( j )( f, i ) = tMesh->get_real_scalar_field_data( f )( tIndex );
+                        }
+                    }
+                }
+            }
+
+            // own nodes stay on this proc
+            Matrix< DDLUMat > tOwnIDs    = tSendIDs( tNumberOfCommProcs );
+            Matrix< DDRMat >  tOwnValues = tSendValues( tNumberOfCommProcs );
+
+            tSendIDs.resize( tNumberOfCommProcs );
+            tSendValues.resize( tNumberOfCommProcs );
+
+            communicate_mats( tCommList, tSendIDs, tNodeIDs( m ) );
+            communicate_mats( tCommList, tSendValues, tNodeValues( m ) );
+
+            tNodeIDs( m ).push_back( tOwnIDs );
+            tNodeValues( m ).push_back( tOwnValues );
+        }
+
+        // meshes refer to old background mesh
+        this->delete_meshes();
+
+        delete mBackgroundMesh;
+
+        // following background meshes, e.g. during remeshing, are decomposed the same way
+        mParameters->set_balanced_processor_decomposition( tProcDims, aProcSplits );
+
+        // create background mesh object on new decomposition
+        Factory tFactory( mParameters );
+
+        mBackgroundMesh = tFactory.create_background_mesh();
+
+        // update element table
+        mBackgroundMesh->collect_active_elements();
+
+        // reset all patterns
+        for ( uint p = 0; p < gNumberOfPatterns; ++p )
+        {
+            mBackgroundMesh->reset_pattern( p );
+        }
+
+        // replay refinement, see File::load_refinement_pattern_from_shared_file()
+        for ( uint p = 0; p < gNumberOfPatterns; ++p )
+        {
+            luint tNumberOfRefinedElements = 0;
+
+            for ( uint l = 0; l < tMaxLevel; ++l )
+            {
+                tNumberOfRefinedElements += tRefinedElements( p )( l ).size();
+            }
+
+            // refinement is collective
+            if ( sum_all( tNumberOfRefinedElements ) == 0 )
+            {
+                continue;
+            }
+
+            mBackgroundMesh->set_activation_pattern( p );
+
+            for ( uint l = 0; l < tMaxLevel; ++l )
+            {
+                // cell which contains elements
+                Cell< Background_Element_Base* > tElements;
+
+                // collect elements from this level
+                mBackgroundMesh->collect_elements_on_level_within_proc_domain( l, tElements );
+
+                // create a map with ids
+                map< moris_id, luint > tMap;
+
+                luint j = 0;
+                for ( Background_Element_Base* tElement : tElements )
+                {
+                    tMap[ tElement->get_hmr_id() ] = j++;
+                }
+
+                // flag elements which exist on this proc
+                for ( luint tID : tRefinedElements( p )( l ) )
+                {
+                    if ( tMap.key_exists( tID ) )
+                    {
+                        tElements( tMap.find( tID ) )->put_on_refinement_queue();
+                    }
+                }
+
+                // refine mesh, queue is synchronized between procs
+                mBackgroundMesh->perform_refinement( p );
+            }
+        }
+
+        mBackgroundMesh->update_database();
+
+        mBackgroundMesh->set_activation_pattern( tActivePattern );
+
+        // initialize mesh objects
+        this->create_meshes();
+
+        mAdditionalLagrangeMeshes.resize( gNumberOfPatterns );
+
+        // restore fields on new meshes
+        for ( uint m = 0; m < tNumberOfLagrangeMeshes; ++m )
+        {
+            Lagrange_Mesh_Base* tMesh = mLagrangeMeshes( m );
+
+            uint tNumberOfFields = tFieldLabels( m ).size();
+
+            if ( tNumberOfFields == 0 )
+            {
+                continue;
+            }
+
+            // map node IDs to proc and position in received data
+            map< luint, std::pair< uint, luint > > tMap;
+
+            for ( uint j = 0; j < tNodeIDs( m ).size(); ++j )
+            {
+                for ( luint i = 0; i < tNodeIDs( m )( j ).numel(); ++i )
+                {
+                    tMap[ tNodeIDs( m )( j )( i ) ] = { j, i };
+                }
+            }
+
+            luint tNumberOfNodes = tMesh->get_number_of_nodes_on_proc();
+
+            for ( uint f = 0; f < tNumberOfFields; ++f )
+            {
+                uint tFieldIndex = tMesh->create_real_scalar_field_data( tFieldLabels( m )( f ), tFieldRanks( m )( f ) );
+
+                tMesh->set_real_scalar_field_bspline_order( tFieldIndex, tFieldOrders( m )( f ) );
+
+                if ( !tFieldIsNodal( m )( f ) )
+                {
+                    continue;
+                }
+
+                Matrix< DDRMat >& tData = tMesh->get_real_scalar_field_data( tFieldIndex );
+
+                tData.set_size( tNumberOfNodes, 1 );
+
+                for ( luint n = 0; n < tNumberOfNodes; ++n )
+                {
+                    luint tID = tMesh->get_node_by_index( n )->get_hmr_id();
+
+                    MORIS_ERROR( tMap.key_exists( tID ),
+                            "Database::repartition_background_mesh(), value of node %lu of field %s has not been received.",
+                            tID,
+                            tFieldLabels( m )( f ).c_str() );
+
+                    std::pair< uint, luint > tSource = tMap.find( tID );
+
+                    tData( n ) = tNodeValues( m )( tSource.first )( f, tSource.second );
+                }
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
     // interpolate field values from source Lagrange to target Lagrange mesh
     void
     Database::interpolate_field(
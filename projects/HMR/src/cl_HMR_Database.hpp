@@ -163,6 +163,23 @@ namespace moris::hmr
 
             // -----------------------------------------------------------------------------
 
+            /**
+             * rebalances the coarsest elements over the proc grid if the number of active
+             * elements per proc, summed over the patterns of all Lagrange meshes, exceeds the
+             * load balancing tolerance. Not called by perform_refinement; call it once after
+             * all patterns have been refined.
+             *
+             * The background mesh and all B-Spline and Lagrange meshes are recreated, such
+             * that background elements, hmr::Mesh and hmr::Field objects referring to the old
+             * meshes must be recreated as well. Nodal field data stored on the Lagrange meshes
+             * is migrated. The new decomposition is stored in the parameters.
+             *
+             * @return true if the mesh has been repartitioned
+             */
+            bool perform_load_balancing();
+
+            // -----------------------------------------------------------------------------
+
             /**
              * aTarget must be a refined variant of aSource
              */
@@ -545,6 +562,27 @@ namespace moris::hmr
 
             // -----------------------------------------------------------------------------
 
+            /**
+             * returns max / mean number of active elements per proc, summed over the given patterns
+             *
+             * @param[ in ] aPatterns patterns the active elements are counted on
+             */
+            real compute_imbalance_factor( const Cell< uint >& aPatterns );
+
+            // -----------------------------------------------------------------------------
+
+            /**
+             * recreates the background mesh decomposed into the given proc slabs, replays the
+             * refinement of all patterns and recreates all meshes. Refined elements and nodal
+             * field values are only sent to the procs which hold them after repartitioning.
+             *
+             * @param[ in ] aProcSplits first coarsest element of each proc slab per direction,
+             *                          followed by the number of elements
+             */
+            void repartition_background_mesh( const Cell< Matrix< DDLUMat > >& aProcSplits );
+
+            // -----------------------------------------------------------------------------
+
     };
 } /* namespace moris */
 
@@ -12,6 +12,8 @@
 
 #include <iostream>
 #include <cstdio>
+#include <algorithm>
+#include <limits>
 
 #include "cl_HMR_Lagrange_Mesh_Base.hpp"
 #include "cl_HMR_Mesh.hpp"
@@ -333,6 +335,13 @@ namespace moris::hmr
             const std::string & aFilePath,
             const bool          aCreateNewFile )
     {
+        // shared files store the coefficients together with the HMR IDs of their basis
+        if( mLagrangeMesh->get_parameters()->use_shared_hdf5_file() )
+        {
+            this->save_field_to_shared_hdf5( aFilePath, aCreateNewFile );
+            return;
+        }
+
         // test if file exists
         std::string tFilePath = make_path_parallel( aFilePath );
 
@@ -437,6 +446,13 @@ namespace moris::hmr
             const std::string & aFilePath,
             const uint          aBSplineOrder )
     {
+        // shared files store the coefficients together with the HMR IDs of their basis
+        if( mLagrangeMesh->get_parameters()->use_shared_hdf5_file() )
+        {
+            this->load_field_from_shared_hdf5( aFilePath );
+            return;
+        }
+
         hid_t tFile    = open_hdf5_file( aFilePath );
         herr_t tStatus = 0;
         load_matrix_from_hdf5_file( tFile,
@@ -449,6 +465,195 @@ namespace moris::hmr
 
     //------------------------------------------------------------------------------
 
+    void Field::save_field_to_shared_hdf5(
+            const std::string & aFilePath,
+            const bool          aCreateNewFile )
+    {
+        BSpline_Mesh_Base * tBSplineMesh = mLagrangeMesh->get_bspline_mesh( mInputBSplineIndex );
+
+        const Matrix< DDRMat > & tCoefficients = this->get_coefficients();
+
+        moris_id tMyRank = par_rank();
+
+        // collect coefficients owned by this proc
+        Cell< luint > tOwnedIndices;
+        tOwnedIndices.reserve( tCoefficients.numel() );
+
+        for( uint k = 0; k < tCoefficients.numel(); ++k )
+        {
+            if( tBSplineMesh->get_basis_by_index( k )->get_owner() == tMyRank )
+            {
+                tOwnedIndices.push_back( k );
+            }
+        }
+
+        // sort by HMR ID, such that a reading proc can search the block of this proc
+        std::sort( tOwnedIndices.begin(), tOwnedIndices.end(),
+                [ tBSplineMesh ]( const luint aA, const luint aB )
+                {
+                    return tBSplineMesh->get_basis_by_index( aA )->get_hmr_id()
+                         < tBSplineMesh->get_basis_by_index( aB )->get_hmr_id();
+                } );
+
+        luint tNumberOfOwnedCoefficients = tOwnedIndices.size();
+
+        Matrix< DDLUMat > tBasisIDs( tNumberOfOwnedCoefficients, 1 );
+        Matrix< DDRMat >  tOwnedCoefficients( tNumberOfOwnedCoefficients, 1 );
+
+        for( luint k = 0; k < tNumberOfOwnedCoefficients; ++k )
+        {
+            tBasisIDs( k )          = tBSplineMesh->get_basis_by_index( tOwnedIndices( k ) )->get_hmr_id();
+            tOwnedCoefficients( k ) = tCoefficients( tOwnedIndices( k ) );
+        }
+
+        // first ID, last ID and number of coefficients of the block of this proc
+        Matrix< DDLUMat > tBlockInfo( 3, 1, 0 );
+
+        if( tNumberOfOwnedCoefficients > 0 )
+        {
+            tBlockInfo( 0 ) = tBasisIDs( 0 );
+            tBlockInfo( 1 ) = tBasisIDs( tNumberOfOwnedCoefficients - 1 );
+            tBlockInfo( 2 ) = tNumberOfOwnedCoefficients;
+        }
+
+        // fields are appended to an existing file unless a new file is requested
+        std::ifstream tFile( aFilePath );
+        bool tFileExists = tFile.good();
+        tFile.close();
+
+        hid_t tFileID;
+
+        if( tFileExists && !aCreateNewFile )
+        {
+            tFileID = open_parallel_hdf5_file( aFilePath, true );
+        }
+        else
+        {
+            tFileID = create_parallel_hdf5_file( aFilePath );
+        }
+
+        herr_t tStatus = 0;
+
+        save_distributed_vector_to_hdf5_file( tFileID,
+                this->get_label() + "_BlockInfo",
+                tBlockInfo,
+                tStatus );
+
+        save_distributed_vector_to_hdf5_file( tFileID,
+                this->get_label() + "_BasisIDs",
+                tBasisIDs,
+                tStatus );
+
+        save_distributed_vector_to_hdf5_file( tFileID,
+                this->get_label(),
+                tOwnedCoefficients,
+                tStatus );
+
+        // close file
+        tStatus = close_hdf5_file( tFileID );
+    }
+
+    //------------------------------------------------------------------------------
+
+    void Field::load_field_from_shared_hdf5( const std::string & aFilePath )
+    {
+        BSpline_Mesh_Base * tBSplineMesh = mLagrangeMesh->get_bspline_mesh( mInputBSplineIndex );
+
+        uint tNumberOfCoefficients = tBSplineMesh->get_number_of_indexed_basis();
+
+        // range of HMR IDs needed on this proc
+        luint tMinID = std::numeric_limits< luint >::max();
+        luint tMaxID = 0;
+
+        for( uint k = 0; k < tNumberOfCoefficients; ++k )
+        {
+            luint tID = tBSplineMesh->get_basis_by_index( k )->get_hmr_id();
+
+            tMinID = std::min( tMinID, tID );
+            tMaxID = std::max( tMaxID, tID );
+        }
+
+        hid_t  tFileID = open_parallel_hdf5_file( aFilePath );
+        herr_t tStatus = 0;
+
+        // first ID, last ID and number of coefficients of the block of each writing proc
+        Matrix< DDLUMat > tBlockInfo;
+
+        load_distributed_vector_from_hdf5_file( tFileID,
+                this->get_label() + "_BlockInfo",
+                tBlockInfo,
+                tStatus );
+
+        // read only the blocks whose ID range overlaps with the IDs needed on this proc
+        uint tNumberOfBlocks = tBlockInfo.numel() / 3;
+
+        Cell< Matrix< DDLUMat > > tBasisIDs;
+        Cell< Matrix< DDRMat > >  tBlockCoefficients;
+
+        luint tOffset = 0;
+
+        for( uint b = 0; b < tNumberOfBlocks; ++b )
+        {
+            luint tNumberOfEntries = tBlockInfo( 3 * b + 2 );
+
+            if( tNumberOfEntries > 0 && tBlockInfo( 3 * b ) <= tMaxID && tBlockInfo( 3 * b + 1 ) >= tMinID )
+            {
+                tBasisIDs.push_back( Matrix< DDLUMat >() );
+                tBlockCoefficients.push_back( Matrix< DDRMat >() );
+
+                load_distributed_vector_block_from_hdf5_file( tFileID,
+                        this->get_label() + "_BasisIDs",
+                        tOffset,
+                        tNumberOfEntries,
+                        tBasisIDs.back(),
+                        tStatus );
+
+                load_distributed_vector_block_from_hdf5_file( tFileID,
+                        this->get_label(),
+                        tOffset,
+                        tNumberOfEntries,
+                        tBlockCoefficients.back(),
+                        tStatus );
+            }
+
+            tOffset += tNumberOfEntries;
+        }
+
+        tStatus = close_hdf5_file( tFileID );
+
+        Matrix< DDRMat > & tCoefficients = this->get_coefficients();
+        tCoefficients.set_size( tNumberOfCoefficients, 1 );
+
+        for( uint k = 0; k < tNumberOfCoefficients; ++k )
+        {
+            luint tID = tBSplineMesh->get_basis_by_index( k )->get_hmr_id();
+
+            bool tFound = false;
+
+            // IDs within a block are sorted
+            for( uint b = 0; b < tBasisIDs.size() && !tFound; ++b )
+            {
+                const luint * tBegin = tBasisIDs( b ).data();
+                const luint * tEnd   = tBegin + tBasisIDs( b ).numel();
+
+                const luint * tPosition = std::lower_bound( tBegin, tEnd, tID );
+
+                if( tPosition != tEnd && *tPosition == tID )
+                {
+                    tCoefficients( k ) = tBlockCoefficients( b )( tPosition - tBegin );
+                    tFound = true;
+                }
+            }
+
+            MORIS_ERROR( tFound,
+                    "Field::load_field_from_shared_hdf5(), coefficient of basis %lu not found in file %s",
+                    tID,
+                    aFilePath.c_str() );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
     void Field::save_node_values_to_binary( const std::string & aFilePath )
     {
         // make path parallel
@@ -339,6 +339,30 @@ namespace moris::hmr
 
             //------------------------------------------------------------------------------
 
+            /**
+             * saves the B-spline coefficients owned by this proc together with the
+             * HMR IDs of their basis into one file shared by all procs. The block of
+             * each proc is sorted by ID, its ID range is stored in a separate data set.
+             *
+             * @param[ in ] aFilePath       path to shared file
+             * @param[ in ] aCreateNewFile  false: field is appended to an existing file
+             */
+            void save_field_to_shared_hdf5(
+                    const std::string & aFilePath,
+                    const bool          aCreateNewFile = true );
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * loads the B-spline coefficients from a shared file. The coefficients are
+             * matched by the HMR IDs of their basis, therefore the file may have been
+             * written by a different number of procs. Only the blocks whose ID range
+             * overlaps with the IDs on this proc are read, and searched by bisection.
+             */
+            void load_field_from_shared_hdf5( const std::string & aFilePath );
+
+            //------------------------------------------------------------------------------
+
             void save_bspline_coeffs_to_binary( const std::string & aFilePath );
 
             //------------------------------------------------------------------------------
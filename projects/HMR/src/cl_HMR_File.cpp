@@ -8,6 +8,8 @@
  *
  */
 
+#include <fstream>
+
 #include "cl_HMR_File.hpp" //HMR/src
 
 #include "cl_HMR_Factory.hpp" //HMR/src
@@ -19,18 +21,42 @@ namespace moris::hmr
 
     //------------------------------------------------------------------------------
 
-    void File::create( const std::string & aPath )
+    void File::create(
+            const std::string & aPath,
+            const bool          aUseSharedFile )
     {
-        // Create a new file using default properties
-        mFileID = create_hdf5_file( aPath );
+        mUseSharedFile = aUseSharedFile;
+
+        if( mUseSharedFile )
+        {
+            // Create a new file which is written collectively by all procs
+            mFileID = create_parallel_hdf5_file( aPath );
+        }
+        else
+        {
+            // Create a new file using default properties
+            mFileID = create_hdf5_file( aPath );
+        }
     }
 
     //------------------------------------------------------------------------------
 
-    void File::open( const std::string & aPath )
+    void File::open(
+            const std::string & aPath,
+            const bool          aUseSharedFile )
     {
-        // opens an existing file with read and write access
-        mFileID = open_hdf5_file( aPath );
+        mUseSharedFile = aUseSharedFile;
+
+        if( mUseSharedFile )
+        {
+            // opens an existing shared file for reading
+            mFileID = open_parallel_hdf5_file( aPath );
+        }
+        else
+        {
+            // opens an existing file with read and write access
+            mFileID = open_hdf5_file( aPath );
+        }
     }
 
     //------------------------------------------------------------------------------
@@ -135,6 +161,12 @@ namespace moris::hmr
                 aParameters->get_bspline_patterns(),
                 mStatus );
 
+        // save shared file flag, refinement patterns and fields are read with the layout they were written with
+        save_scalar_to_hdf5_file( mFileID,
+                "UseSharedHDF5File",
+                aParameters->use_shared_hdf5_file(),
+                mStatus );
+
         // save Sidesets
         Matrix< DDUMat > tSideSets = aParameters->get_side_sets();
         if ( tSideSets.length() == 0 )
@@ -299,6 +331,19 @@ namespace moris::hmr
 
         aParameters->set_lagrange_to_bspline_mesh( tMatBspToLag );
 
+        // load shared file flag, files written before the flag was introduced are per proc files
+        tValBool = false;
+
+        if( dataset_exists( mFileID, "UseSharedHDF5File" ) )
+        {
+            load_scalar_from_hdf5_file( mFileID,
+                    "UseSharedHDF5File",
+                    tValBool,
+                    mStatus );
+        }
+
+        aParameters->set_use_shared_hdf5_file( tValBool );
+
         // load side sets
         load_matrix_from_hdf5_file( mFileID,
                 "SideSets",
@@ -394,6 +439,13 @@ namespace moris::hmr
                 tPatternListUniqueMat,
                 mStatus );
 
+        // shared files store the elements per pattern and level with per proc offsets
+        if( mUseSharedFile )
+        {
+            this->save_refinement_pattern_to_shared_file( aBackgroundMesh, tPatternListUniqueMat );
+            return;
+        }
+
         // element counter
         Matrix< DDLUMat > tElementCounter ( tMaxLevel+1, tNumUniquePattern, 0 );
 
@@ -482,6 +534,13 @@ namespace moris::hmr
                 tPatternToSave,
                 mStatus );
 
+        // shared files store the elements per pattern and level with per proc offsets
+        if( mUseSharedFile )
+        {
+            this->save_refinement_pattern_to_shared_file( aBackgroundMesh, tPatternToSave );
+            return;
+        }
+
         // element counter
         Matrix< DDLUMat > tElementCounter ( tMaxLevel+1, tNumPattern, 0 );
 
@@ -781,6 +840,13 @@ namespace moris::hmr
             Background_Mesh_Base * aMesh,
             const bool             aMode )
     {
+        // shared files are written with a different layout
+        if( mUseSharedFile )
+        {
+            this->load_refinement_pattern_from_shared_file( aMesh );
+            return;
+        }
+
         Matrix< DDUMat > tPatternListUniqueMat;
         load_matrix_from_hdf5_file( mFileID,
                 "PatternInd",
@@ -863,6 +929,160 @@ namespace moris::hmr
 
     //-------------------------------------------------------------------------------
 
+    void File::save_refinement_pattern_to_shared_file(
+            Background_Mesh_Base          * aBackgroundMesh,
+            const moris::Matrix< DDUMat > & aPatternList )
+    {
+        // max level is synchronized between all procs
+        uint tMaxLevel = aBackgroundMesh->get_max_level();
+
+        uint tNumPattern = aPatternList.numel();
+
+        moris_id tMyRank = par_rank();
+
+        // remember number of procs which wrote this file
+        save_scalar_to_hdf5_file( mFileID,
+                "SharedFileNumberOfProcs",
+                (uint) par_size(),
+                mStatus );
+
+        // element counter of this proc
+        Matrix< DDLUMat > tElementCounter ( tMaxLevel+1, tNumPattern, 0 );
+
+        for( uint l = 0; l < tMaxLevel; ++l )
+        {
+            // cell which contains elements
+            Cell< Background_Element_Base* > tElements;
+
+            // collect elements from this level
+            aBackgroundMesh->collect_elements_on_level_within_proc_domain( l, tElements );
+
+            for( uint Ik = 0; Ik < tNumPattern; ++Ik )
+            {
+                // count refined elements owned by this proc, aura elements are written by their owner
+                for( Background_Element_Base * tElement : tElements )
+                {
+                    if( tElement->get_owner() == tMyRank && tElement->is_refined( aPatternList( Ik ) ) )
+                    {
+                        ++tElementCounter( l, Ik );
+                    }
+                }
+
+                Matrix< DDLUMat > tElementIDs( tElementCounter( l, Ik ), 1 );
+
+                luint tCount = 0;
+
+                for( Background_Element_Base * tElement : tElements )
+                {
+                    if( tElement->get_owner() == tMyRank && tElement->is_refined( aPatternList( Ik ) ) )
+                    {
+                        tElementIDs( tCount++ ) = tElement->get_hmr_id();
+                    }
+                }
+
+                // write block of this proc into shared data set
+                save_distributed_vector_to_hdf5_file( mFileID,
+                        "Pattern_" + std::to_string( aPatternList( Ik ) ) + "_Level_" + std::to_string( l ) + "_Elements",
+                        tElementIDs,
+                        mStatus );
+            }
+        }
+
+        // the counter in the file holds the global number of refined elements
+        Matrix< DDLUMat > tGlobalElementCounter = sum_all_matrix( tElementCounter );
+
+        save_matrix_to_hdf5_file( mFileID,
+                "ElementCounter",
+                tGlobalElementCounter,
+                mStatus );
+    }
+
+    //-------------------------------------------------------------------------------
+
+    void File::load_refinement_pattern_from_shared_file( Background_Mesh_Base * aMesh )
+    {
+        Matrix< DDUMat > tPatternList;
+        load_matrix_from_hdf5_file( mFileID,
+                "PatternInd",
+                tPatternList,
+                mStatus );
+
+        // matrix containing global counter
+        Matrix< DDLUMat > tElementCounter;
+        load_matrix_from_hdf5_file( mFileID,
+                "ElementCounter",
+                tElementCounter,
+                mStatus );
+
+        uint tNumberOfProcsOnSave = 0;
+        load_scalar_from_hdf5_file( mFileID,
+                "SharedFileNumberOfProcs",
+                tNumberOfProcsOnSave,
+                mStatus );
+
+        MORIS_LOG_INFO( "Loading refinement pattern written by %u procs on %i procs.",
+                tNumberOfProcsOnSave,
+                par_size() );
+
+        uint tNumPattern = tPatternList.numel();
+
+        // get number of levels
+        uint tNumberOfLevels = tElementCounter.n_rows();
+
+        for( uint Ik = 0; Ik < tNumPattern; Ik++ )
+        {
+            // select B-Spline pattern
+            aMesh->set_activation_pattern( tPatternList( Ik ) );
+
+            // loop over all levels
+            for( uint l = 0; l < tNumberOfLevels; ++l )
+            {
+                std::string tLabel = "Pattern_" + std::to_string( tPatternList( Ik ) ) + "_Level_" + std::to_string( l ) + "_Elements";
+
+                if( tElementCounter( l, Ik ) > 0 )
+                {
+                    // every proc reads all refined elements of this level
+                    Matrix< DDLUMat > tElementIDs;
+                    load_distributed_vector_from_hdf5_file( mFileID,
+                            tLabel,
+                            tElementIDs,
+                            mStatus );
+
+                    // cell which contains elements
+                    Cell< Background_Element_Base* > tElements;
+
+                    // collect elements from this level
+                    aMesh->collect_elements_on_level_within_proc_domain( l, tElements );
+
+                    // create a map with ids
+                    map< moris_id, luint > tMap;
+
+                    luint j = 0;
+                    for( Background_Element_Base* tElement : tElements )
+                    {
+                        tMap[ tElement->get_hmr_id() ] = j++;
+                    }
+
+                    // flag elements which exist on this proc, the others belong to different procs
+                    for( luint k = 0; k < tElementIDs.numel(); ++k )
+                    {
+                        if( tMap.key_exists( tElementIDs( k ) ) )
+                        {
+                            tElements( tMap.find( tElementIDs( k ) ) )->put_on_refinement_queue();
+                        }
+                    }
+                }
+
+                // refine mesh, queue is synchronized between procs
+                aMesh->perform_refinement( tPatternList( Ik ) );
+            }
+        }
+
+        aMesh->update_database();
+    }
+
+    //-------------------------------------------------------------------------------
+
     std::string File::parralize_filename( const std::string & aPath )
     {
         // test if running in parallel mode
@@ -888,6 +1108,27 @@ namespace moris::hmr
 
     //-------------------------------------------------------------------------------
 
+    bool is_shared_hdf5_file( const std::string & aPath )
+    {
+        // in serial, shared and per proc files have the same name and can be opened either way
+        if( par_size() == 1 )
+        {
+            return false;
+        }
+
+        // per proc files carry the number of procs and the proc rank in their name
+        std::ifstream tProcFile( make_path_parallel( aPath ) );
+
+        bool tIsShared = !tProcFile.good();
+
+        tProcFile.close();
+
+        // all procs must open the file in the same mode
+        return all_land( tIsShared );
+    }
+
+    //-------------------------------------------------------------------------------
+
     /**
      * free function needed by loading constructor
      */
@@ -896,8 +1137,8 @@ namespace moris::hmr
         // create file object
         File tHDF5;
 
-        // open file on disk
-        tHDF5.open( aPath );
+        // open file on disk, a shared file is stored under the given path instead of one file per proc
+        tHDF5.open( aPath, is_shared_hdf5_file( aPath ) );
 
         // create new parameter pointer
         Parameters * aParameters = new Parameters;
@@ -37,6 +37,9 @@ namespace moris::hmr
         //! error handler
         herr_t mStatus;
 
+        //! flag telling if one file is shared by all procs (MPI-IO) instead of one file per proc
+        bool mUseSharedFile = false;
+
 //-------------------------------------------------------------------------------
     public :
 //-------------------------------------------------------------------------------
@@ -52,18 +55,24 @@ namespace moris::hmr
 
         /** creates a new HDF5 file
          *
-         * @param[ in ] aPath   path to file
+         * @param[ in ] aPath            path to file
+         * @param[ in ] aUseSharedFile   false: one file per proc, true: one file shared by all procs
          */
-        void create( const std::string & aPath );
+        void create(
+                const std::string & aPath,
+                const bool          aUseSharedFile = false );
 
 //-------------------------------------------------------------------------------
 
         /**
          * opens an existing HDF5 file
          *
-         * @param[ in ] aPath   path to file
+         * @param[ in ] aPath            path to file
+         * @param[ in ] aUseSharedFile   false: one file per proc, true: one file shared by all procs
          */
-        void open( const std::string & aPath );
+        void open(
+                const std::string & aPath,
+                const bool          aUseSharedFile = false );
 
 //-------------------------------------------------------------------------------
 
@@ -140,6 +149,30 @@ namespace moris::hmr
 
 //-------------------------------------------------------------------------------
     private:
+//-------------------------------------------------------------------------------
+
+        /**
+         * stores the refinement pattern into a file shared by all procs.
+         * each proc writes the HMR IDs of the refined elements it owns,
+         * one data set is written per pattern and level.
+         *
+         * @param[ in ] aBackgroundMesh   pointer to background mesh
+         * @param[ in ] aPatternList      patterns to save
+         */
+        void save_refinement_pattern_to_shared_file(
+                Background_Mesh_Base          * aBackgroundMesh,
+                const moris::Matrix< DDUMat > & aPatternList );
+
+//-------------------------------------------------------------------------------
+
+        /**
+         * loads a refinement pattern from a file shared by all procs.
+         * the file may have been written by any number of procs.
+         *
+         * @param[ inout ] aMesh   pointer to background mesh
+         */
+        void load_refinement_pattern_from_shared_file( Background_Mesh_Base * aMesh );
+
 //-------------------------------------------------------------------------------
 
         /**
@@ -150,6 +183,15 @@ namespace moris::hmr
 //-------------------------------------------------------------------------------
     };
 
+//-------------------------------------------------------------------------------
+
+    /**
+     * tests if a file was written as one file shared by all procs, i.e. no per proc file exists
+     *
+     * @param[ in ] aPath   path to file without proc extension
+     */
+    bool is_shared_hdf5_file( const std::string & aPath );
+
 //-------------------------------------------------------------------------------
 
     /**
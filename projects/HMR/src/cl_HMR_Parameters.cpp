@@ -135,6 +135,10 @@ namespace moris::hmr
         // get user defined processor dimensions. Only matters if decomp method == 3.
         string_to_mat( aParameterList.get< std::string >( "processor_dimensions" ), mProcessorDimensions );
 
+        // get load balancing settings
+        this->set_use_load_balancing( aParameterList.get< bool >( "use_load_balancing" ) );
+        this->set_load_balancing_tolerance( aParameterList.get< real >( "load_balancing_tolerance" ) );
+
         // get domain dimensions
         string_to_mat( aParameterList.get< std::string >( "domain_dimensions" ), mDomainDimensions );
 
@@ -267,6 +271,8 @@ namespace moris::hmr
 
         this->set_restart_refinement_pattern_file( aParameterList.get< std::string >( "restart_refinement_pattern_file" ) );
 
+        this->set_use_shared_hdf5_file( aParameterList.get< bool >( "use_shared_hdf5_file" ) );
+
         this->set_basis_fuction_vtk_file_name( aParameterList.get< std::string >( "basis_function_vtk_file" ) );
 
         // get user-defined refinement functions
@@ -484,6 +490,42 @@ namespace moris::hmr
 
     //--------------------------------------------------------------------------------
 
+    void
+    Parameters::set_use_load_balancing( bool aUseLoadBalancing )
+    {
+        // test if calling this function is allowed
+        this->error_if_locked( "set_use_load_balancing" );
+
+        mUseLoadBalancing = aUseLoadBalancing;
+    }
+
+    //--------------------------------------------------------------------------------
+
+    void
+    Parameters::set_load_balancing_tolerance( real aLoadBalancingTolerance )
+    {
+        MORIS_ERROR( aLoadBalancingTolerance >= 1.0,
+                "Parameters::set_load_balancing_tolerance() - tolerance must not be smaller than 1." );
+
+        mLoadBalancingTolerance = aLoadBalancingTolerance;
+    }
+
+    //--------------------------------------------------------------------------------
+
+    void
+    Parameters::set_balanced_processor_decomposition(
+            const Matrix< DDUMat >&          aProcessorDimensions,
+            const Cell< Matrix< DDLUMat > >& aProcessorSplits )
+    {
+        MORIS_ERROR( aProcessorSplits.size() == this->get_number_of_dimensions(),
+                "Parameters::set_balanced_processor_decomposition() - processor splits incompatible with mesh dimensions." );
+
+        mBalancedProcessorDimensions = aProcessorDimensions;
+        mBalancedProcessorSplits     = aProcessorSplits;
+    }
+
+    //--------------------------------------------------------------------------------
+
     /**
      * sets the mesh orders according to given matrix
      */
@@ -68,6 +68,16 @@ namespace moris::hmr
         //! Processor layout if mProcDecompMethod is 0 (user defined here). Product MUST = # of processors used. Can be 1, 2, or 3 dimensions.
         Matrix< DDUMat > mProcessorDimensions = { { 2 }, { 2 } };
 
+        //! rebalance coarsest elements over the proc grid after refinement
+        bool mUseLoadBalancing = false;
+
+        //! rebalance if max / mean number of active elements per proc exceeds this value
+        real mLoadBalancingTolerance = 1.1;
+
+        //! proc grid and slabs found by load balancing, used by all background meshes created afterwards
+        Matrix< DDUMat >          mBalancedProcessorDimensions;
+        Cell< Matrix< DDLUMat > > mBalancedProcessorSplits;
+
         //! number of elements per direction in overall mesh, without aura
         //! 2D or 3D is determined by length of this vector
         Matrix< DDLUMat > mNumberOfElementsPerDimension = { { 2 }, { 2 } };
@@ -176,6 +186,9 @@ namespace moris::hmr
 
         std::string mRestartfromRefinedPattern = "";
 
+        //! write and read refinement pattern files as one file shared by all procs
+        bool mUseSharedHDF5File = false;
+
         //! maximum level for refinement. Default value is specified
         //! by global constant
         uint mMaxRefinementLevel = gMaxNumberOfLevels - 1;
@@ -244,6 +257,92 @@ namespace moris::hmr
 
         //--------------------------------------------------------------------------------
 
+        /**
+         * returns true if the coarsest elements are rebalanced over the proc grid after refinement
+         *
+         * @return bool
+         */
+        bool
+        use_load_balancing() const
+        {
+            return mUseLoadBalancing;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * sets flag for rebalancing the coarsest elements after refinement
+         *
+         * @param[in] aUseLoadBalancing bool
+         */
+        void set_use_load_balancing( bool aUseLoadBalancing );
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * returns the imbalance factor ( max / mean active elements per proc ) above which
+         * the mesh is rebalanced
+         *
+         * @return real
+         */
+        real
+        get_load_balancing_tolerance() const
+        {
+            return mLoadBalancingTolerance;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * sets the imbalance factor above which the mesh is rebalanced
+         *
+         * @param[in] aLoadBalancingTolerance real, not smaller than 1
+         */
+        void set_load_balancing_tolerance( real aLoadBalancingTolerance );
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * returns the proc grid found by load balancing, empty if not balanced
+         *
+         * @return Matrix< DDUMat >
+         */
+        const Matrix< DDUMat >&
+        get_balanced_processor_dimensions() const
+        {
+            return mBalancedProcessorDimensions;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * returns the first coarsest element of each proc slab per direction found by
+         * load balancing, followed by the number of elements. Empty if not balanced.
+         *
+         * @return Cell< Matrix< DDLUMat > >
+         */
+        const Cell< Matrix< DDLUMat > >&
+        get_balanced_processor_splits() const
+        {
+            return mBalancedProcessorSplits;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * sets the decomposition found by load balancing. Allowed on locked parameters,
+         * such that background meshes created later from these parameters, e.g. during
+         * remeshing, use the same decomposition.
+         *
+         * @param[in] aProcessorDimensions number of procs per direction
+         * @param[in] aProcessorSplits     proc slabs per direction
+         */
+        void set_balanced_processor_decomposition(
+                const Matrix< DDUMat >&          aProcessorDimensions,
+                const Cell< Matrix< DDLUMat > >& aProcessorSplits );
+
+        //--------------------------------------------------------------------------------
+
         /*
          * trivial constructor
          */
@@ -1251,6 +1350,14 @@ namespace moris::hmr
 
         //-------------------------------------------------------------------------------
 
+        void
+        set_use_shared_hdf5_file( bool aUseSharedHDF5File )
+        {
+            mUseSharedHDF5File = aUseSharedHDF5File;
+        }
+
+        //-------------------------------------------------------------------------------
+
         const std::string&
         get_write_background_mesh()
         {
@@ -1291,6 +1398,14 @@ namespace moris::hmr
 
         //-------------------------------------------------------------------------------
 
+        bool
+        use_shared_hdf5_file() const
+        {
+            return mUseSharedHDF5File;
+        }
+
+        //-------------------------------------------------------------------------------
+
         uint
         get_max_refinement_level() const
         {
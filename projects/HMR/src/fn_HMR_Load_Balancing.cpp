@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * fn_HMR_Load_Balancing.cpp
+ *
+ */
+
+#include "fn_HMR_Load_Balancing.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "assert.hpp"
+
+namespace moris::hmr
+{
+    // -----------------------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        /**
+         * Returns max / mean of the part weights, 1 if there is no weight at all
+         */
+        real
+        imbalance_factor( const Matrix< DDRMat >& aPartWeights )
+        {
+            real tSum = 0.0;
+            real tMax = 0.0;
+
+            for ( uint iPart = 0; iPart < aPartWeights.numel(); iPart++ )
+            {
+                tSum += aPartWeights( iPart );
+                tMax = std::max( tMax, aPartWeights( iPart ) );
+            }
+
+            if ( tSum <= 0.0 )
+            {
+                return 1.0;
+            }
+
+            return tMax * aPartWeights.numel() / tSum;
+        }
+
+        // -------------------------------------------------------------------------------------------------------------
+
+        /**
+         * Converts a lexicographic element index into a global ijk position
+         */
+        void
+        get_ijk_from_index(
+                luint                    aIndex,
+                const Matrix< DDLUMat >& aNumberOfElementsPerDimension,
+                luint*                   aIJK )
+        {
+            for ( uint iDim = 0; iDim < aNumberOfElementsPerDimension.numel(); iDim++ )
+            {
+                aIJK[ iDim ] = aIndex % aNumberOfElementsPerDimension( iDim );
+                aIndex /= aNumberOfElementsPerDimension( iDim );
+            }
+        }
+    }    // namespace
+
+    // -----------------------------------------------------------------------------------------------------------------
+
+    luint
+    morton_key(
+            const luint* aIJK,
+            uint         aNumberOfDimensions )
+    {
+        luint tKey = 0;
+
+        // number of bits per direction that fit into the key
+        uint tNumberOfBits = ( 8 * sizeof( luint ) ) / aNumberOfDimensions;
+
+        // interleave bits of all directions, most significant first
+        for ( uint iBit = tNumberOfBits; iBit-- > 0; )
+        {
+            for ( uint iDim = aNumberOfDimensions; iDim-- > 0; )
+            {
+                tKey = ( tKey << 1 ) | ( ( aIJK[ iDim ] >> iBit ) & 1 );
+            }
+        }
+
+        return tKey;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+
+    real
+    compute_sfc_imbalance(
+            const Matrix< DDRMat >&  aWeights,
+            const Matrix< DDLUMat >& aNumberOfElementsPerDimension,
+            uint                     aNumberOfParts )
+    {
+        luint tNumberOfElements = aWeights.numel();
+        uint  tNumberOfDims     = aNumberOfElementsPerDimension.numel();
+
+        // compute keys of all elements
+        Cell< luint > tKeys( tNumberOfElements );
+
+        luint tIJK[ 3 ] = { 0, 0, 0 };
+
+        for ( luint iElement = 0; iElement < tNumberOfElements; iElement++ )
+        {
+            get_ijk_from_index( iElement, aNumberOfElementsPerDimension, tIJK );
+
+            tKeys( iElement ) = morton_key( tIJK, tNumberOfDims );
+        }
+
+        // sort elements along curve
+        Cell< luint > tOrder( tNumberOfElements );
+        std::iota( tOrder.begin(), tOrder.end(), 0 );
+
+        std::sort( tOrder.begin(), tOrder.end(),
+                [ &tKeys ]( luint aA, luint aB ) { return tKeys( aA ) < tKeys( aB ); } );
+
+        real tTotalWeight = 0.0;
+
+        for ( luint iElement = 0; iElement < tNumberOfElements; iElement++ )
+        {
+            tTotalWeight += aWeights( iElement );
+        }
+
+        // cut curve into contiguous chunks of approximately equal weight
+        Matrix< DDRMat > tPartWeights( aNumberOfParts, 1, 0.0 );
+
+        uint tPart        = 0;
+        real tAccumulated = 0.0;
+
+        for ( luint iElement = 0; iElement < tNumberOfElements; iElement++ )
+        {
+            real tWeight = aWeights( tOrder( iElement ) );
+
+            // move on to next part if this element is closer to the next target
+            real tTarget = tTotalWeight * ( tPart + 1 ) / aNumberOfParts;
+
+            if ( tPart + 1 < aNumberOfParts and tAccumulated + 0.5 * tWeight > tTarget )
+            {
+                tPart++;
+            }
+
+            tPartWeights( tPart ) += tWeight;
+            tAccumulated += tWeight;
+        }
+
+        return imbalance_factor( tPartWeights );
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+
+    real
+    compute_cartesian_imbalance(
+            const Matrix< DDRMat >&          aWeights,
+            const Matrix< DDLUMat >&         aNumberOfElementsPerDimension,
+            const Cell< Matrix< DDLUMat > >& aProcSplits )
+    {
+        uint tNumberOfDims = aNumberOfElementsPerDimension.numel();
+
+        MORIS_ASSERT( aProcSplits.size() == tNumberOfDims,
+                "compute_cartesian_imbalance() - number of splits does not match number of dimensions." );
+
+        // map element position to proc coordinate per direction
+        Cell< Matrix< DDUMat > > tProcCoords( tNumberOfDims );
+
+        uint tNumberOfParts = 1;
+
+        for ( uint iDim = 0; iDim < tNumberOfDims; iDim++ )
+        {
+            tProcCoords( iDim ).set_size( aNumberOfElementsPerDimension( iDim ), 1 );
+
+            uint tNumberOfProcs = aProcSplits( iDim ).numel() - 1;
+
+            for ( uint iProc = 0; iProc < tNumberOfProcs; iProc++ )
+            {
+                for ( luint iPos = aProcSplits( iDim )( iProc ); iPos < aProcSplits( iDim )( iProc + 1 ); iPos++ )
+                {
+                    tProcCoords( iDim )( iPos ) = iProc;
+                }
+            }
+
+            tNumberOfParts *= tNumberOfProcs;
+        }
+
+        // sum weights per proc
+        Matrix< DDRMat > tPartWeights( tNumberOfParts, 1, 0.0 );
+
+        luint tIJK[ 3 ] = { 0, 0, 0 };
+
+        for ( luint iElement = 0; iElement < aWeights.numel(); iElement++ )
+        {
+            get_ijk_from_index( iElement, aNumberOfElementsPerDimension, tIJK );
+
+            uint tPart   = 0;
+            uint tStride = 1;
+
+            for ( uint iDim = 0; iDim < tNumberOfDims; iDim++ )
+            {
+                tPart += tStride * tProcCoords( iDim )( tIJK[ iDim ] );
+                tStride *= aProcSplits( iDim ).numel() - 1;
+            }
+
+            tPartWeights( tPart ) += aWeights( iElement );
+        }
+
+        return imbalance_factor( tPartWeights );
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+
+    Cell< Matrix< DDLUMat > >
+    compute_balanced_proc_splits(
+            const Matrix< DDRMat >&  aWeights,
+            const Matrix< DDLUMat >& aNumberOfElementsPerDimension,
+            const Matrix< DDUMat >&  aProcDims,
+            luint                    aMinNumberOfElementsPerProc )
+    {
+        uint tNumberOfDims = aNumberOfElementsPerDimension.numel();
+
+        Cell< Matrix< DDLUMat > > tProcSplits( tNumberOfDims );
+
+        luint tIJK[ 3 ] = { 0, 0, 0 };
+
+        for ( uint iDim = 0; iDim < tNumberOfDims; iDim++ )
+        {
+            luint tNumberOfElements = aNumberOfElementsPerDimension( iDim );
+            uint  tNumberOfProcs    = aProcDims( iDim );
+
+            MORIS_ERROR( tNumberOfElements >= tNumberOfProcs,
+                    "compute_balanced_proc_splits() - fewer elements than procs in direction %u.",
+                    iDim );
+
+            // minimum width, limited by what a uniform decomposition would give
+            luint tMinWidth = std::max( std::min( aMinNumberOfElementsPerProc, tNumberOfElements / tNumberOfProcs ), (luint)1 );
+
+            // project weights onto this direction
+            Matrix< DDRMat > tProjectedWeights( tNumberOfElements, 1, 0.0 );
+
+            for ( luint iElement = 0; iElement < aWeights.numel(); iElement++ )
+            {
+                get_ijk_from_index( iElement, aNumberOfElementsPerDimension, tIJK );
+
+                tProjectedWeights( tIJK[ iDim ] ) += aWeights( iElement );
+            }
+
+            real tTotalWeight = 0.0;
+
+            for ( luint iPos = 0; iPos < tNumberOfElements; iPos++ )
+            {
+                tTotalWeight += tProjectedWeights( iPos );
+            }
+
+            Matrix< DDLUMat >& tSplits = tProcSplits( iDim );
+            tSplits.set_size( tNumberOfProcs + 1, 1, 0 );
+            tSplits( tNumberOfProcs ) = tNumberOfElements;
+
+            // place each cut where the accumulated weight is closest to its target
+            luint tPos         = 0;
+            real  tAccumulated = 0.0;
+
+            for ( uint iProc = 1; iProc < tNumberOfProcs; iProc++ )
+            {
+                real tTarget = tTotalWeight * iProc / tNumberOfProcs;
+
+                // each slab keeps the minimum width
+                luint tMinPos = tSplits( iProc - 1 ) + tMinWidth;
+                luint tMaxPos = tNumberOfElements - ( tNumberOfProcs - iProc ) * tMinWidth;
+
+                while ( tPos < tMinPos )
+                {
+                    tAccumulated += tProjectedWeights( tPos++ );
+                }
+
+                while ( tPos < tMaxPos and tAccumulated + 0.5 * tProjectedWeights( tPos ) < tTarget )
+                {
+                    tAccumulated += tProjectedWeights( tPos++ );
+                }
+
+                tSplits( iProc ) = tPos;
+            }
+        }
+
+        return tProcSplits;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * fn_HMR_Load_Balancing.hpp
+ *
+ */
+
+#ifndef MORIS_FN_HMR_LOAD_BALANCING_HPP
+#define MORIS_FN_HMR_LOAD_BALANCING_HPP
+
+#include "typedefs.hpp"
+#include "cl_Cell.hpp"
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+
+/*
+ * Serial helpers for balancing the coarsest background mesh over the procs.
+ *
+ * All functions operate on a weight vector of all coarsest elements of the
+ * global domain, without padding, numbered lexicographically
+ * ( i + n_x * ( j + n_y * k ) ). The imbalance factor of a partition is the
+ * maximum weight of a part divided by the mean weight of all parts.
+ */
+namespace moris::hmr
+{
+    /**
+     * Calculates the position of a coarsest element on the Morton (Z-order) curve
+     *
+     * @param aIJK Global ijk position of the element, without padding
+     * @param aNumberOfDimensions Number of spatial dimensions
+     * @return Morton key
+     */
+    luint morton_key(
+            const luint* aIJK,
+            uint         aNumberOfDimensions );
+
+    /**
+     * Calculates the imbalance factor of a partition into contiguous chunks
+     * of the Morton curve. Since chunks are not restricted to a proc grid, this
+     * is a lower bound for what the Cartesian decomposition can achieve.
+     *
+     * @param aWeights Weights of all coarsest elements
+     * @param aNumberOfElementsPerDimension Number of coarsest elements per direction
+     * @param aNumberOfParts Number of procs
+     * @return Imbalance factor
+     */
+    real compute_sfc_imbalance(
+            const Matrix< DDRMat >&  aWeights,
+            const Matrix< DDLUMat >& aNumberOfElementsPerDimension,
+            uint                     aNumberOfParts );
+
+    /**
+     * Calculates the imbalance factor of a Cartesian decomposition
+     *
+     * @param aWeights Weights of all coarsest elements
+     * @param aNumberOfElementsPerDimension Number of coarsest elements per direction
+     * @param aProcSplits First element of each proc slab per direction, followed by the number of elements
+     * @return Imbalance factor
+     */
+    real compute_cartesian_imbalance(
+            const Matrix< DDRMat >&          aWeights,
+            const Matrix< DDLUMat >&         aNumberOfElementsPerDimension,
+            const Cell< Matrix< DDLUMat > >& aProcSplits );
+
+    /**
+     * Calculates splits of a Cartesian decomposition such that the projection of the
+     * weights onto each direction is evenly distributed over the procs in this direction.
+     *
+     * @param aWeights Weights of all coarsest elements
+     * @param aNumberOfElementsPerDimension Number of coarsest elements per direction
+     * @param aProcDims Number of procs per direction
+     * @param aMinNumberOfElementsPerProc Minimum width of each proc slab, e.g. to fit the aura. Reduced
+     *        to the width of a uniform decomposition if there are not enough elements.
+     * @return First element of each proc slab per direction, followed by the number of elements
+     */
+    Cell< Matrix< DDLUMat > > compute_balanced_proc_splits(
+            const Matrix< DDRMat >&  aWeights,
+            const Matrix< DDLUMat >& aNumberOfElementsPerDimension,
+            const Matrix< DDUMat >&  aProcDims,
+            luint                    aMinNumberOfElementsPerProc = 1 );
+}
+
+#endif    // MORIS_FN_HMR_LOAD_BALANCING_HPP
@@ -135,6 +135,113 @@ namespace moris::hmr
         }
     }
 
+    TEST_CASE( "HMR_IO_Shared_File", "[moris],[hmr],[HMR_IO_Shared_File]" )
+    {
+        if ( par_size() <= 2 )
+        {
+            // create settings object
+            Parameters tParameters;
+
+            tParameters.set_number_of_elements_per_dimension( { { 4 }, { 4 } } );
+
+            tParameters.set_domain_dimensions( { { 1 }, { 1 } } );
+            tParameters.set_domain_offset( { { -0.5 }, { -0.5 } } );
+
+            tParameters.set_bspline_truncation( true );
+
+            tParameters.set_lagrange_orders( { { 1 } } );
+            tParameters.set_lagrange_patterns( { { 2 } } );
+
+            tParameters.set_bspline_orders( { { 1 }, { 1 } } );
+            tParameters.set_bspline_patterns( { { 0 }, { 1 } } );
+
+            tParameters.set_staircase_buffer( 3 );
+            tParameters.set_refinement_buffer( 3 );
+
+            tParameters.set_initial_refinement( { { 1 } } );
+            tParameters.set_initial_refinement_patterns( { { 0 } } );
+
+            Cell< Matrix< DDSMat > > tLagrangeToBSplineMesh( 1 );
+            tLagrangeToBSplineMesh( 0 ) = { { 0 }, { 1 } };
+
+            tParameters.set_lagrange_to_bspline_mesh( tLagrangeToBSplineMesh );
+
+            // write one file shared by all procs
+            tParameters.set_use_shared_hdf5_file( true );
+
+            HMR tHMR( tParameters );
+
+            auto tDatabase = tHMR.get_database();
+
+            tDatabase->set_activation_pattern( 0 );
+
+            tHMR.perform_initial_refinement();
+
+            tDatabase->set_activation_pattern( 1 );
+
+            // refine the first element three times
+            for ( uint tLevel = 0; tLevel < 3; ++tLevel )
+            {
+                tDatabase->get_background_mesh()->get_element( 0 )->put_on_refinement_queue();
+
+                tDatabase->get_background_mesh()->perform_refinement( 1 );
+            }
+
+            tDatabase->unite_patterns( 0, 1, 2 );
+
+            tDatabase->update_bspline_meshes();
+            tDatabase->update_lagrange_meshes();
+            tDatabase->finalize();
+
+            // field whose coefficients are the HMR IDs of their basis
+            auto tMesh  = tHMR.create_mesh( 0 );
+            auto tField = tMesh->create_field( "BasisIDs", 0 );
+
+            BSpline_Mesh_Base* tBSplineMesh = tDatabase->get_lagrange_mesh_by_index( 0 )->get_bspline_mesh( 0 );
+
+            Matrix< DDRMat >& tCoefficients = tField->get_coefficients();
+            tCoefficients.set_size( tBSplineMesh->get_number_of_indexed_basis(), 1 );
+
+            for ( uint iBasis = 0; iBasis < tCoefficients.numel(); iBasis++ )
+            {
+                tCoefficients( iBasis ) = tBSplineMesh->get_basis_by_index( iBasis )->get_hmr_id();
+            }
+
+            // write mesh and field
+            tHMR.save_to_hdf5( "HMR_IO_Shared_Mesh.hdf5", 0 );
+
+            tField->save_field_to_hdf5( "HMR_IO_Shared_Field.hdf5" );
+
+            // restart from shared file
+            HMR tHMR_Input( "HMR_IO_Shared_Mesh.hdf5" );
+
+            auto tInputDatabase = tHMR_Input.get_database();
+
+            REQUIRE( tInputDatabase->get_parameters()->use_shared_hdf5_file() );
+
+            // refinement pattern is restored
+            REQUIRE( tInputDatabase->get_lagrange_mesh_by_index( 0 )->get_number_of_nodes_on_proc()
+                     == tDatabase->get_lagrange_mesh_by_index( 0 )->get_number_of_nodes_on_proc() );
+
+            REQUIRE( tInputDatabase->get_lagrange_mesh_by_index( 0 )->get_number_of_elements()
+                     == tDatabase->get_lagrange_mesh_by_index( 0 )->get_number_of_elements() );
+
+            // coefficients are matched by the HMR IDs of their basis
+            std::shared_ptr< Field > tInputField = tHMR_Input.load_field_from_hdf5_file( "BasisIDs", "HMR_IO_Shared_Field.hdf5", 0, 0 );
+
+            BSpline_Mesh_Base* tInputBSplineMesh = tInputDatabase->get_lagrange_mesh_by_index( 0 )->get_bspline_mesh( 0 );
+
+            const Matrix< DDRMat >& tInputCoefficients = tInputField->get_coefficients();
+
+            REQUIRE( tInputCoefficients.numel() == tInputBSplineMesh->get_number_of_indexed_basis() );
+
+            for ( uint iBasis = 0; iBasis < tInputCoefficients.numel(); iBasis++ )
+            {
+                CHECK( tInputCoefficients( iBasis ) == tInputBSplineMesh->get_basis_by_index( iBasis )->get_hmr_id() );
+            }
+        }
+    }
+
     TEST_CASE( "HMR_Field_IO_EXO", "[moris],[hmr],[HMR_Field_IO_Exo]" )
     {
         if ( par_size() == 1 )
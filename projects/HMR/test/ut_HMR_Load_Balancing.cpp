@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * ut_HMR_Load_Balancing.cpp
+ *
+ */
+
+#include <catch.hpp>
+#include "fn_HMR_Load_Balancing.hpp"
+#include "cl_HMR.hpp"
+#include "cl_HMR_Background_Mesh_Base.hpp"
+#include "cl_HMR_Database.hpp"
+#include "cl_HMR_Lagrange_Mesh_Base.hpp"
+#include "cl_HMR_Parameters.hpp"
+#include "cl_Communication_Tools.hpp"
+
+namespace moris::hmr
+{
+    TEST_CASE( "HMR Load Balancing", "[moris], [hmr], [load_balancing]" )
+    {
+        SECTION( "Morton keys" )
+        {
+            luint tIJK2D[ 3 ][ 2 ] = { { 1, 0 }, { 0, 1 }, { 3, 2 } };
+
+            CHECK( morton_key( tIJK2D[ 0 ], 2 ) == 1 );
+            CHECK( morton_key( tIJK2D[ 1 ], 2 ) == 2 );
+            CHECK( morton_key( tIJK2D[ 2 ], 2 ) == 13 );
+
+            luint tIJK3D[ 3 ] = { 1, 1, 1 };
+
+            CHECK( morton_key( tIJK3D, 3 ) == 7 );
+        }
+
+        SECTION( "Refined corner on 4x4 mesh and 2x2 procs" )
+        {
+            Matrix< DDLUMat > tNumberOfElementsPerDimension = { { 4 }, { 4 } };
+            Matrix< DDUMat >  tProcDims                     = { { 2 }, { 2 } };
+
+            // first element has been refined twice
+            Matrix< DDRMat > tWeights( 16, 1, 1.0 );
+            tWeights( 0 ) = 13.0;
+
+            // uniform decomposition
+            Cell< Matrix< DDLUMat > > tUniformSplits = { { { 0 }, { 2 }, { 4 } }, { { 0 }, { 2 }, { 4 } } };
+
+            CHECK( compute_cartesian_imbalance( tWeights, tNumberOfElementsPerDimension, tUniformSplits ) == Approx( 16.0 / 7.0 ) );
+
+            // balanced decomposition moves both cuts towards the refined corner
+            Cell< Matrix< DDLUMat > > tSplits = compute_balanced_proc_splits( tWeights, tNumberOfElementsPerDimension, tProcDims );
+
+            REQUIRE( tSplits.size() == 2 );
+
+            for ( uint iDim = 0; iDim < 2; iDim++ )
+            {
+                REQUIRE( tSplits( iDim ).numel() == 3 );
+                CHECK( tSplits( iDim )( 0 ) == 0 );
+                CHECK( tSplits( iDim )( 1 ) == 1 );
+                CHECK( tSplits( iDim )( 2 ) == 4 );
+            }
+
+            CHECK( compute_cartesian_imbalance( tWeights, tNumberOfElementsPerDimension, tSplits ) == Approx( 13.0 / 7.0 ) );
+
+            // refined element cannot be split, so the curve does not do better here
+            CHECK( compute_sfc_imbalance( tWeights, tNumberOfElementsPerDimension, 4 ) == Approx( 13.0 / 7.0 ) );
+
+            // minimum slab width is respected
+            Cell< Matrix< DDLUMat > > tWideSplits = compute_balanced_proc_splits( tWeights, tNumberOfElementsPerDimension, tProcDims, 2 );
+
+            CHECK( tWideSplits( 0 )( 1 ) == 2 );
+            CHECK( tWideSplits( 1 )( 1 ) == 2 );
+        }
+
+        SECTION( "Uniform weights" )
+        {
+            Matrix< DDLUMat > tNumberOfElementsPerDimension = { { 6 }, { 4 }, { 2 } };
+            Matrix< DDUMat >  tProcDims                     = { { 3 }, { 2 }, { 1 } };
+
+            Matrix< DDRMat > tWeights( 48, 1, 1.0 );
+
+            Cell< Matrix< DDLUMat > > tSplits = compute_balanced_proc_splits( tWeights, tNumberOfElementsPerDimension, tProcDims );
+
+            CHECK( tSplits( 0 )( 1 ) == 2 );
+            CHECK( tSplits( 0 )( 2 ) == 4 );
+            CHECK( tSplits( 1 )( 1 ) == 2 );
+            CHECK( tSplits( 2 )( 1 ) == 2 );
+
+            CHECK( compute_cartesian_imbalance( tWeights, tNumberOfElementsPerDimension, tSplits ) == Approx( 1.0 ) );
+            CHECK( compute_sfc_imbalance( tWeights, tNumberOfElementsPerDimension, 6 ) == Approx( 1.0 ) );
+        }
+    }
+
+    TEST_CASE( "HMR Repartitioning", "[moris], [hmr], [load_balancing], [HMR_Repartitioning]" )
+    {
+        if ( par_size() == 2 || par_size() == 4 )
+        {
+            Parameters tParameters;
+
+            tParameters.set_number_of_elements_per_dimension( { { 8 }, { 8 } } );
+            tParameters.set_domain_dimensions( { { 1 }, { 1 } } );
+            tParameters.set_domain_offset( { { 0 }, { 0 } } );
+            tParameters.set_lagrange_orders( { { 1 } } );
+            tParameters.set_lagrange_patterns( { { 0 } } );
+            tParameters.set_bspline_orders( { { 1 } } );
+            tParameters.set_bspline_patterns( { { 0 } } );
+
+            Cell< Matrix< DDSMat > > tLagrangeToBSplineMesh( 1 );
+            tLagrangeToBSplineMesh( 0 ) = { { 0 } };
+
+            tParameters.set_lagrange_to_bspline_mesh( tLagrangeToBSplineMesh );
+
+            tParameters.set_use_load_balancing( true );
+
+            HMR tHMR( tParameters );
+
+            auto tDatabase = tHMR.get_database();
+
+            tDatabase->set_activation_pattern( 0 );
+
+            Background_Mesh_Base* tBackgroundMesh = tDatabase->get_background_mesh();
+
+            // refine the lower left corner of the domain three times
+            for ( uint tLevel = 0; tLevel < 3; ++tLevel )
+            {
+                Matrix< DDRMat > tCenter;
+
+                for ( luint e = 0; e < tBackgroundMesh->get_number_of_active_elements_on_proc(); ++e )
+                {
+                    tBackgroundMesh->calc_center_of_element( tBackgroundMesh->get_element( e ), tCenter );
+
+                    if ( tCenter( 0 ) < 0.3 && tCenter( 1 ) < 0.3 )
+                    {
+                        tBackgroundMesh->get_element( e )->put_on_refinement_queue();
+                    }
+                }
+
+                tBackgroundMesh->perform_refinement( 0 );
+            }
+
+            tDatabase->update_bspline_meshes();
+            tDatabase->update_lagrange_meshes();
+
+            luint tNumberOfElements = sum_all( tBackgroundMesh->get_number_of_active_elements_on_proc() );
+            real  tMaxNumberOfElements = max_all( (real)tBackgroundMesh->get_number_of_active_elements_on_proc() );
+
+            // nodal field which is migrated
+            Lagrange_Mesh_Base* tLagrangeMesh = tDatabase->get_lagrange_mesh_by_index( 0 );
+
+            uint tFieldIndex = tLagrangeMesh->create_real_scalar_field_data( "X", EntityRank::NODE );
+
+            Matrix< DDRMat >& tValues = tLagrangeMesh->get_real_scalar_field_data( tFieldIndex );
+
+            tValues.set_size( tLagrangeMesh->get_number_of_nodes_on_proc(), 1 );
+
+            for ( uint n = 0; n < tValues.numel(); ++n )
+            {
+                tValues( n ) = tLagrangeMesh->get_node_by_index( n )->get_xyz()[ 0 ];
+            }
+
+            REQUIRE( tHMR.perform_load_balancing() );
+
+            // meshes have been rebuilt
+            tBackgroundMesh = tDatabase->get_background_mesh();
+            tLagrangeMesh   = tDatabase->get_lagrange_mesh_by_index( 0 );
+
+            CHECK( sum_all( tBackgroundMesh->get_number_of_active_elements_on_proc() ) == tNumberOfElements );
+            CHECK( max_all( (real)tBackgroundMesh->get_number_of_active_elements_on_proc() ) < tMaxNumberOfElements );
+
+            // same decomposition is used by following background meshes
+            CHECK( tDatabase->get_parameters()->get_balanced_processor_splits().size() == 2 );
+
+            REQUIRE( tLagrangeMesh->get_number_of_real_scalar_fields() == 1 );
+
+            const Matrix< DDRMat >& tNewValues = tLagrangeMesh->get_real_scalar_field_data( 0 );
+
+            REQUIRE( tNewValues.numel() == tLagrangeMesh->get_number_of_nodes_on_proc() );
+
+            for ( uint n = 0; n < tNewValues.numel(); ++n )
+            {
+                CHECK( tNewValues( n ) == Approx( tLagrangeMesh->get_node_by_index( n )->get_xyz()[ 0 ] ) );
+            }
+        }
+    }
+}
@@ -27,6 +27,13 @@
 // #define ARMA_USE_MKL_ALLOC
 // #endif
 
+// route matrix storage through the memory tracker such that it is attributed to traced scopes
+#ifdef MORIS_MEMORY_TRACKING
+#include "cl_Memory_Tracker.hpp"
+#define ARMA_ALIEN_MEM_ALLOC_FUNCTION moris::Memory_Tracker::allocate
+#define ARMA_ALIEN_MEM_FREE_FUNCTION moris::Memory_Tracker::deallocate
+#endif
+
 #include <armadillo>
 
 #include "typedefs.hpp"
@@ -0,0 +1,459 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Hash_Map.hpp
+ *
+ */
+
+#ifndef MORIS_CONTAINERS_CL_HASH_MAP_HPP_
+#define MORIS_CONTAINERS_CL_HASH_MAP_HPP_
+
+// C++ header files.
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <cstdint>
+#include <iostream>
+
+// MORIS library header files.
+#include "typedefs.hpp"    // COR/src
+#include "assert.hpp"
+
+namespace moris
+{
+    /**
+     * @brief Open addressing hash map with linear probing. All entries are stored in one contiguous array,
+     * thus a lookup touches only a few neighboring slots instead of chasing the node pointers of std::map.
+     * Provides the interface subset of moris::map used for id to index maps.
+     * The iteration order is not sorted and changes when the map grows.
+     */
+    template< typename T1, typename T2 >
+    class Hash_Map
+    {
+      private:
+        // key value pairs of all slots
+        std::vector< std::pair< T1, T2 > > mSlots;
+
+        // flag if a slot is occupied
+        std::vector< char > mOccupied;
+
+        // number of entries
+        moris::uint mSize = 0;
+
+        // shift of the hash value to obtain the slot index, number of slots is 2^( 64 - mShift )
+        moris::uint mShift = 64;
+
+        // maximal load factor in percent before the map grows
+        static constexpr moris::uint sMaxLoadPercent = 70;
+
+        // minimal number of slots
+        static constexpr moris::uint sMinNumSlots = 8;
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief returns the home slot of a key, the hash is scrambled by Fibonacci hashing
+         * since std::hash is the identity for integral keys
+         */
+        std::size_t
+        get_home_slot( const T1& aK ) const
+        {
+            std::uint64_t tHash = static_cast< std::uint64_t >( std::hash< T1 >()( aK ) ) * 0x9E3779B97F4A7C15ull;
+
+            return static_cast< std::size_t >( tHash >> mShift );
+        }
+
+        //--------------------------------------------------------------------------------
+
+        std::size_t
+        get_next_slot( const std::size_t aSlot ) const
+        {
+            return ( aSlot + 1 ) & ( mSlots.size() - 1 );
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief returns the slot of a key or the number of slots if the key does not exist
+         */
+        std::size_t
+        find_slot( const T1& aK ) const
+        {
+            if ( mSize == 0 )
+            {
+                return mSlots.size();
+            }
+
+            for ( std::size_t tSlot = this->get_home_slot( aK );; tSlot = this->get_next_slot( tSlot ) )
+            {
+                if ( !mOccupied[ tSlot ] )
+                {
+                    return mSlots.size();
+                }
+
+                if ( mSlots[ tSlot ].first == aK )
+                {
+                    return tSlot;
+                }
+            }
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief rehashes all entries into a given number of slots
+         *
+         * @param[in] aNumSlots Number of slots, power of two
+         */
+        void
+        rehash( const std::size_t aNumSlots )
+        {
+            std::vector< std::pair< T1, T2 > > tSlots( aNumSlots );
+            std::vector< char >                tOccupied( aNumSlots, 0 );
+
+            tSlots.swap( mSlots );
+            tOccupied.swap( mOccupied );
+
+            mShift = 64;
+            for ( std::size_t tNumSlots = aNumSlots; tNumSlots > 1; tNumSlots >>= 1 )
+            {
+                mShift--;
+            }
+
+            for ( std::size_t iSlot = 0; iSlot < tSlots.size(); iSlot++ )
+            {
+                if ( tOccupied[ iSlot ] )
+                {
+                    std::size_t tSlot = this->get_home_slot( tSlots[ iSlot ].first );
+
+                    while ( mOccupied[ tSlot ] )
+                    {
+                        tSlot = this->get_next_slot( tSlot );
+                    }
+
+                    mSlots[ tSlot ]    = std::move( tSlots[ iSlot ] );
+                    mOccupied[ tSlot ] = 1;
+                }
+            }
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief returns the slot of a key, a new entry with a default value is created if the key does not exist
+         */
+        std::size_t
+        find_or_insert_slot( const T1& aK )
+        {
+            // grow before inserting such that probing always finds an empty slot
+            if ( 100 * ( (std::size_t)mSize + 1 ) > sMaxLoadPercent * mSlots.size() )
+            {
+                this->rehash( std::max( (std::size_t)sMinNumSlots, 2 * mSlots.size() ) );
+            }
+
+            std::size_t tSlot = this->get_home_slot( aK );
+
+            while ( mOccupied[ tSlot ] )
+            {
+                if ( mSlots[ tSlot ].first == aK )
+                {
+                    return tSlot;
+                }
+
+                tSlot = this->get_next_slot( tSlot );
+            }
+
+            mSlots[ tSlot ]    = std::pair< T1, T2 >( aK, T2() );
+            mOccupied[ tSlot ] = 1;
+            mSize++;
+
+            return tSlot;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief forward iterator over the occupied slots
+         */
+        template< typename Map, typename Pair >
+        class Slot_Iterator
+        {
+          private:
+            Map*        mMap;
+            std::size_t mSlot;
+
+          public:
+            Slot_Iterator( Map* aMap, std::size_t aSlot )
+                    : mMap( aMap )
+                    , mSlot( aSlot )
+            {
+                this->skip_empty_slots();
+            }
+
+            void
+            skip_empty_slots()
+            {
+                while ( mSlot < mMap->mSlots.size() and !mMap->mOccupied[ mSlot ] )
+                {
+                    mSlot++;
+                }
+            }
+
+            Pair& operator*() const { return mMap->mSlots[ mSlot ]; }
+
+            Pair* operator->() const { return &mMap->mSlots[ mSlot ]; }
+
+            Slot_Iterator&
+            operator++()
+            {
+                mSlot++;
+                this->skip_empty_slots();
+                return *this;
+            }
+
+            Slot_Iterator
+            operator++( int )
+            {
+                Slot_Iterator tIterator = *this;
+                ++( *this );
+                return tIterator;
+            }
+
+            bool operator==( const Slot_Iterator& aOther ) const { return mSlot == aOther.mSlot; }
+
+            bool operator!=( const Slot_Iterator& aOther ) const { return mSlot != aOther.mSlot; }
+        };
+
+      public:
+        typedef Slot_Iterator< Hash_Map< T1, T2 >, std::pair< T1, T2 > >             iterator;
+        typedef Slot_Iterator< const Hash_Map< T1, T2 >, const std::pair< T1, T2 > > const_iterator;
+
+        //--------------------------------------------------------------------------------
+
+        Hash_Map() = default;
+
+        Hash_Map( Hash_Map< T1, T2 > const & aMap ) = default;
+
+        ~Hash_Map() = default;
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief allocates slots for a given number of entries such that no rehashing is needed while inserting them
+         *
+         * @param[in] aNumEntries Expected number of entries
+         */
+        void
+        reserve( const moris::uint aNumEntries )
+        {
+            std::size_t tNumSlots = sMinNumSlots;
+
+            while ( sMaxLoadPercent * tNumSlots < 100 * (std::size_t)aNumEntries )
+            {
+                tNumSlots *= 2;
+            }
+
+            if ( tNumSlots > mSlots.size() )
+            {
+                this->rehash( tNumSlots );
+            }
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * Inserts a key value pair if the key does not exist yet. An existing value is not changed.
+         *
+         * @return true if the pair was inserted
+         */
+        template< class pair >
+        bool
+        insert( const pair& apair )
+        {
+            moris::uint tSize = mSize;
+
+            std::size_t tSlot = this->find_or_insert_slot( apair.first );
+
+            if ( mSize == tSize )
+            {
+                return false;
+            }
+
+            mSlots[ tSlot ].second = apair.second;
+
+            return true;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * Access operator. Returns a reference to the mapped value of a key, an element is
+         * inserted if the key does not exist.
+         *
+         * @param[in] aK Key value of the element whose mapped value is accessed
+         */
+        T2&
+        operator[]( const T1& aK )
+        {
+            return mSlots[ this->find_or_insert_slot( aK ) ].second;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * Checks if key exists in map
+         *
+         * @param[in] aK Key to be searched for
+         */
+        bool
+        key_exists( const T1& aK ) const
+        {
+            return this->find_slot( aK ) < mSlots.size();
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * Returns the value of a key, throws an error if the key is not found
+         *
+         * @param[in] aK Key to be searched for
+         */
+        const T2&
+        find( const T1& aK ) const
+        {
+            std::size_t tSlot = this->find_slot( aK );
+
+            MORIS_ERROR( tSlot < mSlots.size(), "moris::Hash_Map.find - Key not found" );
+
+            return mSlots[ tSlot ].second;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        T2&
+        find( const T1& aK )
+        {
+            return const_cast< T2& >( static_cast< const moris::Hash_Map< T1, T2 >* >( this )->find( aK ) );
+        }
+
+        //--------------------------------------------------------------------------------
+
+        bool
+        empty() const
+        {
+            return mSize == 0;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * Removes all elements, the allocated slots are kept
+         */
+        void
+        clear()
+        {
+            std::fill( mOccupied.begin(), mOccupied.end(), 0 );
+            mSize = 0;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        moris::uint
+        size() const
+        {
+            return mSize;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        moris::uint
+        count( const T1& aK ) const
+        {
+            return this->key_exists( aK ) ? 1 : 0;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief Removes an element from the map. Following entries of the probe sequence are
+         * shifted back such that no tombstones are needed.
+         */
+        void
+        erase( const T1& aK )
+        {
+            std::size_t tSlot = this->find_slot( aK );
+
+            if ( tSlot == mSlots.size() )
+            {
+                return;
+            }
+
+            std::size_t tNext = this->get_next_slot( tSlot );
+
+            while ( mOccupied[ tNext ] )
+            {
+                std::size_t tHome = this->get_home_slot( mSlots[ tNext ].first );
+
+                // entry can be moved into the gap if its home slot is not between the gap and its position
+                bool tMove = tSlot <= tNext
+                                   ? ( tHome <= tSlot or tHome > tNext )
+                                   : ( tHome <= tSlot and tHome > tNext );
+
+                if ( tMove )
+                {
+                    mSlots[ tSlot ] = std::move( mSlots[ tNext ] );
+                    tSlot           = tNext;
+                }
+
+                tNext = this->get_next_slot( tNext );
+            }
+
+            mOccupied[ tSlot ] = 0;
+            mSize--;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        iterator begin() { return iterator( this, 0 ); }
+
+        iterator end() { return iterator( this, mSlots.size() ); }
+
+        const_iterator begin() const { return const_iterator( this, 0 ); }
+
+        const_iterator end() const { return const_iterator( this, mSlots.size() ); }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief returns the number of bytes allocated by this map
+         */
+        std::size_t
+        get_memory_usage() const
+        {
+            return mSlots.capacity() * sizeof( std::pair< T1, T2 > ) + mOccupied.capacity() * sizeof( char );
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief Print map on screen
+         */
+        void
+        print( const std::string& aVarName = "morisHashMap" ) const
+        {
+            std::cout << "\n-------------------------------------------------\n\n";
+
+            for ( const auto& tPair : *this )
+            {
+                std::cout << aVarName << "[" << tPair.first << "] = " << tPair.second << '\n';
+            }
+        }
+    };
+}    // namespace moris
+
+#endif /* MORIS_CONTAINERS_CL_HASH_MAP_HPP_ */
@@ -199,6 +199,26 @@ namespace moris
             return mMap.end();
         }
 
+        /**
+         * @brief Returns a const iterator to the first element
+         */
+        auto
+        begin() const
+            -> decltype( mMap.cbegin() )
+        {
+            return mMap.cbegin();
+        }
+
+        /**
+         * @brief  Returns a const iterator pointing to the past-the-end element.
+         */
+        auto
+        end() const
+            -> decltype( mMap.cend() )
+        {
+            return mMap.cend();
+        }
+
         /**
          * @brief  Removes an element from the map
          */
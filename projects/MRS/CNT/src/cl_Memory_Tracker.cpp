@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Memory_Tracker.cpp
+ *
+ */
+
+#include "cl_Memory_Tracker.hpp"
+
+// C++ header files.
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace moris
+{
+    namespace
+    {
+        // maximum depth of nested scopes, deeper scopes are merged into the last one
+        constexpr std::size_t sMaxScopeDepth = 256;
+
+        // size of header storing the allocation size, keeps the default alignment
+        constexpr std::size_t sHeaderSize = alignof( std::max_align_t );
+
+        // number of bytes currently allocated
+        std::atomic< std::size_t > sLiveBytes( 0 );
+
+        // index of innermost scope; scopes are opened by the tracers of each thread
+        // and therefore nested per thread
+        thread_local std::size_t sScopeLevel = 0;
+
+        // peak and initial live bytes of each active scope of this thread
+        thread_local std::size_t sScopePeak[ sMaxScopeDepth ]  = {};
+        thread_local std::size_t sScopeStart[ sMaxScopeDepth ] = {};
+
+        //------------------------------------------------------------------
+
+        inline std::size_t
+        scope_index( std::size_t aLevel )
+        {
+            return aLevel < sMaxScopeDepth ? aLevel : sMaxScopeDepth - 1;
+        }
+
+        //------------------------------------------------------------------
+
+        inline void
+        record_allocation( std::size_t aSize )
+        {
+            std::size_t tLive = sLiveBytes.fetch_add( aSize, std::memory_order_relaxed ) + aSize;
+
+            // raise peak of innermost scope of this thread, parents are updated on sign out
+            std::size_t& tPeak = sScopePeak[ scope_index( sScopeLevel ) ];
+
+            if ( tLive > tPeak )
+            {
+                tPeak = tLive;
+            }
+        }
+
+        //------------------------------------------------------------------
+
+        inline void
+        record_deallocation( std::size_t aSize )
+        {
+            sLiveBytes.fetch_sub( aSize, std::memory_order_relaxed );
+        }
+    }    // namespace
+
+    //------------------------------------------------------------------
+
+    void
+    Memory_Tracker::sign_in()
+    {
+        std::size_t tLevel = scope_index( sScopeLevel + 1 );
+        std::size_t tLive  = sLiveBytes.load();
+
+        sScopeStart[ tLevel ] = tLive;
+        sScopePeak[ tLevel ]  = tLive;
+
+        sScopeLevel++;
+    }
+
+    //------------------------------------------------------------------
+
+    void
+    Memory_Tracker::sign_out()
+    {
+        std::size_t tLevel = sScopeLevel;
+
+        if ( tLevel == 0 )
+        {
+            return;
+        }
+
+        std::size_t tPeak = sScopePeak[ scope_index( tLevel ) ];
+
+        sScopeLevel--;
+
+        // pass peak on to parent scope
+        std::size_t& tParentPeak = sScopePeak[ scope_index( tLevel - 1 ) ];
+
+        if ( tPeak > tParentPeak )
+        {
+            tParentPeak = tPeak;
+        }
+    }
+
+    //------------------------------------------------------------------
+
+    std::size_t
+    Memory_Tracker::live_bytes()
+    {
+        return sLiveBytes.load();
+    }
+
+    //------------------------------------------------------------------
+
+    std::size_t
+    Memory_Tracker::scope_peak_bytes()
+    {
+        return sScopePeak[ scope_index( sScopeLevel ) ];
+    }
+
+    //------------------------------------------------------------------
+
+    std::size_t
+    Memory_Tracker::scope_start_bytes()
+    {
+        return sScopeStart[ scope_index( sScopeLevel ) ];
+    }
+
+    //------------------------------------------------------------------
+
+    void*
+    Memory_Tracker::allocate( std::size_t aSize )
+    {
+        void* tPointer = std::malloc( aSize + sHeaderSize );
+
+        if ( tPointer == nullptr )
+        {
+            throw std::bad_alloc();
+        }
+
+        // store size in front of user memory
+        *static_cast< std::size_t* >( tPointer ) = aSize;
+
+        record_allocation( aSize );
+
+        return static_cast< char* >( tPointer ) + sHeaderSize;
+    }
+
+    //------------------------------------------------------------------
+
+    void
+    Memory_Tracker::deallocate( void* aPointer )
+    {
+        if ( aPointer == nullptr )
+        {
+            return;
+        }
+
+        void* tPointer = static_cast< char* >( aPointer ) - sHeaderSize;
+
+        record_deallocation( *static_cast< std::size_t* >( tPointer ) );
+
+        std::free( tPointer );
+    }
+
+    //------------------------------------------------------------------
+}    // namespace moris
+
+#ifdef MORIS_MEMORY_TRACKING
+
+//------------------------------------------------------------------
+// replacements of the global allocation functions; the remaining variants
+// (nothrow, sized delete) forward to these by default
+
+void*
+operator new( std::size_t aSize )
+{
+    return moris::Memory_Tracker::allocate( aSize );
+}
+
+void*
+operator new[]( std::size_t aSize )
+{
+    return moris::Memory_Tracker::allocate( aSize );
+}
+
+void
+operator delete( void* aPointer ) noexcept
+{
+    moris::Memory_Tracker::deallocate( aPointer );
+}
+
+void
+operator delete[]( void* aPointer ) noexcept
+{
+    moris::Memory_Tracker::deallocate( aPointer );
+}
+
+void
+operator delete( void* aPointer, std::size_t ) noexcept
+{
+    moris::Memory_Tracker::deallocate( aPointer );
+}
+
+void
+operator delete[]( void* aPointer, std::size_t ) noexcept
+{
+    moris::Memory_Tracker::deallocate( aPointer );
+}
+
+#endif
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Memory_Tracker.hpp
+ *
+ */
+
+#ifndef PROJECTS_MRS_CNT_SRC_CL_MEMORY_TRACKER_HPP_
+#define PROJECTS_MRS_CNT_SRC_CL_MEMORY_TRACKER_HPP_
+
+#include <cstddef>
+
+namespace moris
+{
+    //------------------------------------------------------------------
+    /**
+     * Tracks live and peak heap memory attributed to nested scopes.
+     *
+     * If MORIS_MEMORY_TRACKING is defined, the global operators new and delete
+     * as well as the storage of armadillo matrices are routed through this class.
+     * Scopes are opened and closed by the global clock, i.e. by each Tracer, such
+     * that the peak memory of every traced stage can be reported by the logger.
+     * The number of live bytes is shared by all threads, while the scope stack is
+     * kept per thread: an allocation raises the peak of the innermost scope of the
+     * allocating thread only.
+     * Without MORIS_MEMORY_TRACKING the counters are never updated and
+     * is_active() returns false.
+     */
+    class Memory_Tracker
+    {
+      public:
+        //------------------------------------------------------------------
+        /**
+         * returns true if allocation tracking is compiled in
+         */
+        static constexpr bool
+        is_active()
+        {
+#ifdef MORIS_MEMORY_TRACKING
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        //------------------------------------------------------------------
+        /**
+         * opens a new scope; its peak is initialized with the current live bytes
+         */
+        static void sign_in();
+
+        //------------------------------------------------------------------
+        /**
+         * closes the innermost scope and passes its peak on to the parent scope
+         */
+        static void sign_out();
+
+        //------------------------------------------------------------------
+        /**
+         * returns the number of bytes currently allocated through the tracker
+         */
+        static std::size_t live_bytes();
+
+        //------------------------------------------------------------------
+        /**
+         * returns the peak number of live bytes since the innermost scope was opened
+         */
+        static std::size_t scope_peak_bytes();
+
+        //------------------------------------------------------------------
+        /**
+         * returns the number of live bytes when the innermost scope was opened
+         */
+        static std::size_t scope_start_bytes();
+
+        //------------------------------------------------------------------
+        /**
+         * allocates memory and records its size, throws std::bad_alloc on failure
+         * @param[ in ] aSize number of bytes
+         */
+        static void* allocate( std::size_t aSize );
+
+        //------------------------------------------------------------------
+        /**
+         * frees memory allocated by allocate()
+         * @param[ in ] aPointer pointer returned by allocate(), may be null
+         */
+        static void deallocate( void* aPointer );
+
+        //------------------------------------------------------------------
+    };
+}    // namespace moris
+
+#endif /* PROJECTS_MRS_CNT_SRC_CL_MEMORY_TRACKER_HPP_ */
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Sorted_Map.hpp
+ *
+ */
+
+#ifndef MORIS_CONTAINERS_CL_SORTED_MAP_HPP_
+#define MORIS_CONTAINERS_CL_SORTED_MAP_HPP_
+
+// C++ header files.
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <iostream>
+
+// MORIS library header files.
+#include "typedefs.hpp"    // COR/src
+#include "assert.hpp"
+
+namespace moris
+{
+    /**
+     * @brief Map stored as sorted arrays of keys and values for maps which are built once and read often.
+     * Lookups are binary searches over the contiguous key array and no memory is needed besides the keys and values.
+     * Inserting keys in ascending order is of constant cost, any other insertion moves all following entries.
+     * Provides the interface subset of moris::map used for id to index maps.
+     */
+    template< typename T1, typename T2 >
+    class Sorted_Map
+    {
+      private:
+        // sorted keys
+        std::vector< T1 > mKeys;
+
+        // values of the keys
+        std::vector< T2 > mValues;
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief returns the position of the first key not less than a given key
+         */
+        std::size_t
+        lower_bound( const T1& aK ) const
+        {
+            return std::lower_bound( mKeys.begin(), mKeys.end(), aK ) - mKeys.begin();
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief returns the position of a key or the number of entries if the key does not exist
+         */
+        std::size_t
+        find_position( const T1& aK ) const
+        {
+            std::size_t tPos = this->lower_bound( aK );
+
+            if ( tPos < mKeys.size() and !( aK < mKeys[ tPos ] ) )
+            {
+                return tPos;
+            }
+
+            return mKeys.size();
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief returns the position of a key, a new entry with a default value is created if the key does not exist
+         */
+        std::size_t
+        find_or_insert_position( const T1& aK )
+        {
+            // keys inserted in ascending order are appended
+            if ( mKeys.empty() or mKeys.back() < aK )
+            {
+                mKeys.push_back( aK );
+                mValues.push_back( T2() );
+
+                return mKeys.size() - 1;
+            }
+
+            std::size_t tPos = this->lower_bound( aK );
+
+            if ( aK < mKeys[ tPos ] )
+            {
+                mKeys.insert( mKeys.begin() + tPos, aK );
+                mValues.insert( mValues.begin() + tPos, T2() );
+            }
+
+            return tPos;
+        }
+
+        //--------------------------------------------------------------------------------
+
+      public:
+        Sorted_Map() = default;
+
+        Sorted_Map( Sorted_Map< T1, T2 > const & aMap ) = default;
+
+        ~Sorted_Map() = default;
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief allocates memory for a given number of entries
+         *
+         * @param[in] aNumEntries Expected number of entries
+         */
+        void
+        reserve( const moris::uint aNumEntries )
+        {
+            mKeys.reserve( aNumEntries );
+            mValues.reserve( aNumEntries );
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief releases memory which is not needed for the current entries
+         */
+        void
+        shrink_to_fit()
+        {
+            mKeys.shrink_to_fit();
+            mValues.shrink_to_fit();
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * Inserts a key value pair if the key does not exist yet. An existing value is not changed.
+         *
+         * @return true if the pair was inserted
+         */
+        template< class pair >
+        bool
+        insert( const pair& apair )
+        {
+            std::size_t tSize = mKeys.size();
+
+            std::size_t tPos = this->find_or_insert_position( apair.first );
+
+            if ( mKeys.size() == tSize )
+            {
+                return false;
+            }
+
+            mValues[ tPos ] = apair.second;
+
+            return true;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * Access operator. Returns a reference to the mapped value of a key, an element is
+         * inserted if the key does not exist.
+         *
+         * @param[in] aK Key value of the element whose mapped value is accessed
+         */
+        T2&
+        operator[]( const T1& aK )
+        {
+            return mValues[ this->find_or_insert_position( aK ) ];
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * Checks if key exists in map
+         *
+         * @param[in] aK Key to be searched for
+         */
+        bool
+        key_exists( const T1& aK ) const
+        {
+            return this->find_position( aK ) < mKeys.size();
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * Returns the value of a key, throws an error if the key is not found
+         *
+         * @param[in] aK Key to be searched for
+         */
+        const T2&
+        find( const T1& aK ) const
+        {
+            std::size_t tPos = this->find_position( aK );
+
+            MORIS_ERROR( tPos < mKeys.size(), "moris::Sorted_Map.find - Key not found" );
+
+            return mValues[ tPos ];
+        }
+
+        //--------------------------------------------------------------------------------
+
+        T2&
+        find( const T1& aK )
+        {
+            return const_cast< T2& >( static_cast< const moris::Sorted_Map< T1, T2 >* >( this )->find( aK ) );
+        }
+
+        //--------------------------------------------------------------------------------
+
+        bool
+        empty() const
+        {
+            return mKeys.empty();
+        }
+
+        //--------------------------------------------------------------------------------
+
+        void
+        clear()
+        {
+            mKeys.clear();
+            mValues.clear();
+        }
+
+        //--------------------------------------------------------------------------------
+
+        moris::uint
+        size() const
+        {
+            return mKeys.size();
+        }
+
+        //--------------------------------------------------------------------------------
+
+        moris::uint
+        count( const T1& aK ) const
+        {
+            return this->key_exists( aK ) ? 1 : 0;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief Removes an element from the map
+         */
+        void
+        erase( const T1& aK )
+        {
+            std::size_t tPos = this->find_position( aK );
+
+            if ( tPos < mKeys.size() )
+            {
+                mKeys.erase( mKeys.begin() + tPos );
+                mValues.erase( mValues.begin() + tPos );
+            }
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief returns the sorted keys
+         */
+        const std::vector< T1 >&
+        get_keys() const
+        {
+            return mKeys;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief returns the values in the order of the sorted keys
+         */
+        const std::vector< T2 >&
+        get_values() const
+        {
+            return mValues;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief returns the number of bytes allocated by this map
+         */
+        std::size_t
+        get_memory_usage() const
+        {
+            return mKeys.capacity() * sizeof( T1 ) + mValues.capacity() * sizeof( T2 );
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * @brief Print map on screen
+         */
+        void
+        print( const std::string& aVarName = "morisSortedMap" ) const
+        {
+            std::cout << "\n-------------------------------------------------\n\n";
+
+            for ( std::size_t iEntry = 0; iEntry < mKeys.size(); iEntry++ )
+            {
+                std::cout << aVarName << "[" << mKeys[ iEntry ] << "] = " << mValues[ iEntry ] << '\n';
+            }
+        }
+    };
+}    // namespace moris
+
+#endif /* MORIS_CONTAINERS_CL_SORTED_MAP_HPP_ */
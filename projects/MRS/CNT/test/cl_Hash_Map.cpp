@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Hash_Map.cpp
+ *
+ */
+
+#include <catch.hpp>
+
+// MORIS project header files.
+#include "cl_Hash_Map.hpp"    // CNT/src
+#include "cl_Map.hpp"         // CNT/src
+
+// ----------------------------------------------------------------------------
+
+TEST_CASE( "moris::Hash_Map" )
+{
+    moris::Hash_Map< moris::moris_id, moris::moris_index > tMap;
+
+    SECTION( "moris::Hash_Map insert and find" )
+    {
+        tMap[ 5 ]  = 0;
+        tMap[ 17 ] = 1;
+
+        REQUIRE( tMap.insert( std::make_pair( 3, 2 ) ) );
+        REQUIRE( !tMap.insert( std::make_pair( 3, 7 ) ) );
+
+        REQUIRE( tMap.size() == 3 );
+        REQUIRE( tMap.find( 5 ) == 0 );
+        REQUIRE( tMap.find( 17 ) == 1 );
+        REQUIRE( tMap.find( 3 ) == 2 );
+        REQUIRE( tMap.key_exists( 17 ) );
+        REQUIRE( !tMap.key_exists( 4 ) );
+        REQUIRE( tMap.count( 4 ) == 0 );
+    }
+
+    SECTION( "moris::Hash_Map growth and erase" )
+    {
+        // compare against moris::map with keys that collide in a small table
+        moris::map< moris::moris_id, moris::moris_index > tReference;
+
+        tMap.reserve( 10 );
+
+        for ( moris::moris_index iKey = 0; iKey < 1000; iKey++ )
+        {
+            tMap[ 64 * iKey ]       = iKey;
+            tReference[ 64 * iKey ] = iKey;
+        }
+
+        for ( moris::moris_index iKey = 0; iKey < 1000; iKey += 3 )
+        {
+            tMap.erase( 64 * iKey );
+            tReference.erase( 64 * iKey );
+        }
+
+        REQUIRE( tMap.size() == tReference.size() );
+
+        for ( moris::moris_index iKey = 0; iKey < 1000; iKey++ )
+        {
+            REQUIRE( tMap.key_exists( 64 * iKey ) == tReference.key_exists( 64 * iKey ) );
+        }
+
+        moris::uint tNumIterated = 0;
+
+        for ( auto& tPair : tMap )
+        {
+            REQUIRE( tReference.find( tPair.first ) == tPair.second );
+            tNumIterated++;
+        }
+
+        REQUIRE( tNumIterated == tMap.size() );
+    }
+
+    SECTION( "moris::Hash_Map clear" )
+    {
+        tMap[ 1 ] = 1;
+        tMap.clear();
+
+        REQUIRE( tMap.empty() );
+        REQUIRE( !tMap.key_exists( 1 ) );
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Sorted_Map.cpp
+ *
+ */
+
+#include <catch.hpp>
+
+// MORIS project header files.
+#include "cl_Sorted_Map.hpp"    // CNT/src
+
+// ----------------------------------------------------------------------------
+
+TEST_CASE( "moris::Sorted_Map" )
+{
+    moris::Sorted_Map< moris::moris_id, moris::moris_index > tMap;
+
+    SECTION( "moris::Sorted_Map insert and find" )
+    {
+        tMap[ 17 ] = 1;
+        tMap[ 5 ]  = 0;
+        tMap[ 30 ] = 3;
+
+        REQUIRE( tMap.insert( std::make_pair( 9, 2 ) ) );
+        REQUIRE( !tMap.insert( std::make_pair( 9, 7 ) ) );
+
+        REQUIRE( tMap.size() == 4 );
+        REQUIRE( tMap.find( 5 ) == 0 );
+        REQUIRE( tMap.find( 9 ) == 2 );
+        REQUIRE( tMap.find( 17 ) == 1 );
+        REQUIRE( tMap.find( 30 ) == 3 );
+        REQUIRE( !tMap.key_exists( 10 ) );
+
+        // keys are sorted
+        REQUIRE( tMap.get_keys() == std::vector< moris::moris_id >( { 5, 9, 17, 30 } ) );
+        REQUIRE( tMap.get_values() == std::vector< moris::moris_index >( { 0, 2, 1, 3 } ) );
+    }
+
+    SECTION( "moris::Sorted_Map erase and clear" )
+    {
+        tMap[ 1 ] = 1;
+        tMap[ 2 ] = 2;
+        tMap.erase( 1 );
+
+        REQUIRE( tMap.size() == 1 );
+        REQUIRE( !tMap.key_exists( 1 ) );
+        REQUIRE( tMap.find( 2 ) == 2 );
+
+        tMap.clear();
+
+        REQUIRE( tMap.empty() );
+    }
+}
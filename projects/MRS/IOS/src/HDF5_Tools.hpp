@@ -137,6 +137,85 @@ namespace moris
 
     //------------------------------------------------------------------------------
 
+    /**
+     * create a new HDF5 file that is shared by all procs.
+     * The file is opened through the MPI-IO driver, all procs must call this function.
+     */
+    inline hid_t
+    create_parallel_hdf5_file( const std::string& aPath )
+    {
+        MORIS_ERROR( aPath.size() > 0, "No file path given." );
+
+#ifdef H5_HAVE_PARALLEL
+        // create file access property list using the MPI-IO driver
+        hid_t tAccessList = H5Pcreate( H5P_FILE_ACCESS );
+        H5Pset_fapl_mpio( tAccessList, get_comm(), MPI_INFO_NULL );
+
+        // create file collectively
+        hid_t tFileID = H5Fcreate(
+                aPath.c_str(),
+                H5F_ACC_TRUNC,
+                H5P_DEFAULT,
+                tAccessList );
+
+        H5Pclose( tAccessList );
+
+        return tFileID;
+#else
+        MORIS_ERROR( par_size() == 1,
+                "create_parallel_hdf5_file: HDF5 was built without parallel support, shared files can only be written in serial." );
+
+        return create_hdf5_file( aPath, false );
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+
+    /**
+     * open an existing HDF5 file that is shared by all procs.
+     * all procs must call this function. The file is opened read only
+     * unless write access is requested.
+     */
+    inline hid_t
+    open_parallel_hdf5_file(
+            const std::string& aPath,
+            bool               aWriteAccess = false )
+    {
+        MORIS_ERROR( aPath.size() > 0, "No file path given." );
+
+        // test if file exists
+        std::ifstream tFile( aPath );
+
+        // throw error if file does not exist
+        MORIS_ERROR( tFile, "Could not open HDF5 file %s", aPath.c_str() );
+
+        // close file
+        tFile.close();
+
+#ifdef H5_HAVE_PARALLEL
+        // create file access property list using the MPI-IO driver
+        hid_t tAccessList = H5Pcreate( H5P_FILE_ACCESS );
+        H5Pset_fapl_mpio( tAccessList, get_comm(), MPI_INFO_NULL );
+
+        // open file collectively
+        hid_t tFileID = H5Fopen(
+                aPath.c_str(),
+                aWriteAccess ? H5F_ACC_RDWR : H5F_ACC_RDONLY,
+                tAccessList );
+
+        H5Pclose( tAccessList );
+
+        return tFileID;
+#else
+        MORIS_ERROR( par_size() == 1,
+                "open_parallel_hdf5_file: HDF5 was built without parallel support, shared files can only be read in serial." );
+
+        return open_hdf5_file( aPath, false );
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+
     /**
      * test if a data set exists
      */
@@ -617,9 +696,9 @@ namespace moris
                     H5P_DEFAULT,
                     aVector.data() );
         }
-        else if ( aStatus == 2 )
+        else if ( aStatus == 1 )
         {
-            // all good, reset status
+            // empty vector, H5Sget_simple_extent_dims() returned the rank of the data space
             aStatus = 0;
         }
         // Close/release resources
@@ -633,6 +712,265 @@ namespace moris
 
     //------------------------------------------------------------------------------
 
+    /**
+     * stores the local part of a distributed column vector into a shared file.
+     * Each proc writes its entries into a contiguous block of a 1D data set,
+     * the block offset is given by the sum of the entries on all lower ranks.
+     * All procs must call this function, also if they have no entries.
+     *
+     * @param[ inout ] aFileID       handler to hdf5 file opened with create_parallel_hdf5_file()
+     * @param[ in ]    aLabel        label of data set to save
+     * @param[ in ]    aLocalVector  entries owned by this proc
+     * @param[ in ]    aStatus       error handler
+     */
+    template< typename T >
+    inline void
+    save_distributed_vector_to_hdf5_file(
+            hid_t&             aFileID,
+            const std::string& aLabel,
+            const Matrix< T >& aLocalVector,
+            herr_t&            aStatus )
+    {
+        // check datatype
+        MORIS_ASSERT( test_size_of_datatype( (typename Matrix< T >::Data_Type)0 ),
+                "Sizes of MORIS datatype and HDF5 datatype do not match." );
+
+        MORIS_ASSERT( aLocalVector.n_cols() <= 1,
+                "save_distributed_vector_to_hdf5_file(), only column vectors can be saved." );
+
+        // number of local entries, offset of this proc and global size
+        luint tNumLocalEntries = aLocalVector.numel();
+
+        hsize_t tLocalSize  = tNumLocalEntries;
+        hsize_t tOffset     = get_processor_offset( tNumLocalEntries );
+        hsize_t tGlobalSize = sum_all( tNumLocalEntries );
+
+        // create global data space
+        hid_t tFileSpace = H5Screate_simple( 1, &tGlobalSize, NULL );
+
+        // select data type for matrix to save
+        hid_t tDataType = H5Tcopy( get_hdf5_datatype( (typename Matrix< T >::Data_Type)0 ) );
+
+        // set data type to little endian
+        aStatus = H5Tset_order( tDataType, H5T_ORDER_LE );
+
+        // create new dataset (collective)
+        hid_t tDataSet = H5Dcreate(
+                aFileID,
+                aLabel.c_str(),
+                tDataType,
+                tFileSpace,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT );
+
+        // select block of this proc in file and create matching memory space
+        hid_t tMemSpace = H5Screate_simple( 1, &tLocalSize, NULL );
+
+        if ( tLocalSize > 0 )
+        {
+            H5Sselect_hyperslab( tFileSpace, H5S_SELECT_SET, &tOffset, NULL, &tLocalSize, NULL );
+        }
+        else
+        {
+            H5Sselect_none( tFileSpace );
+            H5Sselect_none( tMemSpace );
+        }
+
+        // create transfer property list
+        hid_t tTransferList = H5Pcreate( H5P_DATASET_XFER );
+
+#ifdef H5_HAVE_PARALLEL
+        H5Pset_dxpl_mpio( tTransferList, H5FD_MPIO_COLLECTIVE );
+#endif
+
+        // write block of this proc
+        if ( tGlobalSize > 0 )
+        {
+            aStatus = H5Dwrite(
+                    tDataSet,
+                    tDataType,
+                    tMemSpace,
+                    tFileSpace,
+                    tTransferList,
+                    aLocalVector.data() );
+        }
+
+        // close open hids
+        H5Pclose( tTransferList );
+        H5Sclose( tMemSpace );
+        H5Sclose( tFileSpace );
+        H5Tclose( tDataType );
+        H5Dclose( tDataSet );
+
+        // check for error
+        MORIS_ASSERT( aStatus >= 0, "Error in HDF5 save_distributed_vector_to_hdf5_file()" );
+    }
+
+    //------------------------------------------------------------------------------
+
+    /**
+     * loads a distributed vector written by save_distributed_vector_to_hdf5_file().
+     * Every proc reads the whole vector, so that the data can be redistributed
+     * onto a number of procs that differs from the one used for writing.
+     *
+     * @param[ inout ] aFileID  handler to hdf5 file
+     * @param[ in ]    aLabel   label of data set to load
+     * @param[ out ]   aVector  global vector
+     * @param[ in ]    aStatus  error handler
+     */
+    template< typename T >
+    inline void
+    load_distributed_vector_from_hdf5_file(
+            hid_t&             aFileID,
+            const std::string& aLabel,
+            Matrix< T >&       aVector,
+            herr_t&            aStatus )
+    {
+        // check datatype
+        MORIS_ASSERT( test_size_of_datatype( (typename Matrix< T >::Data_Type)0 ),
+                "Sizes of MORIS data type and HDF5 data type do not match." );
+
+        // test if data set exists
+        MORIS_ERROR( dataset_exists( aFileID, aLabel ),
+                "The data set %s cannot be opened because it does not exist.\n",
+                aLabel.c_str() );
+
+        // open the data set
+        hid_t tDataSet = H5Dopen1( aFileID, aLabel.c_str() );
+
+        // get the data type of the set
+        hid_t tDataType = H5Dget_type( tDataSet );
+
+        // make sure that data type fits to type of matrix
+        MORIS_ERROR( H5Tget_class( tDataType ) == H5Tget_class( get_hdf5_datatype( (typename Matrix< T >::Data_Type)0 ) ),
+                "ERROR in reading from file: vector %s has the wrong data type.",
+                aLabel.c_str() );
+
+        // get handler to data space
+        hid_t tDataSpace = H5Dget_space( tDataSet );
+
+        // vector dimensions
+        hsize_t tSize = 0;
+
+        // ask hdf for dimensions
+        H5Sget_simple_extent_dims( tDataSpace, &tSize, NULL );
+
+        // allocate memory for output
+        aVector.set_size( tSize, 1 );
+
+        aStatus = 0;
+
+        // test if vector is not empty
+        if ( tSize > 0 )
+        {
+            // read data into the matrix, the native type is used for conversion
+            aStatus = H5Dread(
+                    tDataSet,
+                    get_hdf5_datatype( (typename Matrix< T >::Data_Type)0 ),
+                    H5S_ALL,
+                    H5S_ALL,
+                    H5P_DEFAULT,
+                    aVector.data() );
+        }
+
+        // Close/release resources
+        H5Tclose( tDataType );
+        H5Dclose( tDataSet );
+        H5Sclose( tDataSpace );
+
+        // check for error
+        MORIS_ASSERT( aStatus >= 0, "Error in HDF5 load_distributed_vector_from_hdf5_file()" );
+    }
+
+    //------------------------------------------------------------------------------
+
+    /**
+     * loads a contiguous block of a distributed vector written by save_distributed_vector_to_hdf5_file()
+     * through a hyperslab selection, such that a proc only reads the part it needs.
+     * The read is independent, i.e. procs may call this function a different number of times.
+     *
+     * @param[ inout ] aFileID      handler to hdf5 file
+     * @param[ in ]    aLabel       label of data set to load
+     * @param[ in ]    aOffset      position of first entry in data set
+     * @param[ in ]    aNumEntries  number of entries to read
+     * @param[ out ]   aVector      block of the vector
+     * @param[ in ]    aStatus      error handler
+     */
+    template< typename T >
+    inline void
+    load_distributed_vector_block_from_hdf5_file(
+            hid_t&             aFileID,
+            const std::string& aLabel,
+            const luint        aOffset,
+            const luint        aNumEntries,
+            Matrix< T >&       aVector,
+            herr_t&            aStatus )
+    {
+        // check datatype
+        MORIS_ASSERT( test_size_of_datatype( (typename Matrix< T >::Data_Type)0 ),
+                "Sizes of MORIS data type and HDF5 data type do not match." );
+
+        // test if data set exists
+        MORIS_ERROR( dataset_exists( aFileID, aLabel ),
+                "The data set %s cannot be opened because it does not exist.\n",
+                aLabel.c_str() );
+
+        // open the data set
+        hid_t tDataSet = H5Dopen1( aFileID, aLabel.c_str() );
+
+        // get handler to data space
+        hid_t tFileSpace = H5Dget_space( tDataSet );
+
+        // vector dimensions
+        hsize_t tSize = 0;
+
+        H5Sget_simple_extent_dims( tFileSpace, &tSize, NULL );
+
+        MORIS_ERROR( aOffset + aNumEntries <= tSize,
+                "load_distributed_vector_block_from_hdf5_file(), block %lu to %lu exceeds size %lu of data set %s.",
+                aOffset,
+                aOffset + aNumEntries,
+                (luint)tSize,
+                aLabel.c_str() );
+
+        // allocate memory for output
+        aVector.set_size( aNumEntries, 1 );
+
+        aStatus = 0;
+
+        if ( aNumEntries > 0 )
+        {
+            hsize_t tOffset     = aOffset;
+            hsize_t tNumEntries = aNumEntries;
+
+            // select block in file and create matching memory space
+            H5Sselect_hyperslab( tFileSpace, H5S_SELECT_SET, &tOffset, NULL, &tNumEntries, NULL );
+
+            hid_t tMemSpace = H5Screate_simple( 1, &tNumEntries, NULL );
+
+            // read data into the matrix, the native type is used for conversion
+            aStatus = H5Dread(
+                    tDataSet,
+                    get_hdf5_datatype( (typename Matrix< T >::Data_Type)0 ),
+                    tMemSpace,
+                    tFileSpace,
+                    H5P_DEFAULT,
+                    aVector.data() );
+
+            H5Sclose( tMemSpace );
+        }
+
+        // Close/release resources
+        H5Sclose( tFileSpace );
+        H5Dclose( tDataSet );
+
+        // check for error
+        MORIS_ASSERT( aStatus >= 0, "Error in HDF5 load_distributed_vector_block_from_hdf5_file()" );
+    }
+
+    //------------------------------------------------------------------------------
+
     /**
      * saves a scalar value to a file
      * file must be open
@@ -9,6 +9,7 @@
  */
 
 #include "cl_GlobalClock.hpp"
+#include "cl_Memory_Tracker.hpp"
 #include "Log_Constants.hpp"
 
 #include <cstdio>
@@ -100,6 +101,10 @@ namespace moris
         if ( PRINT_WALL_TIME )
             mWallTimeStamps.push_back( std::chrono::system_clock::now() );
 
+        // open memory tracking scope for new entity
+        if ( Memory_Tracker::is_active() )
+            Memory_Tracker::sign_in();
+
 #ifdef MORIS_HAVE_DEBUG
         // check that indentation level and array size match
         if ( mIndentationLevel != mCurrentFunctionID.size() - 1 )
@@ -146,6 +151,10 @@ namespace moris
         if ( PRINT_WALL_TIME )
             mWallTimeStamps.pop_back();
 
+        // close memory tracking scope of entity
+        if ( Memory_Tracker::is_active() )
+            Memory_Tracker::sign_out();
+
 #ifdef MORIS_HAVE_DEBUG
         // check that indentation level and array size match
         if ( mIndentationLevel != mCurrentFunctionID.size() - 1 )
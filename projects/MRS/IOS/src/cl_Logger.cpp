@@ -20,6 +20,8 @@
 #include <sstream>
 #include <iomanip>
 #include <limits>
+#include <algorithm>
+#include <chrono>
 
 #include "typedefs.hpp"
 #include "IO_Tools.hpp"
@@ -27,6 +29,7 @@
 
 // for the global clock
 #include "cl_GlobalClock.hpp"    // MRS/IOS/src
+#include "cl_Memory_Tracker.hpp"    // MRS/CNT/src
 #include "cl_Tracer_Enums.hpp"
 
 #include "fn_stringify.hpp"
@@ -124,6 +127,12 @@ namespace moris
                     std::cout << "\n <MRS::IOS::cl_Logger::initialize()>: Unknown direct output format, using standard mode. \n";
             }
 
+            // user requests benchmark output
+            if ( std::string( argv[ k ] ) == "--benchmark" || std::string( argv[ k ] ) == "-bm" )
+            {
+                this->initialize_benchmark( std::string( argv[ k + 1 ] ) );
+            }
+
         }    // end for each input argument
 
         // print header
@@ -267,6 +276,9 @@ namespace moris
         // add memory consumption information to log output
         std::string tMemoryUsage = this->memory_usage();
 
+        // add peak memory of traced scope to log output
+        std::string tScopeMemoryUsage = this->scope_memory_usage();
+
         // log to console - only processor mOutputRank prints message
         if ( logger_par_rank() == mOutputRank )
         {
@@ -310,6 +322,13 @@ namespace moris
                                   << std::flush;
                     }
 
+                    if ( !tScopeMemoryUsage.empty() )
+                    {
+                        std::cout << print_empty_line( mGlobalClock.mIndentationLevel ) << "_"
+                                  << tScopeMemoryUsage << std::endl
+                                  << std::flush;
+                    }
+
                     std::cout << print_empty_line( mGlobalClock.mIndentationLevel - 1 ) << " \n";
                 }
                 else
@@ -322,14 +341,174 @@ namespace moris
                         std::cout << tMemoryUsage << std::endl
                                   << std::flush;
                     }
+
+                    if ( !tScopeMemoryUsage.empty() )
+                    {
+                        std::cout << tScopeMemoryUsage << std::endl
+                                  << std::flush;
+                    }
                 }
             }
         }
 
+        // record phase for benchmark output
+        if ( mWriteBenchmark )
+        {
+            std::chrono::duration< double > tChronoElapsedWallTime =
+                    ( std::chrono::system_clock::now() - mGlobalClock.mWallTimeStamps[ mGlobalClock.mIndentationLevel ] );
+
+            this->record_benchmark_phase( tElapsedTime, tChronoElapsedWallTime.count() );
+        }
+
         // decrement clock
         mGlobalClock.sign_out();
     }
 
+    // -----------------------------------------------------------------------------
+
+    void
+    Logger::initialize_benchmark( const std::string& aFileName )
+    {
+        mWriteBenchmark        = true;
+        mBenchmarkFileName     = aFileName;
+        mIsBenchmarkOutputRank = logger_par_rank() == 0;
+
+        mBenchmarkRecords.clear();
+        mBenchmarkPhaseIndices.clear();
+    }
+
+    // -----------------------------------------------------------------------------
+
+    std::map< std::string, real >&
+    Logger::get_benchmark_record()
+    {
+        // phase name is the path of the current entity in the tracing tree
+        std::string tPhase;
+
+        for ( uint iLevel = 1; iLevel <= mGlobalClock.mIndentationLevel; iLevel++ )
+        {
+            if ( iLevel > 1 )
+            {
+                tPhase += " / ";
+            }
+
+            tPhase += mGlobalClock.mCurrentEntity[ iLevel ] + " - "
+                    + mGlobalClock.mCurrentType[ iLevel ] + " - "
+                    + mGlobalClock.mCurrentAction[ iLevel ];
+        }
+
+        auto tIter = mBenchmarkPhaseIndices.find( tPhase );
+
+        if ( tIter == mBenchmarkPhaseIndices.end() )
+        {
+            mBenchmarkPhaseIndices[ tPhase ] = mBenchmarkRecords.size();
+            mBenchmarkRecords.push_back( { tPhase, std::map< std::string, real >() } );
+
+            return mBenchmarkRecords.back().second;
+        }
+
+        return mBenchmarkRecords[ tIter->second ].second;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    void
+    Logger::add_benchmark_value(
+            const std::string& aQuantity,
+            real               aValue )
+    {
+        if ( !mWriteBenchmark )
+        {
+            return;
+        }
+
+        // the slowest processor determines the benchmark
+        real tMaxValue = logger_max_all( aValue );
+
+        this->get_benchmark_record()[ aQuantity ] = tMaxValue;
+    }
+
+    // -----------------------------------------------------------------------------
+
+    void
+    Logger::record_benchmark_phase(
+            real aCpuTime,
+            real aWallTime )
+    {
+        // times of the slowest processor
+        real tCpuTime  = logger_max_all( aCpuTime );
+        real tWallTime = logger_max_all( aWallTime );
+
+        // high water mark of the resident memory at the end of the phase in MB
+        struct rusage tUsage;
+        getrusage( RUSAGE_SELF, &tUsage );
+
+        real tLocalPeak = tUsage.ru_maxrss / 1024.0;
+        real tPeak      = logger_max_all( tLocalPeak );
+
+        std::map< std::string, real >& tRecord = this->get_benchmark_record();
+
+        // phases traced repeatedly, e.g. within iterations, are accumulated
+        tRecord[ "calls" ] += 1.0;
+        tRecord[ "cpu_time" ] += tCpuTime;
+        tRecord[ "wall_time" ] += tWallTime;
+        tRecord[ "peak_memory" ] = std::max( tRecord[ "peak_memory" ], tPeak );
+
+        // peak of the memory tracked within the phase
+        if ( Memory_Tracker::is_active() )
+        {
+            real tLocalScopePeak = Memory_Tracker::scope_peak_bytes() / 1024.0 / 1024.0;
+            real tScopePeak      = logger_max_all( tLocalScopePeak );
+
+            tRecord[ "tracked_peak_memory" ] = std::max( tRecord[ "tracked_peak_memory" ], tScopePeak );
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    void
+    Logger::write_benchmark_file()
+    {
+        if ( !mIsBenchmarkOutputRank )
+        {
+            return;
+        }
+
+        std::ofstream tFile( mBenchmarkFileName, std::ofstream::out );
+
+        if ( !tFile.is_open() )
+        {
+            std::cout << "Logger::write_benchmark_file() - Could not open benchmark file " << mBenchmarkFileName << " \n";
+            return;
+        }
+
+        // phase names are built from entity names which do not contain characters to be escaped
+        tFile << "{\n";
+        tFile << "    \"phases\": [\n";
+
+        for ( uint iPhase = 0; iPhase < mBenchmarkRecords.size(); iPhase++ )
+        {
+            tFile << "        {\n";
+            tFile << "            \"name\": \"" << mBenchmarkRecords[ iPhase ].first << "\"";
+
+            for ( auto const & tQuantity : mBenchmarkRecords[ iPhase ].second )
+            {
+                tFile << ",\n            \"" << tQuantity.first << "\": "
+                      << std::scientific << std::setprecision( 8 ) << tQuantity.second;
+            }
+
+            tFile << "\n        }" << ( iPhase + 1 < mBenchmarkRecords.size() ? "," : "" ) << "\n";
+        }
+
+        tFile << "    ]\n";
+        tFile << "}\n";
+
+        tFile.close();
+
+        std::cout << "Benchmark results written to " << mBenchmarkFileName << " \n"
+                  << std::flush;
+    }
+
     //------------------------------------------------------------------------------
 
     void
@@ -839,4 +1018,41 @@ namespace moris
 
         return tMemUsage;
     }
+
+    // -----------------------------------------------------------------------------
+
+    // prints peak memory of current scope recorded by memory tracker
+    std::string
+    Logger::scope_memory_usage()
+    {
+        // return empty string if memory tracking is not compiled in
+        if ( !Memory_Tracker::is_active() )
+        {
+            return "";
+        }
+
+        // peak and growth of live memory within current scope, and live memory at sign out
+        real tLocalPeak   = Memory_Tracker::scope_peak_bytes() / 1024.0 / 1024.0;
+        real tLocalGrowth = tLocalPeak - Memory_Tracker::scope_start_bytes() / 1024.0 / 1024.0;
+        real tLocalLive   = Memory_Tracker::live_bytes() / 1024.0 / 1024.0;
+
+        // log individual values of this processor to file
+        if ( mWriteToAscii )
+        {
+            this->log_to_file( "PeakMemory", tLocalPeak );
+            this->log_to_file( "PeakMemoryGrowth", tLocalGrowth );
+        }
+
+        // get statistics on memory usage across all processors
+        uint tMaxPeak   = std::round( this->logger_max_all( tLocalPeak ) );
+        uint tMinPeak   = std::round( this->logger_min_all( tLocalPeak ) );
+        uint tMaxGrowth = std::round( this->logger_max_all( tLocalGrowth ) );
+        uint tMinGrowth = std::round( this->logger_min_all( tLocalGrowth ) );
+        uint tMaxLive   = std::round( this->logger_max_all( tLocalLive ) );
+        uint tMinLive   = std::round( this->logger_min_all( tLocalLive ) );
+
+        return "Tracked memory in MB: peak (max/min) = " + std::to_string( tMaxPeak ) + " / " + std::to_string( tMinPeak ) +    //
+               " | peak growth (max/min) = " + std::to_string( tMaxGrowth ) + " / " + std::to_string( tMinGrowth ) +          //
+               " | live at sign out (max/min) = " + std::to_string( tMaxLive ) + " / " + std::to_string( tMinLive );
+    }
 }    // end namespace moris
@@ -15,6 +15,9 @@
 #include <cstdio>
 #include <string>
 #include <cstring>
+#include <vector>
+#include <map>
+#include <unordered_map>
 
 #include "typedefs.hpp"
 #include "IO_Tools.hpp"
@@ -72,6 +75,21 @@ namespace moris
 
         uint mIteration = 0;    // FIXME this is absolutely a hack, it doesn't even store the iteration correctly :)
 
+        /**
+         * @brief Flag to control recording of per phase timing and memory for the benchmark suite
+         */
+        bool mWriteBenchmark = false;
+
+        // file the benchmark results are written to by processor 0
+        std::string mBenchmarkFileName;
+
+        // rank is stored as the benchmark file is written after MPI has been finalized
+        bool mIsBenchmarkOutputRank = false;
+
+        // traced phases in order of their first sign out and their accumulated quantities
+        std::vector< std::pair< std::string, std::map< std::string, real > > > mBenchmarkRecords;
+        std::unordered_map< std::string, uint >                                 mBenchmarkPhaseIndices;
+
         inline int
         logger_par_rank()
         {
@@ -139,6 +157,12 @@ namespace moris
                 mStream.close();
             }
 
+            // write recorded benchmark phases
+            if ( mWriteBenchmark )
+            {
+                this->write_benchmark_file();
+            }
+
             // log end of Global Clock to console - only processor mOutputRank prints message
             std::cout << "Global Clock Stopped. ElapsedTime = " << tElapsedTime << " \n"
                       << std::flush;
@@ -527,6 +551,46 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        /**
+         * Enables recording of wall time, cpu time and memory of every traced phase.
+         * The results are written in JSON format when the logger is destroyed.
+         *
+         * @param aFileName name of the JSON file written by processor 0
+         */
+        void initialize_benchmark( const std::string& aFileName );
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * Adds a quantity to the benchmark record of the currently traced phase,
+         * e.g. the memory used by a data structure. Does nothing if benchmarking is not enabled.
+         *
+         * @param aQuantity name of the quantity, quantities ending with "_time" are treated as times
+         * @param aValue value of the quantity, lower values are better
+         */
+        void add_benchmark_value(
+                const std::string& aQuantity,
+                real               aValue );
+
+        //------------------------------------------------------------------------------
+
+        // accumulates timing and memory of the phase being signed out
+        void record_benchmark_phase(
+                real aCpuTime,
+                real aWallTime );
+
+        //------------------------------------------------------------------------------
+
+        // returns the record of the currently traced phase, the phase name is the path in the tracing tree
+        std::map< std::string, real >& get_benchmark_record();
+
+        //------------------------------------------------------------------------------
+
+        // writes the recorded benchmark phases to file
+        void write_benchmark_file();
+
+        //------------------------------------------------------------------------------
+
         // checks whether an instance exits
         bool exists(
                 const std::string& aEntityBase,
@@ -602,6 +666,12 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        // for logging peak memory of the current scope recorded by the memory tracker,
+        // returns empty string if memory tracking is not compiled in
+        std::string scope_memory_usage();
+
+        //------------------------------------------------------------------------------
+
         // write logged info to formatted file
         template< class T >
         void
@@ -412,6 +412,15 @@ namespace moris
 
         void
         Space_Interpolator::eval_space_jacobian()
+        {
+            // call function pointer
+            ( this->*mSpaceJacFunc )();
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Space_Interpolator::eval_space_jacobian_general()
         {
             // check that mXHat is set
             MORIS_ASSERT( mXHat.numel() > 0,
@@ -2958,6 +2967,84 @@ namespace moris
                             " Space_Interpolator::set_function_pointers - invalid cellshape used." );
                 }
             }
+
+            // replace generic space Jacobian evaluations by fixed-size kernels if available
+            this->set_fixed_size_function_pointers();
+        }
+
+        //------------------------------------------------------------------------------
+
+        void
+        Space_Interpolator::set_fixed_size_function_pointers()
+        {
+            // reset to generic space Jacobian
+            mSpaceJacFunc = &Space_Interpolator::eval_space_jacobian_general;
+
+            // fixed-size kernels only apply to bulk cells with square Jacobian;
+            // rectangular cells keep their diagonal inverse
+            if ( mSpaceSideset or mNumSpaceParamDim != mNumSpaceDim or mInterpolationShape == CellShape::RECTANGULAR )
+            {
+                return;
+            }
+
+            switch ( mNumSpaceDim )
+            {
+                case 2:
+                {
+                    switch ( mNumSpaceBases )
+                    {
+                        // TRI3
+                        case 3:
+                        {
+                            mSpaceJacFunc    = &Space_Interpolator::eval_space_jacobian_fixed< 2, 3 >;
+                            mInvSpaceJacFunc = &Space_Interpolator::eval_inverse_space_jacobian_fixed< 2, 3 >;
+                            break;
+                        }
+                        // QUAD4
+                        case 4:
+                        {
+                            mSpaceJacFunc    = &Space_Interpolator::eval_space_jacobian_fixed< 2, 4 >;
+                            mInvSpaceJacFunc = &Space_Interpolator::eval_inverse_space_jacobian_fixed< 2, 4 >;
+                            break;
+                        }
+                        default:
+                            break;
+                    }
+                    break;
+                }
+                case 3:
+                {
+                    switch ( mNumSpaceBases )
+                    {
+                        // TET4
+                        case 4:
+                        {
+                            mSpaceJacFunc    = &Space_Interpolator::eval_space_jacobian_fixed< 3, 4 >;
+                            mInvSpaceJacFunc = &Space_Interpolator::eval_inverse_space_jacobian_fixed< 3, 4 >;
+                            break;
+                        }
+                        // HEX8
+                        case 8:
+                        {
+                            mSpaceJacFunc    = &Space_Interpolator::eval_space_jacobian_fixed< 3, 8 >;
+                            mInvSpaceJacFunc = &Space_Interpolator::eval_inverse_space_jacobian_fixed< 3, 8 >;
+                            break;
+                        }
+                        // HEX27
+                        case 27:
+                        {
+                            mSpaceJacFunc    = &Space_Interpolator::eval_space_jacobian_fixed< 3, 27 >;
+                            mInvSpaceJacFunc = &Space_Interpolator::eval_inverse_space_jacobian_fixed< 3, 27 >;
+                            break;
+                        }
+                        default:
+                            break;
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
         }
 
         //------------------------------------------------------------------------------
@@ -27,6 +27,8 @@
 #include "fn_det.hpp"
 #include "fn_inv.hpp"
 
+#include "cl_MTK_Space_Interpolator_Kernel.hpp"
+
 namespace moris
 {
     namespace mtk
@@ -115,6 +117,9 @@ namespace moris
             real ( Space_Interpolator::*mSpaceDetJDerivFunc )(
                     const Matrix< DDRMat >& aSpaceJt ) = nullptr;
 
+            // pointer to function for space Jacobian
+            void ( Space_Interpolator::*mSpaceJacFunc )() = &Space_Interpolator::eval_space_jacobian_general;
+
             // point to function for inverse of space Jacobian
             void ( Space_Interpolator::*mInvSpaceJacFunc )() = nullptr;
 
@@ -724,6 +729,45 @@ namespace moris
             void eval_inverse_space_jacobian_2d_tri();
             void eval_inverse_space_jacobian_3d_tri();
 
+            //------------------------------------------------------------------------------
+            /**
+             * evaluate space Jacobian with generic matrix operations
+             */
+            void eval_space_jacobian_general();
+
+            //------------------------------------------------------------------------------
+            /**
+             * evaluate space Jacobian and its inverse with fixed-size kernels
+             * for bulk cells with D spatial dimensions and B bases
+             */
+            template< uint D, uint B >
+            void
+            eval_space_jacobian_fixed()
+            {
+                // check that mXHat is set
+                MORIS_ASSERT( mXHat.numel() > 0,
+                        "Space_Interpolator::eval_space_jacobian_fixed - mXHat is not set." );
+
+                Space_Interpolator_Kernel< D, B >::eval_space_jacobian( this->dNdXi(), mXHat, mSpaceJac );
+            }
+
+            template< uint D, uint B >
+            void
+            eval_inverse_space_jacobian_fixed()
+            {
+                MORIS_ASSERT( this->space_det_J() > sDetJInvJacLowerLimit,
+                        "Space determinate close to zero or negative: %e\n",
+                        this->space_det_J() );
+
+                Space_Interpolator_Kernel< D, B >::eval_inverse_space_jacobian( this->space_jacobian(), mInvSpaceJac );
+            }
+
+            /**
+             * select fixed-size kernels for space Jacobian and its inverse if available
+             * for the current cell, i.e. TRI3, QUAD4, TET4, HEX8 and HEX27 bulk cells
+             */
+            void set_fixed_size_function_pointers();
+
             //------------------------------------------------------------------------------
             /**
              * evaluate normal to side
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_MTK_Space_Interpolator_Kernel.hpp
+ *
+ */
+
+#ifndef SRC_MTK_CL_MTK_SPACE_INTERPOLATOR_KERNEL_HPP_
+#define SRC_MTK_CL_MTK_SPACE_INTERPOLATOR_KERNEL_HPP_
+
+#include "typedefs.hpp"
+#include "assert.hpp"
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+
+namespace moris
+{
+    namespace mtk
+    {
+        //------------------------------------------------------------------------------
+        /**
+         * Fixed-size geometry kernels for a cell with a given number of spatial
+         * dimensions and bases, e.g. < 2, 3 > TRI3, < 2, 4 > QUAD4, < 3, 4 > TET4,
+         * < 3, 8 > HEX8 and < 3, 27 > HEX27.
+         *
+         * All intermediate results are kept on the stack and loop bounds are known
+         * at compile time such that the compiler can fully unroll them. Matrices are
+         * accessed through their raw column-major storage, which is shared by the
+         * Armadillo and Eigen backends. Only bulk cells with the parametric dimension
+         * equal to the spatial dimension are supported.
+         */
+        template< uint D, uint B >
+        class Space_Interpolator_Kernel
+        {
+            static_assert( D == 2 || D == 3, "Space_Interpolator_Kernel - only 2D and 3D cells are supported." );
+
+          public:
+            //------------------------------------------------------------------------------
+            /**
+             * evaluates the transposed space Jacobian J = dNdXi * xHat
+             * @param[ in ]  adNdXi   shape function derivatives wrt xi ( D x B )
+             * @param[ in ]  aXHat    nodal coordinates ( B x D )
+             * @param[ out ] aSpaceJt transposed space Jacobian ( D x D )
+             */
+            static void
+            eval_space_jacobian(
+                    const Matrix< DDRMat >& adNdXi,
+                    const Matrix< DDRMat >& aXHat,
+                    Matrix< DDRMat >&       aSpaceJt )
+            {
+                MORIS_ASSERT( adNdXi.n_rows() == D and adNdXi.n_cols() == B,
+                        "Space_Interpolator_Kernel::eval_space_jacobian - dNdXi has wrong size." );
+                MORIS_ASSERT( aXHat.n_rows() == B and aXHat.n_cols() == D,
+                        "Space_Interpolator_Kernel::eval_space_jacobian - xHat has wrong size." );
+
+                const real* tdNdXi = adNdXi.data();
+                const real* tXHat  = aXHat.data();
+
+                real tJt[ D * D ] = {};
+
+                for ( uint iBase = 0; iBase < B; iBase++ )
+                {
+                    for ( uint iDim = 0; iDim < D; iDim++ )
+                    {
+                        const real tX = tXHat[ iBase + iDim * B ];
+
+                        for ( uint iParam = 0; iParam < D; iParam++ )
+                        {
+                            tJt[ iParam + iDim * D ] += tdNdXi[ iParam + iBase * D ] * tX;
+                        }
+                    }
+                }
+
+                aSpaceJt.set_size( D, D );
+
+                real* tOut = aSpaceJt.data();
+
+                for ( uint iEntry = 0; iEntry < D * D; iEntry++ )
+                {
+                    tOut[ iEntry ] = tJt[ iEntry ];
+                }
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * evaluates the determinant of a D x D matrix stored column-major
+             * @param[ in ] aJ pointer to matrix storage
+             */
+            static real
+            eval_determinant( const real* aJ )
+            {
+                if constexpr ( D == 2 )
+                {
+                    return aJ[ 0 ] * aJ[ 3 ] - aJ[ 2 ] * aJ[ 1 ];
+                }
+                else
+                {
+                    return aJ[ 0 ] * ( aJ[ 4 ] * aJ[ 8 ] - aJ[ 7 ] * aJ[ 5 ] )
+                         - aJ[ 3 ] * ( aJ[ 1 ] * aJ[ 8 ] - aJ[ 7 ] * aJ[ 2 ] )
+                         + aJ[ 6 ] * ( aJ[ 1 ] * aJ[ 5 ] - aJ[ 4 ] * aJ[ 2 ] );
+                }
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * evaluates the inverse of the transposed space Jacobian
+             * @param[ in ]  aSpaceJt    transposed space Jacobian ( D x D )
+             * @param[ out ] aInvSpaceJt inverse of transposed space Jacobian ( D x D )
+             */
+            static void
+            eval_inverse_space_jacobian(
+                    const Matrix< DDRMat >& aSpaceJt,
+                    Matrix< DDRMat >&       aInvSpaceJt )
+            {
+                MORIS_ASSERT( aSpaceJt.n_rows() == D and aSpaceJt.n_cols() == D,
+                        "Space_Interpolator_Kernel::eval_inverse_space_jacobian - Jacobian has wrong size." );
+
+                const real* tJ = aSpaceJt.data();
+
+                real tInvDet = 1.0 / eval_determinant( tJ );
+
+                aInvSpaceJt.set_size( D, D );
+
+                real* tInvJ = aInvSpaceJt.data();
+
+                if constexpr ( D == 2 )
+                {
+                    tInvJ[ 0 ] = tJ[ 3 ] * tInvDet;
+                    tInvJ[ 1 ] = -tJ[ 1 ] * tInvDet;
+                    tInvJ[ 2 ] = -tJ[ 2 ] * tInvDet;
+                    tInvJ[ 3 ] = tJ[ 0 ] * tInvDet;
+                }
+                else
+                {
+                    tInvJ[ 0 ] = ( tJ[ 4 ] * tJ[ 8 ] - tJ[ 7 ] * tJ[ 5 ] ) * tInvDet;
+                    tInvJ[ 1 ] = ( tJ[ 7 ] * tJ[ 2 ] - tJ[ 1 ] * tJ[ 8 ] ) * tInvDet;
+                    tInvJ[ 2 ] = ( tJ[ 1 ] * tJ[ 5 ] - tJ[ 4 ] * tJ[ 2 ] ) * tInvDet;
+                    tInvJ[ 3 ] = ( tJ[ 6 ] * tJ[ 5 ] - tJ[ 3 ] * tJ[ 8 ] ) * tInvDet;
+                    tInvJ[ 4 ] = ( tJ[ 0 ] * tJ[ 8 ] - tJ[ 6 ] * tJ[ 2 ] ) * tInvDet;
+                    tInvJ[ 5 ] = ( tJ[ 3 ] * tJ[ 2 ] - tJ[ 0 ] * tJ[ 5 ] ) * tInvDet;
+                    tInvJ[ 6 ] = ( tJ[ 3 ] * tJ[ 7 ] - tJ[ 6 ] * tJ[ 4 ] ) * tInvDet;
+                    tInvJ[ 7 ] = ( tJ[ 6 ] * tJ[ 1 ] - tJ[ 0 ] * tJ[ 7 ] ) * tInvDet;
+                    tInvJ[ 8 ] = ( tJ[ 0 ] * tJ[ 4 ] - tJ[ 3 ] * tJ[ 1 ] ) * tInvDet;
+                }
+            }
+
+            //------------------------------------------------------------------------------
+            /**
+             * evaluates the space-time shape function derivatives wrt x
+             * dNdx( :, iTime * B + iBase ) = NTime( iTime ) * invJ * dNdXi( :, iBase )
+             * @param[ in ]  aInvSpaceJt inverse of transposed space Jacobian ( D x D )
+             * @param[ in ]  adNdXi      space shape function derivatives wrt xi ( D x B )
+             * @param[ in ]  aNTime      time shape functions ( 1 x T )
+             * @param[ out ] adNdx       space-time shape function derivatives wrt x ( D x B*T )
+             */
+            static void
+            eval_space_time_dNdx(
+                    const Matrix< DDRMat >& aInvSpaceJt,
+                    const Matrix< DDRMat >& adNdXi,
+                    const Matrix< DDRMat >& aNTime,
+                    Matrix< DDRMat >&       adNdx )
+            {
+                MORIS_ASSERT( aInvSpaceJt.n_rows() == D and aInvSpaceJt.n_cols() == D,
+                        "Space_Interpolator_Kernel::eval_space_time_dNdx - inverse Jacobian has wrong size." );
+                MORIS_ASSERT( adNdXi.n_rows() == D and adNdXi.n_cols() == B,
+                        "Space_Interpolator_Kernel::eval_space_time_dNdx - dNdXi has wrong size." );
+                MORIS_ASSERT( adNdx.n_rows() == D and adNdx.n_cols() == B * aNTime.numel(),
+                        "Space_Interpolator_Kernel::eval_space_time_dNdx - dNdx has wrong size." );
+
+                const real* tInvJ  = aInvSpaceJt.data();
+                const real* tdNdXi = adNdXi.data();
+
+                // space derivatives, computed once for all time bases
+                real tdNdx[ D * B ] = {};
+
+                for ( uint iBase = 0; iBase < B; iBase++ )
+                {
+                    for ( uint iParam = 0; iParam < D; iParam++ )
+                    {
+                        const real tdN = tdNdXi[ iParam + iBase * D ];
+
+                        for ( uint iDim = 0; iDim < D; iDim++ )
+                        {
+                            tdNdx[ iDim + iBase * D ] += tInvJ[ iDim + iParam * D ] * tdN;
+                        }
+                    }
+                }
+
+                // blocks of the space-time matrix are contiguous in column-major storage
+                real* tOut = adNdx.data();
+
+                const uint tNumTimeBases = aNTime.numel();
+
+                for ( uint iTime = 0; iTime < tNumTimeBases; iTime++ )
+                {
+                    const real tNTime = aNTime( iTime );
+
+                    real* tBlock = tOut + iTime * D * B;
+
+                    for ( uint iEntry = 0; iEntry < D * B; iEntry++ )
+                    {
+                        tBlock[ iEntry ] = tNTime * tdNdx[ iEntry ];
+                    }
+                }
+            }
+
+            //------------------------------------------------------------------------------
+        };
+
+        //------------------------------------------------------------------------------
+    } /* namespace mtk */
+} /* namespace moris */
+
+#endif /* SRC_MTK_CL_MTK_SPACE_INTERPOLATOR_KERNEL_HPP_ */
@@ -50,6 +50,20 @@ namespace moris::mtk
 
     //------------------------------------------------------------------------------
 
+    Cell_DataBase::Cell_DataBase( moris_id aCellId,
+            moris_id                                 aCellOwner,
+            std::shared_ptr< moris::mtk::Cell_Info > aCellInfo,
+            moris_index                              aCellIndex2,
+            mtk::Mesh*                               aMesh )
+            : Cell( aCellId, aCellIndex2, aCellOwner, aCellInfo )
+            , mBaseCell( nullptr )
+            , mCellIndex2( aCellIndex2 )
+            , mMesh( aMesh )
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
     moris::Cell< Vertex* >
     Cell_DataBase::get_vertex_pointers() const
     {
@@ -106,6 +120,10 @@ namespace moris::mtk
     uint
     Cell_DataBase::get_level() const
     {
+        MORIS_ERROR( mBaseCell != nullptr,
+                "Cell_DataBase::get_level() - cell %i has no base cell to get the refinement level from ( e.g. cell loaded from a mesh snapshot )",
+                mCellIndex2 );
+
         return mBaseCell->get_level();
     }
 
@@ -130,6 +148,10 @@ namespace moris::mtk
     const luint*
     Cell_DataBase::get_ijk() const
     {
+        MORIS_ERROR( mBaseCell != nullptr,
+                "Cell_DataBase::get_ijk() - cell %i has no base cell to get the ijk position from ( e.g. cell loaded from a mesh snapshot )",
+                mCellIndex2 );
+
         return mBaseCell->get_ijk();
     }
 
@@ -20,7 +20,7 @@ namespace moris::mtk
     class Cell_DataBase : public mtk::Cell
     {
       private:
-        mtk::Cell* mBaseCell;
+        mtk::Cell* mBaseCell = nullptr;
 
         moris_index mCellIndex2;
         mtk::Mesh*  mMesh;
@@ -74,6 +74,23 @@ namespace moris::mtk
 
         //------------------------------------------------------------------------------
 
+        /**
+         * @brief Construct an IP cell without an underlying mtk cell, used when reloading a mesh snapshot
+         *
+         * @param aCellId id of the cell
+         * @param aCellOwner owner of the cell
+         * @param aCellInfo a cell info
+         * @param aCellIndex2 index of the cell in the data base
+         * @param aMesh data base mesh
+         */
+        Cell_DataBase( moris_id                          aCellId,
+                moris_id                                 aCellOwner,
+                std::shared_ptr< moris::mtk::Cell_Info > aCellInfo,
+                moris_index                              aCellIndex2,
+                mtk::Mesh*                               aMesh );
+
+        //------------------------------------------------------------------------------
+
         /**
          * @brief Destroy the Cell_DataBase object
          *
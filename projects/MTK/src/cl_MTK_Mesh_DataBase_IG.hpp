@@ -673,6 +673,30 @@ namespace moris
             moris::Memory_Map
             get_memory_usage();
 
+            // ----------------------------------------------------------------------------
+
+            /**
+             * @brief Appends the raw data of the mesh including all clusters and sets to the snapshot file
+             * written by Interpolation_Mesh_DataBase_IP::save_to_hdf5(). Pointers are stored as indices.
+             *
+             * @param aFilePath path of the snapshot file
+             */
+            void
+            save_to_hdf5( const std::string& aFilePath );
+
+            // ----------------------------------------------------------------------------
+
+            /**
+             * @brief Builds the mesh from a snapshot written by save_to_hdf5() on the same number of procs.
+             *
+             * @param aFilePath path of the snapshot file
+             * @param aIPMesh interpolation mesh loaded from the same snapshot file
+             */
+            void
+            load_from_hdf5(
+                    const std::string&              aFilePath,
+                    Interpolation_Mesh_DataBase_IP* aIPMesh );
+
             friend class Periodic2D_Analysis;
             friend class Integration_Mesh_Editor;
         };
@@ -0,0 +1,680 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_MTK_Mesh_DataBase_IG_Snapshot.cpp
+ *
+ */
+
+#include <map>
+#include <string>
+
+#include "cl_MTK_Mesh_DataBase_IG.hpp"
+#include "cl_MTK_Mesh_DataBase_IP.hpp"
+#include "cl_MTK_Vertex_DataBase.hpp"
+#include "cl_MTK_Cell_DataBase.hpp"
+#include "cl_MTK_Cell_Info_Factory.hpp"
+#include "cl_MTK_Cell_Info.hpp"
+#include "cl_MTK_Cell_Cluster_DataBase.hpp"
+#include "cl_MTK_Side_Cluster_DataBase.hpp"
+#include "cl_MTK_Double_Side_Cluster.hpp"
+#include "cl_MTK_Block.hpp"
+#include "cl_MTK_Side_Set.hpp"
+#include "cl_MTK_Double_Side_Set.hpp"
+#include "cl_Tracer.hpp"
+
+#include "HDF5_Tools.hpp"
+
+namespace moris::mtk
+{
+    namespace
+    {
+        // ----------------------------------------------------------------------------
+
+        /**
+         * @brief converts a list of vertex or cell pointers into their indices
+         */
+        template< typename T >
+        std::vector< moris_index >
+        pointers_to_indices( const moris::Cell< T* >& aPointers )
+        {
+            std::vector< moris_index > tIndices( aPointers.size() );
+
+            for ( uint iEntry = 0; iEntry < aPointers.size(); iEntry++ )
+            {
+                tIndices[ iEntry ] = aPointers( iEntry )->get_index();
+            }
+
+            return tIndices;
+        }
+
+        // ----------------------------------------------------------------------------
+
+        /**
+         * @brief hdf5 has no native bool type, flags are stored as unsigned integers
+         */
+        std::vector< uint >
+        flags_to_uint( const moris::Cell< bool >& aFlags )
+        {
+            return std::vector< uint >( aFlags.begin(), aFlags.end() );
+        }
+
+        // ----------------------------------------------------------------------------
+
+        moris::Cell< bool >
+        uint_to_flags( const std::vector< uint >& aValues )
+        {
+            moris::Cell< bool > tFlags( aValues.size() );
+
+            for ( uint iEntry = 0; iEntry < aValues.size(); iEntry++ )
+            {
+                tFlags( iEntry ) = aValues[ iEntry ] != 0;
+            }
+
+            return tFlags;
+        }
+
+        // ----------------------------------------------------------------------------
+
+        void
+        save_index_map(
+                hid_t&                                                        aFileID,
+                const std::string&                                            aLabel,
+                const std::unordered_map< moris::moris_index, moris_index >& aMap,
+                herr_t&                                                       aStatus )
+        {
+            std::vector< moris_index > tKeys;
+            std::vector< moris_index > tValues;
+
+            tKeys.reserve( aMap.size() );
+            tValues.reserve( aMap.size() );
+
+            for ( const auto& iPair : aMap )
+            {
+                tKeys.push_back( iPair.first );
+                tValues.push_back( iPair.second );
+            }
+
+            save_vector_to_hdf5_file( aFileID, aLabel + "_Keys", tKeys, aStatus );
+            save_vector_to_hdf5_file( aFileID, aLabel + "_Values", tValues, aStatus );
+        }
+
+        // ----------------------------------------------------------------------------
+
+        void
+        load_index_map(
+                hid_t&                                                  aFileID,
+                const std::string&                                      aLabel,
+                std::unordered_map< moris::moris_index, moris_index >& aMap,
+                herr_t&                                                 aStatus )
+        {
+            std::vector< moris_index > tKeys;
+            std::vector< moris_index > tValues;
+
+            load_vector_from_hdf5_file( aFileID, aLabel + "_Keys", tKeys, aStatus );
+            load_vector_from_hdf5_file( aFileID, aLabel + "_Values", tValues, aStatus );
+
+            aMap.reserve( tKeys.size() );
+
+            for ( uint iEntry = 0; iEntry < tKeys.size(); iEntry++ )
+            {
+                aMap[ tKeys[ iEntry ] ] = tValues[ iEntry ];
+            }
+        }
+
+        // ----------------------------------------------------------------------------
+
+        /**
+         * @brief saves name, colors and cluster indices of a list of sets,
+         * the cluster index is the position of the cluster in the array it is stored in
+         */
+        template< typename ClusterClass >
+        void
+        save_sets(
+                hid_t&                                 aFileID,
+                const std::string&                     aLabel,
+                const moris::Cell< moris::mtk::Set* >& aSets,
+                const moris::Cell< ClusterClass >&     aPrimaryClusters,
+                const moris::Cell< ClusterClass >&     aSecondaryClusters,
+                herr_t&                                aStatus )
+        {
+            save_scalar_to_hdf5_file( aFileID, aLabel + "_Num_Sets", (uint)aSets.size(), aStatus );
+
+            std::vector< uint > tUsesSecondaryClusters( aSets.size(), 0 );
+
+            for ( uint iSet = 0; iSet < aSets.size(); iSet++ )
+            {
+                std::string tSuffix = "_" + std::to_string( iSet );
+
+                moris::Cell< Cluster const * > const & tClusters = aSets( iSet )->get_clusters_on_set();
+
+                std::vector< moris_index > tClusterIndices( tClusters.size() );
+
+                for ( uint iCluster = 0; iCluster < tClusters.size(); iCluster++ )
+                {
+                    ClusterClass const * tCluster = static_cast< ClusterClass const * >( tClusters( iCluster ) );
+
+                    // clusters of a set are either all primary or all secondary ( ghost ) clusters
+                    if ( tCluster >= aPrimaryClusters.memptr() and tCluster < aPrimaryClusters.memptr() + aPrimaryClusters.size() )
+                    {
+                        tClusterIndices[ iCluster ] = tCluster - aPrimaryClusters.memptr();
+                    }
+                    else
+                    {
+                        MORIS_ERROR( tCluster >= aSecondaryClusters.memptr() and tCluster < aSecondaryClusters.memptr() + aSecondaryClusters.size(),
+                                "Integration_Mesh_DataBase_IG::save_to_hdf5() - cluster of set %s is not stored in the mesh",
+                                aSets( iSet )->get_set_name().c_str() );
+
+                        tClusterIndices[ iCluster ] = tCluster - aSecondaryClusters.memptr();
+
+                        tUsesSecondaryClusters[ iSet ] = 1;
+                    }
+                }
+
+                save_string_to_hdf5_file( aFileID, aLabel + "_Name" + tSuffix, aSets( iSet )->get_set_name(), aStatus );
+                save_matrix_to_hdf5_file( aFileID, aLabel + "_Colors" + tSuffix, aSets( iSet )->get_set_colors(), aStatus );
+                save_vector_to_hdf5_file( aFileID, aLabel + "_Clusters" + tSuffix, tClusterIndices, aStatus );
+            }
+
+            save_vector_to_hdf5_file( aFileID, aLabel + "_Uses_Secondary_Clusters", tUsesSecondaryClusters, aStatus );
+        }
+
+        // ----------------------------------------------------------------------------
+
+        /**
+         * @brief loads the sets written by save_sets() and constructs them on the given clusters
+         */
+        template< typename SetClass, typename ClusterClass >
+        void
+        load_sets(
+                hid_t&                           aFileID,
+                const std::string&               aLabel,
+                moris::Cell< moris::mtk::Set* >& aSets,
+                moris::Cell< ClusterClass >&     aPrimaryClusters,
+                moris::Cell< ClusterClass >&     aSecondaryClusters,
+                uint                             aSpatialDim,
+                herr_t&                          aStatus )
+        {
+            uint tNumSets = 0;
+            load_scalar_from_hdf5_file( aFileID, aLabel + "_Num_Sets", tNumSets, aStatus );
+
+            std::vector< uint > tUsesSecondaryClusters;
+            load_vector_from_hdf5_file( aFileID, aLabel + "_Uses_Secondary_Clusters", tUsesSecondaryClusters, aStatus );
+
+            aSets.resize( tNumSets, nullptr );
+
+            for ( uint iSet = 0; iSet < tNumSets; iSet++ )
+            {
+                std::string tSuffix = "_" + std::to_string( iSet );
+
+                std::string                tName;
+                Matrix< IndexMat >         tColors;
+                std::vector< moris_index > tClusterIndices;
+
+                load_string_from_hdf5_file( aFileID, aLabel + "_Name" + tSuffix, tName, aStatus );
+                load_matrix_from_hdf5_file( aFileID, aLabel + "_Colors" + tSuffix, tColors, aStatus );
+                load_vector_from_hdf5_file( aFileID, aLabel + "_Clusters" + tSuffix, tClusterIndices, aStatus );
+
+                moris::Cell< ClusterClass >& tClusterList = tUsesSecondaryClusters[ iSet ] ? aSecondaryClusters : aPrimaryClusters;
+
+                moris::Cell< Cluster const * > tClusters( tClusterIndices.size() );
+
+                for ( uint iCluster = 0; iCluster < tClusterIndices.size(); iCluster++ )
+                {
+                    tClusters( iCluster ) = &tClusterList( tClusterIndices[ iCluster ] );
+                }
+
+                aSets( iSet ) = new SetClass( tName, tClusters, tColors, aSpatialDim );
+            }
+        }
+
+        // ----------------------------------------------------------------------------
+
+        /**
+         * @brief saves leader, follower and vertex pairs of double sided clusters built on the given side clusters
+         */
+        void
+        save_double_sided_clusters(
+                hid_t&                                           aFileID,
+                const std::string&                               aLabel,
+                const moris::Cell< mtk::Double_Side_Cluster >&   aDblSideClusters,
+                const moris::Cell< mtk::Side_Cluster_DataBase >& aLeaderClusters,
+                const moris::Cell< mtk::Side_Cluster_DataBase >& aFollowerClusters,
+                herr_t&                                          aStatus )
+        {
+            std::vector< moris_index > tLeaderIndices( aDblSideClusters.size() );
+            std::vector< moris_index > tFollowerIndices( aDblSideClusters.size() );
+            std::vector< moris_index > tVertexPairOffsets( aDblSideClusters.size() + 1, 0 );
+            std::vector< moris_index > tVertexPairIndices;
+
+            for ( uint iCluster = 0; iCluster < aDblSideClusters.size(); iCluster++ )
+            {
+                tLeaderIndices[ iCluster ] = static_cast< mtk::Side_Cluster_DataBase const * >( &aDblSideClusters( iCluster ).get_leader_side_cluster() )
+                                           - aLeaderClusters.memptr();
+
+                tFollowerIndices[ iCluster ] = static_cast< mtk::Side_Cluster_DataBase const * >( &aDblSideClusters( iCluster ).get_follower_side_cluster() )
+                                             - aFollowerClusters.memptr();
+
+                for ( const auto& iVertex : aDblSideClusters( iCluster ).get_leader_vertex_pairs() )
+                {
+                    tVertexPairIndices.push_back( iVertex->get_index() );
+                }
+
+                tVertexPairOffsets[ iCluster + 1 ] = tVertexPairIndices.size();
+            }
+
+            save_vector_to_hdf5_file( aFileID, aLabel + "_Leader_Clusters", tLeaderIndices, aStatus );
+            save_vector_to_hdf5_file( aFileID, aLabel + "_Follower_Clusters", tFollowerIndices, aStatus );
+            save_vector_to_hdf5_file( aFileID, aLabel + "_Vertex_Pair_Offsets", tVertexPairOffsets, aStatus );
+            save_vector_to_hdf5_file( aFileID, aLabel + "_Vertex_Pair_Indices", tVertexPairIndices, aStatus );
+        }
+
+        // ----------------------------------------------------------------------------
+
+        void
+        load_double_sided_clusters(
+                hid_t&                                     aFileID,
+                const std::string&                         aLabel,
+                moris::Cell< mtk::Double_Side_Cluster >&   aDblSideClusters,
+                moris::Cell< mtk::Side_Cluster_DataBase >& aLeaderClusters,
+                moris::Cell< mtk::Side_Cluster_DataBase >& aFollowerClusters,
+                moris::Cell< Vertex_DataBase >&            aVertices,
+                herr_t&                                    aStatus )
+        {
+            std::vector< moris_index > tLeaderIndices;
+            std::vector< moris_index > tFollowerIndices;
+            std::vector< moris_index > tVertexPairOffsets;
+            std::vector< moris_index > tVertexPairIndices;
+
+            load_vector_from_hdf5_file( aFileID, aLabel + "_Leader_Clusters", tLeaderIndices, aStatus );
+            load_vector_from_hdf5_file( aFileID, aLabel + "_Follower_Clusters", tFollowerIndices, aStatus );
+            load_vector_from_hdf5_file( aFileID, aLabel + "_Vertex_Pair_Offsets", tVertexPairOffsets, aStatus );
+            load_vector_from_hdf5_file( aFileID, aLabel + "_Vertex_Pair_Indices", tVertexPairIndices, aStatus );
+
+            aDblSideClusters.resize( tLeaderIndices.size() );
+
+            for ( uint iCluster = 0; iCluster < tLeaderIndices.size(); iCluster++ )
+            {
+                moris::Cell< mtk::Vertex const * > tVertexPair( tVertexPairOffsets[ iCluster + 1 ] - tVertexPairOffsets[ iCluster ] );
+
+                for ( uint iPair = 0; iPair < tVertexPair.size(); iPair++ )
+                {
+                    tVertexPair( iPair ) = &aVertices( tVertexPairIndices[ tVertexPairOffsets[ iCluster ] + iPair ] );
+                }
+
+                aDblSideClusters( iCluster ) = mtk::Double_Side_Cluster(
+                        &aLeaderClusters( tLeaderIndices[ iCluster ] ),
+                        &aFollowerClusters( tFollowerIndices[ iCluster ] ),
+                        tVertexPair );
+            }
+        }
+
+        // ----------------------------------------------------------------------------
+    }    // namespace
+
+    // ----------------------------------------------------------------------------
+
+    void
+    Integration_Mesh_DataBase_IG::save_to_hdf5( const std::string& aFilePath )
+    {
+        Tracer tTracer( "MTK", "IG mesh", "Save snapshot" );
+
+        MORIS_LOG_INFO( "Saving integration mesh snapshot to file: %s", aFilePath.c_str() );
+
+        // the interpolation mesh has created the file already
+        hid_t  tFileID = open_hdf5_file( aFilePath );
+        herr_t tStatus = 0;
+
+        // vertex data
+        save_matrix_to_hdf5_file( tFileID, "IG_Vertex_Coordinates", mVertexCoordinates, tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Vertex_IDs", mVertexIdList.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Vertex_Owners", mVertexOwnerList.data(), tStatus );
+
+        // cell data, the cell info is stored as geometry type and interpolation order per cell
+        std::vector< uint > tCellGeometries( mCells.size() );
+        std::vector< uint > tCellInterpolationOrders( mCells.size() );
+
+        for ( uint iCell = 0; iCell < mCells.size(); iCell++ )
+        {
+            tCellGeometries[ iCell ]          = (uint)mCellInfoList( iCell )->get_cell_geometry();
+            tCellInterpolationOrders[ iCell ] = (uint)mCellInfoList( iCell )->get_cell_interpolation_order();
+        }
+
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_To_Vertex_Offsets", mCellToVertexOffSet.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_To_Vertex_Indices", pointers_to_indices( mCellToVertices ), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_IDs", mCellIdList.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_Owners", mCellOwnerList.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_Geometries", tCellGeometries, tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_Interpolation_Orders", tCellInterpolationOrders, tStatus );
+
+        // cell clusters
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_Cluster_Primary_Cell_Offsets", mCellClusterToPrimaryIGCellOffSet.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_Cluster_Primary_Cells", pointers_to_indices( mCellClusterToPrimaryIGCell ), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_Cluster_Void_Cell_Offsets", mCellClusterToVoidIGCellOffset.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_Cluster_Void_Cells", pointers_to_indices( mCellClusterToVoidIGCell ), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_Cluster_Vertex_Offsets", mCellClusterToVertexOffset.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_Cluster_Vertices", pointers_to_indices( mCellClusterToVeretx ), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Cell_Cluster_Is_Trivial", flags_to_uint( mCellClusterIsTrivial ), tStatus );
+
+        save_scalar_to_hdf5_file( tFileID, "IG_Has_Cell_Cluster_Coords", (uint)( mCellClusterVertexCoords != nullptr ), tStatus );
+
+        if ( mCellClusterVertexCoords != nullptr )
+        {
+            save_matrix_to_hdf5_file( tFileID, "IG_Cell_Cluster_Coords", *mCellClusterVertexCoords, tStatus );
+        }
+
+        save_index_map( tFileID, "IG_Cell_Cluster_Row_Numbers", mCellClusterIndexToRowNumber, tStatus );
+
+        // side clusters
+        save_scalar_to_hdf5_file( tFileID, "IG_Num_Side_Clusters", mNumSideClusters, tStatus );
+        save_scalar_to_hdf5_file( tFileID, "IG_Num_Side_Cluster_Objects", (uint)mSideClusters.size(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Side_Cluster_Primary_Cell_Offsets", mSideClusterToPrimaryIGCellOffset.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Side_Cluster_Primary_Cells", pointers_to_indices( mSideClusterToPrimaryIGCell ), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Side_Cluster_Side_Ordinals", mSideClusterToPrimaryIGCellSideOrd.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Side_Cluster_Void_Cell_Offsets", mSideClusterToVoidIGCellOffset.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Side_Cluster_Void_Cells", pointers_to_indices( mSideClusterToVoidIGCell ), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Side_Cluster_Vertex_Offsets", mSideClusterToVertexOffSet.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Side_Cluster_Vertices", pointers_to_indices( mSideClusterToVeretx ), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Side_Cluster_IP_Cells", mSideClusterToIPCell.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Side_Cluster_Is_Trivial", flags_to_uint( mSideClusterIsTrivial ), tStatus );
+        save_index_map( tFileID, "IG_Side_Cluster_Row_Numbers", mSideClusterIndexToRowNumber, tStatus );
+
+        // double sided clusters
+        save_double_sided_clusters( tFileID, "IG_Double_Sided_Cluster", mDblSideClusters, mSideClusters, mSideClusters, tStatus );
+
+        // ghost clusters, leader and follower data is stored in alternating order
+        save_vector_to_hdf5_file( tFileID, "IG_Ghost_IP_Cells", mGhostLeaderFollowerIPCellList.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Ghost_IG_Cells", pointers_to_indices( mGhostLeaderFollowerIGCellList ), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Ghost_Side_Ordinals", mGhostLeaderFollowerOrd.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Ghost_Is_Trivial", flags_to_uint( mGhostLeaderFollowerIsTrivial ), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Ghost_Vertex_Offsets", mGhostLeaderFollowerVertexOffSet.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Ghost_Vertices", pointers_to_indices( mGhostLeaderFollowerToVertex ), tStatus );
+
+        save_double_sided_clusters( tFileID, "IG_Ghost_Double_Sided_Cluster", mGhostDblSidedSet, mGhostLeader, mGhostFollower, tStatus );
+
+        save_scalar_to_hdf5_file( tFileID, "IG_Has_Secondary_Cluster_Coords", (uint)( mSecondaryClusterVertexCoords != nullptr ), tStatus );
+
+        if ( mSecondaryClusterVertexCoords != nullptr )
+        {
+            save_matrix_to_hdf5_file( tFileID, "IG_Secondary_Cluster_Coords", *mSecondaryClusterVertexCoords, tStatus );
+        }
+
+        save_index_map( tFileID, "IG_Secondary_Cluster_Row_Numbers", mSecondaryClusterIndexToRowNumber, tStatus );
+
+        // sets, the topology of the block sets is stored in the order of the block sets
+        std::vector< uint > tBlockTopologies( mListOfBlocks.size() );
+
+        for ( uint iSet = 0; iSet < mListOfBlocks.size(); iSet++ )
+        {
+            tBlockTopologies[ iSet ] = (uint)mCellTopologyToNameMap.find( mListOfBlocks( iSet )->get_set_name() );
+        }
+
+        save_sets( tFileID, "IG_Block_Set", mListOfBlocks, mCellClusters, mCellClusters, tStatus );
+        save_vector_to_hdf5_file( tFileID, "IG_Block_Set_Topologies", tBlockTopologies, tStatus );
+
+        save_sets( tFileID, "IG_Side_Set", mListOfSideSets, mSideClusters, mSideClusters, tStatus );
+        save_sets( tFileID, "IG_Double_Sided_Set", mListOfDoubleSideSets, mDblSideClusters, mGhostDblSidedSet, tStatus );
+
+        MORIS_ERROR( tStatus == 0,
+                "Integration_Mesh_DataBase_IG::save_to_hdf5() - HDF5 writer returned status %i.",
+                tStatus );
+
+        close_hdf5_file( tFileID );
+    }
+
+    // ----------------------------------------------------------------------------
+
+    void
+    Integration_Mesh_DataBase_IG::load_from_hdf5(
+            const std::string&              aFilePath,
+            Interpolation_Mesh_DataBase_IP* aIPMesh )
+    {
+        Tracer tTracer( "MTK", "IG mesh", "Load snapshot" );
+
+        MORIS_ERROR( mVertices.size() == 0 and mCells.size() == 0,
+                "Integration_Mesh_DataBase_IG::load_from_hdf5() - mesh has already been built" );
+
+        MORIS_ERROR( aIPMesh != nullptr and aIPMesh->get_num_elems() > 0,
+                "Integration_Mesh_DataBase_IG::load_from_hdf5() - interpolation mesh has to be loaded first" );
+
+        MORIS_LOG_INFO( "Loading integration mesh snapshot from file: %s", aFilePath.c_str() );
+
+        mIPMesh = aIPMesh;
+
+        hid_t  tFileID = open_hdf5_file( aFilePath );
+        herr_t tStatus = 0;
+
+        // vertex data
+        load_matrix_from_hdf5_file( tFileID, "IG_Vertex_Coordinates", mVertexCoordinates, tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Vertex_IDs", mVertexIdList.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Vertex_Owners", mVertexOwnerList.data(), tStatus );
+
+        uint tNumVertices = mVertexCoordinates.n_cols();
+        uint tSpatialDim  = mVertexCoordinates.n_rows();
+
+        MORIS_ERROR( mVertexIdList.size() == tNumVertices and mVertexOwnerList.size() == tNumVertices,
+                "Integration_Mesh_DataBase_IG::load_from_hdf5() - vertex data in file %s is inconsistent",
+                aFilePath.c_str() );
+
+        mVertices.reserve( tNumVertices );
+        mVertexGlobalIdToLocalIndex.reserve( tNumVertices );
+
+        for ( uint iVertex = 0; iVertex < tNumVertices; iVertex++ )
+        {
+            mVertices.emplace_back( iVertex, this );
+
+            mVertexGlobalIdToLocalIndex[ mVertexIdList( iVertex ) ] = iVertex;
+        }
+
+        // cell data
+        std::vector< moris_index > tCellToVertexIndices;
+        std::vector< uint >        tCellGeometries;
+        std::vector< uint >        tCellInterpolationOrders;
+
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_To_Vertex_Offsets", mCellToVertexOffSet.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_To_Vertex_Indices", tCellToVertexIndices, tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_IDs", mCellIdList.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_Owners", mCellOwnerList.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_Geometries", tCellGeometries, tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_Interpolation_Orders", tCellInterpolationOrders, tStatus );
+
+        uint tNumCells = mCellIdList.size();
+
+        MORIS_ERROR( mCellToVertexOffSet.size() == tNumCells + 1 and tCellGeometries.size() == tNumCells,
+                "Integration_Mesh_DataBase_IG::load_from_hdf5() - cell data in file %s is inconsistent",
+                aFilePath.c_str() );
+
+        mCellToVertices.reserve( tCellToVertexIndices.size() );
+
+        for ( const moris_index& iVertex : tCellToVertexIndices )
+        {
+            mCellToVertices.push_back( &mVertices( iVertex ) );
+        }
+
+        // cells of the same type share one cell info
+        mtk::Cell_Info_Factory                                                tFactory;
+        std::map< std::pair< uint, uint >, std::shared_ptr< mtk::Cell_Info > > tCellInfos;
+
+        mCells.reserve( tNumCells );
+        mCellInfoList.reserve( tNumCells );
+
+        for ( uint iCell = 0; iCell < tNumCells; iCell++ )
+        {
+            std::pair< uint, uint > tCellType( tCellGeometries[ iCell ], tCellInterpolationOrders[ iCell ] );
+
+            if ( tCellInfos.find( tCellType ) == tCellInfos.end() )
+            {
+                tCellInfos[ tCellType ] = tFactory.create_cell_info_sp(
+                        (enum Geometry_Type)tCellType.first,
+                        (enum Interpolation_Order)tCellType.second );
+            }
+
+            mCellInfoList.push_back( tCellInfos[ tCellType ] );
+
+            mCells.push_back( Cell_DataBase( mCellIdList( iCell ),
+                    mCellOwnerList( iCell ),
+                    mCellInfoList( iCell ),
+                    iCell,
+                    this ) );
+        }
+
+        // helper to convert stored cell and vertex indices back into pointers
+        auto tToCells = [ this ]( const std::vector< moris_index >& aIndices, moris::Cell< mtk::Cell* >& aCells ) {
+            aCells.reserve( aIndices.size() );
+            for ( const moris_index& iCell : aIndices )
+            {
+                aCells.push_back( &mCells( iCell ) );
+            }
+        };
+
+        auto tToVertices = [ this ]( const std::vector< moris_index >& aIndices, moris::Cell< mtk::Vertex* >& aVertices ) {
+            aVertices.reserve( aIndices.size() );
+            for ( const moris_index& iVertex : aIndices )
+            {
+                aVertices.push_back( &mVertices( iVertex ) );
+            }
+        };
+
+        std::vector< moris_index > tIndices;
+        std::vector< uint >        tFlags;
+        uint                       tHasCoords = 0;
+
+        // cell clusters
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_Cluster_Primary_Cell_Offsets", mCellClusterToPrimaryIGCellOffSet.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_Cluster_Primary_Cells", tIndices, tStatus );
+        tToCells( tIndices, mCellClusterToPrimaryIGCell );
+
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_Cluster_Void_Cell_Offsets", mCellClusterToVoidIGCellOffset.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_Cluster_Void_Cells", tIndices, tStatus );
+        tToCells( tIndices, mCellClusterToVoidIGCell );
+
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_Cluster_Vertex_Offsets", mCellClusterToVertexOffset.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_Cluster_Vertices", tIndices, tStatus );
+        tToVertices( tIndices, mCellClusterToVeretx );
+
+        load_vector_from_hdf5_file( tFileID, "IG_Cell_Cluster_Is_Trivial", tFlags, tStatus );
+        mCellClusterIsTrivial = uint_to_flags( tFlags );
+
+        load_scalar_from_hdf5_file( tFileID, "IG_Has_Cell_Cluster_Coords", tHasCoords, tStatus );
+
+        if ( tHasCoords )
+        {
+            mCellClusterVertexCoords = new moris::Matrix< moris::DDRMat >();
+            load_matrix_from_hdf5_file( tFileID, "IG_Cell_Cluster_Coords", *mCellClusterVertexCoords, tStatus );
+        }
+
+        load_index_map( tFileID, "IG_Cell_Cluster_Row_Numbers", mCellClusterIndexToRowNumber, tStatus );
+
+        // there is one cell cluster per interpolation cell
+        uint tNumCellClusters = mCellClusterIsTrivial.size();
+
+        MORIS_ERROR( tNumCellClusters == aIPMesh->get_num_elems() and mCellClusterToPrimaryIGCellOffSet.size() == tNumCellClusters + 1,
+                "Integration_Mesh_DataBase_IG::load_from_hdf5() - cell clusters in file %s do not match the interpolation mesh",
+                aFilePath.c_str() );
+
+        mCellClusters.reserve( tNumCellClusters );
+
+        for ( uint iCluster = 0; iCluster < tNumCellClusters; iCluster++ )
+        {
+            mCellClusters.push_back( mtk::Cell_Cluster_DataBase( (moris_index)iCluster, this ) );
+        }
+
+        // side clusters
+        uint tNumSideClusters = 0;
+
+        load_scalar_from_hdf5_file( tFileID, "IG_Num_Side_Clusters", mNumSideClusters, tStatus );
+        load_scalar_from_hdf5_file( tFileID, "IG_Num_Side_Cluster_Objects", tNumSideClusters, tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Side_Cluster_Primary_Cell_Offsets", mSideClusterToPrimaryIGCellOffset.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Side_Cluster_Primary_Cells", tIndices, tStatus );
+        tToCells( tIndices, mSideClusterToPrimaryIGCell );
+
+        load_vector_from_hdf5_file( tFileID, "IG_Side_Cluster_Side_Ordinals", mSideClusterToPrimaryIGCellSideOrd.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Side_Cluster_Void_Cell_Offsets", mSideClusterToVoidIGCellOffset.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Side_Cluster_Void_Cells", tIndices, tStatus );
+        tToCells( tIndices, mSideClusterToVoidIGCell );
+
+        load_vector_from_hdf5_file( tFileID, "IG_Side_Cluster_Vertex_Offsets", mSideClusterToVertexOffSet.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Side_Cluster_Vertices", tIndices, tStatus );
+        tToVertices( tIndices, mSideClusterToVeretx );
+
+        load_vector_from_hdf5_file( tFileID, "IG_Side_Cluster_IP_Cells", mSideClusterToIPCell.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Side_Cluster_Is_Trivial", tFlags, tStatus );
+        mSideClusterIsTrivial = uint_to_flags( tFlags );
+
+        load_index_map( tFileID, "IG_Side_Cluster_Row_Numbers", mSideClusterIndexToRowNumber, tStatus );
+
+        // side clusters added after the mesh was built are included in the number of side cluster objects
+        mSideClusters.resize( tNumSideClusters );
+
+        for ( uint iCluster = 0; iCluster < tNumSideClusters; iCluster++ )
+        {
+            mSideClusters( iCluster ) = mtk::Side_Cluster_DataBase( (moris_index)iCluster, this );
+        }
+
+        // double sided clusters
+        load_double_sided_clusters( tFileID, "IG_Double_Sided_Cluster", mDblSideClusters, mSideClusters, mSideClusters, mVertices, tStatus );
+
+        // ghost clusters
+        load_vector_from_hdf5_file( tFileID, "IG_Ghost_IP_Cells", mGhostLeaderFollowerIPCellList.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Ghost_IG_Cells", tIndices, tStatus );
+        tToCells( tIndices, mGhostLeaderFollowerIGCellList );
+
+        load_vector_from_hdf5_file( tFileID, "IG_Ghost_Side_Ordinals", mGhostLeaderFollowerOrd.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Ghost_Is_Trivial", tFlags, tStatus );
+        mGhostLeaderFollowerIsTrivial = uint_to_flags( tFlags );
+
+        load_vector_from_hdf5_file( tFileID, "IG_Ghost_Vertex_Offsets", mGhostLeaderFollowerVertexOffSet.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "IG_Ghost_Vertices", tIndices, tStatus );
+        tToVertices( tIndices, mGhostLeaderFollowerToVertex );
+
+        // ghost side clusters are indexed after the side clusters, leader and follower alternate
+        uint tNumGhostClusters = mGhostLeaderFollowerIPCellList.size() / 2;
+
+        mGhostLeader.resize( tNumGhostClusters );
+        mGhostFollower.resize( tNumGhostClusters );
+
+        for ( uint iCluster = 0; iCluster < tNumGhostClusters; iCluster++ )
+        {
+            mGhostLeader( iCluster )   = mtk::Side_Cluster_DataBase( (moris_index)( tNumSideClusters + 2 * iCluster ), this );
+            mGhostFollower( iCluster ) = mtk::Side_Cluster_DataBase( (moris_index)( tNumSideClusters + 2 * iCluster + 1 ), this );
+        }
+
+        load_double_sided_clusters( tFileID, "IG_Ghost_Double_Sided_Cluster", mGhostDblSidedSet, mGhostLeader, mGhostFollower, mVertices, tStatus );
+
+        load_scalar_from_hdf5_file( tFileID, "IG_Has_Secondary_Cluster_Coords", tHasCoords, tStatus );
+
+        if ( tHasCoords )
+        {
+            mSecondaryClusterVertexCoords = new moris::Matrix< moris::DDRMat >();
+            load_matrix_from_hdf5_file( tFileID, "IG_Secondary_Cluster_Coords", *mSecondaryClusterVertexCoords, tStatus );
+        }
+
+        load_index_map( tFileID, "IG_Secondary_Cluster_Row_Numbers", mSecondaryClusterIndexToRowNumber, tStatus );
+
+        // sets
+        load_sets< mtk::Block >( tFileID, "IG_Block_Set", mListOfBlocks, mCellClusters, mCellClusters, tSpatialDim, tStatus );
+        load_sets< mtk::Side_Set >( tFileID, "IG_Side_Set", mListOfSideSets, mSideClusters, mSideClusters, tSpatialDim, tStatus );
+        load_sets< mtk::Double_Side_Set >( tFileID, "IG_Double_Sided_Set", mListOfDoubleSideSets, mDblSideClusters, mGhostDblSidedSet, tSpatialDim, tStatus );
+
+        std::vector< uint > tBlockTopologies;
+        load_vector_from_hdf5_file( tFileID, "IG_Block_Set_Topologies", tBlockTopologies, tStatus );
+
+        for ( uint iSet = 0; iSet < mListOfBlocks.size(); iSet++ )
+        {
+            mCellTopologyToNameMap[ mListOfBlocks( iSet )->get_set_name() ] = (enum CellTopology)tBlockTopologies[ iSet ];
+        }
+
+        MORIS_ERROR( tStatus == 0,
+                "Integration_Mesh_DataBase_IG::load_from_hdf5() - HDF5 reader returned status %i.",
+                tStatus );
+
+        close_hdf5_file( tFileID );
+
+        // collect all sets to set up the set indices and shapes
+        this->collect_all_sets();
+    }
+
+    // ----------------------------------------------------------------------------
+}    // namespace moris::mtk
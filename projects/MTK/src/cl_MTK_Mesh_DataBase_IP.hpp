@@ -529,6 +529,28 @@ namespace moris
 
             // ----------------------------------------------------------------------------
 
+            /**
+             * @brief Writes the raw data of the mesh including the vertex T-matrices to a binary hdf5 file.
+             * Each proc writes its own file, the proc count is added to the file name in parallel.
+             *
+             * @param aFilePath path of the snapshot file
+             */
+            void
+            save_to_hdf5( const std::string& aFilePath );
+
+            // ----------------------------------------------------------------------------
+
+            /**
+             * @brief Builds the mesh from a snapshot written by save_to_hdf5() on the same number of procs.
+             * The cells of the reloaded mesh do not have a base cell, hence no level or ijk position.
+             *
+             * @param aFilePath path of the snapshot file
+             */
+            void
+            load_from_hdf5( const std::string& aFilePath );
+
+            // ----------------------------------------------------------------------------
+
             friend class Interpolation_Mesh_Editor;
         };
     }    // namespace mtk
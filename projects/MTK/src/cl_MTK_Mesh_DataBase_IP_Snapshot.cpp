@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_MTK_Mesh_DataBase_IP_Snapshot.cpp
+ *
+ */
+
+#include <string>
+
+#include "cl_MTK_Mesh_DataBase_IP.hpp"
+#include "cl_MTK_Vertex_DataBase.hpp"
+#include "cl_MTK_Vertex_Interpolation_DataBase.hpp"
+#include "cl_MTK_Cell_DataBase.hpp"
+#include "cl_MTK_Cell_Info_Factory.hpp"
+#include "cl_MTK_Cell_Info.hpp"
+#include "cl_Tracer.hpp"
+
+#include "HDF5_Tools.hpp"
+
+namespace moris::mtk
+{
+    // ----------------------------------------------------------------------------
+
+    void
+    Interpolation_Mesh_DataBase_IP::save_to_hdf5( const std::string& aFilePath )
+    {
+        Tracer tTracer( "MTK", "IP mesh", "Save snapshot" );
+
+        MORIS_LOG_INFO( "Saving interpolation mesh snapshot to file: %s", aFilePath.c_str() );
+
+        hid_t  tFileID = create_hdf5_file( aFilePath );
+        herr_t tStatus = 0;
+
+        // vertex data
+        save_scalar_to_hdf5_file( tFileID, "Spatial_Dimension", this->get_spatial_dim(), tStatus );
+        save_matrix_to_hdf5_file( tFileID, "Vertex_Coordinates", mVertexCoordinates, tStatus );
+        save_vector_to_hdf5_file( tFileID, "Vertex_IDs", mVertexIdList.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "Vertex_Owners", mVertexOwnerList.data(), tStatus );
+
+        // T-matrices of all enriched B-spline meshes
+        save_matrix_to_hdf5_file( tFileID, "Mesh_Indices", mMeshIndices, tStatus );
+
+        for ( uint iLocalOrder = 0; iLocalOrder < mOffSetTMatrix.size(); iLocalOrder++ )
+        {
+            std::string tSuffix = "_" + std::to_string( iLocalOrder );
+
+            save_vector_to_hdf5_file( tFileID, "TMatrix_Offsets" + tSuffix, mOffSetTMatrix( iLocalOrder ).data(), tStatus );
+            save_vector_to_hdf5_file( tFileID, "TMatrix_Weights" + tSuffix, mWeights( iLocalOrder ).data(), tStatus );
+            save_vector_to_hdf5_file( tFileID, "Basis_IDs" + tSuffix, mBasisIds( iLocalOrder ).data(), tStatus );
+            save_vector_to_hdf5_file( tFileID, "Basis_Owners" + tSuffix, mBasisOwners( iLocalOrder ).data(), tStatus );
+            save_vector_to_hdf5_file( tFileID, "Basis_Indices" + tSuffix, mBasisIndices( iLocalOrder ).data(), tStatus );
+        }
+
+        // cell data, vertex pointers are stored as vertex indices
+        moris::Cell< moris_index > tCellToVertexIndices( mCellToVertices.size() );
+
+        for ( uint iEntry = 0; iEntry < mCellToVertices.size(); iEntry++ )
+        {
+            tCellToVertexIndices( iEntry ) = mCellToVertices( iEntry )->get_index();
+        }
+
+        save_vector_to_hdf5_file( tFileID, "Cell_To_Vertex_Offsets", mCellToVertexOffSet.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "Cell_To_Vertex_Indices", tCellToVertexIndices.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "Cell_IDs", mCellIdList.data(), tStatus );
+        save_vector_to_hdf5_file( tFileID, "Cell_Owners", mCellOwnerList.data(), tStatus );
+
+        MORIS_ERROR( mCellInfo != nullptr, "Interpolation_Mesh_DataBase_IP::save_to_hdf5() - mesh has no cell info" );
+
+        save_scalar_to_hdf5_file( tFileID, "Cell_Geometry", (uint)mCellInfo->get_cell_geometry(), tStatus );
+        save_scalar_to_hdf5_file( tFileID, "Cell_Interpolation_Order", (uint)mCellInfo->get_cell_interpolation_order(), tStatus );
+
+        // communication table and adof maps of all B-spline meshes
+        save_matrix_to_hdf5_file( tFileID, "Communication_Table", mCommunicationTable, tStatus );
+
+        save_scalar_to_hdf5_file( tFileID, "Num_Adof_Maps", (uint)mAdofMap.size(), tStatus );
+
+        for ( uint iBSpline = 0; iBSpline < mAdofMap.size(); iBSpline++ )
+        {
+            std::vector< moris_id >    tKeys;
+            std::vector< moris_index > tValues;
+
+            tKeys.reserve( mAdofMap( iBSpline ).size() );
+            tValues.reserve( mAdofMap( iBSpline ).size() );
+
+            for ( const auto& iPair : mAdofMap( iBSpline ) )
+            {
+                tKeys.push_back( iPair.first );
+                tValues.push_back( iPair.second );
+            }
+
+            std::string tSuffix = "_" + std::to_string( iBSpline );
+
+            save_vector_to_hdf5_file( tFileID, "Adof_Map_Keys" + tSuffix, tKeys, tStatus );
+            save_vector_to_hdf5_file( tFileID, "Adof_Map_Values" + tSuffix, tValues, tStatus );
+        }
+
+        MORIS_ERROR( tStatus == 0,
+                "Interpolation_Mesh_DataBase_IP::save_to_hdf5() - HDF5 writer returned status %i.",
+                tStatus );
+
+        close_hdf5_file( tFileID );
+    }
+
+    // ----------------------------------------------------------------------------
+
+    void
+    Interpolation_Mesh_DataBase_IP::load_from_hdf5( const std::string& aFilePath )
+    {
+        Tracer tTracer( "MTK", "IP mesh", "Load snapshot" );
+
+        MORIS_ERROR( mVertices.size() == 0 and mCells.size() == 0,
+                "Interpolation_Mesh_DataBase_IP::load_from_hdf5() - mesh has already been built" );
+
+        MORIS_LOG_INFO( "Loading interpolation mesh snapshot from file: %s", aFilePath.c_str() );
+
+        hid_t  tFileID = open_hdf5_file( aFilePath );
+        herr_t tStatus = 0;
+
+        // vertex data
+        load_scalar_from_hdf5_file( tFileID, "Spatial_Dimension", mSpatilDim, tStatus );
+        load_matrix_from_hdf5_file( tFileID, "Vertex_Coordinates", mVertexCoordinates, tStatus );
+        load_vector_from_hdf5_file( tFileID, "Vertex_IDs", mVertexIdList.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "Vertex_Owners", mVertexOwnerList.data(), tStatus );
+
+        uint tNumVertices = mVertexCoordinates.n_cols();
+
+        MORIS_ERROR( mVertexIdList.size() == tNumVertices and mVertexOwnerList.size() == tNumVertices
+                             and mVertexCoordinates.n_rows() == mSpatilDim,
+                "Interpolation_Mesh_DataBase_IP::load_from_hdf5() - vertex data in file %s is inconsistent",
+                aFilePath.c_str() );
+
+        // T-matrices of all enriched B-spline meshes
+        load_matrix_from_hdf5_file( tFileID, "Mesh_Indices", mMeshIndices, tStatus );
+
+        uint tNumLocalInterpolations = mMeshIndices.numel();
+
+        mOffSetTMatrix.resize( tNumLocalInterpolations );
+        mWeights.resize( tNumLocalInterpolations );
+        mBasisIds.resize( tNumLocalInterpolations );
+        mBasisOwners.resize( tNumLocalInterpolations );
+        mBasisIndices.resize( tNumLocalInterpolations );
+
+        for ( uint iLocalOrder = 0; iLocalOrder < tNumLocalInterpolations; iLocalOrder++ )
+        {
+            mGlobalMeshIndexToLocalMeshIndex[ mMeshIndices( iLocalOrder ) ] = iLocalOrder;
+
+            std::string tSuffix = "_" + std::to_string( iLocalOrder );
+
+            load_vector_from_hdf5_file( tFileID, "TMatrix_Offsets" + tSuffix, mOffSetTMatrix( iLocalOrder ).data(), tStatus );
+            load_vector_from_hdf5_file( tFileID, "TMatrix_Weights" + tSuffix, mWeights( iLocalOrder ).data(), tStatus );
+            load_vector_from_hdf5_file( tFileID, "Basis_IDs" + tSuffix, mBasisIds( iLocalOrder ).data(), tStatus );
+            load_vector_from_hdf5_file( tFileID, "Basis_Owners" + tSuffix, mBasisOwners( iLocalOrder ).data(), tStatus );
+            load_vector_from_hdf5_file( tFileID, "Basis_Indices" + tSuffix, mBasisIndices( iLocalOrder ).data(), tStatus );
+
+            MORIS_ERROR( mOffSetTMatrix( iLocalOrder ).size() == tNumVertices + 1
+                                 and mOffSetTMatrix( iLocalOrder )( tNumVertices ) == mWeights( iLocalOrder ).size(),
+                    "Interpolation_Mesh_DataBase_IP::load_from_hdf5() - T-matrix data of B-spline mesh %i is inconsistent",
+                    mMeshIndices( iLocalOrder ) );
+        }
+
+        // create the vertices and their interpolations on top of the raw data
+        mVertices.reserve( tNumVertices );
+        mVertexInterpoltions.resize( tNumLocalInterpolations * tNumVertices );
+        mVertexInterpoltionsPtrs.reserve( tNumLocalInterpolations * tNumVertices );
+        mVertexGlobalIdToLocalIndex.reserve( tNumVertices );
+
+        for ( uint iVertex = 0; iVertex < tNumVertices; iVertex++ )
+        {
+            mVertices.emplace_back( Vertex_DataBase( iVertex, this ) );
+
+            mVertexGlobalIdToLocalIndex[ mVertexIdList( iVertex ) ] = iVertex;
+
+            for ( uint iOrder = 0; iOrder < tNumLocalInterpolations; iOrder++ )
+            {
+                mVertexInterpoltions( tNumLocalInterpolations * iVertex + iOrder ) =
+                        Vertex_Interpolation_DataBase( iVertex, iOrder, this );
+            }
+        }
+
+        for ( auto& iVertexInterpolation : mVertexInterpoltions )
+        {
+            mVertexInterpoltionsPtrs.push_back( &iVertexInterpolation );
+        }
+
+        // cell data
+        moris::Cell< moris_index > tCellToVertexIndices;
+
+        load_vector_from_hdf5_file( tFileID, "Cell_To_Vertex_Offsets", mCellToVertexOffSet.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "Cell_To_Vertex_Indices", tCellToVertexIndices.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "Cell_IDs", mCellIdList.data(), tStatus );
+        load_vector_from_hdf5_file( tFileID, "Cell_Owners", mCellOwnerList.data(), tStatus );
+
+        uint tNumCells = mCellIdList.size();
+
+        MORIS_ERROR( mCellToVertexOffSet.size() == tNumCells + 1 and mCellOwnerList.size() == tNumCells,
+                "Interpolation_Mesh_DataBase_IP::load_from_hdf5() - cell data in file %s is inconsistent",
+                aFilePath.c_str() );
+
+        mCellToVertices.reserve( tCellToVertexIndices.size() );
+
+        for ( const moris_index& iVertex : tCellToVertexIndices )
+        {
+            mCellToVertices.push_back( &mVertices( iVertex ) );
+        }
+
+        uint tGeometry    = 0;
+        uint tInterpOrder = 0;
+
+        load_scalar_from_hdf5_file( tFileID, "Cell_Geometry", tGeometry, tStatus );
+        load_scalar_from_hdf5_file( tFileID, "Cell_Interpolation_Order", tInterpOrder, tStatus );
+
+        mtk::Cell_Info_Factory tFactory;
+        mCellInfo = tFactory.create_cell_info_sp( (enum Geometry_Type)tGeometry, (enum Interpolation_Order)tInterpOrder );
+
+        mCells.reserve( tNumCells );
+
+        for ( uint iCell = 0; iCell < tNumCells; iCell++ )
+        {
+            mCells.push_back( Cell_DataBase( mCellIdList( iCell ),
+                    mCellOwnerList( iCell ),
+                    mCellInfo,
+                    iCell,
+                    this ) );
+        }
+
+        // communication table and adof maps of all B-spline meshes
+        load_matrix_from_hdf5_file( tFileID, "Communication_Table", mCommunicationTable, tStatus );
+
+        uint tNumAdofMaps = 0;
+        load_scalar_from_hdf5_file( tFileID, "Num_Adof_Maps", tNumAdofMaps, tStatus );
+
+        mAdofMap.resize( tNumAdofMaps );
+
+        for ( uint iBSpline = 0; iBSpline < tNumAdofMaps; iBSpline++ )
+        {
+            std::vector< moris_id >    tKeys;
+            std::vector< moris_index > tValues;
+
+            std::string tSuffix = "_" + std::to_string( iBSpline );
+
+            load_vector_from_hdf5_file( tFileID, "Adof_Map_Keys" + tSuffix, tKeys, tStatus );
+            load_vector_from_hdf5_file( tFileID, "Adof_Map_Values" + tSuffix, tValues, tStatus );
+
+            for ( uint iEntry = 0; iEntry < tKeys.size(); iEntry++ )
+            {
+                mAdofMap( iBSpline )[ tKeys[ iEntry ] ] = tValues[ iEntry ];
+            }
+        }
+
+        MORIS_ERROR( tStatus == 0,
+                "Interpolation_Mesh_DataBase_IP::load_from_hdf5() - HDF5 reader returned status %i.",
+                tStatus );
+
+        close_hdf5_file( tFileID );
+    }
+
+    // ----------------------------------------------------------------------------
+}    // namespace moris::mtk
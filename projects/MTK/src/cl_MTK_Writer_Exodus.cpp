@@ -132,6 +132,96 @@ namespace moris
 
         //--------------------------------------------------------------------------------------------------------------
 
+        void
+        Writer_Exodus::append_to_mesh_file(
+                std::string        aFilePath,
+                const std::string& aFileName,
+                std::string        aTempPath,
+                const std::string& aTempName )
+        {
+            MORIS_ERROR( mMesh != nullptr, "No mesh has been given to the Exodus Writer!" );
+
+            MORIS_ERROR( mExoID == -1,
+                    "Exodus file is currently open, call close_file() before opening a new one." );
+
+            // set temporary and permanent file names
+            this->set_file_names(
+                    aFilePath,
+                    aFileName,
+                    aTempPath,
+                    aTempName );
+
+            // move permanent file to temporary file while it is open
+            MORIS_ERROR( std::rename( mPermFileName.c_str(), mTempFileName.c_str() ) == 0,
+                    "Cannot reopen exodus file: %s as %s",
+                    mPermFileName.c_str(),
+                    mTempFileName.c_str() );
+
+            this->open_file( mTempFileName, false );
+
+            MORIS_ERROR( mExoID > -1, "Exodus file cannot be opened: %s", mTempFileName.c_str() );
+
+            // restore mesh information; the topology is assumed to be identical to the one stored in the file
+            mNumNodes       = mMesh->get_num_nodes();
+            mNumMtkElements = mMesh->get_num_elems();
+
+            this->get_node_sets();
+            this->get_side_sets();
+            this->get_block_sets();
+
+            // check that the file matches the mesh
+            MORIS_ERROR( ex_inquire_int( mExoID, EX_INQ_NODES ) == (int)mNumNodes
+                                 and ex_inquire_int( mExoID, EX_INQ_ELEM ) == (int)mNumUniqueExodusElements,
+                    "Writer_Exodus::append_to_mesh_file() - Mesh does not match topology stored in %s.",
+                    mPermFileName.c_str() );
+
+            // restore block names map
+            moris::Cell< std::string > tBlockNames = mMesh->get_set_names( EntityRank::ELEMENT );
+
+            for ( uint iBlockIndexInExoMesh = 0; iBlockIndexInExoMesh < mElementBlockIndices.size(); iBlockIndexInExoMesh++ )
+            {
+                mBlockNamesMap[ tBlockNames( mElementBlockIndices( iBlockIndexInExoMesh ) ) ] = iBlockIndexInExoMesh;
+            }
+
+            // restore side set names map and punch card of facets used in exodus mesh
+            moris::Cell< std::string > tSideSetNames = mMesh->get_set_names( mMesh->get_facet_rank() );
+
+            mFacetUsedInExodus.resize( mSideSetIndices.size() );
+
+            for ( uint iSideSetInExoMesh = 0; iSideSetInExoMesh < mSideSetIndices.size(); iSideSetInExoMesh++ )
+            {
+                std::string tSetLabel = tSideSetNames( mSideSetIndices( iSideSetInExoMesh ) );
+
+                mSideSetNamesMap[ tSetLabel ] = iSideSetInExoMesh;
+
+                Matrix< IndexMat > tIgElemIndices;
+                Matrix< IndexMat > tIgElemSideOrdinals;
+                mMesh->get_sideset_elems_loc_inds_and_ords(
+                        tSetLabel,
+                        tIgElemIndices,
+                        tIgElemSideOrdinals );
+
+                mFacetUsedInExodus( iSideSetInExoMesh ).resize( tIgElemIndices.numel(), true );
+
+                for ( uint iIgElemInSideSet = 0; iIgElemInSideSet < tIgElemIndices.numel(); iIgElemInSideSet++ )
+                {
+                    mFacetUsedInExodus( iSideSetInExoMesh )( iIgElemInSideSet ) =
+                            mMtkExodusElementIndexMap( tIgElemIndices( iIgElemInSideSet ) ) != MORIS_INDEX_MAX;
+                }
+            }
+
+            // restore variable names
+            this->read_variable_names( EX_NODAL, mNodalFieldNamesMap );
+            this->read_variable_names( EX_ELEM_BLOCK, mElementalFieldNamesMap );
+            this->read_variable_names( EX_SIDE_SET, mSideSetFieldNamesMap );
+            this->read_variable_names( EX_GLOBAL, mGlobalVariableNamesMap );
+
+            // continue after last time step stored in file
+            mTimeStep = ex_inquire_int( mExoID, EX_INQ_TIME );
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
         void
         Writer_Exodus::write_points(
                 std::string        aFilePath,
@@ -639,6 +729,31 @@ namespace moris
             MORIS_ERROR( mExoID == -1,
                     "Exodus file is currently open, call close_file() before creating a new one." );
 
+            // set temporary and permanent file names
+            this->set_file_names(
+                    aFilePath,
+                    aFileName,
+                    aTempPath,
+                    aTempName );
+
+            // Create the database
+            int cpu_ws = sizeof( real );    // word size in bytes of the floating point variables used in moris
+            int io_ws  = sizeof( real );    // word size as stored in exodus
+
+            mExoID = ex_create( mTempFileName.c_str(), EX_CLOBBER, &cpu_ws, &io_ws );
+
+            MORIS_ERROR( mExoID > -1, "Exodus file cannot be created: %s", mTempFileName.c_str() );
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void
+        Writer_Exodus::set_file_names(
+                std::string        aFilePath,
+                const std::string& aFileName,
+                std::string        aTempPath,
+                const std::string& aTempName )
+        {
             // Add temporary and permanent file names to file paths
             if ( !aFilePath.empty() )
             {
@@ -668,14 +783,30 @@ namespace moris
                 mTempFileName += "." + tParSizeStr + "." + tParRankStr;
                 mPermFileName += "." + tParSizeStr + "." + tParRankStr;
             }
+        }
 
-            // Create the database
-            int cpu_ws = sizeof( real );    // word size in bytes of the floating point variables used in moris
-            int io_ws  = sizeof( real );    // word size as stored in exodus
+        //--------------------------------------------------------------------------------------------------------------
 
-            mExoID = ex_create( mTempFileName.c_str(), EX_CLOBBER, &cpu_ws, &io_ws );
+        void
+        Writer_Exodus::read_variable_names(
+                ex_entity_type                  aVariableType,
+                moris::map< std::string, int >& aNamesMap )
+        {
+            aNamesMap.clear();
 
-            MORIS_ERROR( mExoID > -1, "Exodus file cannot be created: %s", mTempFileName.c_str() );
+            // get number of variables of this type stored in file
+            int tNumVariables = 0;
+            ex_get_variable_param( mExoID, aVariableType, &tNumVariables );
+
+            // read names and store them as map
+            for ( int tVariableIndex = 0; tVariableIndex < tNumVariables; tVariableIndex++ )
+            {
+                char tName[ MAX_STR_LENGTH + 1 ];
+
+                ex_get_variable_name( mExoID, aVariableType, tVariableIndex + 1, tName );
+
+                aNamesMap[ std::string( tName ) ] = tVariableIndex;
+            }
         }
 
         //--------------------------------------------------------------------------------------------------------------
@@ -170,6 +170,25 @@ namespace moris
                     const std::string& aTempName );
 
             //------------------------------------------------------------------------------
+
+            /**
+             * Reopens an Exodus file previously written by write_mesh() for the same mesh topology and
+             * restores the writer state, such that further time steps and fields can be appended
+             * without writing the mesh again. The file is moved to the temporary file name while it is
+             * open and renamed back by close_file().
+             *
+             * @param aFilePath The path of the final file
+             * @param aFileName The name of the final file
+             * @param aTempPath The path of the temporary file
+             * @param aTempName The name of a temporary file
+             */
+            void append_to_mesh_file(
+                    std::string        aFilePath,
+                    const std::string& aFileName,
+                    std::string        aTempPath,
+                    const std::string& aTempName );
+
+            //------------------------------------------------------------------------------
             
             /**
              * Save temporary to permanent Exodus file.
@@ -319,6 +338,34 @@ namespace moris
           private:
             
             //------------------------------------------------------------------------------
+            /**
+             * Sets the temporary and permanent file names, adds the processor extension if running in parallel
+             *
+             * @param aFilePath The path of the final file
+             * @param aFileName The name of the final file
+             * @param aTempPath The path of the temporary file
+             * @param aTempName The name of a temporary file
+             */
+            void set_file_names(
+                    std::string        aFilePath,
+                    const std::string& aFileName,
+                    std::string        aTempPath,
+                    const std::string& aTempName );
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * Reads the names of the variables of a given type from the open Exodus file into a name map
+             *
+             * @param aVariableType Exodus type of the variables
+             * @param aNamesMap map from variable name to variable index
+             */
+            void read_variable_names(
+                    ex_entity_type                  aVariableType,
+                    moris::map< std::string, int >& aNamesMap );
+
+            //------------------------------------------------------------------------------
+
             /**
              * Creates an Exodus database at the given file path and string
              *
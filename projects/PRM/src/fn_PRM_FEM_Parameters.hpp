@@ -42,6 +42,7 @@ namespace moris
             tParameterList.insert( "dof_dependencies", "" );
             tParameterList.insert( "dv_dependencies", "" );
             tParameterList.insert( "field_dependencies", "" );
+            tParameterList.insert( "time_dependent", true );    // false if the value function is constant in time
 
             return tParameterList;
         }
@@ -307,6 +308,14 @@ namespace moris
             // enum for finite difference perturbation strategy (relative, absolute)
             tParameterList.insert( "finite_difference_perturbation_strategy", (uint)( fem::Perturbation_Type::RELATIVE ) );
 
+            // bool true for evaluating all integration points of an element at once,
+            // only used if supported by all IWGs on a set and not for staggered solves
+            tParameterList.insert( "use_batched_evaluation", false );
+
+            // bool true for reusing the element matrices of sets on which all IWGs are linear in the dofs,
+            // requires the properties on these sets to be independent of time
+            tParameterList.insert( "cache_linear_element_matrices", false );
+
             return tParameterList;
         }
 
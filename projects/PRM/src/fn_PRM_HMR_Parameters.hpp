@@ -36,6 +36,12 @@ namespace moris
             // User defined processor grid.  Decomp method must = 0.  Product of array must match number of processors used
             tParameterList.insert( "processor_dimensions", "2, 2" );
 
+            // rebalance coarsest elements over the proc grid after refinement, weighted by active elements
+            tParameterList.insert( "use_load_balancing", false );
+
+            // rebalance if max / mean number of active elements per proc exceeds this value
+            tParameterList.insert( "load_balancing_tolerance", 1.1 );
+
             // width, height and depth of domain (without aura)
             tParameterList.insert( "domain_dimensions", "1, 1" );
             // offset from the origin
@@ -105,6 +111,9 @@ namespace moris
             // name of restart file - load
             tParameterList.insert( "restart_refinement_pattern_file", "" );
 
+            // write and read restart files as one file shared by all procs (MPI-IO)
+            tParameterList.insert( "use_shared_hdf5_file", false );
+
             // name of vtk file for writing basis function locations
             tParameterList.insert( "basis_function_vtk_file", "" );
 
@@ -68,6 +68,9 @@ namespace moris
             // General MSI parameters
             mMSIParameterList.insert( "order_adofs_by_host", false );
 
+            // reordering of owned adofs to reduce matrix bandwidth: "" (none) or "rcm" (reverse Cuthill-McKee)
+            mMSIParameterList.insert( "adof_ordering", "" );
+
             mMSIParameterList.insert( "msi_checker", false );
 
             // Number of eigen vectors
@@ -34,6 +34,16 @@ namespace moris
             // save operator to matlab file
             tSolverWarehouseList.insert( "SOL_save_operator_to_matlab", std::string( "" ) );
 
+            // apply the Jacobian element by element instead of assembling it. Preconditioners are
+            // built from the assembled diagonal. Epetra only
+            tSolverWarehouseList.insert( "SOL_matrix_free", false );
+
+            // store the element Jacobians of the matrix-free operator for all Krylov iterations of a Newton step.
+            // Needs several times the memory of the assembled matrix for high order B-splines (cubic 3D: 64^2 values
+            // per element and field vs. about 343 entries per row). Otherwise the operator is applied by directional
+            // finite differences of the element residuals, which only stores one residual per element
+            tSolverWarehouseList.insert( "SOL_matrix_free_store_element_matrices", false );
+
             // save final solution vector to file
             tSolverWarehouseList.insert( "SOL_save_final_sol_vec_to_file", std::string( "" ) );
 
@@ -174,6 +184,10 @@ namespace moris
 
             // Reuse of preconditioner
             aParameterlist.insert( "prec_reuse", false );
+
+            // store and apply preconditioner in single precision, Krylov solver stays in double precision.
+            // Only for ifpack ILU
+            aParameterlist.insert( "prec_single_precision", false );
         }
 
         //------------------------------------------------------------------------------
@@ -255,6 +269,10 @@ namespace moris
 
             // Reuse of preconditioner
             aParameterlist.insert( "prec_reuse", false );
+
+            // store and apply preconditioner in single precision, Krylov solver stays in double precision.
+            // Only for ifpack ILU
+            aParameterlist.insert( "prec_single_precision", false );
         }
 
         // //------------------------------------------------------------------------------
@@ -313,6 +331,11 @@ namespace moris
             // Update flag for vismesh
             mEigAlgoParameterList.insert( "Update_Flag", true );
 
+            // Warm start flag: eigenvectors of previous solve are initial vectors of next solve, e.g. in optimization.
+            // The preconditioner is only kept for repeated solves of the same linear system (recomputed if prec_reuse is set);
+            // the model rebuilds the linear system for every design, thus the preconditioner is rebuilt for every design.
+            mEigAlgoParameterList.insert( "Warm_Start", false );
+
             // add parameters from ifpack preconditioner
             create_ifpack_preconditioner_parameterlist( mEigAlgoParameterList );
 
@@ -521,6 +544,10 @@ namespace moris
             // set convergence criteria
             tLinAlgorithmParameterList.insert( "Convergence Tolerance", 1e-08 );
 
+            // size of recycle space of Recycling GMRES and Recycling CG. The recycle space is kept
+            // across solves, e.g. Newton iterations and time steps, as long as the system size does not change
+            tLinAlgorithmParameterList.insert( "Num Recycled Blocks", INT_MAX );
+
             // left or right preconditioner
             tLinAlgorithmParameterList.insert( "Left-right Preconditioner", "left" );
 
@@ -734,6 +761,17 @@ namespace moris
             // Determines if linear solve should restart on fail
             tNonLinAlgorithmParameterList.insert( "NLA_combined_res_jac_assembly", true );
 
+            // Jacobian-free Newton-Krylov: Jacobian-vector products by finite differences of the residual,
+            // the assembled Jacobian is only used for the preconditioner. Epetra based iterative solvers only
+            tNonLinAlgorithmParameterList.insert( "NLA_jacobian_free", false );
+
+            // Jacobian-free Newton-Krylov: number of iterations after which the preconditioning Jacobian is rebuilt
+            tNonLinAlgorithmParameterList.insert( "NLA_jacobian_free_rebuild_frequency", 5 );
+
+            // Jacobian-free Newton-Krylov: preconditioning Jacobian is rebuilt if the residual norm
+            // decreases by less than this factor per iteration
+            tNonLinAlgorithmParameterList.insert( "NLA_jacobian_free_stagnation_ratio", 0.5 );
+
             // Determines if Newton should restart on fail
             tNonLinAlgorithmParameterList.insert( "NLA_rebuild_nonlin_solv_on_fail", false );
 
@@ -795,6 +833,27 @@ namespace moris
             // Time Frame
             tTimeAlgorithmParameterList.insert( "TSA_Time_Frame", 1.0 );
 
+            // Number of time step solutions kept as checkpoints for the adjoint solve,
+            // the solutions in between are recomputed. 0: keep the solutions of all time steps
+            tTimeAlgorithmParameterList.insert( "TSA_Num_Checkpoints", 0 );
+
+            // File name for storing checkpoints on the local disk instead of in memory, e.g. "./checkpoint.hdf5"
+            tTimeAlgorithmParameterList.insert( "TSA_Checkpoint_File", "" );
+
+            // Adaptive time stepping, TSA_Num_Time_Steps defines the initial time step size.
+            // The time step error is estimated by the difference of the solution and its linear extrapolation
+            tTimeAlgorithmParameterList.insert( "TSA_Adaptive_Time_Stepping", false );
+
+            // Relative tolerance for the estimated time step error
+            tTimeAlgorithmParameterList.insert( "TSA_Time_Step_Tolerance", 1.0e-3 );
+
+            // Minimal and maximal time step size for adaptive time stepping, 0.0: no limit
+            tTimeAlgorithmParameterList.insert( "TSA_Min_Time_Step", 0.0 );
+            tTimeAlgorithmParameterList.insert( "TSA_Max_Time_Step", 0.0 );
+
+            // Maximal number of consecutive rejections of a time step before the solve is aborted
+            tTimeAlgorithmParameterList.insert( "TSA_Max_Rejected_Time_Steps", 20 );
+
             return tTimeAlgorithmParameterList;
         }
 
@@ -38,6 +38,7 @@ namespace moris
             mVISParameterList.insert( "Field_Names"    , "" );
             mVISParameterList.insert( "Field_Type"     , "" );
             mVISParameterList.insert( "IQI_Names"      , "" );
+            mVISParameterList.insert( "Reuse_Topology" , false );
 
             return mVISParameterList;
         }
@@ -43,6 +43,7 @@ namespace moris
             tParameterList.insert( "enrich_mesh_indices", "0" );
             tParameterList.insert( "sort_basis_enrichment_levels", false );
             tParameterList.insert( "unenriched_mesh_indices", "" );
+            tParameterList.insert( "enrichment_threads", 1 );    // threads for the computations local to a basis support
 
             // ghost stabilization and ghost related parameters
             tParameterList.insert( "ghost_stab", false );         // Perform ghost stabilization
@@ -109,6 +110,10 @@ namespace moris
             // write Cut_Integration_Mesh
             tParameterList.insert( "output_cut_ig_mesh", false );
 
+            // number of threads used for the local flood fills of the intersected background cells in the subphase
+            // identification, all other decomposition steps are serial
+            tParameterList.insert( "flood_fill_threads", 1 );
+
             // write Intersection_Mesh
             tParameterList.insert( "output_intersection_mesh", false );
 
@@ -136,6 +141,13 @@ namespace moris
 
             tParameterList.insert( "delete_xtk_after_generation", true );
 
+            // path of a per-proc snapshot of the data base ip and ig meshes, written after generation ( "" = no snapshot )
+            tParameterList.insert( "database_snapshot_file", "" );
+
+            // load the data base meshes from database_snapshot_file instead of running HMR, GEN and XTK, the geometry must be
+            // unchanged; only for a single design without shape sensitivities
+            tParameterList.insert( "load_database_snapshot", false );
+
             tParameterList.insert( "activate_basis_agglomeration", false );
             tParameterList.insert( "volume_fraction", 1.0 );    // by default all the cut cells are considered bad
             tParameterList.insert( "activate_cell_agglomeration", false );
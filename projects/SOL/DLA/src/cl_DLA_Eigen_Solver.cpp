@@ -17,6 +17,7 @@
 #include "cl_SOL_Enums.hpp"
 
 // C++ system files
+#include <algorithm>
 #include <cstddef>
 #include "typedefs.hpp"
 #include "cl_Communication_Tools.hpp"
@@ -146,6 +147,9 @@ Eigen_Solver::solve_linear_system(
         Linear_Problem*   aLinearSystem,
         const moris::sint aIter )
 {
+    MORIS_ERROR( !aLinearSystem->is_matrix_free(),
+            "Eigen_Solver::solve_linear_system - eigen solvers require an assembled matrix, SOL_matrix_free must be false." );
+
     // get stiffness matrix of class Epetra_FECrs
     mMat = aLinearSystem->get_matrix()->get_matrix();
 
@@ -155,35 +159,65 @@ Eigen_Solver::solve_linear_system(
     // get stiffness matrix of distributed matrix type
     mNewMat = aLinearSystem->get_matrix();
 
+    // warm start with eigenvectors of previous solve, e.g. of previous optimization iteration, if the map has not changed;
+    // the eigenvectors are handed over to the solver of the next design by the solver warehouse
+    bool tWarmStart = mParameterList.get< bool >( "Warm_Start" )
+                   && !mWarmStart->mEigenVectors.is_null()
+                   && mWarmStart->mEigenVectors->Map().SameAs( mMat->OperatorDomainMap() );
+
+    if ( !tWarmStart )
+    {
+        mWarmStart->mEigenVectors = Teuchos::null;
+    }
+
+    // preconditioner is kept if the linear system has not changed; it is recomputed if prec_reuse is set and rebuilt otherwise.
+    // Only the eigenvectors are handed over across designs: the model builds a new linear system for every design,
+    // thus the preconditioner is initialized again for each design.
+    mSolveIter = ( tWarmStart && aLinearSystem == mLinearSystem ) ? mSolveIter + 1 : 1;
+
+    mLinearSystem = aLinearSystem;
+
+    MORIS_LOG_SPEC( "EigenSolverWarmStart", tWarmStart );
+
     // request type of eigen solver algorithm from parameterlist
     std::string tEigAlgType =
             mParameterList.get< std::string >( "Eigen_Algorithm" );
 
+    int tStatus = 0;
+
     if ( tEigAlgType == "EIGALG_BLOCK_DAVIDSON" )
     {
         // set block davidson method as eigen solver algorithm
-        return this->solve_block_davidson_system( aLinearSystem );
+        tStatus = this->solve_block_davidson_system( aLinearSystem );
     }
     else if ( tEigAlgType == "EIGALG_GENERALIZED_DAVIDSON" )
     {
         // set generalized davidson method as eigen solver algorithm
-        return this->solve_generalized_davidson_system( aLinearSystem );
+        tStatus = this->solve_generalized_davidson_system( aLinearSystem );
     }
     else if ( tEigAlgType == "EIGALG_BLOCK_KRYLOV_SCHUR" )
     {
         // set block krylov schur method as eigen solver algorithm
-        return this->solve_block_krylov_schur_system( aLinearSystem );
+        tStatus = this->solve_block_krylov_schur_system( aLinearSystem );
     }
     else if ( tEigAlgType == "EIGALG_BLOCK_KRYLOV_SCHUR_AMESOS" )
     {
         // set block krylov schur (amesos) method as eigen solver algorithm
-        return this->solve_block_krylov_schur_amesos_system( aLinearSystem );
+        tStatus = this->solve_block_krylov_schur_amesos_system( aLinearSystem );
     }
     else
     {
         MORIS_ERROR( false, "Wrong Eigensolver algorithm specified!\n" );
         return 0;
     }
+
+    // keep eigenvectors as initial vectors of next solve
+    if ( mParameterList.get< bool >( "Warm_Start" ) && tStatus == 0 && mSol.numVecs > 0 )
+    {
+        mWarmStart->mEigenVectors = Teuchos::rcp( new Epetra_MultiVector( *mSol.Evecs ) );
+    }
+
+    return tStatus;
 }
 
 // ----------------------------------------------------------------------------
@@ -213,6 +247,7 @@ Eigen_Solver::build_linearized_system()
     mMap = mNewMat->get_map();
 
     // create eigen solver vector of Vector_Epetra class
+    delete mFreeSolVec;
     mFreeSolVec = new Vector_Epetra( mMap, 1, true, false );
 
     // Make sure that the number of blocks and eigenvalues does not exceed NumFreeDofs
@@ -223,7 +258,7 @@ Eigen_Solver::build_linearized_system()
 
     // Create initial vector for the solver
     mIvec = Teuchos::RCP( new Epetra_MultiVector( mSPmat->OperatorDomainMap(), tBlockSize ) );
-    mIvec->Random();
+    this->set_initial_vectors();
 
     // Create the eigenproblem, except if the algorithm used is BLOCK_KRYLOV_SCHUR or EIGALG_BLOCK_KRYLOV_SCHUR_AMESOS
     // as they build their eigenproblems later locally
@@ -241,6 +276,27 @@ Eigen_Solver::build_linearized_system()
 
 // -----------------------------------------------------------------------------
 
+void
+Eigen_Solver::set_initial_vectors()
+{
+    mIvec->Random();
+
+    if ( mWarmStart->mEigenVectors.is_null() )
+    {
+        return;
+    }
+
+    // copy as many eigenvectors of previous solve as fit into the block
+    int tNumVecs = std::min( mWarmStart->mEigenVectors->NumVectors(), mIvec->NumVectors() );
+
+    for ( int iVec = 0; iVec < tNumVecs; iVec++ )
+    {
+        ( *mIvec )( iVec )->Update( 1.0, *( *mWarmStart->mEigenVectors )( iVec ), 0.0 );
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 void
 Eigen_Solver::set_eigen_solver_manager_parameters()
 {
@@ -263,8 +319,11 @@ Eigen_Solver::solve_block_davidson_system( Linear_Problem* aLinearSystem )
     Teuchos::RCP< Ifpack_Preconditioner >               tIfpackPrec;
     Teuchos::RCP< ML_Epetra::MultiLevelPreconditioner > tMlPrec;
 
-    // initialize preconditioner
-    mPrec.initialize( mParameterList, aLinearSystem );
+    // initialize preconditioner unless it is kept from previous solve
+    if ( mSolveIter == 1 )
+    {
+        mPrec.initialize( mParameterList, aLinearSystem );
+    }
 
     // request ifpack type preconditioner as a string
     std::string tIfpackPrectype = mParameterList.get< std::string >( "ifpack_prec_type" );
@@ -288,7 +347,7 @@ Eigen_Solver::solve_block_davidson_system( Linear_Problem* aLinearSystem )
     {
         MORIS_ERROR( false, "Incorrect preconditioner type" );
     }
-    mPrec.build();
+    mPrec.build( mSolveIter );
 
     // get ifpack preconditioner if it exists
     tIfpackPrec = mPrec.get_ifpack_prec();
@@ -360,6 +419,10 @@ Eigen_Solver::solve_block_davidson_system( Linear_Problem* aLinearSystem )
     // Solve the problem
     Anasazi::ReturnType tReturnCode = MySolverMan.solve();
 
+    // number of iterations, used to judge warm starts
+    mSolNumIters = MySolverMan.getNumIters();
+    MORIS_LOG_SPEC( "EigenSolverIterations", mSolNumIters );
+
     // Check if the problem solve converged
     if ( tReturnCode != Anasazi::Converged && MyPID == 0 )
     {
@@ -526,8 +589,11 @@ Eigen_Solver::solve_generalized_davidson_system( Linear_Problem* aLinearSystem )
     Teuchos::RCP< Ifpack_Preconditioner >               tIfpackPrec;
     Teuchos::RCP< ML_Epetra::MultiLevelPreconditioner > tMlPrec;
 
-    // initialize preconditioner
-    mPrec.initialize( mParameterList, aLinearSystem );
+    // initialize preconditioner unless it is kept from previous solve
+    if ( mSolveIter == 1 )
+    {
+        mPrec.initialize( mParameterList, aLinearSystem );
+    }
 
     // request ifpack type preconditioner as a string
     std::string tIfpackPrectype = mParameterList.get< std::string >( "ifpack_prec_type" );
@@ -551,7 +617,7 @@ Eigen_Solver::solve_generalized_davidson_system( Linear_Problem* aLinearSystem )
     {
         MORIS_ERROR( false, "Incorrect preconditioner type" );
     }
-    mPrec.build();
+    mPrec.build( mSolveIter );
 
     // get ifpack preconditioner if it exists
     tIfpackPrec = mPrec.get_ifpack_prec();
@@ -589,6 +655,9 @@ Eigen_Solver::solve_generalized_davidson_system( Linear_Problem* aLinearSystem )
     // loop over increasing convergence tolerances until converged solution found
     real tTolConv = mParameterList.get< moris::real >( "Convergence_Tolerance" );
 
+    // number of iterations summed over all tolerances, used to judge warm starts
+    mSolNumIters = 0;
+
     for ( uint iconv = 0; iconv < 5; ++iconv )
     {
         // Set required relative convergence
@@ -605,6 +674,8 @@ Eigen_Solver::solve_generalized_davidson_system( Linear_Problem* aLinearSystem )
         // Solve the problem to the specified tolerances or length
         Anasazi::ReturnType tReturnCode = MySolverMgr.solve();
 
+        mSolNumIters += MySolverMgr.getNumIters();
+
         // Get number of converged eigen vectors
         mSol = mMyEigProblem->getSolution();
 
@@ -625,6 +696,8 @@ Eigen_Solver::solve_generalized_davidson_system( Linear_Problem* aLinearSystem )
         tTolConv *= 10.0;
     }
 
+    MORIS_LOG_SPEC( "EigenSolverIterations", mSolNumIters );
+
     // Get the eigenvalues and eigenvectors from the eigenproblem
     mSol                                          = mMyEigProblem->getSolution();
     std::vector< Anasazi::Value< double > > evals = mSol.Evals;
@@ -799,13 +872,19 @@ Eigen_Solver::solve_block_krylov_schur_system( Linear_Problem* aLinearSystem )
 
     int MyPID = par_rank();
 
+    // build linear system
+    this->build_linearized_system();
+
     // Set the preconditioner
     Teuchos::RCP< Epetra_Operator >                     tPrecOp;
     Teuchos::RCP< Ifpack_Preconditioner >               tIfpackPrec;
     Teuchos::RCP< ML_Epetra::MultiLevelPreconditioner > tMlPrec;
 
-    // initialize preconditioner
-    mPrec.initialize( mParameterList, aLinearSystem );
+    // initialize preconditioner unless it is kept from previous solve
+    if ( mSolveIter == 1 )
+    {
+        mPrec.initialize( mParameterList, aLinearSystem );
+    }
 
     // request ifpack type preconditioner as a string
     std::string tIfpackPrectype = mParameterList.get< std::string >( "ifpack_prec_type" );
@@ -831,7 +910,7 @@ Eigen_Solver::solve_block_krylov_schur_system( Linear_Problem* aLinearSystem )
     }
 
     // build preconditioner
-    mPrec.build();
+    mPrec.build( mSolveIter );
 
     // get ifpack preconditioner if it exists
     tIfpackPrec = mPrec.get_ifpack_prec();
@@ -938,6 +1017,10 @@ Eigen_Solver::solve_block_krylov_schur_system( Linear_Problem* aLinearSystem )
     // Solve the problem
     Anasazi::ReturnType tReturnCode = MySolverMan.solve();
 
+    // number of iterations, used to judge warm starts
+    mSolNumIters = MySolverMan.getNumIters();
+    MORIS_LOG_SPEC( "EigenSolverIterations", mSolNumIters );
+
     // Check if the problem solve converged
     if ( tReturnCode != Anasazi::Converged && MyPID == 0 )
     {
@@ -1069,6 +1152,9 @@ Eigen_Solver::solve_block_krylov_schur_amesos_system( Linear_Problem* aLinearSys
 
     int MyPID = par_rank();
 
+    // build linear system
+    this->build_linearized_system();
+
     // Tell the linear problem about the mass matrix M
     mEpetraProblem.SetOperator( mSPmassmat.getRawPtr() );
 
@@ -1181,6 +1267,10 @@ Eigen_Solver::solve_block_krylov_schur_amesos_system( Linear_Problem* aLinearSys
     // Solve the problem
     Anasazi::ReturnType tReturnCode = MySolverMan.solve();
 
+    // number of iterations, used to judge warm starts
+    mSolNumIters = MySolverMan.getNumIters();
+    MORIS_LOG_SPEC( "EigenSolverIterations", mSolNumIters );
+
     // Check if the problem solve converged
     if ( tReturnCode != Anasazi::Converged && MyPID == 0 )
     {
@@ -65,6 +65,19 @@ namespace moris
     namespace dla
     {
         class Linear_Problem;
+
+        //-----------------------------------------------------------------------
+        /**
+         * @brief eigenvectors of the previous solve of an eigen solver; shared with the solver warehouse
+         * and the model such that a warm start survives the rebuild of the solvers for a new design
+         */
+        struct Eigen_Solver_Warm_Start
+        {
+            Teuchos::RCP< Epetra_MultiVector > mEigenVectors;
+        };
+
+        //-----------------------------------------------------------------------
+
         class Eigen_Solver : public Linear_Solver_Algorithm
         {
           private:
@@ -107,6 +120,23 @@ namespace moris
 
             Epetra_LinearProblem mEpetraProblem;
 
+            // Eigenvectors of the previous solve, used as initial vectors of the next solve if Warm_Start is set
+            std::shared_ptr< Eigen_Solver_Warm_Start > mWarmStart = std::make_shared< Eigen_Solver_Warm_Start >();
+
+            // Linear system of the previous solve
+            Linear_Problem* mLinearSystem = nullptr;
+
+            // Number of consecutive warm started solves with the same preconditioner, 1 if preconditioner is initialized
+            sint mSolveIter = 0;
+
+            //-----------------------------------------------------------------------
+            /**
+             * @brief fills initial vectors with eigenvectors of the previous solve if warm started,
+             * remaining vectors are random
+             */
+
+            void set_initial_vectors();
+
           public:
             //-----------------------------------------------------------------------
             /**
@@ -220,6 +250,28 @@ namespace moris
                 return mFreeSolVec;
             }
 
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * @brief sets the warm start of a previous eigen solver, e.g. of the previous optimization iteration
+             */
+
+            void
+            set_warm_start( std::shared_ptr< Eigen_Solver_Warm_Start > aWarmStart )
+            {
+                mWarmStart = aWarmStart;
+            }
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * @brief returns the warm start holding the eigenvectors of the last solve
+             */
+
+            std::shared_ptr< Eigen_Solver_Warm_Start >
+            get_warm_start()
+            {
+                return mWarmStart;
+            }
+
             //-------------------------------------------------------------------------------------------------
             /**
              * @brief return eigenvalues
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Jacobian_Free_Operator_Epetra.cpp
+ *
+ */
+
+#include <cmath>
+
+#include "cl_DLA_Jacobian_Free_Operator_Epetra.hpp"
+#include "cl_DLA_Solver_Interface.hpp"
+#include "cl_SOL_Dist_Map.hpp"
+#include "cl_SOL_Matrix_Vector_Factory.hpp"
+#include "cl_Vector_Epetra.hpp"
+
+// detailed logging package
+#include "cl_Tracer.hpp"
+
+using namespace moris;
+using namespace dla;
+
+//----------------------------------------------------------------------------------------
+
+Jacobian_Free_Operator_Epetra::Jacobian_Free_Operator_Epetra(
+        Solver_Interface* aSolverInterface,
+        sol::Dist_Vector* aResidual )
+        : mSolverInterface( aSolverInterface )
+        , mResidual( aResidual )
+        , mPointMap( aResidual->get_map()->get_epetra_point_map() )
+{
+    sol::Matrix_Vector_Factory tMatFactory( sol::MapType::Epetra );
+
+    mPointDirection    = tMatFactory.create_vector( aSolverInterface, aResidual->get_map(), 1, true );
+    mFreeDirection     = tMatFactory.create_vector( aSolverInterface, aResidual->get_map(), 1 );
+    mPerturbedResidual = tMatFactory.create_vector( aSolverInterface, aResidual->get_map(), 1, true );
+}
+
+//----------------------------------------------------------------------------------------
+
+Jacobian_Free_Operator_Epetra::~Jacobian_Free_Operator_Epetra()
+{
+    delete mPointDirection;
+    delete mFreeDirection;
+    delete mFullDirection;
+    delete mPerturbedResidual;
+    delete mSolutionCopy;
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Jacobian_Free_Operator_Epetra::set_solution_vector( sol::Dist_Vector* aSolution )
+{
+    MORIS_ERROR( aSolution->get_num_vectors() == 1,
+            "Jacobian_Free_Operator_Epetra::set_solution_vector - only implemented for a single solution vector." );
+
+    // vectors on full map are rebuilt if the solution vector changes
+    if ( mSolution != aSolution )
+    {
+        delete mFullDirection;
+        delete mSolutionCopy;
+
+        sol::Matrix_Vector_Factory tMatFactory( sol::MapType::Epetra );
+
+        mFullDirection = tMatFactory.create_vector( mSolverInterface, aSolution->get_map(), 1 );
+        mSolutionCopy  = tMatFactory.create_vector( mSolverInterface, aSolution->get_map(), 1 );
+    }
+
+    mSolution = aSolution;
+}
+
+//----------------------------------------------------------------------------------------
+
+int
+Jacobian_Free_Operator_Epetra::Apply(
+        const Epetra_MultiVector& X,
+        Epetra_MultiVector&       Y ) const
+{
+    Tracer tTracer( "LinearProblem", "JacobianFree", "Apply" );
+
+    MORIS_ERROR( mSolution != nullptr,
+            "Jacobian_Free_Operator_Epetra::Apply - solution vector has not been set." );
+
+    Epetra_MultiVector* tPointDirection    = static_cast< Vector_Epetra* >( mPointDirection )->get_epetra_vector();
+    Epetra_MultiVector* tPerturbedResidual = static_cast< Vector_Epetra* >( mPerturbedResidual )->get_epetra_vector();
+    Epetra_MultiVector* tResidual          = static_cast< Vector_Epetra* >( mResidual )->get_epetra_vector();
+
+    // norm of full vector counts shared dofs multiple times, sufficient for the step size
+    real tSolutionNorm = mSolution->vec_norm2()( 0 );
+
+    mSolutionCopy->vec_plus_vec( 1.0, *mSolution, 0.0 );
+
+    for ( int iVec = 0; iVec < X.NumVectors(); iVec++ )
+    {
+        ( *tPointDirection )( 0 )->Update( 1.0, *X( iVec ), 0.0 );
+
+        real tDirectionNorm = mPointDirection->vec_norm2()( 0 );
+
+        if ( tDirectionNorm == 0.0 )
+        {
+            Y( iVec )->PutScalar( 0.0 );
+
+            continue;
+        }
+
+        // step size balancing truncation and round-off error
+        real tStepSize = std::sqrt( ( 1.0 + tSolutionNorm ) * MORIS_REAL_EPS ) / tDirectionNorm;
+
+        // perturb solution, u + h v
+        mFreeDirection->vec_plus_vec( 1.0, *mPointDirection, 0.0 );
+
+        mFullDirection->vec_put_scalar( 0.0 );
+        mFullDirection->import_local_to_global( *mFreeDirection );
+
+        mSolution->vec_plus_vec( tStepSize, *mFullDirection, 1.0 );
+
+        // residual at perturbed solution
+        mPerturbedResidual->vec_put_scalar( 0.0 );
+
+        mSolverInterface->assemble_RHS( mPerturbedResidual );
+
+        // restore solution
+        mSolution->vec_plus_vec( 1.0, *mSolutionCopy, 0.0 );
+
+        // J v = ( R( u + h v ) - R( u ) ) / h
+        Y( iVec )->Update( 1.0 / tStepSize, *( *tPerturbedResidual )( 0 ), -1.0 / tStepSize, *( *tResidual )( 0 ), 0.0 );
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Jacobian_Free_Operator_Epetra.hpp
+ *
+ */
+
+#ifndef SRC_DISTLINALG_CL_DLA_JACOBIAN_FREE_OPERATOR_EPETRA_HPP_
+#define SRC_DISTLINALG_CL_DLA_JACOBIAN_FREE_OPERATOR_EPETRA_HPP_
+
+// TPL header files
+#include "Epetra_Operator.h"
+#include "Epetra_MultiVector.h"
+#include "Epetra_Map.h"
+
+#include "typedefs.hpp"
+
+namespace moris
+{
+    class Solver_Interface;
+
+    namespace sol
+    {
+        class Dist_Vector;
+    }
+
+    namespace dla
+    {
+        /**
+         * Jacobian operator approximated by finite differences of the residual,
+         * J v = ( R( u + h v ) - R( u ) ) / h, such that only residuals are assembled.
+         * R( u ) is the residual of the linear system, i.e. it has to be assembled at u before the solve.
+         */
+        class Jacobian_Free_Operator_Epetra : public virtual Epetra_Operator
+        {
+          private:
+            //! Pointer to solver interface
+            Solver_Interface* mSolverInterface;
+
+            //! Residual at the linearization point, on free point map
+            sol::Dist_Vector* mResidual;
+
+            //! Solution vector the solver interface assembles the residual with, on full map
+            sol::Dist_Vector* mSolution = nullptr;
+
+            //! Copy of solution vector, restored after each perturbation
+            sol::Dist_Vector* mSolutionCopy = nullptr;
+
+            //! Direction on free point map, free map and full map
+            sol::Dist_Vector* mPointDirection = nullptr;
+            sol::Dist_Vector* mFreeDirection  = nullptr;
+            sol::Dist_Vector* mFullDirection  = nullptr;
+
+            //! Residual at perturbed solution, on free point map
+            sol::Dist_Vector* mPerturbedResidual = nullptr;
+
+            //! Free point map, domain and range of this operator
+            Epetra_Map* mPointMap;
+
+            //------------------------------------------------------------------------------
+
+          public:
+            //------------------------------------------------------------------------------
+
+            /**
+             * constructor
+             *
+             * @param[ in ] aSolverInterface Solver interface assembling the residual
+             * @param[ in ] aResidual        Residual of the linear system at the linearization point
+             */
+            Jacobian_Free_Operator_Epetra(
+                    Solver_Interface* aSolverInterface,
+                    sol::Dist_Vector* aResidual );
+
+            //------------------------------------------------------------------------------
+
+            ~Jacobian_Free_Operator_Epetra();
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * sets the solution vector which is perturbed, i.e. the one set in the solver interface
+             *
+             * @param[ in ] aSolution Solution vector on full map
+             */
+            void set_solution_vector( sol::Dist_Vector* aSolution );
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * applies the finite difference approximation of the Jacobian, one residual assembly per vector
+             */
+            int Apply( const Epetra_MultiVector& X, Epetra_MultiVector& Y ) const;
+
+            //------------------------------------------------------------------------------
+
+            // the transpose of the Jacobian cannot be formed from residuals
+            int
+            SetUseTranspose( bool aUseTranspose )
+            {
+                return aUseTranspose ? -1 : 0;
+            }
+
+            //------------------------------------------------------------------------------
+
+            bool
+            UseTranspose() const
+            {
+                return false;
+            }
+
+            //------------------------------------------------------------------------------
+
+            int
+            ApplyInverse( const Epetra_MultiVector& X, Epetra_MultiVector& Y ) const
+            {
+                return -1;
+            }
+
+            //------------------------------------------------------------------------------
+
+            bool
+            HasNormInf() const
+            {
+                return false;
+            }
+
+            //------------------------------------------------------------------------------
+
+            double
+            NormInf() const
+            {
+                return -1.0;
+            }
+
+            //------------------------------------------------------------------------------
+
+            const char*
+            Label() const
+            {
+                return "Jacobian free finite difference operator";
+            }
+
+            //------------------------------------------------------------------------------
+
+            const Epetra_Comm&
+            Comm() const
+            {
+                return mPointMap->Comm();
+            }
+
+            //------------------------------------------------------------------------------
+
+            const Epetra_Map&
+            OperatorDomainMap() const
+            {
+                return *mPointMap;
+            }
+
+            //------------------------------------------------------------------------------
+
+            const Epetra_Map&
+            OperatorRangeMap() const
+            {
+                return *mPointMap;
+            }
+        };
+    }    // namespace dla
+}    // namespace moris
+
+#endif /* SRC_DISTLINALG_CL_DLA_JACOBIAN_FREE_OPERATOR_EPETRA_HPP_ */
@@ -104,6 +104,14 @@ namespace moris
         {
             Tracer tTracer( "LinearProblem", "AssembleJacobian" );
 
+            // the Jacobian is applied element by element, only its approximation is assembled
+            if ( mIsMatrixFree )
+            {
+                this->assemble_operator_approximation();
+
+                return;
+            }
+
             mMat->mat_put_scalar( 0.0 );
 
             // assemble Jacobian
@@ -168,6 +176,15 @@ namespace moris
         {
             Tracer tTracer( "LinearProblem", "AssembleResidualAndJacobian" );
 
+            if ( mIsMatrixFree )
+            {
+                this->assemble_residual();
+
+                this->assemble_operator_approximation();
+
+                return;
+            }
+
             mPointVectorRHS->vec_put_scalar( 0.0 );
             mMat->mat_put_scalar( 0.0 );
 
@@ -261,7 +278,7 @@ namespace moris
                     mSolverInterface->get_num_rhs() );
 
             // multiply jacobian with previous solution vector
-            mMat->mat_vec_product( *mPointVectorLHS, *tMatTimesSolVec, false );
+            this->apply_operator( *mPointVectorLHS, *tMatTimesSolVec );
 
             // add contribution to RHS
             mPointVectorRHS->vec_plus_vec( 1.0, *tMatTimesSolVec, 1.0 );
@@ -272,6 +289,24 @@ namespace moris
 
         //----------------------------------------------------------------------------------------
 
+        Epetra_Operator*
+        Linear_Problem::get_epetra_operator()
+        {
+            return mMat->get_matrix();
+        }
+
+        //----------------------------------------------------------------------------------------
+
+        void
+        Linear_Problem::apply_operator(
+                const sol::Dist_Vector& aInputVec,
+                sol::Dist_Vector&       aResult )
+        {
+            mMat->mat_vec_product( aInputVec, aResult, false );
+        }
+
+        //----------------------------------------------------------------------------------------
+
         Matrix< DDRMat >
         Linear_Problem::compute_residual_of_linear_system()
         {
@@ -287,7 +322,7 @@ namespace moris
                     tNumberOfRHS );
 
             // multiply jacobian with previous solution vector
-            mMat->mat_vec_product( *mPointVectorLHS, *tResVec, false );
+            this->apply_operator( *mPointVectorLHS, *tResVec );
 
             // add contribution to RHS
             tResVec->vec_plus_vec( -1.0, *mPointVectorRHS, 1.0 );
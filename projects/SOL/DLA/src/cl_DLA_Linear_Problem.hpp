@@ -15,6 +15,8 @@
 #include "linalg_typedefs.hpp"
 #include "cl_SOL_Enums.hpp"
 
+class Epetra_Operator;
+
 namespace moris
 {
     //--------------------------------------------------------------------------
@@ -64,6 +66,23 @@ namespace moris
             //! Pointer to RHS Matrix Type
             std::string mRHSMatType;
 
+            //! Flag for a matrix-free operator; mMat then holds the assembled approximation for the preconditioner
+            bool mIsMatrixFree = false;
+
+            //! Flag for a finite difference operator of the residual; mMat then holds the lagged Jacobian for the preconditioner
+            bool mIsJacobianFree = false;
+
+            //------------------------------------------------------------------
+
+            /**
+             * assembles the approximation of a matrix-free operator into mMat
+             */
+            virtual void
+            assemble_operator_approximation()
+            {
+                MORIS_ERROR( false, "Linear_Problem::assemble_operator_approximation - matrix-free operator not supported." );
+            }
+
             //------------------------------------------------------------------
 
           public:
@@ -159,6 +178,51 @@ namespace moris
 
             //------------------------------------------------------------------
 
+            /**
+             * returns whether the operator is applied matrix-free or Jacobian-free. get_matrix() then returns
+             * the assembled approximation the preconditioner is built from.
+             */
+            bool
+            is_matrix_free() const
+            {
+                return mIsMatrixFree || mIsJacobianFree;
+            }
+
+            //------------------------------------------------------------------
+
+            /**
+             * switches the operator to finite differences of the residual, J v = ( R( u + h v ) - R( u ) ) / h.
+             * The residual has to be assembled at u before each solve. The assembled Jacobian is only used
+             * by the preconditioner and may be lagged.
+             *
+             * @param[ in ] aSolutionVector Solution vector u set in the solver interface, nullptr switches back
+             *                              to the assembled Jacobian
+             */
+            virtual void
+            set_jacobian_free( sol::Dist_Vector* aSolutionVector )
+            {
+                MORIS_ERROR( aSolutionVector == nullptr,
+                        "Linear_Problem::set_jacobian_free - Jacobian-free operator not supported for this linear system." );
+            }
+
+            //------------------------------------------------------------------
+
+            /**
+             * returns the operator for Epetra based solvers, i.e. the matrix or the matrix-free operator
+             */
+            virtual Epetra_Operator* get_epetra_operator();
+
+            //------------------------------------------------------------------
+
+            /**
+             * applies the operator of the linear system, aResult = A aInputVec
+             */
+            virtual void apply_operator(
+                    const sol::Dist_Vector& aInputVec,
+                    sol::Dist_Vector&       aResult );
+
+            //------------------------------------------------------------------
+
             virtual void get_solution( moris::Matrix< DDRMat >& LHSValues ) = 0;
 
             //------------------------------------------------------------------
@@ -35,7 +35,7 @@ namespace moris
           protected:
             moris::real mCondEstimate;
 
-            moris::uint mSolNumIters;
+            moris::uint mSolNumIters = 0;
             moris::real mSolTrueResidual;
             moris::real mSolScaledResidual;
             moris::real mSolTime;
@@ -78,6 +78,17 @@ namespace moris
             {
                 return mParameterList( aKey );
             }
+
+            //-----------------------------------------------------------------------
+            /**
+             * @brief returns the number of iterations of the last solve, 0 if not reported by the solver
+             */
+
+            moris::uint
+            get_num_iterations() const
+            {
+                return mSolNumIters;
+            }
         };
     }    // namespace dla
 }    // namespace moris
@@ -126,6 +126,9 @@ Linear_Solver_Amesos::solve_linear_system(
 
     mLinearSystem = aLinearSystem;
 
+    MORIS_ERROR( !aLinearSystem->is_matrix_free(),
+            "Linear_Solver_Amesos::solve_linear_system - direct solvers require an assembled matrix, SOL_matrix_free must be false." );
+
     mEpetraProblem.SetOperator( aLinearSystem->get_matrix()->get_matrix() );
     mEpetraProblem.SetRHS( dynamic_cast< Vector_Epetra* >( aLinearSystem->get_solver_RHS() )->get_epetra_vector() );
     mEpetraProblem.SetLHS( dynamic_cast< Vector_Epetra* >( aLinearSystem->get_free_solver_LHS() )->get_epetra_vector() );
@@ -51,7 +51,7 @@ Linear_Solver_Aztec::Linear_Solver_Aztec( Linear_Problem* aLinearSystem )
     mLinearSystem = aLinearSystem;
 
     // Set matrix. solution vector and RHS
-    mEpetraProblem.SetOperator( mLinearSystem->get_matrix()->get_matrix() );
+    mEpetraProblem.SetOperator( mLinearSystem->get_epetra_operator() );
 
     mEpetraProblem.SetRHS( static_cast< Vector_Epetra* >(
             mLinearSystem->get_solver_RHS() )
@@ -164,8 +164,14 @@ Linear_Solver_Aztec::solve_linear_system(
     // set linear system
     mLinearSystem = aLinearSystem;
 
-    // Set matrix in linear system
-    mEpetraProblem.SetOperator( mLinearSystem->get_matrix()->get_matrix() );
+    // Set matrix or matrix-free operator in linear system
+    mEpetraProblem.SetOperator( mLinearSystem->get_epetra_operator() );
+
+    // internal preconditioners of Aztec need the assembled matrix
+    MORIS_ERROR( !mLinearSystem->is_matrix_free()
+                         || mParameterList.get< moris::sint >( "AZ_precond" ) == INT_MAX
+                         || mParameterList.get< moris::sint >( "AZ_precond" ) == AZ_none,
+            "Linear_Solver_Aztec::solve_linear_system - matrix-free operator requires AZ_precond = AZ_none, use ifpack or ml instead.\n" );
 
     // Get LHS and RHS vectors
     sol::Dist_Vector* tRHS = mLinearSystem->get_solver_RHS();
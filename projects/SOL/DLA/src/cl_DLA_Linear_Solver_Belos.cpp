@@ -90,23 +90,31 @@ Linear_Solver_Belos::solve_linear_system(
     // set Belos solver options
     this->set_solver_internal_parameters();
 
+    // initialize preconditioner in first iteration or for a new linear system
+    sint tPrecIter = aIter;
+
+    if ( aIter <= 1 || mLinearSystem != aLinearSystem )
+    {
+        mPreconditioner.initialize( mParameterList, aLinearSystem );
+
+        tPrecIter = 1;
+    }
+
     // set linear system
     mLinearSystem = aLinearSystem;
 
-    // initialize, build and set preconditioner
-    Preconditioner_Trilinos tPreconditioner( mParameterList, mLinearSystem );
-
-    tPreconditioner.build();
+    // build preconditioner or reuse it based on input parameters
+    mPreconditioner.build( tPrecIter );
 
-    MORIS_ERROR( tPreconditioner.exists(),
+    MORIS_ERROR( mPreconditioner.exists(),
             "Linear_Solver_Belos::solve_linear_system - No preconditioner has been defined.\n" );
 
     RCP< Belos::EpetraPrecOp > belosPrec =
-            rcp( new Belos::EpetraPrecOp( tPreconditioner.get_operator() ) );
+            rcp( new Belos::EpetraPrecOp( mPreconditioner.get_operator() ) );
 
-    // get operator, solution and Rhs vectors
-    RCP< Epetra_CrsMatrix > A =
-            rcp( dynamic_cast< Epetra_CrsMatrix* >( aLinearSystem->get_matrix()->get_matrix() ), false );
+    // get operator, i.e. matrix or matrix-free operator, solution and Rhs vectors
+    RCP< Epetra_Operator > A =
+            rcp( aLinearSystem->get_epetra_operator(), false );
     RCP< Epetra_MultiVector > X =
             rcp( dynamic_cast< Vector_Epetra* >( aLinearSystem->get_free_solver_LHS() )->get_epetra_vector(), false );
     RCP< Epetra_MultiVector > B =
@@ -130,13 +138,27 @@ Linear_Solver_Belos::solve_linear_system(
     MORIS_ERROR( problem->setProblem(),
             "Linear_Solver_Belos::solve_linear_system - LinearProblem is not correctly set up.\n" );
 
+    // recycling solvers keep their solver manager and thus the recycle space as long as the
+    // map of the linear system does not change, e.g. over Newton iterations, time steps and adjoint solves
+    bool tReuseSolver = this->is_recycling_solver()
+                     && !mSolver.is_null()
+                     && mRecycleMap->SameAs( A->OperatorDomainMap() );
+
     // Create iterative solver.
-    SolverFactory< double, Epetra_MultiVector, Epetra_Operator > factory;
+    if ( !tReuseSolver )
+    {
+        SolverFactory< double, Epetra_MultiVector, Epetra_Operator > factory;
+
+        mSolver = factory.create(
+                mParameterList.get< std::string >( "Solver Type" ),
+                mMyPl );
+
+        mRecycleMap = rcp( new Epetra_Map( A->OperatorDomainMap() ) );
+    }
+
+    MORIS_LOG_SPEC( "KrylovSpaceRecycled", tReuseSolver );
 
-    RCP< Belos::SolverManager< double, Epetra_MultiVector, Epetra_Operator > > solver =
-            factory.create(
-                    mParameterList.get< std::string >( "Solver Type" ),
-                    mMyPl );
+    RCP< Belos::SolverManager< double, Epetra_MultiVector, Epetra_Operator > > solver = mSolver;
 
     // Tell the solver what problem you want to solve.
     solver->setProblem( problem );
@@ -147,7 +169,9 @@ Linear_Solver_Belos::solve_linear_system(
     MORIS_LOG_SPEC( "IterativeSolverConverged", tSolverConvergence );
 
     // Ask the solver how many iterations the last solve() took.
-    MORIS_LOG_SPEC( "LinearSolverIterations", solver->getNumIters() );
+    mSolNumIters = solver->getNumIters();
+
+    MORIS_LOG_SPEC( "LinearSolverIterations", mSolNumIters );
 
     // Get solution tolerance across all RHS
     MORIS_LOG_SPEC( "LinearResidualNorm_All_RHS", solver->achievedTol() );
@@ -160,12 +184,30 @@ Linear_Solver_Belos::solve_linear_system(
         MORIS_LOG_SPEC( "LinearResidualNorm_RHS_" + std::to_string( i ), tRelativeResidualNorm( i ) );
     }
 
+    // the solver manager is only kept if it carries a recycle space
+    if ( !this->is_recycling_solver() )
+    {
+        mSolver     = Teuchos::null;
+        mRecycleMap = Teuchos::null;
+    }
+
     // return solver status
     return 0;
 }
 
 //---------------------------------------------------------------------------------------------------
 
+bool
+Linear_Solver_Belos::is_recycling_solver()
+{
+    const std::string& tSolverType = mParameterList.get< std::string >( "Solver Type" );
+
+    return tSolverType == "Recycling GMRES" || tSolverType == "GCRODR"
+        || tSolverType == "Recycling CG" || tSolverType == "RCG";
+}
+
+//---------------------------------------------------------------------------------------------------
+
 void
 Linear_Solver_Belos::set_solver_internal_parameters()
 {
@@ -196,6 +238,11 @@ Linear_Solver_Belos::set_solver_internal_parameters()
         mMyPl->set( "Convergence Tolerance", mParameterList.get< moris::real >( "Convergence Tolerance" ) );
     }
 
+    if ( mParameterList.get< moris::sint >( "Num Recycled Blocks" ) != INT_MAX )
+    {
+        mMyPl->set( "Num Recycled Blocks", mParameterList.get< moris::sint >( "Num Recycled Blocks" ) );
+    }
+
     if ( mParameterList.get< moris::sint >( "Output Frequency" ) != -1 )
     {
         mMyPl->set( "Output Frequency", mParameterList.get< moris::real >( "Output Frequency" ) );
@@ -15,11 +15,15 @@
 #include "Epetra_ConfigDefs.h"
 
 #include "cl_DLA_Linear_Solver_Algorithm.hpp"
+#include "cl_DLA_Preconditioner_Trilinos.hpp"
 
 #include "BelosConfigDefs.hpp"
 #include "BelosLinearProblem.hpp"
 #include "BelosEpetraAdapter.hpp"
 #include "BelosGCRODRSolMgr.hpp"
+#include "BelosSolverManager.hpp"
+
+#include "Epetra_Map.h"
 
 #include "Teuchos_ParameterList.hpp"
 
@@ -35,6 +39,19 @@ private:
 
     Teuchos::RCP< Teuchos::ParameterList > mMyPl;
 
+    Preconditioner_Trilinos mPreconditioner;
+
+    // solver manager of recycling solvers, kept across solves together with its recycle space
+    Teuchos::RCP< Belos::SolverManager< double, Epetra_MultiVector, Epetra_Operator > > mSolver;
+
+    // map of the linear system the recycle space belongs to
+    Teuchos::RCP< Epetra_Map > mRecycleMap;
+
+    /**
+     * returns true if the solver type keeps a recycle space across solves
+     */
+    bool is_recycling_solver();
+
 protected:
 public:
     Linear_Solver_Belos();
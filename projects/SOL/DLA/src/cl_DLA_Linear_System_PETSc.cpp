@@ -94,6 +94,9 @@ Linear_System_PETSc::Linear_System_PETSc(
     mTplType         = sol::MapType::Petsc;
     mSolverWarehouse = aSolverWarehouse;
 
+    MORIS_ERROR( !mSolverWarehouse->get_matrix_free(),
+            "Linear_System_PETSc::Linear_System_PETSc - matrix-free operator is only implemented for Epetra." );
+
     if ( mNotCreatedByNonLinearSolver )
     {
         // Initialize petsc solvers
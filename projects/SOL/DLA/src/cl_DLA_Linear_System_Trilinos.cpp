@@ -111,6 +111,11 @@ Linear_System_Trilinos::Linear_System_Trilinos(
 {
     mTplType         = sol::MapType::Epetra;
     mSolverWarehouse = aSolverWarehouse;
+    mIsMatrixFree    = mSolverWarehouse->get_matrix_free();
+
+    MORIS_ERROR( !mIsMatrixFree || mSolverWarehouse->get_RHS_mat_type().empty(),
+            "Linear_System_Trilinos::Linear_System_Trilinos - matrix-free operator cannot be used with a RHS matrix." );
+
     sol::Matrix_Vector_Factory tMatFactory( mTplType );
 
     aFreeMap->build_dof_translator( aInput->get_my_local_global_overlapping_map(), false );
@@ -136,7 +141,20 @@ Linear_System_Trilinos::Linear_System_Trilinos(
     // start timer
     tic tTimer;
 
-    mSolverInterface->build_graph( mMat );
+    if ( mIsMatrixFree )
+    {
+        // the matrix only holds the diagonal the preconditioner is built from
+        mSolverInterface->build_diagonal_graph( mMat );
+
+        mMatrixFreeOperator = new Matrix_Free_Operator_Epetra(
+                aInput,
+                aFreeMap,
+                mSolverWarehouse->get_matrix_free_store_element_matrices() );
+    }
+    else
+    {
+        mSolverInterface->build_graph( mMat );
+    }
 
     if ( !mSolverWarehouse->get_output_to_matlab_string().empty() || !mSolverWarehouse->get_RHS_mat_type().empty() )
     {
@@ -151,6 +169,12 @@ Linear_System_Trilinos::Linear_System_Trilinos(
 
 Linear_System_Trilinos::~Linear_System_Trilinos()
 {
+    delete mMatrixFreeOperator;
+    mMatrixFreeOperator = nullptr;
+
+    delete mJacobianFreeOperator;
+    mJacobianFreeOperator = nullptr;
+
     delete mMat;
     mMat = nullptr;
 
@@ -205,3 +229,94 @@ Linear_System_Trilinos::get_solution( Matrix< DDRMat >& LHSValues )
 {
     mPointVectorLHS->extract_copy( LHSValues );
 }
+
+//------------------------------------------------------------------------------------------
+
+Epetra_Operator*
+Linear_System_Trilinos::get_epetra_operator()
+{
+    if ( mIsJacobianFree )
+    {
+        return mJacobianFreeOperator;
+    }
+
+    if ( mMatrixFreeOperator != nullptr )
+    {
+        return mMatrixFreeOperator;
+    }
+
+    return mMat->get_matrix();
+}
+
+//------------------------------------------------------------------------------------------
+
+void
+Linear_System_Trilinos::apply_operator(
+        const sol::Dist_Vector& aInputVec,
+        sol::Dist_Vector&       aResult )
+{
+    if ( !this->is_matrix_free() )
+    {
+        mMat->mat_vec_product( aInputVec, aResult, false );
+
+        return;
+    }
+
+    this->get_epetra_operator()->Apply(
+            *static_cast< const Vector_Epetra& >( aInputVec ).get_epetra_vector(),
+            *static_cast< Vector_Epetra& >( aResult ).get_epetra_vector() );
+}
+
+//------------------------------------------------------------------------------------------
+
+void
+Linear_System_Trilinos::set_jacobian_free( sol::Dist_Vector* aSolutionVector )
+{
+    mIsJacobianFree = aSolutionVector != nullptr;
+
+    if ( !mIsJacobianFree )
+    {
+        return;
+    }
+
+    MORIS_ERROR( mMatrixFreeOperator == nullptr,
+            "Linear_System_Trilinos::set_jacobian_free - Jacobian-free operator cannot be combined with SOL_matrix_free." );
+
+    MORIS_ERROR( mSolverInterface->get_num_rhs() == 1,
+            "Linear_System_Trilinos::set_jacobian_free - Jacobian-free operator only implemented for a single RHS." );
+
+    if ( mJacobianFreeOperator == nullptr )
+    {
+        mJacobianFreeOperator = new Jacobian_Free_Operator_Epetra( mSolverInterface, mPointVectorRHS );
+    }
+
+    mJacobianFreeOperator->set_solution_vector( aSolutionVector );
+}
+
+//------------------------------------------------------------------------------------------
+
+void
+Linear_System_Trilinos::assemble_operator_approximation()
+{
+    Tracer tTracer( "LinearProblem", "AssembleOperatorApproximation" );
+
+    MORIS_ERROR( mMatrixFreeOperator != nullptr,
+            "Linear_System_Trilinos::assemble_operator_approximation - no matrix-free operator built." );
+
+    sol::Matrix_Vector_Factory tMatFactory( mTplType );
+
+    // diagonal on the free point map
+    sol::Dist_Vector* tDiagonal = tMatFactory.create_vector(
+            mSolverInterface,
+            mPointVectorRHS->get_map(),
+            1,
+            true );
+
+    mMatrixFreeOperator->compute_diagonal( *static_cast< Vector_Epetra* >( tDiagonal )->get_epetra_vector() );
+
+    mMat->mat_put_scalar( 0.0 );
+
+    mMat->replace_diagonal_values( *tDiagonal );
+
+    delete tDiagonal;
+}
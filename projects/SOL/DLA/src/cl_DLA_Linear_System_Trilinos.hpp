@@ -30,6 +30,8 @@
 #include "Epetra_Export.h"
 
 #include "cl_DLA_Eigen_Solver.hpp"
+#include "cl_DLA_Matrix_Free_Operator_Epetra.hpp"
+#include "cl_DLA_Jacobian_Free_Operator_Epetra.hpp"
 
 #include "cl_Vector_Epetra.hpp"
 #include "cl_Sparse_Matrix_EpetraFECrs.hpp"
@@ -47,8 +49,19 @@ namespace moris
         class Linear_System_Trilinos : public Linear_Problem
         {
           private:
+            //! Element by element Jacobian, if the operator is applied matrix-free
+            Matrix_Free_Operator_Epetra* mMatrixFreeOperator = nullptr;
+
+            //! Finite difference Jacobian, if the operator is applied Jacobian-free
+            Jacobian_Free_Operator_Epetra* mJacobianFreeOperator = nullptr;
 
           protected:
+            //------------------------------------------------------------------
+
+            /**
+             * assembles the diagonal of the matrix-free operator into mMat
+             */
+            void assemble_operator_approximation();
 
           public:
             Linear_System_Trilinos( Solver_Interface* aInput );
@@ -66,6 +79,14 @@ namespace moris
             moris::sint solve_linear_system();
 
             void get_solution( Matrix< DDRMat >& LHSValues );
+
+            Epetra_Operator* get_epetra_operator();
+
+            void set_jacobian_free( sol::Dist_Vector* aSolutionVector );
+
+            void apply_operator(
+                    const sol::Dist_Vector& aInputVec,
+                    sol::Dist_Vector&       aResult );
         };
     }    // namespace dla
 }    // namespace moris
@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Matrix_Free_Operator_Epetra.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "cl_DLA_Matrix_Free_Operator_Epetra.hpp"
+#include "cl_DLA_Solver_Interface.hpp"
+#include "cl_SOL_Dist_Map.hpp"
+#include "cl_SOL_Matrix_Vector_Factory.hpp"
+#include "cl_Vector_Epetra.hpp"
+
+#include "fn_trans.hpp"
+#include "cl_Communication_Tools.hpp"
+
+// detailed logging package
+#include "cl_Tracer.hpp"
+#include "cl_Logger.hpp"
+
+using namespace moris;
+using namespace dla;
+
+//----------------------------------------------------------------------------------------
+
+Matrix_Free_Operator_Epetra::Matrix_Free_Operator_Epetra(
+        Solver_Interface* aSolverInterface,
+        sol::Dist_Map*    aFreeMap,
+        bool              aStoreElementMatrices )
+        : mSolverInterface( aSolverInterface )
+        , mFreeMap( aFreeMap )
+        , mPointMap( aFreeMap->get_epetra_point_map() )
+        , mStoreElementMatrices( aStoreElementMatrices )
+{
+    this->build_column_map();
+
+    if ( !mStoreElementMatrices )
+    {
+        sol::Matrix_Vector_Factory tMatFactory( sol::MapType::Epetra );
+
+        mPointDirection = tMatFactory.create_vector( aSolverInterface, aFreeMap, 1, true );
+        mFreeDirection  = tMatFactory.create_vector( aSolverInterface, aFreeMap, 1 );
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+Matrix_Free_Operator_Epetra::~Matrix_Free_Operator_Epetra()
+{
+    delete mImporter;
+    delete mExporter;
+    delete mColumnMap;
+
+    delete mPointDirection;
+    delete mFreeDirection;
+    delete mFullDirection;
+    delete mSolutionCopy;
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::build_column_map()
+{
+    Tracer tTracer( "LinearProblem", "MatrixFree", "BuildColumnMap" );
+
+    uint tNumBlocks = mSolverInterface->get_num_my_blocks();
+
+    // free point IDs of all equation objects
+    moris::Cell< moris::Cell< Matrix< IdMat > > > tElementPointIds( tNumBlocks );
+
+    std::vector< int > tColumnIds;
+
+    for ( uint Ii = 0; Ii < tNumBlocks; Ii++ )
+    {
+        uint tNumEquationObjectOnSet = mSolverInterface->get_num_equation_objects_on_set( Ii );
+
+        tElementPointIds( Ii ).resize( tNumEquationObjectOnSet );
+
+        for ( uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
+        {
+            Matrix< DDSMat > tElementTopology;
+            mSolverInterface->get_element_topology( Ii, Ik, tElementTopology );
+
+            // constrained dofs are translated to -1, as for the graph of the assembled matrix
+            mFreeMap->translate_ids_to_free_point_ids( tElementTopology, tElementPointIds( Ii )( Ik ), true );
+
+            for ( uint iDof = 0; iDof < tElementPointIds( Ii )( Ik ).numel(); iDof++ )
+            {
+                if ( tElementPointIds( Ii )( Ik )( iDof ) >= 0 )
+                {
+                    tColumnIds.push_back( tElementPointIds( Ii )( Ik )( iDof ) );
+                }
+            }
+        }
+    }
+
+    // unique IDs, owned and shared ones
+    std::sort( tColumnIds.begin(), tColumnIds.end() );
+    tColumnIds.erase( std::unique( tColumnIds.begin(), tColumnIds.end() ), tColumnIds.end() );
+
+    mColumnMap = new Epetra_Map( -1, tColumnIds.size(), tColumnIds.data(), 0, mPointMap->Comm() );
+
+    mImporter = new Epetra_Import( *mColumnMap, *mPointMap );
+    mExporter = new Epetra_Export( *mColumnMap, *mPointMap );
+
+    // translate free point IDs into local indices of the column map
+    mElementColumnIndices.resize( tNumBlocks );
+
+    for ( uint Ii = 0; Ii < tNumBlocks; Ii++ )
+    {
+        uint tNumEquationObjectOnSet = tElementPointIds( Ii ).size();
+
+        mElementColumnIndices( Ii ).resize( tNumEquationObjectOnSet );
+
+        for ( uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
+        {
+            const Matrix< IdMat >& tPointIds = tElementPointIds( Ii )( Ik );
+
+            Matrix< DDSMat >& tColumnIndices = mElementColumnIndices( Ii )( Ik );
+
+            tColumnIndices.set_size( tPointIds.numel(), 1, -1 );
+
+            for ( uint iDof = 0; iDof < tPointIds.numel(); iDof++ )
+            {
+                if ( tPointIds( iDof ) >= 0 )
+                {
+                    tColumnIndices( iDof ) = mColumnMap->LID( (int)tPointIds( iDof ) );
+                }
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+int
+Matrix_Free_Operator_Epetra::Apply(
+        const Epetra_MultiVector& X,
+        Epetra_MultiVector&       Y ) const
+{
+    Tracer tTracer( "LinearProblem", "MatrixFree", "Apply" );
+
+    MORIS_ERROR( mIsLinearized,
+            "Matrix_Free_Operator_Epetra::Apply - compute_diagonal() has to be called for the linearization point first." );
+
+    // local contributions to the result of all dofs used on this proc
+    Epetra_MultiVector tColumnY( *mColumnMap, X.NumVectors(), true );
+
+    if ( mStoreElementMatrices )
+    {
+        // input values of all dofs used on this proc
+        Epetra_MultiVector tColumnX( *mColumnMap, X.NumVectors(), false );
+
+        tColumnX.Import( X, *mImporter, Insert );
+
+        this->apply_element_matrices( tColumnX, tColumnY );
+    }
+    else
+    {
+        MORIS_ERROR( !mUseTranspose,
+                "Matrix_Free_Operator_Epetra::Apply - transpose is only available with stored element matrices." );
+
+        this->apply_element_residual_differences( X, tColumnY );
+    }
+
+    // sum contributions of all procs into owned rows
+    Y.PutScalar( 0.0 );
+
+    return Y.Export( tColumnY, *mExporter, Add );
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::apply_element_matrices(
+        const Epetra_MultiVector& aColumnX,
+        Epetra_MultiVector&       aColumnY ) const
+{
+    uint tNumVectors = aColumnX.NumVectors();
+
+    Matrix< DDRMat > tElementX;
+    Matrix< DDRMat > tElementY;
+
+    for ( uint Ii = 0; Ii < mElementColumnIndices.size(); Ii++ )
+    {
+        for ( uint Ik = 0; Ik < mElementColumnIndices( Ii ).size(); Ik++ )
+        {
+            const Matrix< DDSMat >& tColumnIndices = mElementColumnIndices( Ii )( Ik );
+            const Matrix< DDRMat >& tElementMatrix = mElementMatrices( Ii )( Ik );
+
+            uint tNumDofs = tColumnIndices.numel();
+
+            if ( tNumDofs == 0 || tElementMatrix.numel() == 0 )
+            {
+                continue;
+            }
+
+            // gather element values, constrained dofs do not contribute
+            tElementX.set_size( tNumDofs, tNumVectors, 0.0 );
+
+            for ( uint iDof = 0; iDof < tNumDofs; iDof++ )
+            {
+                if ( tColumnIndices( iDof ) >= 0 )
+                {
+                    for ( uint iVec = 0; iVec < tNumVectors; iVec++ )
+                    {
+                        tElementX( iDof, iVec ) = aColumnX[ iVec ][ tColumnIndices( iDof ) ];
+                    }
+                }
+            }
+
+            if ( mUseTranspose )
+            {
+                tElementY = trans( tElementMatrix ) * tElementX;
+            }
+            else
+            {
+                tElementY = tElementMatrix * tElementX;
+            }
+
+            // scatter element result
+            for ( uint iDof = 0; iDof < tNumDofs; iDof++ )
+            {
+                if ( tColumnIndices( iDof ) >= 0 )
+                {
+                    for ( uint iVec = 0; iVec < tNumVectors; iVec++ )
+                    {
+                        aColumnY[ iVec ][ tColumnIndices( iDof ) ] += tElementY( iDof, iVec );
+                    }
+                }
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::apply_element_residual_differences(
+        const Epetra_MultiVector& X,
+        Epetra_MultiVector&       aColumnY ) const
+{
+    Epetra_MultiVector* tPointDirection = static_cast< Vector_Epetra* >( mPointDirection )->get_epetra_vector();
+
+    Cell< Matrix< DDRMat > > tElementResidual;
+
+    // norm of full vector counts shared dofs multiple times, sufficient for the step size
+    real tSolutionNorm = mSolution->vec_norm2()( 0 );
+
+    mSolutionCopy->vec_plus_vec( 1.0, *mSolution, 0.0 );
+
+    for ( int iVec = 0; iVec < X.NumVectors(); iVec++ )
+    {
+        ( *tPointDirection )( 0 )->Update( 1.0, *X( iVec ), 0.0 );
+
+        real tDirectionNorm = mPointDirection->vec_norm2()( 0 );
+
+        if ( tDirectionNorm == 0.0 )
+        {
+            continue;
+        }
+
+        // step size balancing truncation and round-off error
+        real tStepSize = std::sqrt( ( 1.0 + tSolutionNorm ) * MORIS_REAL_EPS ) / tDirectionNorm;
+
+        // perturb solution, u + h v
+        mFreeDirection->vec_plus_vec( 1.0, *mPointDirection, 0.0 );
+
+        mFullDirection->vec_put_scalar( 0.0 );
+        mFullDirection->import_local_to_global( *mFreeDirection );
+
+        mSolution->vec_plus_vec( tStepSize, *mFullDirection, 1.0 );
+
+        mSolverInterface->report_beginning_of_assembly();
+
+        for ( uint Ii = 0; Ii < mElementColumnIndices.size(); Ii++ )
+        {
+            mSolverInterface->initialize_set( Ii );
+
+            for ( uint Ik = 0; Ik < mElementColumnIndices( Ii ).size(); Ik++ )
+            {
+                const Matrix< DDSMat >& tColumnIndices = mElementColumnIndices( Ii )( Ik );
+                const Matrix< DDRMat >& tResidual      = mElementResiduals( Ii )( Ik );
+
+                if ( tColumnIndices.numel() == 0 || tResidual.numel() == 0 )
+                {
+                    continue;
+                }
+
+                mSolverInterface->get_equation_object_rhs( Ii, Ik, tElementResidual );
+
+                // J_e v_e = ( R_e( u + h v ) - R_e( u ) ) / h
+                for ( uint iDof = 0; iDof < tColumnIndices.numel(); iDof++ )
+                {
+                    if ( tColumnIndices( iDof ) >= 0 )
+                    {
+                        aColumnY[ iVec ][ tColumnIndices( iDof ) ] += ( tElementResidual( 0 )( iDof ) - tResidual( iDof ) ) / tStepSize;
+                    }
+                }
+            }
+
+            mSolverInterface->free_block_memory( Ii );
+        }
+
+        mSolverInterface->report_end_of_assembly();
+
+        // restore solution
+        mSolution->vec_plus_vec( 1.0, *mSolutionCopy, 0.0 );
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::compute_diagonal( Epetra_MultiVector& aDiagonal )
+{
+    Tracer tTracer( "LinearProblem", "MatrixFree", "ComputeDiagonal" );
+
+    Epetra_MultiVector tColumnDiagonal( *mColumnMap, 1, true );
+
+    Matrix< DDRMat >         tElementMatrix;
+    Cell< Matrix< DDRMat > > tElementResidual;
+
+    uint tNumBlocks = mElementColumnIndices.size();
+
+    // the stored element data is replaced by the one of the current solution
+    mIsLinearized = false;
+
+    if ( mStoreElementMatrices )
+    {
+        mElementMatrices.resize( tNumBlocks );
+    }
+    else
+    {
+        // the adjoint operator is the transposed Jacobian, which finite differences of the residual do not provide
+        MORIS_ERROR( mSolverInterface->get_is_forward_analysis(),
+                "Matrix_Free_Operator_Epetra::compute_diagonal - sensitivity analysis needs SOL_matrix_free_store_element_matrices." );
+
+        MORIS_ERROR( mSolverInterface->get_num_rhs() == 1,
+                "Matrix_Free_Operator_Epetra::compute_diagonal - finite differences only implemented for a single RHS." );
+
+        this->set_solution_vector( mSolverInterface->get_solution_vector() );
+
+        mElementResiduals.resize( tNumBlocks );
+    }
+
+    real tNumStoredValues = 0.0;
+
+    mSolverInterface->report_beginning_of_assembly();
+
+    for ( uint Ii = 0; Ii < tNumBlocks; Ii++ )
+    {
+        uint tNumEquationObjectOnSet = mElementColumnIndices( Ii ).size();
+
+        if ( mStoreElementMatrices )
+        {
+            mElementMatrices( Ii ).resize( tNumEquationObjectOnSet );
+        }
+        else
+        {
+            mElementResiduals( Ii ).resize( tNumEquationObjectOnSet );
+        }
+
+        mSolverInterface->initialize_set( Ii );
+
+        for ( uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
+        {
+            const Matrix< DDSMat >& tColumnIndices = mElementColumnIndices( Ii )( Ik );
+
+            if ( tColumnIndices.numel() == 0 )
+            {
+                continue;
+            }
+
+            if ( mStoreElementMatrices )
+            {
+                mSolverInterface->get_equation_object_operator( Ii, Ik, mElementMatrices( Ii )( Ik ) );
+
+                tNumStoredValues += mElementMatrices( Ii )( Ik ).numel();
+            }
+            else
+            {
+                mSolverInterface->get_equation_object_operator_and_rhs( Ii, Ik, tElementMatrix, tElementResidual );
+
+                mElementResiduals( Ii )( Ik ) = tElementResidual( 0 );
+
+                tNumStoredValues += tElementResidual( 0 ).numel();
+            }
+
+            const Matrix< DDRMat >& tDiagonalMatrix = mStoreElementMatrices ? mElementMatrices( Ii )( Ik ) : tElementMatrix;
+
+            if ( tDiagonalMatrix.numel() == 0 )
+            {
+                continue;
+            }
+
+            for ( uint iDof = 0; iDof < tColumnIndices.numel(); iDof++ )
+            {
+                if ( tColumnIndices( iDof ) >= 0 )
+                {
+                    tColumnDiagonal[ 0 ][ tColumnIndices( iDof ) ] += tDiagonalMatrix( iDof, iDof );
+                }
+            }
+        }
+
+        mSolverInterface->free_block_memory( Ii );
+    }
+
+    mSolverInterface->report_end_of_assembly();
+
+    mIsLinearized = true;
+
+    // memory of the element data kept for the Krylov iterations of this Newton step
+    real tStoredMemory = sum_all( tNumStoredValues ) * sizeof( real ) / 1.0e6;
+
+    MORIS_LOG_SPEC( mStoreElementMatrices ? "MatrixFreeElementMatricesMB" : "MatrixFreeElementResidualsMB", tStoredMemory );
+
+    gLogger.add_benchmark_value( "matrix_free_memory", tStoredMemory );
+
+    aDiagonal.PutScalar( 0.0 );
+
+    aDiagonal.Export( tColumnDiagonal, *mExporter, Add );
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::set_solution_vector( sol::Dist_Vector* aSolution )
+{
+    MORIS_ERROR( aSolution != nullptr && aSolution->get_num_vectors() == 1,
+            "Matrix_Free_Operator_Epetra::set_solution_vector - a single solution vector is needed for finite differences." );
+
+    // vectors on full map are rebuilt if the solution vector changes
+    if ( mSolution != aSolution )
+    {
+        delete mFullDirection;
+        delete mSolutionCopy;
+
+        sol::Matrix_Vector_Factory tMatFactory( sol::MapType::Epetra );
+
+        mFullDirection = tMatFactory.create_vector( mSolverInterface, aSolution->get_map(), 1 );
+        mSolutionCopy  = tMatFactory.create_vector( mSolverInterface, aSolution->get_map(), 1 );
+    }
+
+    mSolution = aSolution;
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Matrix_Free_Operator_Epetra::free_element_matrices()
+{
+    mElementMatrices.clear();
+    mElementResiduals.clear();
+
+    mIsLinearized = false;
+}
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Matrix_Free_Operator_Epetra.hpp
+ *
+ */
+
+#ifndef SRC_DISTLINALG_CL_DLA_MATRIX_FREE_OPERATOR_EPETRA_HPP_
+#define SRC_DISTLINALG_CL_DLA_MATRIX_FREE_OPERATOR_EPETRA_HPP_
+
+// TPL header files
+#include "Epetra_Operator.h"
+#include "Epetra_MultiVector.h"
+#include "Epetra_Map.h"
+#include "Epetra_Import.h"
+#include "Epetra_Export.h"
+
+#include "cl_Matrix.hpp"
+#include "cl_Cell.hpp"
+#include "linalg_typedefs.hpp"
+
+namespace moris
+{
+    class Solver_Interface;
+
+    namespace sol
+    {
+        class Dist_Map;
+        class Dist_Vector;
+    }
+
+    namespace dla
+    {
+        /**
+         * Jacobian operator which is applied element by element without assembling a global sparse matrix.
+         * By default the element Jacobians are not formed in the Krylov iterations: the action of an element
+         * Jacobian is computed by a directional finite difference of the element residual,
+         * J_e v_e = ( R_e( u + h v ) - R_e( u ) ) / h, with the element residuals R_e( u ) of the linearization
+         * point kept per Newton step. The element Jacobians are only computed once per Newton step for the diagonal
+         * the preconditioner is built from.
+         * Optionally the element Jacobians are stored with the diagonal and applied in the Krylov iterations. This
+         * needs several times the memory of the assembled matrix for high order B-splines, e.g. a cubic 3D element
+         * stores 64^2 values per field while a row of the assembled matrix has about 343 entries per field.
+         */
+        class Matrix_Free_Operator_Epetra : public virtual Epetra_Operator
+        {
+          private:
+            //! Pointer to solver interface
+            Solver_Interface* mSolverInterface;
+
+            //! Free map of the linear system, translates element topologies to free point IDs
+            sol::Dist_Map* mFreeMap;
+
+            //! Free point map of the linear system, domain and range of this operator
+            Epetra_Map* mPointMap;
+
+            //! Map of all free point IDs used by local equation objects, including the ones owned by other procs
+            Epetra_Map* mColumnMap = nullptr;
+
+            //! Import from point map to column map and export back to point map
+            Epetra_Import* mImporter = nullptr;
+            Epetra_Export* mExporter = nullptr;
+
+            //! Local index in column map per set, equation object and element dof, -1 for constrained dofs
+            moris::Cell< moris::Cell< Matrix< DDSMat > > > mElementColumnIndices;
+
+            //! Element Jacobians per set and equation object, computed with the diagonal if stored
+            moris::Cell< moris::Cell< Matrix< DDRMat > > > mElementMatrices;
+
+            //! Element residuals at the linearization point per set and equation object, if element Jacobians are not stored
+            moris::Cell< moris::Cell< Matrix< DDRMat > > > mElementResiduals;
+
+            //! Flag whether element Jacobians are stored between applications
+            bool mStoreElementMatrices = false;
+
+            //! Flag whether the element data of the current linearization point has been computed
+            bool mIsLinearized = false;
+
+            //! Solution vector the solver interface evaluates the residual with, on full map
+            sol::Dist_Vector* mSolution = nullptr;
+
+            //! Copy of solution vector, restored after each perturbation
+            sol::Dist_Vector* mSolutionCopy = nullptr;
+
+            //! Direction on free point map, free map and full map
+            sol::Dist_Vector* mPointDirection = nullptr;
+            sol::Dist_Vector* mFreeDirection  = nullptr;
+            sol::Dist_Vector* mFullDirection  = nullptr;
+
+            bool mUseTranspose = false;
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * computes the column map and the column indices of all equation objects
+             */
+            void build_column_map();
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * applies the stored element Jacobians, Y = J X, or their transpose
+             */
+            void apply_element_matrices(
+                    const Epetra_MultiVector& aColumnX,
+                    Epetra_MultiVector&       aColumnY ) const;
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * applies the Jacobian by directional finite differences of the element residuals, Y = J X
+             */
+            void apply_element_residual_differences(
+                    const Epetra_MultiVector& X,
+                    Epetra_MultiVector&       aColumnY ) const;
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * sets the solution vector the residuals are evaluated with, on full map
+             */
+            void set_solution_vector( sol::Dist_Vector* aSolution );
+
+            //------------------------------------------------------------------------------
+
+          public:
+            //------------------------------------------------------------------------------
+
+            /**
+             * constructor
+             *
+             * @param[ in ] aSolverInterface Solver interface providing the element Jacobians
+             * @param[ in ] aFreeMap         Free map of the linear system with dof translator built
+             * @param[ in ] aStoreElementMatrices Store the element Jacobians between applications instead of
+             *                                    applying them by finite differences of the element residuals
+             */
+            Matrix_Free_Operator_Epetra(
+                    Solver_Interface* aSolverInterface,
+                    sol::Dist_Map*    aFreeMap,
+                    bool              aStoreElementMatrices = false );
+
+            //------------------------------------------------------------------------------
+
+            ~Matrix_Free_Operator_Epetra();
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * applies the Jacobian, Y = J X, element by element. Uses the stored element Jacobians if requested,
+             * directional finite differences of the element residuals otherwise. The transpose is only available
+             * for stored element Jacobians. compute_diagonal() has to be called for the linearization point first.
+             */
+            int Apply( const Epetra_MultiVector& X, Epetra_MultiVector& Y ) const;
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * computes the element Jacobians for the current solution and the diagonal of the Jacobian.
+             * Called once per Newton step, stores the element Jacobians or the element residuals for the following
+             * applications. The memory used by the stored element data is logged.
+             *
+             * @param[ out ] aDiagonal Vector on the free point map
+             */
+            void compute_diagonal( Epetra_MultiVector& aDiagonal );
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * releases the stored element data, the next diagonal has to be computed before the next application
+             */
+            void free_element_matrices();
+
+            //------------------------------------------------------------------------------
+
+            int
+            SetUseTranspose( bool aUseTranspose )
+            {
+                mUseTranspose = aUseTranspose;
+                return 0;
+            }
+
+            //------------------------------------------------------------------------------
+
+            bool
+            UseTranspose() const
+            {
+                return mUseTranspose;
+            }
+
+            //------------------------------------------------------------------------------
+
+            // the inverse is not available, preconditioners are built from an assembled approximation
+            int
+            ApplyInverse( const Epetra_MultiVector& X, Epetra_MultiVector& Y ) const
+            {
+                return -1;
+            }
+
+            //------------------------------------------------------------------------------
+
+            bool
+            HasNormInf() const
+            {
+                return false;
+            }
+
+            //------------------------------------------------------------------------------
+
+            double
+            NormInf() const
+            {
+                return -1.0;
+            }
+
+            //------------------------------------------------------------------------------
+
+            const char*
+            Label() const
+            {
+                return "Matrix free element by element Jacobian";
+            }
+
+            //------------------------------------------------------------------------------
+
+            const Epetra_Comm&
+            Comm() const
+            {
+                return mPointMap->Comm();
+            }
+
+            //------------------------------------------------------------------------------
+
+            const Epetra_Map&
+            OperatorDomainMap() const
+            {
+                return *mPointMap;
+            }
+
+            //------------------------------------------------------------------------------
+
+            const Epetra_Map&
+            OperatorRangeMap() const
+            {
+                return *mPointMap;
+            }
+        };
+    }    // namespace dla
+}    // namespace moris
+
+#endif /* SRC_DISTLINALG_CL_DLA_MATRIX_FREE_OPERATOR_EPETRA_HPP_ */
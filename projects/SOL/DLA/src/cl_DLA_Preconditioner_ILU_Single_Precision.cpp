@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Preconditioner_ILU_Single_Precision.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include "cl_DLA_Preconditioner_ILU_Single_Precision.hpp"
+
+#include "Ifpack_Condest.h"
+
+#include "cl_Stopwatch.hpp"
+#include "assert.hpp"
+
+using namespace moris;
+using namespace dla;
+
+//-------------------------------------------------------------------------------
+
+Preconditioner_ILU_Single_Precision::Preconditioner_ILU_Single_Precision( Epetra_RowMatrix* aMatrix )
+        : mMatrix( aMatrix )
+{
+}
+
+//-------------------------------------------------------------------------------
+
+int
+Preconditioner_ILU_Single_Precision::SetParameters( Teuchos::ParameterList& aParameterList )
+{
+    mLevelOfFill       = aParameterList.get( "fact: level-of-fill", mLevelOfFill );
+    mAbsoluteThreshold = aParameterList.get( "fact: absolute threshold", mAbsoluteThreshold );
+    mRelativeThreshold = aParameterList.get( "fact: relative threshold", mRelativeThreshold );
+    mRelaxValue        = aParameterList.get( "fact: relax value", mRelaxValue );
+
+    return 0;
+}
+
+//-------------------------------------------------------------------------------
+
+int
+Preconditioner_ILU_Single_Precision::Initialize()
+{
+    // start timer
+    tic tTimer;
+
+    mIsInitialized = false;
+    mIsComputed    = false;
+
+    int tNumRows       = mMatrix->NumMyRows();
+    int tMaxNumEntries = mMatrix->MaxNumEntries();
+
+    std::vector< int >    tRowColumns( tMaxNumEntries );
+    std::vector< double > tRowValues( tMaxNumEntries );
+
+    // level of fill of every stored entry, only needed for the symbolic factorization
+    std::vector< int > tLevels;
+
+    mRowOffsets.assign( tNumRows + 1, 0 );
+    mDiagonal.assign( tNumRows, 0 );
+    mColumns.clear();
+
+    // ordered pattern of the current row with level of fill per column
+    std::map< int, int > tRowPattern;
+
+    for ( int iRow = 0; iRow < tNumRows; iRow++ )
+    {
+        int tNumEntries = 0;
+
+        mMatrix->ExtractMyRowCopy( iRow, tMaxNumEntries, tNumEntries, tRowValues.data(), tRowColumns.data() );
+
+        tRowPattern.clear();
+
+        for ( int iEntry = 0; iEntry < tNumEntries; iEntry++ )
+        {
+            if ( tRowColumns[ iEntry ] < tNumRows )
+            {
+                tRowPattern[ tRowColumns[ iEntry ] ] = 0;
+            }
+        }
+
+        // the diagonal is always part of the pattern
+        tRowPattern[ iRow ] = 0;
+
+        // eliminate with all previous rows of the L part, fill created in the process is visited as well
+        for ( auto tIt = tRowPattern.begin(); tIt->first < iRow; ++tIt )
+        {
+            int tRowK   = tIt->first;
+            int tLevelK = tIt->second;
+
+            for ( int iPos = mDiagonal[ tRowK ] + 1; iPos < mRowOffsets[ tRowK + 1 ]; iPos++ )
+            {
+                int tLevel = tLevelK + tLevels[ iPos ] + 1;
+
+                if ( tLevel <= mLevelOfFill )
+                {
+                    auto tEntry = tRowPattern.emplace( mColumns[ iPos ], tLevel );
+
+                    if ( !tEntry.second )
+                    {
+                        tEntry.first->second = std::min( tEntry.first->second, tLevel );
+                    }
+                }
+            }
+        }
+
+        for ( const auto& tEntry : tRowPattern )
+        {
+            if ( tEntry.first == iRow )
+            {
+                mDiagonal[ iRow ] = mColumns.size();
+            }
+
+            mColumns.push_back( tEntry.first );
+            tLevels.push_back( tEntry.second );
+        }
+
+        mRowOffsets[ iRow + 1 ] = mColumns.size();
+    }
+
+    mColumns.shrink_to_fit();
+
+    mIsInitialized = true;
+    mNumInitialize++;
+
+    mInitializeTime += tTimer.toc< moris::chronos::milliseconds >().wall / 1000.0;
+
+    return 0;
+}
+
+//-------------------------------------------------------------------------------
+
+int
+Preconditioner_ILU_Single_Precision::Compute()
+{
+    if ( !mIsInitialized )
+    {
+        IFPACK_CHK_ERR( this->Initialize() );
+    }
+
+    // start timer
+    tic tTimer;
+
+    mIsComputed = false;
+    mCondest    = -1.0;
+
+    int tNumRows       = mMatrix->NumMyRows();
+    int tMaxNumEntries = mMatrix->MaxNumEntries();
+
+    std::vector< int >    tRowColumns( tMaxNumEntries );
+    std::vector< double > tRowValues( tMaxNumEntries );
+
+    // current row in double precision and position of its columns in the pattern, -1 if not in pattern
+    std::vector< double > tWork( tNumRows, 0.0 );
+    std::vector< int >    tPositions( tNumRows, -1 );
+
+    mValues.assign( mColumns.size(), 0.0f );
+
+    for ( int iRow = 0; iRow < tNumRows; iRow++ )
+    {
+        for ( int iPos = mRowOffsets[ iRow ]; iPos < mRowOffsets[ iRow + 1 ]; iPos++ )
+        {
+            tPositions[ mColumns[ iPos ] ] = iPos;
+            tWork[ mColumns[ iPos ] ]      = 0.0;
+        }
+
+        int tNumEntries = 0;
+
+        mMatrix->ExtractMyRowCopy( iRow, tMaxNumEntries, tNumEntries, tRowValues.data(), tRowColumns.data() );
+
+        for ( int iEntry = 0; iEntry < tNumEntries; iEntry++ )
+        {
+            if ( tRowColumns[ iEntry ] < tNumRows )
+            {
+                tWork[ tRowColumns[ iEntry ] ] += tRowValues[ iEntry ];
+            }
+        }
+
+        // perturb diagonal as Ifpack_ILU does
+        double tSign = tWork[ iRow ] < 0.0 ? -1.0 : 1.0;
+
+        tWork[ iRow ] = tWork[ iRow ] * mRelativeThreshold + tSign * mAbsoluteThreshold;
+
+        // fill outside the pattern, added to the diagonal for a modified ILU
+        double tDropped = 0.0;
+
+        for ( int iPos = mRowOffsets[ iRow ]; iPos < mDiagonal[ iRow ]; iPos++ )
+        {
+            int tRowK = mColumns[ iPos ];
+
+            double tFactor = tWork[ tRowK ] / mValues[ mDiagonal[ tRowK ] ];
+
+            tWork[ tRowK ] = tFactor;
+
+            for ( int iPosK = mDiagonal[ tRowK ] + 1; iPosK < mRowOffsets[ tRowK + 1 ]; iPosK++ )
+            {
+                if ( tPositions[ mColumns[ iPosK ] ] >= 0 )
+                {
+                    tWork[ mColumns[ iPosK ] ] -= tFactor * mValues[ iPosK ];
+                }
+                else
+                {
+                    tDropped += tFactor * mValues[ iPosK ];
+                }
+            }
+        }
+
+        tWork[ iRow ] -= mRelaxValue * tDropped;
+
+        MORIS_ERROR( tWork[ iRow ] != 0.0,
+                "Preconditioner_ILU_Single_Precision::Compute - zero pivot in row %d.\n",
+                iRow );
+
+        // round row of factors to single precision
+        for ( int iPos = mRowOffsets[ iRow ]; iPos < mRowOffsets[ iRow + 1 ]; iPos++ )
+        {
+            mValues[ iPos ] = static_cast< float >( tWork[ mColumns[ iPos ] ] );
+
+            tPositions[ mColumns[ iPos ] ] = -1;
+        }
+    }
+
+    mIsComputed = true;
+    mNumCompute++;
+
+    mComputeTime += tTimer.toc< moris::chronos::milliseconds >().wall / 1000.0;
+
+    return 0;
+}
+
+//-------------------------------------------------------------------------------
+
+int
+Preconditioner_ILU_Single_Precision::ApplyInverse(
+        const Epetra_MultiVector& X,
+        Epetra_MultiVector&       Y ) const
+{
+    MORIS_ERROR( mIsComputed,
+            "Preconditioner_ILU_Single_Precision::ApplyInverse - preconditioner has not been computed.\n" );
+
+    MORIS_ERROR( X.NumVectors() == Y.NumVectors(),
+            "Preconditioner_ILU_Single_Precision::ApplyInverse - number of vectors does not match.\n" );
+
+    // start timer
+    tic tTimer;
+
+    // solve in place
+    if ( &X != &Y )
+    {
+        Y = X;
+    }
+
+    int tNumRows = mDiagonal.size();
+
+    for ( int iVec = 0; iVec < Y.NumVectors(); iVec++ )
+    {
+        double* tY = Y[ iVec ];
+
+        // forward substitution with unit lower triangle
+        for ( int iRow = 0; iRow < tNumRows; iRow++ )
+        {
+            double tSum = tY[ iRow ];
+
+            for ( int iPos = mRowOffsets[ iRow ]; iPos < mDiagonal[ iRow ]; iPos++ )
+            {
+                tSum -= mValues[ iPos ] * tY[ mColumns[ iPos ] ];
+            }
+
+            tY[ iRow ] = tSum;
+        }
+
+        // backward substitution with upper triangle
+        for ( int iRow = tNumRows - 1; iRow >= 0; iRow-- )
+        {
+            double tSum = tY[ iRow ];
+
+            for ( int iPos = mDiagonal[ iRow ] + 1; iPos < mRowOffsets[ iRow + 1 ]; iPos++ )
+            {
+                tSum -= mValues[ iPos ] * tY[ mColumns[ iPos ] ];
+            }
+
+            tY[ iRow ] = tSum / mValues[ mDiagonal[ iRow ] ];
+        }
+    }
+
+    mNumApplyInverse++;
+
+    mApplyInverseTime += tTimer.toc< moris::chronos::milliseconds >().wall / 1000.0;
+
+    return 0;
+}
+
+//-------------------------------------------------------------------------------
+
+double
+Preconditioner_ILU_Single_Precision::Condest(
+        const Ifpack_CondestType aCondestType,
+        const int                aMaxIters,
+        const double             aTolerance,
+        Epetra_RowMatrix*        aMatrix )
+{
+    if ( !mIsComputed )
+    {
+        return -1.0;
+    }
+
+    // estimate only once per factorization
+    if ( mCondest == -1.0 )
+    {
+        mCondest = Ifpack_Condest( *this, aCondestType, aMaxIters, aTolerance, aMatrix );
+    }
+
+    return mCondest;
+}
+
+//-------------------------------------------------------------------------------
+
+std::ostream&
+Preconditioner_ILU_Single_Precision::Print( std::ostream& aStream ) const
+{
+    real tMemory = ( mColumns.size() * ( sizeof( int ) + sizeof( float ) )
+                           + ( mRowOffsets.size() + mDiagonal.size() ) * sizeof( int ) )
+                 / 1024.0 / 1024.0;
+
+    aStream << "ILU single precision" << std::endl
+            << "  level of fill   = " << mLevelOfFill << std::endl
+            << "  number of rows  = " << mDiagonal.size() << std::endl
+            << "  nonzeros of L+U = " << mColumns.size() << std::endl
+            << "  memory [MB]     = " << tMemory << std::endl
+            << "  condest         = " << mCondest << std::endl;
+
+    return aStream;
+}
+
+//-------------------------------------------------------------------------------
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Preconditioner_ILU_Single_Precision.hpp
+ *
+ */
+
+#ifndef SRC_DISTLINALG_CL_DLA_PRECONDITIONER_ILU_SINGLE_PRECISION_HPP_
+#define SRC_DISTLINALG_CL_DLA_PRECONDITIONER_ILU_SINGLE_PRECISION_HPP_
+
+#include <vector>
+
+// TPL header files
+#include "Epetra_RowMatrix.h"
+#include "Epetra_MultiVector.h"
+#include "Epetra_Map.h"
+#include "Teuchos_ParameterList.hpp"
+
+#include "Ifpack_Preconditioner.h"
+#include "Ifpack_CondestType.h"
+
+#include "typedefs.hpp"
+
+namespace moris
+{
+    namespace dla
+    {
+        /**
+         * Incomplete LU factorization ILU(k) of a local matrix whose factors are stored in single precision.
+         * The factorization and the triangular solves are carried out in double precision, only the stored
+         * factors are rounded. This halves the memory and the memory traffic of the factors, while the
+         * outer Krylov iteration stays in double precision.
+         *
+         * The preconditioner works on the local rows only and is used within Ifpack_AdditiveSchwarz,
+         * which provides overlap, reordering and the combination of the local solutions.
+         */
+        class Preconditioner_ILU_Single_Precision : public Ifpack_Preconditioner
+        {
+          private:
+            //! Local matrix to be factorized
+            Epetra_RowMatrix* mMatrix;
+
+            //! Parameters of the factorization, named as for Ifpack_ILU
+            int    mLevelOfFill        = 0;
+            double mAbsoluteThreshold  = 0.0;
+            double mRelativeThreshold  = 1.0;
+            double mRelaxValue         = 0.0;
+
+            //! Factors L and U in compressed row format; L has a unit diagonal which is not stored
+            std::vector< int >   mRowOffsets;
+            std::vector< int >   mColumns;
+            std::vector< float > mValues;
+
+            //! Position of diagonal entry per row, the U part of a row starts here
+            std::vector< int > mDiagonal;
+
+            bool mIsInitialized = false;
+            bool mIsComputed    = false;
+
+            double mCondest = -1.0;
+
+            int mNumInitialize   = 0;
+            int mNumCompute      = 0;
+            mutable int mNumApplyInverse = 0;
+
+            double mInitializeTime = 0.0;
+            double mComputeTime    = 0.0;
+            mutable double mApplyInverseTime = 0.0;
+
+            //------------------------------------------------------------------------------
+
+          public:
+            //------------------------------------------------------------------------------
+
+            /**
+             * constructor
+             *
+             * @param[ in ] aMatrix Local matrix, all column indices refer to local rows
+             */
+            Preconditioner_ILU_Single_Precision( Epetra_RowMatrix* aMatrix );
+
+            //------------------------------------------------------------------------------
+
+            ~Preconditioner_ILU_Single_Precision(){};
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * reads fact: level-of-fill, fact: absolute threshold, fact: relative threshold
+             * and fact: relax value
+             */
+            int SetParameters( Teuchos::ParameterList& aParameterList );
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * computes the sparsity pattern of the factors for the given level of fill
+             */
+            int Initialize();
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * computes the numerical factorization and stores it in single precision
+             */
+            int Compute();
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * solves L U Y = X, X and Y may be the same vector
+             */
+            int ApplyInverse( const Epetra_MultiVector& X, Epetra_MultiVector& Y ) const;
+
+            //------------------------------------------------------------------------------
+
+            bool
+            IsInitialized() const
+            {
+                return mIsInitialized;
+            }
+
+            //------------------------------------------------------------------------------
+
+            bool
+            IsComputed() const
+            {
+                return mIsComputed;
+            }
+
+            //------------------------------------------------------------------------------
+
+            double Condest(
+                    const Ifpack_CondestType aCondestType = Ifpack_Cheap,
+                    const int                aMaxIters    = 1550,
+                    const double             aTolerance   = 1e-9,
+                    Epetra_RowMatrix*        aMatrix      = nullptr );
+
+            //------------------------------------------------------------------------------
+
+            double
+            Condest() const
+            {
+                return mCondest;
+            }
+
+            //------------------------------------------------------------------------------
+
+            const Epetra_RowMatrix&
+            Matrix() const
+            {
+                return *mMatrix;
+            }
+
+            //------------------------------------------------------------------------------
+
+            int
+            Apply( const Epetra_MultiVector& X, Epetra_MultiVector& Y ) const
+            {
+                return -1;
+            }
+
+            //------------------------------------------------------------------------------
+
+            int
+            SetUseTranspose( bool aUseTranspose )
+            {
+                return aUseTranspose ? -1 : 0;
+            }
+
+            //------------------------------------------------------------------------------
+
+            bool
+            UseTranspose() const
+            {
+                return false;
+            }
+
+            //------------------------------------------------------------------------------
+
+            bool
+            HasNormInf() const
+            {
+                return false;
+            }
+
+            //------------------------------------------------------------------------------
+
+            double
+            NormInf() const
+            {
+                return -1.0;
+            }
+
+            //------------------------------------------------------------------------------
+
+            const char*
+            Label() const
+            {
+                return "ILU single precision";
+            }
+
+            //------------------------------------------------------------------------------
+
+            const Epetra_Comm&
+            Comm() const
+            {
+                return mMatrix->Comm();
+            }
+
+            //------------------------------------------------------------------------------
+
+            const Epetra_Map&
+            OperatorDomainMap() const
+            {
+                return mMatrix->OperatorDomainMap();
+            }
+
+            //------------------------------------------------------------------------------
+
+            const Epetra_Map&
+            OperatorRangeMap() const
+            {
+                return mMatrix->OperatorRangeMap();
+            }
+
+            //------------------------------------------------------------------------------
+
+            int
+            NumInitialize() const
+            {
+                return mNumInitialize;
+            }
+
+            //------------------------------------------------------------------------------
+
+            int
+            NumCompute() const
+            {
+                return mNumCompute;
+            }
+
+            //------------------------------------------------------------------------------
+
+            int
+            NumApplyInverse() const
+            {
+                return mNumApplyInverse;
+            }
+
+            //------------------------------------------------------------------------------
+
+            double
+            InitializeTime() const
+            {
+                return mInitializeTime;
+            }
+
+            //------------------------------------------------------------------------------
+
+            double
+            ComputeTime() const
+            {
+                return mComputeTime;
+            }
+
+            //------------------------------------------------------------------------------
+
+            double
+            ApplyInverseTime() const
+            {
+                return mApplyInverseTime;
+            }
+
+            //------------------------------------------------------------------------------
+
+            double
+            InitializeFlops() const
+            {
+                return 0.0;
+            }
+
+            //------------------------------------------------------------------------------
+
+            double
+            ComputeFlops() const
+            {
+                return 0.0;
+            }
+
+            //------------------------------------------------------------------------------
+
+            double
+            ApplyInverseFlops() const
+            {
+                return 0.0;
+            }
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * prints level of fill, size and memory of the factors
+             */
+            std::ostream& Print( std::ostream& aStream ) const;
+        };
+    }    // namespace dla
+}    // namespace moris
+
+#endif /* SRC_DISTLINALG_CL_DLA_PRECONDITIONER_ILU_SINGLE_PRECISION_HPP_ */
@@ -9,6 +9,7 @@
  */
 
 #include "cl_DLA_Preconditioner_Trilinos.hpp"
+#include "cl_DLA_Preconditioner_ILU_Single_Precision.hpp"
 #include "cl_DLA_Linear_Problem.hpp"
 #include "cl_SOL_Dist_Vector.hpp"
 #include "cl_SOL_Dist_Matrix.hpp"
@@ -198,8 +199,19 @@ moris::sint Preconditioner_Trilinos::build_ifpack_preconditioner()
     // Get overlap across processors
     int OverlapLevel = mParameterList.get< moris::sint >( "overlap-level" ) ;
 
-    // Create the preconditioner.
-    mIfPackPrec = rcp ( Factory.Create ( PrecType, tOperator, OverlapLevel ) );
+    // Create the preconditioner. In single precision the local ILU factors are stored as float,
+    // the additive Schwarz method around it and the Krylov solver stay in double precision
+    if ( mParameterList.get< bool >( "prec_single_precision" ) )
+    {
+        MORIS_ERROR( PrecType == "ILU",
+                "Preconditioner_Trilinos::build_ifpack_preconditioner - single precision is only implemented for ILU.\n" );
+
+        mIfPackPrec = rcp ( new Ifpack_AdditiveSchwarz< Preconditioner_ILU_Single_Precision >( tOperator, OverlapLevel ) );
+    }
+    else
+    {
+        mIfPackPrec = rcp ( Factory.Create ( PrecType, tOperator, OverlapLevel ) );
+    }
 
     // Specify local solver specific parameters
     if ( PrecType == "ILU" )
@@ -349,6 +361,9 @@ moris::sint Preconditioner_Trilinos::build_ml_preconditioner()
     MORIS_ERROR(mLinearSystem,
             "Preconditioner_Trilinos::build_ml_preconditioner - linear system not set.\n" );
 
+    MORIS_ERROR( !mParameterList.get< bool >( "prec_single_precision" ),
+            "Preconditioner_Trilinos::build_ml_preconditioner - single precision is not available for ml, use ifpack ILU.\n" );
+
     // ml parameter list
     ParameterList tMlParams;
 
@@ -11,6 +11,7 @@
 #include "cl_DLA_Solver_Interface.hpp"
 #include "cl_SOL_Dist_Matrix.hpp"
 #include "cl_SOL_Dist_Vector.hpp"
+#include "cl_SOL_Dist_Map.hpp"
 #include "cl_SOL_Warehouse.hpp"
 
 using namespace moris;
@@ -28,6 +29,12 @@ Solver_Interface::build_graph( moris::sol::Dist_Matrix* aMat, bool aUseSparsityP
         // build the sparsity pattern based on the
         aMat->build_graph( mNonZeroDigonal, mNonZeroOffDigonal );
 
+        // plans of a previous graph on this map are outdated
+        if ( mAssemblyPlans.key_exists( aMat->get_map()->get_map_id() ) )
+        {
+            mAssemblyPlans.erase( aMat->get_map()->get_map_id() );
+        }
+
         return;
     }
 
@@ -50,6 +57,189 @@ Solver_Interface::build_graph( moris::sol::Dist_Matrix* aMat, bool aUseSparsityP
 
     // global assembly to communicate entries
     aMat->initial_matrix_global_assembly();
+
+    // graph is final now
+    this->build_assembly_plans( aMat );
+}
+
+//---------------------------------------------------------------------------------------------------------
+
+void
+Solver_Interface::build_diagonal_graph( moris::sol::Dist_Matrix* aMat )
+{
+    // Get local number of elements
+    moris::uint numBlocks = this->get_num_my_blocks();
+
+    Matrix< DDSMat > tElementTopology;
+    Matrix< DDSMat > tDofTopology( 1, 1 );
+
+    // Loop over all local elements and insert one entry per dof
+    for ( moris::uint Ii = 0; Ii < numBlocks; Ii++ )
+    {
+        moris::uint tNumEquationObjectOnSet = this->get_num_equation_objects_on_set( Ii );
+
+        for ( moris::uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
+        {
+            this->get_element_topology( Ii, Ik, tElementTopology );
+
+            for ( moris::uint Ij = 0; Ij < tElementTopology.numel(); Ij++ )
+            {
+                tDofTopology( 0 ) = tElementTopology( Ij );
+
+                aMat->build_graph( 1, tDofTopology );
+            }
+        }
+    }
+
+    // global assembly to communicate entries
+    aMat->initial_matrix_global_assembly();
+}
+
+//---------------------------------------------------------------------------------------------------------
+
+void
+Solver_Interface::build_assembly_plans( moris::sol::Dist_Matrix* aMat )
+{
+    moris::uint tMapId = aMat->get_map()->get_map_id();
+
+    // plans of a previous graph on this map are outdated
+    if ( mAssemblyPlans.key_exists( tMapId ) )
+    {
+        mAssemblyPlans.erase( tMapId );
+    }
+
+    Assembly_Plan tPlan;
+
+    moris::uint tNumBlocks = this->get_num_my_blocks();
+
+    tPlan.mTopologies.resize( tNumBlocks );
+    tPlan.mLocalRows.resize( tNumBlocks );
+    tPlan.mValueOffsets.resize( tNumBlocks );
+
+    for ( moris::uint Ii = 0; Ii < tNumBlocks; Ii++ )
+    {
+        moris::uint tNumEquationObjectOnSet = this->get_num_equation_objects_on_set( Ii );
+
+        tPlan.mTopologies( Ii ).resize( tNumEquationObjectOnSet );
+        tPlan.mLocalRows( Ii ).resize( tNumEquationObjectOnSet );
+        tPlan.mValueOffsets( Ii ).resize( tNumEquationObjectOnSet );
+
+        for ( moris::uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
+        {
+            this->get_element_topology( Ii, Ik, tPlan.mTopologies( Ii )( Ik ) );
+
+            // matrix type does not support plans, keep using global IDs
+            if ( not aMat->compute_assembly_plan(
+                         tPlan.mTopologies( Ii )( Ik ),
+                         tPlan.mLocalRows( Ii )( Ik ),
+                         tPlan.mValueOffsets( Ii )( Ik ) ) )
+            {
+                return;
+            }
+        }
+    }
+
+    mAssemblyPlans[ tMapId ] = std::move( tPlan );
+}
+
+//---------------------------------------------------------------------------------------------------------
+
+const Solver_Interface::Assembly_Plan*
+Solver_Interface::get_assembly_plan(
+        moris::sol::Dist_Map*          aMap,
+        const moris::uint              aMyBlockInd,
+        const moris::uint              aMyElementInd,
+        const moris::Matrix< DDSMat >& aElementTopology )
+{
+    if ( not mAssemblyPlans.key_exists( aMap->get_map_id() ) )
+    {
+        return nullptr;
+    }
+
+    const Assembly_Plan& tPlan = mAssemblyPlans.find( aMap->get_map_id() );
+
+    if ( aMyBlockInd >= tPlan.mTopologies.size() or aMyElementInd >= tPlan.mTopologies( aMyBlockInd ).size() )
+    {
+        return nullptr;
+    }
+
+    // topology depends on the requested dof types, plan is only valid for the one it was built for
+    const Matrix< DDSMat >& tTopology = tPlan.mTopologies( aMyBlockInd )( aMyElementInd );
+
+    if ( tTopology.numel() != aElementTopology.numel() )
+    {
+        return nullptr;
+    }
+
+    for ( moris::uint Ia = 0; Ia < tTopology.numel(); Ia++ )
+    {
+        if ( tTopology( Ia ) != aElementTopology( Ia ) )
+        {
+            return nullptr;
+        }
+    }
+
+    return &tPlan;
+}
+
+//---------------------------------------------------------------------------------------------------------
+
+void
+Solver_Interface::sum_into_matrix(
+        moris::sol::Dist_Matrix*       aMat,
+        const moris::uint              aMyBlockInd,
+        const moris::uint              aMyElementInd,
+        const moris::Matrix< DDSMat >& aElementTopology,
+        const moris::Matrix< DDRMat >& aElementMatrix )
+{
+    const Assembly_Plan* tPlan = this->get_assembly_plan( aMat->get_map(), aMyBlockInd, aMyElementInd, aElementTopology );
+
+    if ( tPlan != nullptr )
+    {
+        aMat->fill_matrix_with_plan(
+                aElementMatrix,
+                aElementTopology,
+                tPlan->mLocalRows( aMyBlockInd )( aMyElementInd ),
+                tPlan->mValueOffsets( aMyBlockInd )( aMyElementInd ) );
+    }
+    else
+    {
+        aMat->fill_matrix(
+                aElementTopology.length(),
+                aElementMatrix,
+                aElementTopology );
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------
+
+void
+Solver_Interface::sum_into_vector(
+        moris::sol::Dist_Vector*       aVector,
+        const moris::uint              aMyBlockInd,
+        const moris::uint              aMyElementInd,
+        const moris::Matrix< DDSMat >& aElementTopology,
+        const moris::Matrix< DDRMat >& aElementRHS,
+        const moris::uint              aVectorIndex )
+{
+    // row indices of the matrix are valid for vectors built on the same map
+    const Assembly_Plan* tPlan = this->get_assembly_plan( aVector->get_map(), aMyBlockInd, aMyElementInd, aElementTopology );
+
+    if ( tPlan != nullptr )
+    {
+        aVector->sum_into_local_values(
+                tPlan->mLocalRows( aMyBlockInd )( aMyElementInd ),
+                aElementTopology,
+                aElementRHS,
+                aVectorIndex );
+    }
+    else
+    {
+        aVector->sum_into_global_values(
+                aElementTopology,
+                aElementRHS,
+                aVectorIndex );
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------
@@ -144,7 +334,10 @@ Solver_Interface::assemble_RHS(
                 {
                     if ( tElementRHS( Ia ).numel() > 0 )
                     {
-                        aVectorRHS->sum_into_global_values(
+                        this->sum_into_vector(
+                                aVectorRHS,
+                                Ii,
+                                Ik,
                                 tElementTopology,
                                 tElementRHS( Ia ),
                                 Ia );
@@ -196,7 +389,10 @@ Solver_Interface::assemble_staggered_RHS_contribution( moris::sol::Dist_Vector*
                 {
                     if ( tElementRHS( Ia ).numel() > 0 )
                     {
-                        aVectorRHS->sum_into_global_values(
+                        this->sum_into_vector(
+                                aVectorRHS,
+                                Ii,
+                                Ik,
                                 tElementTopology,
                                 tElementRHS( Ia ),
                                 Ia );
@@ -251,7 +447,10 @@ Solver_Interface::assemble_additional_DqDs_RHS_contribution( moris::sol::Dist_Ve
                     for ( moris::uint Ia = 0; Ia < tNumRHS; Ia++ )
                     {
                         if ( tElementRHS( Ia ).numel() > 0 )
-                            aVectorRHS->sum_into_global_values(
+                            this->sum_into_vector(
+                                    aVectorRHS,
+                                    Ii,
+                                    Ik,
                                     tElementTopology,
                                     tElementRHS( Ia ),
                                     Ia );
@@ -300,10 +499,7 @@ Solver_Interface::assemble_jacobian(
             // Fill element in distributed matrix
             if ( tElementMatrix.numel() > 0 )
             {
-                aMat->fill_matrix(
-                        tElementTopology.length(),
-                        tElementMatrix,
-                        tElementTopology );
+                this->sum_into_matrix( aMat, Ii, Ik, tElementTopology, tElementMatrix );
             }
         }
 
@@ -349,10 +545,7 @@ Solver_Interface::fill_matrix_and_RHS(
             // Fill element in distributed matrix
             if ( tElementMatrix.numel() > 0 )
             {
-                aMat->fill_matrix(
-                        tElementTopology.length(),
-                        tElementMatrix,
-                        tElementTopology );
+                this->sum_into_matrix( aMat, Ii, Ik, tElementTopology, tElementMatrix );
             }
 
             // Loop over all RHS vectors
@@ -366,7 +559,10 @@ Solver_Interface::fill_matrix_and_RHS(
                     if ( tElementRHS( Ia ).numel() > 0 )
                     {
                         // Fill elementRHS in distributed RHS
-                        aVectorRHS->sum_into_global_values(
+                        this->sum_into_vector(
+                                aVectorRHS,
+                                Ii,
+                                Ik,
                                 tElementTopology,
                                 tElementRHS( Ia ),
                                 Ia );
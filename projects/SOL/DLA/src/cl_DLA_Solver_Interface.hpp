@@ -14,6 +14,7 @@
 #include "cl_Matrix.hpp"
 #include "cl_Cell.hpp"
 #include "linalg_typedefs.hpp"
+#include "cl_Map.hpp"
 #include "cl_FEM_Enums.hpp"
 
 #include "cl_DLA_Geometric_Multigrid.hpp"
@@ -28,6 +29,7 @@ namespace moris
     {
         class Dist_Vector;
         class Dist_Matrix;
+        class Dist_Map;
         class SOL_Warehouse;
     }    // namespace sol
 
@@ -57,6 +59,65 @@ namespace moris
 
         bool mIsForwardAnalysis = true;
 
+        // local row indices and matrix value offsets per set and equation object, see build_assembly_plans()
+        struct Assembly_Plan
+        {
+            moris::Cell< moris::Cell< Matrix< DDSMat > > > mTopologies;
+            moris::Cell< moris::Cell< Matrix< DDSMat > > > mLocalRows;
+            moris::Cell< moris::Cell< Matrix< DDSMat > > > mValueOffsets;
+        };
+
+        // assembly plans per map id. Each linear system builds its own map, such that
+        // several linear systems on this interface do not overwrite each others plans.
+        moris::map< moris::uint, Assembly_Plan > mAssemblyPlans;
+
+        //------------------------------------------------------------------------------
+        /**
+         * computes the local row indices and value offsets of all equation objects, such that
+         * the assembly does not need to translate global IDs in every iteration
+         * @param[ in ] aMat matrix with final graph
+         */
+        void build_assembly_plans( moris::sol::Dist_Matrix* aMat );
+
+        //------------------------------------------------------------------------------
+        /**
+         * returns the assembly plan of an equation object for a map, if it has been computed
+         * for this map and the topology of the equation object did not change since
+         * @param[ in ] aMap               map of matrix or vector to assemble into
+         * @param[ in ] aMyBlockInd        set index
+         * @param[ in ] aMyElementInd      equation object index on set
+         * @param[ in ] aElementTopology   topology of equation object
+         * @return plan or nullptr
+         */
+        const Assembly_Plan* get_assembly_plan(
+                moris::sol::Dist_Map*          aMap,
+                const moris::uint              aMyBlockInd,
+                const moris::uint              aMyElementInd,
+                const moris::Matrix< DDSMat >& aElementTopology );
+
+        //------------------------------------------------------------------------------
+        /**
+         * sums an element matrix into the distributed matrix, using the assembly plan if available
+         */
+        void sum_into_matrix(
+                moris::sol::Dist_Matrix*       aMat,
+                const moris::uint              aMyBlockInd,
+                const moris::uint              aMyElementInd,
+                const moris::Matrix< DDSMat >& aElementTopology,
+                const moris::Matrix< DDRMat >& aElementMatrix );
+
+        //------------------------------------------------------------------------------
+        /**
+         * sums an element RHS into the distributed vector, using the assembly plan if available
+         */
+        void sum_into_vector(
+                moris::sol::Dist_Vector*       aVector,
+                const moris::uint              aMyBlockInd,
+                const moris::uint              aMyElementInd,
+                const moris::Matrix< DDSMat >& aElementTopology,
+                const moris::Matrix< DDRMat >& aElementRHS,
+                const moris::uint              aVectorIndex );
+
       protected:
         moris::Cell< moris_id > mNonZeroDigonal;
         moris::Cell< moris_id > mNonZeroOffDigonal;
@@ -75,7 +136,7 @@ namespace moris
         /**
          * indicated that this equation model is used for the sensitivity analysis
          */
-        void
+        virtual void
         set_is_sensitivity_analysis()
         {
             mIsForwardAnalysis = false;
@@ -85,7 +146,7 @@ namespace moris
         /**
          * indicated that this equation model is used for the forward analysis
          */
-        void
+        virtual void
         set_is_forward_analysis()
         {
             mIsForwardAnalysis = true;
@@ -128,6 +189,15 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        virtual sol::Dist_Vector*
+        get_solution_vector()
+        {
+            MORIS_ERROR( false, "Solver_Interface::get_solution_vector: not set." );
+            return nullptr;
+        }
+
+        //------------------------------------------------------------------------------
+
         virtual void
         set_eigen_solution_vector( sol::Dist_Vector* aSolutionVector )
         {
@@ -566,7 +636,8 @@ namespace moris
 
         /**
          * @brief builds thr graph based on the precomputed sparsity pattern
-         * This is for Petsc right now
+         * This is for Petsc right now. Without sparsity pattern, assembly plans are
+         * computed for the final graph.
          * 
          * @param aMat 
          * @param aUseSparsityPattern 
@@ -575,6 +646,16 @@ namespace moris
 
         //---------------------------------------------------------------------------------------------------------
 
+        /**
+         * @brief builds a graph with the diagonal entries of all dofs only. Used for the assembled
+         * approximation of a matrix-free operator, which the preconditioner is built from.
+         *
+         * @param aMat
+         */
+        void build_diagonal_graph( moris::sol::Dist_Matrix* aMat );
+
+        //---------------------------------------------------------------------------------------------------------
+
         void fill_matrix_and_RHS(
                 moris::sol::Dist_Matrix* aMat,
                 moris::sol::Dist_Vector* aVectorRHS );
@@ -149,6 +149,9 @@ Solver_Interface_Proxy::Solver_Interface_Proxy()
         mElementMatrixValues( 61, 0 ) = 0;
         mElementMatrixValues( 62, 0 ) = -3;
         mElementMatrixValues( 63, 0 ) = 12;
+
+        // element matrix as used by element by element operators, the assembly only uses its values
+        mElementMatrixValues.reshape( mNumDofsPerElement, mNumDofsPerElement );
     }
 }
 
@@ -14,6 +14,7 @@
 #include "cl_Matrix.hpp"
 #include "linalg_typedefs.hpp"
 #include "cl_DLA_Solver_Interface.hpp"
+#include "cl_SOL_Dist_Vector.hpp"
 #include "cl_Communication_Manager.hpp"    // COM/src
 #include "cl_Communication_Tools.hpp"      // COM/src
 
@@ -43,6 +44,12 @@ namespace moris
 
         sol::Dist_Vector* mEigVector;
 
+        // solution vector, used for a solution dependent residual
+        sol::Dist_Vector* mSolutionVector = nullptr;
+
+        // flag for the residual of the linear problem, i.e. element matrix times element solution minus RHS
+        bool mUseLinearResidual = false;
+
       public:
         // ----------------------------------------------------------------------------------------------
 
@@ -104,7 +111,27 @@ namespace moris
 
         // ----------------------------------------------------------------------------------------------
 
-        void set_solution_vector( sol::Dist_Vector* aSolutionVector ){};
+        void
+        set_solution_vector( sol::Dist_Vector* aSolutionVector )
+        {
+            mSolutionVector = aSolutionVector;
+        }
+
+        // ----------------------------------------------------------------------------------------------
+
+        sol::Dist_Vector*
+        get_solution_vector()
+        {
+            return mSolutionVector;
+        }
+
+        // ----------------------------------------------------------------------------------------------
+
+        void
+        set_use_linear_residual( bool aUseLinearResidual )
+        {
+            mUseLinearResidual = aUseLinearResidual;
+        }
 
         // ----------------------------------------------------------------------------------------------
         // local-to-global map
@@ -239,6 +266,17 @@ namespace moris
             {
                 aElementRHS( Ik ) = mMyRHSValues( Ik ).get_column( aMyElementInd );
             }
+
+            if ( mUseLinearResidual )
+            {
+                Cell< Matrix< DDRMat > > tElementSolution;
+
+                Matrix< DDSMat > tElementTopology = mEleDofConectivity.get_column( aMyElementInd );
+
+                mSolutionVector->extract_my_values( tElementTopology.numel(), tElementTopology, 0, tElementSolution );
+
+                aElementRHS( 0 ) = mElementMatrixValues * tElementSolution( 0 ) - aElementRHS( 0 );
+            }
         }
 
         //------------------------------------------------------------------------------
@@ -270,12 +308,7 @@ namespace moris
         {
             aElementMatrix = mElementMatrixValues;
 
-            aElementRHS.resize( mNumRHS );
-
-            for ( uint Ik = 0; Ik < mNumRHS; Ik++ )
-            {
-                aElementRHS( Ik ) = mMyRHSValues( Ik ).get_column( aMyElementInd );
-            }
+            this->get_equation_object_rhs( aMyEquSetInd, aMyElementInd, aElementRHS );
         }
 
         // ----------------------------------------------------------------------------------------------
@@ -161,6 +161,84 @@ TEST_CASE("Sum Dist Vector","[Sum Dist Vector],[DistLinAlg]")
     }
 }
 
+TEST_CASE("Sum Dist Vector Local Indices","[Sum Dist Vector Local Indices],[DistLinAlg]")
+{
+    // Determine process rank
+    size_t size = par_size();
+
+    if (size == 4)
+    {
+        // Build Input Class
+        Solver_Interface* tSolverInput = new Solver_Interface_Proxy( );
+
+        // Build matrix factory
+        sol::Matrix_Vector_Factory     tMatFactory;
+
+        // Build map
+        Dist_Map* tMap = tMatFactory.create_map( tSolverInput->get_my_local_global_map(),
+                                                   tSolverInput->get_constrained_Ids() );
+
+        // build distributed vectors
+        Dist_Vector * tVectorA = tMatFactory.create_vector( tSolverInput, tMap, 1 );
+        Dist_Vector * tVectorB = tMatFactory.create_vector( tSolverInput, tMap, 1 );
+
+        // Fill A with global IDs and B with local indices
+        for (moris::uint Ii=0; Ii< tSolverInput->get_num_my_elements(); Ii++)
+        {
+            Matrix< DDSMat > tElementTopology;
+            tSolverInput->get_element_topology(Ii, tElementTopology );
+
+            Cell< Matrix< DDRMat > > tElementRHS;
+            tSolverInput->get_equation_object_rhs(Ii, tElementRHS );
+
+            Matrix< DDSMat > tLocalIndices;
+            tVectorB->compute_local_indices( tElementTopology, tLocalIndices );
+
+            tVectorA->sum_into_global_values( tElementTopology, tElementRHS(0) );
+            tVectorB->sum_into_local_values( tLocalIndices, tElementTopology, tElementRHS(0) );
+        }
+        tVectorA->vector_global_assembly();
+        tVectorB->vector_global_assembly();
+
+        moris::Matrix< DDRMat > tSolA;
+        moris::Matrix< DDRMat > tSolB;
+
+        tVectorA->extract_copy( tSolA );
+        tVectorB->extract_copy( tSolB );
+
+        REQUIRE( tSolA.numel() == tSolB.numel() );
+
+        for ( uint Ik = 0; Ik < tSolA.numel(); Ik++ )
+        {
+            CHECK( equal_to( tSolA( Ik ), tSolB( Ik ) ) );
+        }
+
+        // extract owned values with local indices
+        Matrix< DDSMat > tOwnedIds( tVectorB->vec_local_length(), 1 );
+
+        for ( sint Ik = 0; Ik < tVectorB->vec_local_length(); Ik++ )
+        {
+            tOwnedIds( Ik ) = tMap->get_epetra_map()->GID( Ik );
+        }
+
+        Matrix< DDSMat > tLocalIndices;
+        REQUIRE( tVectorB->compute_local_indices( tOwnedIds, tLocalIndices ) );
+
+        Cell< Matrix< DDRMat > > tValues;
+        tVectorB->extract_local_values( tLocalIndices, tValues );
+
+        for ( sint Ik = 0; Ik < tVectorB->vec_local_length(); Ik++ )
+        {
+            CHECK( equal_to( tValues( 0 )( Ik ), tSolB( Ik ) ) );
+        }
+
+        delete( tSolverInput );
+        delete( tVectorA );
+        delete( tVectorB );
+        delete tMap;
+    }
+}
+
 TEST_CASE("Scale Dist Vector","[Scale Dist Vector],[DistLinAlg]")
 {
     // Determine process rank
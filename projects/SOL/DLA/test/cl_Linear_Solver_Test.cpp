@@ -10,6 +10,7 @@
 
 #include "catch.hpp"
 #include "fn_equal_to.hpp"    // ALG/src
+#include "fn_norm.hpp"
 #include "typedefs.hpp"       // COR/src
 #include "cl_Matrix.hpp"
 #include "linalg_typedefs.hpp"
@@ -30,8 +31,11 @@
 #include "cl_Solver_Interface_Proxy.hpp"       // DLA/src/
 #include "cl_DLA_Solver_Factory.hpp"           // DLA/src/
 #include "cl_SOL_Warehouse.hpp"
+#include "fn_PRM_SOL_Parameters.hpp"
 
-#include "cl_DLA_Linear_System_Trilinos.hpp"    // DLA/src/
+#include "cl_DLA_Linear_System_Trilinos.hpp"          // DLA/src/
+#include "cl_DLA_Matrix_Free_Operator_Epetra.hpp"    // DLA/src/
+#include "cl_Vector_Epetra.hpp"                       // SOL/SOL_CORE/src/
 
 extern moris::Comm_Manager gMorisComm;
 namespace moris
@@ -91,6 +95,108 @@ namespace moris
             }
         }
 
+        TEST_CASE( "Matrix Free Operator Epetra", "[Matrix Free Operator],[DistLinAlg]" )
+        {
+            if ( par_size() == 4 )
+            {
+                Solver_Interface* tSolverInterface = new Solver_Interface_Proxy();
+
+                Solver_Factory tSolFactory;
+
+                // create and assemble linear system as reference
+                Linear_Problem* tLinProblem = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Epetra );
+
+                tLinProblem->assemble_residual_and_jacobian();
+
+                // the proxy returns the mass matrix once all element matrices were requested, use a new one.
+                // Its residual depends on the solution such that the operator can be applied by finite differences
+                Solver_Interface_Proxy* tOperatorInterface = new Solver_Interface_Proxy();
+                tOperatorInterface->set_use_linear_residual( true );
+
+                sol::Dist_Map* tFreeMap = tLinProblem->get_solver_RHS()->get_map();
+
+                sol::Matrix_Vector_Factory tMatFactory( sol::MapType::Epetra );
+
+                sol::Dist_Map* tFullMap = tMatFactory.create_full_map(
+                        tOperatorInterface->get_my_local_global_map(),
+                        tOperatorInterface->get_my_local_global_overlapping_map() );
+
+                sol::Dist_Vector* tSolution = tMatFactory.create_vector( tOperatorInterface, tFullMap, 1 );
+                tSolution->random();
+
+                tOperatorInterface->set_solution_vector( tSolution );
+
+                Matrix_Free_Operator_Epetra tOperator( tOperatorInterface, tFreeMap );
+
+                sol::Dist_Vector* tInput          = tMatFactory.create_vector( tSolverInterface, tFreeMap, 1, true );
+                sol::Dist_Vector* tMatrixResult   = tMatFactory.create_vector( tSolverInterface, tFreeMap, 1, true );
+                sol::Dist_Vector* tOperatorResult = tMatFactory.create_vector( tSolverInterface, tFreeMap, 1, true );
+                sol::Dist_Vector* tDiagonal       = tMatFactory.create_vector( tSolverInterface, tFreeMap, 1, true );
+
+                tInput->random();
+
+                // apply assembled and matrix free operator, the element Jacobians are only used for the diagonal
+                tLinProblem->get_matrix()->mat_vec_product( *tInput, *tMatrixResult, false );
+
+                tOperator.compute_diagonal( *dynamic_cast< Vector_Epetra* >( tDiagonal )->get_epetra_vector() );
+
+                tOperator.Apply(
+                        *dynamic_cast< Vector_Epetra* >( tInput )->get_epetra_vector(),
+                        *dynamic_cast< Vector_Epetra* >( tOperatorResult )->get_epetra_vector() );
+
+                real tNorm = tMatrixResult->vec_norm2()( 0 );
+
+                tOperatorResult->vec_plus_vec( -1.0, *tMatrixResult, 1.0 );
+
+                // finite differences of a linear residual are only limited by round-off
+                CHECK( tOperatorResult->vec_norm2()( 0 ) < 1.0e-6 * tNorm );
+
+                // the perturbed solution is restored
+                Matrix< DDRMat > tSolutionBefore;
+                tSolution->extract_copy( tSolutionBefore );
+
+                tOperator.Apply(
+                        *dynamic_cast< Vector_Epetra* >( tInput )->get_epetra_vector(),
+                        *dynamic_cast< Vector_Epetra* >( tOperatorResult )->get_epetra_vector() );
+
+                Matrix< DDRMat > tSolutionAfter;
+                tSolution->extract_copy( tSolutionAfter );
+
+                CHECK( norm( tSolutionAfter - tSolutionBefore ) == 0.0 );
+
+                // element matrices are computed once with the diagonal and reused by all following applications.
+                // A second request of all element matrices would return the mass matrix of the proxy.
+                Solver_Interface* tStoringInterface = new Solver_Interface_Proxy();
+
+                Matrix_Free_Operator_Epetra tStoringOperator( tStoringInterface, tFreeMap, true );
+
+                tStoringOperator.compute_diagonal( *dynamic_cast< Vector_Epetra* >( tDiagonal )->get_epetra_vector() );
+
+                for ( uint iApply = 0; iApply < 2; iApply++ )
+                {
+                    tStoringOperator.Apply(
+                            *dynamic_cast< Vector_Epetra* >( tInput )->get_epetra_vector(),
+                            *dynamic_cast< Vector_Epetra* >( tOperatorResult )->get_epetra_vector() );
+
+                    tOperatorResult->vec_plus_vec( -1.0, *tMatrixResult, 1.0 );
+
+                    CHECK( tOperatorResult->vec_norm2()( 0 ) < 1.0e-12 * tNorm );
+                }
+
+                delete tDiagonal;
+                delete tSolution;
+                delete tFullMap;
+                delete tInput;
+                delete tMatrixResult;
+                delete tOperatorResult;
+
+                delete ( tSolverInterface );
+                delete ( tOperatorInterface );
+                delete ( tStoringInterface );
+                delete ( tLinProblem );
+            }
+        }
+
         TEST_CASE( "Linear Solver Aztec", "[Linear Solver Aztec],[Linear Solver],[DistLinAlg]" )
         {
             if ( par_size() == 4 )
@@ -186,6 +292,50 @@ namespace moris
             }
         }
 
+        TEST_CASE( "Linear Solver Aztec Single Precision ILU", "[Linear Solver Aztec],[Linear Solver],[DistLinAlg]" )
+        {
+            if ( par_size() == 4 )
+            {
+                Solver_Interface* tSolverInterface = new Solver_Interface_Proxy();
+
+                Solver_Factory tSolFactory;
+
+                Linear_Problem* tLinProblem = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Epetra );
+
+                std::shared_ptr< Linear_Solver_Algorithm > tLinSolver = tSolFactory.create_solver( sol::SolverType::AZTEC_IMPL );
+
+                tLinProblem->assemble_residual_and_jacobian();
+
+                tLinSolver->set_param( "AZ_max_iter" )    = 200;
+                tLinSolver->set_param( "AZ_diagnostics" ) = AZ_none;
+                tLinSolver->set_param( "AZ_output" )      = AZ_none;
+
+                // ILU factors stored in single precision, Krylov iteration in double precision
+                tLinSolver->set_param( "ifpack_prec_type" )      = std::string( "ILU" );
+                tLinSolver->set_param( "fact: level-of-fill" )   = 1;
+                tLinSolver->set_param( "prec_single_precision" ) = true;
+
+                tLinSolver->solve_linear_system( tLinProblem );
+
+                moris::Matrix< DDRMat > tSol;
+                tLinProblem->get_solution( tSol );
+
+                // Check if solution corresponds to given solution
+                if ( par_rank() == 0 )
+                {
+                    CHECK( equal_to( tSol( 0, 0 ), -0.0138889, 1.0e+08 ) );
+                    CHECK( equal_to( tSol( 5, 0 ), -0.00694444, 1.0e+08 ) );
+                }
+                if ( par_rank() == 3 )
+                {
+                    CHECK( equal_to( tSol( 3, 0 ), -0.0138889, 1.0e+08 ) );
+                }
+
+                delete ( tSolverInterface );
+                delete ( tLinProblem );
+            }
+        }
+
         TEST_CASE( "Linear Solver Belos multiple RHS", "[Linear Solver multiple RHS],[Linear Solver],[DistLinAlg]" )
         {
             if ( par_size() == 1 )
@@ -221,6 +371,52 @@ namespace moris
             }
         }
 
+        TEST_CASE( "Linear Solver Belos Recycling GMRES", "[Linear Solver Belos Recycling],[Linear Solver],[DistLinAlg]" )
+        {
+            if ( par_size() == 1 )
+            {
+                Solver_Interface* tSolverInterface = new Solver_Interface_Proxy( 1 );
+
+                Solver_Factory tSolFactory;
+
+                Linear_Problem* tLinProblem = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Epetra );
+
+                std::shared_ptr< Linear_Solver_Algorithm > tLinSolver = tSolFactory.create_solver( sol::SolverType::BELOS_IMPL );
+
+                tLinSolver->set_param( "Solver Type" )         = std::string( "Recycling GMRES" );
+                tLinSolver->set_param( "Num Blocks" )          = 10;
+                tLinSolver->set_param( "Num Recycled Blocks" ) = 2;
+
+                tLinProblem->assemble_jacobian();
+                tLinProblem->assemble_residual();
+
+                // second solve of the same system reuses the recycle space of the first one
+                moris::Cell< uint > tNumIterations( 2, 0 );
+
+                for ( sint iSolve = 1; iSolve <= 2; iSolve++ )
+                {
+                    tLinProblem->get_free_solver_LHS()->vec_put_scalar( 0.0 );
+
+                    tLinSolver->solve_linear_system( tLinProblem, iSolve );
+
+                    tNumIterations( iSolve - 1 ) = tLinSolver->get_num_iterations();
+
+                    moris::Matrix< DDRMat > tSol;
+                    tLinProblem->get_solution( tSol );
+
+                    CHECK( equal_to( tSol( 5, 0 ), -0.0138889, 1.0e+08 ) );
+                    CHECK( equal_to( tSol( 12, 0 ), -0.00694444, 1.0e+08 ) );
+                }
+
+                // the recycled Krylov space reduces the number of iterations of the second solve
+                CHECK( tNumIterations( 0 ) > 0 );
+                CHECK( tNumIterations( 1 ) < tNumIterations( 0 ) );
+
+                delete ( tSolverInterface );
+                delete ( tLinProblem );
+            }
+        }
+
 #ifdef MORIS_HAVE_PETSC
         TEST_CASE( "Linear System PETSc single RHS", "[Linear Solver single RHS],[Linear Solver],[DistLinAlg]" )
         {
@@ -386,5 +582,176 @@ namespace moris
             }
         }
 
+        TEST_CASE( "Eigen Solver Block Davidson Warm Start", "[Eigen Solver Block Davidson Warm Start],[Eigen Solver], [EigSolve]" )
+        {
+            if ( par_size() == 1 )
+            {
+                Solver_Interface_Proxy* tSolverInterface = new Solver_Interface_Proxy( std::string( "Block_Davidson_Eigen" ) );
+
+                Solver_Factory tSolFactory;
+
+                sol::SOL_Warehouse tSolverWarehouse( tSolverInterface );
+
+                std::string tRHSMatType = std::string( "MassMat" );
+                ( &tSolverWarehouse )->set_RHS_mat_type( tRHSMatType );
+
+                sol::Matrix_Vector_Factory tMatFactory( sol::MapType::Epetra );
+
+                sol::Dist_Map* tMap = tMatFactory.create_map( tSolverInterface->get_my_local_global_map() );
+
+                sol::Dist_Map* tMapFull = tMatFactory.create_full_map(
+                        tSolverInterface->get_my_local_global_map(),
+                        tSolverInterface->get_my_local_global_overlapping_map() );
+
+                Linear_Problem* tEigProblem = tSolFactory.create_linear_system( tSolverInterface, &tSolverWarehouse, tMap, tMapFull, sol::MapType::Epetra );
+
+                std::shared_ptr< Linear_Solver_Algorithm > tEigSolver = tSolFactory.create_solver( sol::SolverType::EIGEN_SOLVER );
+
+                tEigSolver->set_param( "Eigen_Algorithm" )                = std::string( "EIGALG_BLOCK_DAVIDSON" );
+                tEigSolver->set_param( "Which" )                          = std::string( "SM" );
+                tEigSolver->set_param( "Verbosity" )                      = false;
+                tEigSolver->set_param( "Block_Size" )                     = 1;
+                tEigSolver->set_param( "Num_Blocks" )                     = 2;
+                tEigSolver->set_param( "NumFreeDofs" )                    = 8;
+                tEigSolver->set_param( "Num_Eig_Vals" )                   = 1;
+                tEigSolver->set_param( "MaxSubSpaceDims" )                = 6;
+                tEigSolver->set_param( "MaxRestarts" )                    = 20;
+                tEigSolver->set_param( "Initial_Guess" )                  = 0;
+                tEigSolver->set_param( "Convergence_Tolerance" )          = 1e-05;
+                tEigSolver->set_param( "Relative_Convergence_Tolerance" ) = true;
+                tEigSolver->set_param( "ifpack_prec_type" )               = std::string( "Amesos" );
+                tEigSolver->set_param( "amesos: solver type" )            = std::string( "Amesos_Pardiso" );
+                tEigSolver->set_param( "overlap-level" )                  = 0;
+                tEigSolver->set_param( "schwarz: combine mode" )          = std::string( "add" );
+                tEigSolver->set_param( "prec_reuse" )                     = true;
+                tEigSolver->set_param( "Warm_Start" )                     = true;
+                tEigSolver->set_param( "Update_Flag" )                    = false;
+
+                tEigProblem->assemble_jacobian();
+
+                // second solve starts from eigenvector and preconditioner of first solve
+                for ( uint iSolve = 0; iSolve < 2; iSolve++ )
+                {
+                    tEigSolver->solve_linear_system( tEigProblem, 0 );
+
+                    std::vector< Anasazi::Value< double > > tSol = dynamic_cast< Eigen_Solver* >( tEigSolver.get() )->get_eigen_values();
+
+                    CHECK( equal_to( tSol[ 0 ].realpart, 0.5, 1.0e+08 ) );
+                }
+
+                delete ( tSolverInterface );
+                delete ( tEigProblem );
+            }
+        }
+
+        TEST_CASE( "Eigen Solver Block Davidson Warm Start Rebuild", "[Eigen Solver Block Davidson Warm Start Rebuild],[Eigen Solver], [EigSolve]" )
+        {
+            if ( par_size() == 1 )
+            {
+                Solver_Interface_Proxy* tSolverInterface = new Solver_Interface_Proxy( std::string( "Block_Davidson_Eigen" ) );
+
+                Solver_Factory tSolFactory;
+
+                sol::SOL_Warehouse tSolverWarehouse( tSolverInterface );
+
+                std::string tRHSMatType = std::string( "MassMat" );
+                ( &tSolverWarehouse )->set_RHS_mat_type( tRHSMatType );
+
+                sol::Matrix_Vector_Factory tMatFactory( sol::MapType::Epetra );
+
+                ParameterList tEigenParameters = prm::create_eigen_algorithm_parameter_list();
+                tEigenParameters.set( "Eigen_Algorithm", std::string( "EIGALG_BLOCK_DAVIDSON" ) );
+                tEigenParameters.set( "Which", std::string( "SM" ) );
+                tEigenParameters.set( "Verbosity", false );
+                tEigenParameters.set( "Block_Size", 1 );
+                tEigenParameters.set( "Num_Blocks", 2 );
+                tEigenParameters.set( "NumFreeDofs", 8 );
+                tEigenParameters.set( "Num_Eig_Vals", 1 );
+                tEigenParameters.set( "MaxSubSpaceDims", 6 );
+                tEigenParameters.set( "MaxRestarts", 20 );
+                tEigenParameters.set( "Convergence_Tolerance", 1e-05 );
+                tEigenParameters.set( "Relative_Convergence_Tolerance", true );
+                tEigenParameters.set( "ifpack_prec_type", std::string( "Amesos" ) );
+                tEigenParameters.set( "amesos: solver type", std::string( "Amesos_Pardiso" ) );
+                tEigenParameters.set( "prec_reuse", true );
+                tEigenParameters.set( "Warm_Start", true );
+                tEigenParameters.set( "Update_Flag", false );
+
+                // solve of the first design with a cold start
+                sol::Dist_Map* tMap = tMatFactory.create_map( tSolverInterface->get_my_local_global_map() );
+
+                sol::Dist_Map* tMapFull = tMatFactory.create_full_map(
+                        tSolverInterface->get_my_local_global_map(),
+                        tSolverInterface->get_my_local_global_overlapping_map() );
+
+                Linear_Problem* tEigProblem = tSolFactory.create_linear_system( tSolverInterface, &tSolverWarehouse, tMap, tMapFull, sol::MapType::Epetra );
+
+                std::shared_ptr< Linear_Solver_Algorithm > tEigSolver = tSolFactory.create_solver( sol::SolverType::EIGEN_SOLVER, tEigenParameters );
+
+                tEigProblem->assemble_jacobian();
+
+                tEigSolver->solve_linear_system( tEigProblem, 0 );
+
+                uint tColdIterations = tEigSolver->get_num_iterations();
+
+                // rebuild the warehouse as the model does for every design, handing over the warm starts
+                moris::Cell< moris::Cell< moris::ParameterList > > tParameterlist( 7 );
+                for ( uint Ik = 0; Ik < 7; Ik++ )
+                {
+                    tParameterlist( Ik ).resize( 1 );
+                }
+
+                tParameterlist( 0 )( 0 ) = tEigenParameters;
+                tParameterlist( 1 )( 0 ) = moris::prm::create_linear_solver_parameter_list();
+                tParameterlist( 2 )( 0 ) = moris::prm::create_nonlinear_algorithm_parameter_list();
+                tParameterlist( 3 )( 0 ) = moris::prm::create_nonlinear_solver_parameter_list();
+                tParameterlist( 3 )( 0 ).set( "NLA_DofTypes", "L2" );
+                tParameterlist( 4 )( 0 ) = moris::prm::create_time_solver_algorithm_parameter_list();
+                tParameterlist( 5 )( 0 ) = moris::prm::create_time_solver_parameter_list();
+                tParameterlist( 5 )( 0 ).set( "TSA_DofTypes", "L2" );
+                tParameterlist( 5 )( 0 ).set( "TSA_Output_Indices", "" );
+                tParameterlist( 5 )( 0 ).set( "TSA_Output_Criteria", "" );
+                tParameterlist( 6 )( 0 ) = moris::prm::create_solver_warehouse_parameterlist();
+
+                std::shared_ptr< Eigen_Solver_Warm_Start > tWarmStart = dynamic_cast< Eigen_Solver* >( tEigSolver.get() )->get_warm_start();
+
+                sol::SOL_Warehouse tRebuiltWarehouse( tSolverInterface );
+                tRebuiltWarehouse.set_parameterlist( tParameterlist );
+                tRebuiltWarehouse.set_eigen_solver_warm_starts( { tWarmStart } );
+                tRebuiltWarehouse.initialize();
+
+                REQUIRE( tRebuiltWarehouse.get_eigen_solver_warm_starts().size() == 1 );
+                CHECK( tRebuiltWarehouse.get_eigen_solver_warm_starts()( 0 ) == tWarmStart );
+
+                // solve of the next design with a new solver, linear system and map
+                sol::Dist_Map* tRebuiltMap = tMatFactory.create_map( tSolverInterface->get_my_local_global_map() );
+
+                sol::Dist_Map* tRebuiltMapFull = tMatFactory.create_full_map(
+                        tSolverInterface->get_my_local_global_map(),
+                        tSolverInterface->get_my_local_global_overlapping_map() );
+
+                Linear_Problem* tRebuiltEigProblem = tSolFactory.create_linear_system( tSolverInterface, &tSolverWarehouse, tRebuiltMap, tRebuiltMapFull, sol::MapType::Epetra );
+
+                std::shared_ptr< Linear_Solver_Algorithm > tRebuiltEigSolver = tSolFactory.create_solver( sol::SolverType::EIGEN_SOLVER, tEigenParameters );
+
+                dynamic_cast< Eigen_Solver* >( tRebuiltEigSolver.get() )->set_warm_start( tRebuiltWarehouse.get_eigen_solver_warm_starts()( 0 ) );
+
+                tRebuiltEigProblem->assemble_jacobian();
+
+                tRebuiltEigSolver->solve_linear_system( tRebuiltEigProblem, 0 );
+
+                std::vector< Anasazi::Value< double > > tSol = dynamic_cast< Eigen_Solver* >( tRebuiltEigSolver.get() )->get_eigen_values();
+
+                CHECK( equal_to( tSol[ 0 ].realpart, 0.5, 1.0e+08 ) );
+
+                // the eigenvector of the previous design is a better initial vector than a random one
+                CHECK( tRebuiltEigSolver->get_num_iterations() < tColdIterations );
+
+                delete ( tSolverInterface );
+                delete ( tEigProblem );
+                delete ( tRebuiltEigProblem );
+            }
+        }
+
     }    // namespace dla
 }    // namespace moris
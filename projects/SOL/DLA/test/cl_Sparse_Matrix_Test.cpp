@@ -101,6 +101,81 @@ namespace moris
             }
         }
 
+        TEST_CASE( "Sparse Mat Assembly Plan", "[Sparse Mat Assembly Plan],[DistLinAlg]" )
+        {
+            // Determine process rank
+            size_t rank = par_rank();
+            size_t size = par_size();
+
+            if ( size == 4 )
+            {
+                // Build Input Class
+                Solver_Interface* tSolverInput = new Solver_Interface_Proxy();
+
+                // Build matrix factory
+                Matrix_Vector_Factory tMatFactory;
+
+                // Build map
+                Dist_Map* tLocalMap = tMatFactory.create_map( tSolverInput->get_my_local_global_map(),
+                        tSolverInput->get_constrained_Ids() );
+
+                // Create pointer to sparse matrix
+                sol::Dist_Matrix* tMat = tMatFactory.create_matrix( tSolverInput, tLocalMap );
+
+                // Build sparse matrix graph
+                for ( moris::uint Ii = 0; Ii < tSolverInput->get_num_my_elements(); Ii++ )
+                {
+                    Matrix< DDSMat > tElementTopology;
+                    tSolverInput->get_element_topology( Ii, tElementTopology );
+
+                    tMat->build_graph( tElementTopology.n_rows(), tElementTopology );
+                }
+
+                // Call Global Asemby to ship information between processes
+                tMat->matrix_global_assembly();
+
+                // Fill element matrices into global matrix using precomputed local rows and offsets
+                for ( uint Ii = 0; Ii < tSolverInput->get_num_my_elements(); Ii++ )
+                {
+                    Matrix< DDSMat > tElementTopology;
+                    tSolverInput->get_element_topology( Ii, tElementTopology );
+
+                    Matrix< DDSMat > tLocalRows;
+                    Matrix< DDSMat > tValueOffsets;
+                    REQUIRE( tMat->compute_assembly_plan( tElementTopology, tLocalRows, tValueOffsets ) );
+
+                    Matrix< DDRMat > tElementMatrix;
+                    tSolverInput->get_equation_object_operator( Ii, tElementMatrix );
+
+                    tMat->fill_matrix_with_plan( tElementMatrix, tElementTopology, tLocalRows, tValueOffsets );
+                }
+
+                // Call Global Asemby to ship information between processes
+                tMat->matrix_global_assembly();
+
+                // Set up output matrix
+                sint tGlobalRow  = 8;
+                sint tLength     = 13;
+                sint tNumEntries = 5;
+
+                moris::Matrix< DDRMat > tValues( tLength, 1, 0.0 );
+
+                // Get matrix values
+                tMat->get_matrix()->ExtractGlobalRowCopy( tGlobalRow, tLength, tNumEntries, tValues.data() );
+
+                // Compare to values assembled with global IDs
+                if ( rank == 0 )
+                {
+                    CHECK( equal_to( tValues( 0, 0 ), 24 ) );
+                    CHECK( equal_to( tValues( 4, 0 ), -6 ) );
+                    CHECK( equal_to( tValues( 8, 0 ), -3 ) );
+                }
+                delete ( tSolverInput );
+                delete ( tLocalMap );
+                delete ( tMat );
+            }
+        }
+
         TEST_CASE( "Scale Sparse Mat", "[Scale Sparse Mat],[DistLinAlg]" )
         {
             // Determine process rank
@@ -98,6 +98,25 @@ Newton_Solver::solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem )
     // set solver load control strategy
     Solver_Load_Control tLoadControlStrategy( mParameterListNonlinearSolver );
 
+    // get options for Jacobian-free Newton-Krylov
+    bool tJacobianFree            = mParameterListNonlinearSolver.get< bool >( "NLA_jacobian_free" );
+    sint tJacobianRebuildFreq     = mParameterListNonlinearSolver.get< sint >( "NLA_jacobian_free_rebuild_frequency" );
+    real tJacobianStagnationRatio = mParameterListNonlinearSolver.get< real >( "NLA_jacobian_free_stagnation_ratio" );
+
+    if ( tJacobianFree )
+    {
+        MORIS_ERROR( mMyNonLinSolverManager->get_solver_interface()->get_is_forward_analysis(),
+                "Newton_Solver::solver_nonlinear_system - Jacobian-free Newton-Krylov only implemented for forward analysis.\n" );
+
+        // Jacobian-vector products are formed with the current solution vector
+        mNonlinearProblem->get_linearized_problem()->set_jacobian_free( mNonlinearProblem->get_full_vector() );
+    }
+
+    // iteration of last Jacobian assembly and residual norms of the last two iterations
+    sint tJacobianIt            = 1;
+    real tResidualNorm          = MORIS_REAL_MAX;
+    real tPreviousResidualNorm  = MORIS_REAL_MAX;
+
     // initialize flags
     bool tIsConverged     = false;
     bool tRebuildJacobian = true;
@@ -119,6 +138,19 @@ Newton_Solver::solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem )
             tRebuildJacobian = mParameterListNonlinearSolver.get< bool >( "NLA_rebuild_jacobian" );
         }
 
+        // Jacobian-free: the Jacobian only serves as preconditioner and is rebuilt
+        // every couple of iterations or if the residual stagnates
+        if ( tJacobianFree && It > 1 )
+        {
+            tRebuildJacobian = It - tJacobianIt >= tJacobianRebuildFreq
+                            || tResidualNorm > tJacobianStagnationRatio * tPreviousResidualNorm;
+        }
+
+        if ( tRebuildJacobian )
+        {
+            tJacobianIt = It;
+        }
+
         // For sensitivity analysis only: set current solution to LHS of linear system as residual is defined by A x - b
         if ( !mMyNonLinSolverManager->get_solver_interface()->get_is_forward_analysis() )
         {
@@ -145,7 +177,10 @@ Newton_Solver::solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem )
         }
         else
         {
-            mNonlinearProblem->build_linearized_problem( tRebuildJacobian, tCombinedResJacAssembly, It );
+            // combined assembly would always build the Jacobian
+            bool tCombinedAssembly = tCombinedResJacAssembly && ( tRebuildJacobian || !tJacobianFree );
+
+            mNonlinearProblem->build_linearized_problem( tRebuildJacobian, tCombinedAssembly, It );
         }
 
         // check for convergence
@@ -158,6 +193,12 @@ Newton_Solver::solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem )
                 tMaxIts,
                 tHardBreak );
 
+        if ( tJacobianFree )
+        {
+            tPreviousResidualNorm = tResidualNorm;
+            tResidualNorm         = mMyNonLinSolverManager->get_residual_norm();
+        }
+
         // exit if convergence criterion is met
         if ( tIsConverged and tLoadFactor >= 1.0 )
         {
@@ -212,6 +253,12 @@ Newton_Solver::solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem )
                 *mNonlinearProblem->get_linearized_problem()->get_full_solver_LHS(),
                 1.0 );
     }
+
+    // subsequent solves, e.g. adjoint solves, use the assembled Jacobian
+    if ( tJacobianFree )
+    {
+        mNonlinearProblem->get_linearized_problem()->set_jacobian_free( nullptr );
+    }
 }
 
 //--------------------------------------------------------------------------------------------------------------------------
@@ -123,6 +123,8 @@ void NLA_Solver_Interface_Proxy::get_equation_object_operator(
     mSolutionVector->extract_copy( mMySolVec );
 
     aElementMatrix = mFunctionJac( mNX, mNY, mMySolVec, aMyElementInd );
+
+    mNumElementJacobians++;
 }
 
 // ----------------------------------------------------------------------------------------------
@@ -135,6 +137,8 @@ void NLA_Solver_Interface_Proxy::get_equation_object_operator(
     mSolutionVector->extract_copy( mMySolVec );
 
     aElementMatrix = mFunctionJac( mNX, mNY, mMySolVec, aMyElementInd );
+
+    mNumElementJacobians++;
 }
 
 // ----------------------------------------------------------------------------------------------
@@ -149,6 +153,8 @@ void NLA_Solver_Interface_Proxy::get_equation_object_operator_and_rhs(
     mSolutionVector->extract_copy( mMySolVec );
 
     aElementMatrix = mFunctionJac( mNX, mNY, mMySolVec, aMyElementInd );
+
+    mNumElementJacobians++;
 }
 
 // ----------------------------------------------------------------------------------------------
@@ -164,5 +170,7 @@ void NLA_Solver_Interface_Proxy::get_equation_object_operator_and_rhs(
     aElementRHS = { mFunctionRes( mNX, mNY, mTime(1), mMySolVec, aMyElementInd ) };
 
     aElementMatrix = mFunctionJac( mNX, mNY, mMySolVec, aMyElementInd );
+
+    mNumElementJacobians++;
 }
 
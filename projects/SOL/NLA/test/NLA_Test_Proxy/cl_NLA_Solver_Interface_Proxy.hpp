@@ -60,6 +60,9 @@ namespace moris
 
             moris::Cell< enum MSI::Dof_Type > mListOfDofTypes;
 
+            // number of element Jacobians computed
+            moris::uint mNumElementJacobians = 0;
+
           public:
             // ----------------------------------------------------------------------------
 
@@ -101,6 +104,17 @@ namespace moris
 
             void set_solution_vector( sol::Dist_Vector* aSolutionVector );
 
+            // ----------------------------------------------------------------------------------------------
+
+            /**
+             * returns the number of Jacobian assemblies, i.e. the number of Jacobians computed for all elements
+             */
+            moris::uint
+            get_num_jacobian_assemblies()
+            {
+                return mNumElementJacobians / mNumElements;
+            }
+
             // ----------------------------------------------------------------------------
 
             void free_block_memory( const uint aBlockInd ){};
@@ -439,6 +439,99 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        TEST_CASE( "Newton Solver Test Jacobian Free", "[NLA],[NLA_Test_Jacobian_Free]" )
+        {
+            if ( par_size() == 1 )
+            {
+                // solves the problem Jacobian-free and returns the number of Jacobian assemblies and Newton iterations
+                auto tSolveJacobianFree = []( sint aRebuildFrequency, real aStagnationRatio, uint& aNumJacobians, uint& aNumIterations ) {
+                    NLA_Solver_Interface_Proxy* tSolverInput = new NLA_Solver_Interface_Proxy( 2, 1, 1, 1, test_residual1, test_jacobian1, test_topo1 );
+
+                    dla::Linear_Solver* tLinSolManager = new dla::Linear_Solver();
+                    Nonlinear_Solver    tNonLinSolManager;
+                    tNonLinSolManager.set_solver_interface( tSolverInput );
+
+                    Nonlinear_Problem* tNonlinearProblem = new Nonlinear_Problem( tSolverInput );
+
+                    Nonlinear_Solver_Factory tNonlinFactory;
+
+                    std::shared_ptr< Nonlinear_Algorithm > tNonlLinSolverAlgorithm =
+                            tNonlinFactory.create_nonlinear_solver( NonlinearSolverType::NEWTON_SOLVER );
+
+                    tNonlLinSolverAlgorithm->set_linear_solver( tLinSolManager );
+
+                    // Jacobian-vector products from residuals, Jacobian for preconditioner only rebuilt every couple of
+                    // iterations or if the residual stagnates
+                    sint tMaxIter = 20;
+
+                    tNonlLinSolverAlgorithm->set_param( "NLA_max_iter" )                        = tMaxIter;
+                    tNonlLinSolverAlgorithm->set_param( "NLA_hard_break" )                      = false;
+                    tNonlLinSolverAlgorithm->set_param( "NLA_jacobian_free" )                   = true;
+                    tNonlLinSolverAlgorithm->set_param( "NLA_jacobian_free_rebuild_frequency" ) = aRebuildFrequency;
+                    tNonlLinSolverAlgorithm->set_param( "NLA_jacobian_free_stagnation_ratio" )  = aStagnationRatio;
+
+                    tNonLinSolManager.set_nonlinear_algorithm( tNonlLinSolverAlgorithm, 0 );
+
+                    dla::Solver_Factory tSolFactory;
+
+                    std::shared_ptr< dla::Linear_Solver_Algorithm > tLinSolver = tSolFactory.create_solver( sol::SolverType::AZTEC_IMPL );
+
+                    tLinSolver->set_param( "AZ_diagnostics" )   = AZ_none;
+                    tLinSolver->set_param( "AZ_output" )        = AZ_none;
+                    tLinSolver->set_param( "AZ_solver" )        = AZ_gmres;
+                    tLinSolver->set_param( "ifpack_prec_type" ) = std::string( "ILU" );
+
+                    tLinSolManager->set_linear_algorithm( 0, tLinSolver );
+
+                    tNonLinSolManager.solve( tNonlinearProblem );
+
+                    Matrix< DDSMat > tGlobalIndExtract( 2, 1, 0 );
+                    tGlobalIndExtract( 1, 0 ) = 1;
+                    moris::Cell< Matrix< DDRMat > > tMyValues;
+
+                    tNonlLinSolverAlgorithm->extract_my_values( 2, tGlobalIndExtract, 0, tMyValues );
+
+                    // finite difference Jacobian converges to the same solution
+                    CHECK( equal_to( tMyValues( 0 )( 0, 0 ), 0.04011965, 1.0e+10 ) );
+                    CHECK( equal_to( tMyValues( 0 )( 1, 0 ), 0.0154803, 1.0e+10 ) );
+
+                    aNumJacobians  = tSolverInput->get_num_jacobian_assemblies();
+                    aNumIterations = std::round( tNonLinSolManager.get_relative_number_iterations() * tMaxIter );
+
+                    delete ( tNonlinearProblem );
+                    delete ( tLinSolManager );
+                    delete ( tSolverInput );
+                };
+
+                uint tNumJacobians  = 0;
+                uint tNumIterations = 0;
+
+                // rebuild every 3 iterations without stagnation, i.e. in iterations 1, 4, 7, ...
+                tSolveJacobianFree( 3, 1.0e+12, tNumJacobians, tNumIterations );
+
+                REQUIRE( tNumIterations > 3 );
+                CHECK( tNumJacobians == ( tNumIterations + 2 ) / 3 );
+
+                // rebuild every 3 iterations and on stagnation with the default ratio; less often than every iteration
+                tSolveJacobianFree( 3, 0.5, tNumJacobians, tNumIterations );
+
+                CHECK( tNumJacobians >= ( tNumIterations + 2 ) / 3 );
+                CHECK( tNumJacobians < tNumIterations );
+
+                // a residual which is not reduced to zero is treated as stagnation, rebuild in every iteration
+                tSolveJacobianFree( 100, 0.0, tNumJacobians, tNumIterations );
+
+                CHECK( tNumJacobians == tNumIterations );
+
+                // no stagnation and no periodic rebuild, the Jacobian of the first iteration is kept
+                tSolveJacobianFree( 100, 1.0e+12, tNumJacobians, tNumIterations );
+
+                CHECK( tNumJacobians == 1 );
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
 #ifdef MORIS_HAVE_PETSC
         TEST_CASE( "Newton Solver Test Petsc", "[NLA],[NLA_Test_Petsc]" )
         {
@@ -34,9 +34,23 @@ namespace moris
     {
         class Dist_Map
         {
+          private:
+            // unique id of this map, used to check if local indices computed for this map are still valid
+            const moris::uint mMapId;
+
+            // ---------------------------------------------------------------------------------------------------------
+
+            static moris::uint
+            get_new_map_id()
+            {
+                static moris::uint sMapCounter = 0;
+                return sMapCounter++;
+            }
+
           public:
             // ---------------------------------------------------------------------------------------------------------
-            Dist_Map(){};
+            Dist_Map()
+                    : mMapId( get_new_map_id() ){};
 
             // ---------------------------------------------------------------------------------------------------------
             /** Destructor */
@@ -44,6 +58,19 @@ namespace moris
 
             // ---------------------------------------------------------------------------------------------------------
 
+            /**
+             * Returns an id which is unique for each map created during the run, unlike its address
+             *
+             * @return Map id
+             */
+            moris::uint
+            get_map_id() const
+            {
+                return mMapId;
+            }
+
+            // ---------------------------------------------------------------------------------------------------------
+
             virtual moris::sint return_local_ind_of_global_Id( moris::uint aGlobalId ) const = 0;
 
             // ---------------------------------------------------------------------------------------------------------
@@ -128,6 +128,44 @@ namespace moris
 
             virtual void get_diagonal( moris::sol::Dist_Vector& aDiagVec ) const = 0;
 
+            /**
+             * Computes local row indices and offsets into the stored row values for an element,
+             * such that fill_matrix_with_plan() can sum into the matrix without translating IDs.
+             * The matrix graph has to be final. The default implementation does not support this.
+             *
+             * @param aEleDofConnectivity Element topology
+             * @param aLocalRows Local row index per element dof, -1 for rows owned by other procs
+             * @param aValueOffsets Offset of each element matrix entry in its row, -1 if not stored
+             * @return Whether a plan has been computed
+             */
+            virtual bool
+            compute_assembly_plan(
+                    const moris::Matrix< DDSMat >& aEleDofConnectivity,
+                    moris::Matrix< DDSMat >&       aLocalRows,
+                    moris::Matrix< DDSMat >&       aValueOffsets )
+            {
+                return false;
+            }
+
+            /**
+             * Sums an element matrix into the matrix using a plan computed by compute_assembly_plan().
+             * The default implementation uses the global IDs.
+             *
+             * @param aA_val Element matrix
+             * @param aEleDofConnectivity Element topology
+             * @param aLocalRows Local row indices
+             * @param aValueOffsets Offsets of the entries in their rows
+             */
+            virtual void
+            fill_matrix_with_plan(
+                    const moris::Matrix< DDRMat >& aA_val,
+                    const moris::Matrix< DDSMat >& aEleDofConnectivity,
+                    const moris::Matrix< DDSMat >& aLocalRows,
+                    const moris::Matrix< DDSMat >& aValueOffsets )
+            {
+                this->fill_matrix( aEleDofConnectivity.numel(), aA_val, aEleDofConnectivity );
+            }
+
             virtual void mat_put_scalar( const moris::real& aValue ) = 0;
 
             virtual void sparse_mat_left_scale( const moris::sol::Dist_Vector& aScaleVector ) = 0;
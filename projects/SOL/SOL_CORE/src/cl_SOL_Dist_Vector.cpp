@@ -30,5 +30,37 @@ namespace moris
         }
 
         //--------------------------------------------------------------------------------------------------------------
+
+        bool
+        Dist_Vector::compute_local_indices(
+                const moris::Matrix< DDSMat >& aGlobalIds,
+                moris::Matrix< DDSMat >&       aLocalIndices )
+        {
+            return false;
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void
+        Dist_Vector::extract_local_values(
+                const moris::Matrix< DDSMat >&          aLocalIndices,
+                moris::Cell< moris::Matrix< DDRMat > >& LHSValues )
+        {
+            MORIS_ERROR( false, "Dist_Vector::extract_local_values - not implemented for this vector type" );
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
+
+        void
+        Dist_Vector::sum_into_local_values(
+                const moris::Matrix< DDSMat >& aLocalIndices,
+                const moris::Matrix< DDSMat >& aGlobalIds,
+                const moris::Matrix< DDRMat >& aValues,
+                const uint&                    aVectorIndex )
+        {
+            this->sum_into_global_values( aGlobalIds, aValues, aVectorIndex );
+        }
+
+        //--------------------------------------------------------------------------------------------------------------
     }    // namespace sol
 }    // namespace moris
@@ -233,6 +233,44 @@ namespace moris
                     const moris::uint&                      aBlockRowOffsets,
                     moris::Cell< moris::Matrix< DDRMat > >& LHSValues ) = 0;
 
+            /**
+             * Computes the local indices of the given global IDs, such that values can be extracted
+             * repeatedly without translating the IDs. The default implementation does not support this.
+             *
+             * @param aGlobalIds Global IDs
+             * @param aLocalIndices Local indices in this vector
+             * @return Whether all IDs are available on this proc and extract_local_values() can be used
+             */
+            virtual bool compute_local_indices(
+                    const moris::Matrix< DDSMat >& aGlobalIds,
+                    moris::Matrix< DDSMat >&       aLocalIndices );
+
+            /**
+             * Extracts values at local indices computed by compute_local_indices().
+             *
+             * @param aLocalIndices Local indices
+             * @param LHSValues Matrix to extract into
+             */
+            virtual void extract_local_values(
+                    const moris::Matrix< DDSMat >&          aLocalIndices,
+                    moris::Cell< moris::Matrix< DDRMat > >& LHSValues );
+
+            /**
+             * Sums values into this vector, using local indices for owned entries. Entries with a negative
+             * local index are summed in based on their global ID. The default implementation uses the global
+             * IDs for all entries.
+             *
+             * @param aLocalIndices Local indices, -1 for entries owned by other procs
+             * @param aGlobalIds Global IDs
+             * @param aValues Values to sum in
+             * @param aVectorIndex Vector index of multi-vector
+             */
+            virtual void sum_into_local_values(
+                    const moris::Matrix< DDSMat >& aLocalIndices,
+                    const moris::Matrix< DDSMat >& aGlobalIds,
+                    const moris::Matrix< DDRMat >& aValues,
+                    const uint&                    aVectorIndex = 0 );
+
             /**
              * Gets a pointer to the real values stored in this vector.
              *
@@ -87,6 +87,8 @@ SOL_Warehouse::initialize()
     mTPLType = static_cast< moris::sol::MapType >( mParameterlist( 6 )( 0 ).get< moris::uint >( "SOL_TPL_Type" ) );
 
     mOperatorToMatlab      = mParameterlist( 6 )( 0 ).get< std::string >( "SOL_save_operator_to_matlab" );
+    mMatrixFree            = mParameterlist( 6 )( 0 ).get< bool >( "SOL_matrix_free" );
+    mMatrixFreeStoreElementMatrices = mParameterlist( 6 )( 0 ).get< bool >( "SOL_matrix_free_store_element_matrices" );
     mSaveFinalSolVecToFile = mParameterlist( 6 )( 0 ).get< std::string >( "SOL_save_final_sol_vec_to_file" );
 
     mLoadSolVecFromFile    = mParameterlist( 6 )( 0 ).get< std::string >( "SOL_load_sol_vec_from_file" );
@@ -129,11 +131,30 @@ SOL_Warehouse::create_linear_solver_algorithms()
 
     moris::dla::Solver_Factory tSolFactory;
 
+    // warm starts handed over from a previous warehouse are kept, other entries are filled below
+    mEigenSolverWarmStarts.resize( tNumLinAlgorithms, nullptr );
+
     for ( uint Ik = 0; Ik < tNumLinAlgorithms; Ik++ )
     {
         mLinearSolverAlgorithms( Ik ) = tSolFactory.create_solver(
                 static_cast< moris::sol::SolverType >( mParameterlist( 0 )( Ik ).get< moris::uint >( "Solver_Implementation" ) ),
                 mParameterlist( 0 )( Ik ) );
+
+        dla::Eigen_Solver* tEigenSolver = dynamic_cast< dla::Eigen_Solver* >( mLinearSolverAlgorithms( Ik ).get() );
+
+        if ( tEigenSolver == nullptr )
+        {
+            mEigenSolverWarmStarts( Ik ) = nullptr;
+        }
+        else if ( mEigenSolverWarmStarts( Ik ) != nullptr )
+        {
+            // continue with eigenvectors of the previous design; checked against the new map in the solve
+            tEigenSolver->set_warm_start( mEigenSolverWarmStarts( Ik ) );
+        }
+        else
+        {
+            mEigenSolverWarmStarts( Ik ) = tEigenSolver->get_warm_start();
+        }
     }
 }
 
@@ -33,6 +33,7 @@ namespace moris
         class Linear_Solver_Algorithm;
         class Linear_Solver;
         class Eigen_Solver;
+        struct Eigen_Solver_Warm_Start;
 
     }    // namespace dla
     namespace NLA
@@ -74,6 +75,9 @@ namespace moris
             Cell< std::shared_ptr< dla::Linear_Solver_Algorithm > > mLinearSolverAlgorithms;
             Cell< dla::Linear_Solver* >                             mLinearSolvers;
 
+            // warm starts of the eigen solver algorithms, one per linear algorithm; handed over by the model to survive a rebuild
+            Cell< std::shared_ptr< dla::Eigen_Solver_Warm_Start > > mEigenSolverWarmStarts;
+
             // List of nonlinear solver algorithms and solvers
             Cell< std::shared_ptr< NLA::Nonlinear_Algorithm > > mNonlinearSolverAlgorithms;
             Cell< NLA::Nonlinear_Solver* >                      mNonlinearSolvers;
@@ -95,6 +99,12 @@ namespace moris
             // save operator to matlab string
             std::string mOperatorToMatlab = std::string( "" );
 
+            // apply the Jacobian matrix-free
+            bool mMatrixFree = false;
+
+            // store the element Jacobians of the matrix-free operator between Krylov iterations
+            bool mMatrixFreeStoreElementMatrices = false;
+
             // save final solution vector to file string
             std::string mSaveFinalSolVecToFile = std::string( "" );
 
@@ -222,6 +232,31 @@ namespace moris
 
             //--------------------------------------------------------------------------------------------------------
 
+            /**
+             * @brief sets the warm starts of the eigen solvers of a previous warehouse. Has to be called before initialize().
+             * A warm start is only used by the eigen solver with the same linear algorithm index.
+             *
+             * @param[in] aWarmStarts warm starts per linear algorithm, entries can be nullptr
+             */
+            void
+            set_eigen_solver_warm_starts( Cell< std::shared_ptr< dla::Eigen_Solver_Warm_Start > > const & aWarmStarts )
+            {
+                mEigenSolverWarmStarts = aWarmStarts;
+            }
+
+            //--------------------------------------------------------------------------------------------------------
+
+            /**
+             * @brief returns the warm starts of the eigen solvers per linear algorithm, nullptr for other algorithms
+             */
+            Cell< std::shared_ptr< dla::Eigen_Solver_Warm_Start > > const &
+            get_eigen_solver_warm_starts()
+            {
+                return mEigenSolverWarmStarts;
+            }
+
+            //--------------------------------------------------------------------------------------------------------
+
             tsa::Time_Solver*
             get_main_time_solver()
             {
@@ -246,6 +281,22 @@ namespace moris
 
             //--------------------------------------------------------------------------------------------------------
 
+            bool
+            get_matrix_free()
+            {
+                return mMatrixFree;
+            }
+
+            //--------------------------------------------------------------------------------------------------------
+
+            bool
+            get_matrix_free_store_element_matrices()
+            {
+                return mMatrixFreeStoreElementMatrices;
+            }
+
+            //--------------------------------------------------------------------------------------------------------
+
             const std::string&
             get_save_final_sol_vec_to_file()
             {
@@ -10,6 +10,8 @@
 
 #include "cl_Sparse_Matrix_EpetraFECrs.hpp"
 
+#include <algorithm>
+
 extern moris::Comm_Manager gMorisComm;
 
 using namespace moris;
@@ -131,6 +133,137 @@ void Sparse_Matrix_EpetraFECrs::fill_matrix(
 
 // ----------------------------------------------------------------------------------------------------------------------
 
+bool Sparse_Matrix_EpetraFECrs::compute_assembly_plan(
+        const moris::Matrix< DDSMat > & aEleDofConnectivity,
+        moris::Matrix< DDSMat >       & aLocalRows,
+        moris::Matrix< DDSMat >       & aValueOffsets )
+{
+    // point maps translate the IDs first, and the column indices are only final once the graph is filled
+    if( mMatBuildWithPointMap || mEpetraMat == nullptr || !mEpetraMat->Filled() )
+    {
+        return false;
+    }
+
+    moris::uint tNumDofs = aEleDofConnectivity.numel();
+
+    aLocalRows.set_size( tNumDofs, 1, -1 );
+    aValueOffsets.set_size( tNumDofs, tNumDofs, -1 );
+
+    // local column indices of element dofs
+    moris::Matrix< DDSMat > tLocalCols( tNumDofs, 1, -1 );
+
+    for( moris::uint Ik = 0; Ik < tNumDofs; Ik++ )
+    {
+        tLocalCols( Ik ) = mEpetraMat->ColMap().LID( aEleDofConnectivity( Ik ) );
+    }
+
+    for( moris::uint Ii = 0; Ii < tNumDofs; Ii++ )
+    {
+        int tLocalRow = mEpetraMat->RowMap().LID( aEleDofConnectivity( Ii ) );
+
+        aLocalRows( Ii ) = tLocalRow;
+
+        // rows of other procs are summed in via global IDs
+        if( tLocalRow < 0 )
+        {
+            continue;
+        }
+
+        int     tNumEntries = 0;
+        double* tValues     = nullptr;
+        int*    tIndices    = nullptr;
+
+        mEpetraMat->ExtractMyRowView( tLocalRow, tNumEntries, tValues, tIndices );
+
+        // find position of each element column in this row
+        for( moris::uint Ik = 0; Ik < tNumDofs; Ik++ )
+        {
+            if( tLocalCols( Ik ) < 0 )
+            {
+                continue;
+            }
+
+            int* tEntry = std::find( tIndices, tIndices + tNumEntries, tLocalCols( Ik ) );
+
+            if( tEntry != tIndices + tNumEntries )
+            {
+                aValueOffsets( Ii, Ik ) = tEntry - tIndices;
+            }
+        }
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
+void Sparse_Matrix_EpetraFECrs::fill_matrix_with_plan(
+        const moris::Matrix< DDRMat > & aA_val,
+        const moris::Matrix< DDSMat > & aEleDofConnectivity,
+        const moris::Matrix< DDSMat > & aLocalRows,
+        const moris::Matrix< DDSMat > & aValueOffsets )
+{
+    moris::uint tNumDofs = aEleDofConnectivity.numel();
+
+    MORIS_ASSERT( aLocalRows.numel() == tNumDofs && aValueOffsets.n_cols() == tNumDofs,
+            "Sparse_Matrix_EpetraFECrs::fill_matrix_with_plan - plan does not match element topology" );
+
+    moris::uint tNumOffProcRows = 0;
+
+    // sum owned rows directly into the row values
+    for( moris::uint Ii = 0; Ii < tNumDofs; Ii++ )
+    {
+        if( aLocalRows( Ii ) < 0 )
+        {
+            tNumOffProcRows++;
+            continue;
+        }
+
+        int     tNumEntries = 0;
+        double* tValues     = nullptr;
+
+        mEpetraMat->ExtractMyRowView( aLocalRows( Ii ), tNumEntries, tValues );
+
+        for( moris::uint Ik = 0; Ik < tNumDofs; Ik++ )
+        {
+            if( aValueOffsets( Ii, Ik ) >= 0 )
+            {
+                tValues[ aValueOffsets( Ii, Ik ) ] += aA_val( Ii, Ik );
+            }
+        }
+    }
+
+    if( tNumOffProcRows == 0 )
+    {
+        return;
+    }
+
+    // remaining rows are communicated during global assembly
+    moris::Matrix< DDSMat > tOffProcRows( tNumOffProcRows, 1 );
+    moris::Matrix< DDRMat > tOffProcValues( tNumOffProcRows, tNumDofs );
+
+    moris::uint tCounter = 0;
+
+    for( moris::uint Ii = 0; Ii < tNumDofs; Ii++ )
+    {
+        if( aLocalRows( Ii ) < 0 )
+        {
+            tOffProcRows( tCounter ) = aEleDofConnectivity( Ii );
+
+            for( moris::uint Ik = 0; Ik < tNumDofs; Ik++ )
+            {
+                tOffProcValues( tCounter, Ik ) = aA_val( Ii, Ik );
+            }
+
+            tCounter++;
+        }
+    }
+
+    this->sum_into_values( tOffProcRows, aEleDofConnectivity, tOffProcValues );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------
+
 void Sparse_Matrix_EpetraFECrs::insert_values(
         const Matrix<DDSMat>& aRowIDs,
         const Matrix<DDSMat>& aColumnIDs,
@@ -99,6 +99,15 @@ public:
 
     void get_diagonal( moris::sol::Dist_Vector & aDiagVec ) const;
 
+    bool compute_assembly_plan( const moris::Matrix< DDSMat > & aEleDofConnectivity,
+                                      moris::Matrix< DDSMat > & aLocalRows,
+                                      moris::Matrix< DDSMat > & aValueOffsets );
+
+    void fill_matrix_with_plan( const moris::Matrix< DDRMat > & aA_val,
+                                const moris::Matrix< DDSMat > & aEleDofConnectivity,
+                                const moris::Matrix< DDSMat > & aLocalRows,
+                                const moris::Matrix< DDSMat > & aValueOffsets );
+
     void mat_put_scalar( const moris::real & aValue );
 
     void sparse_mat_left_scale( const moris::sol::Dist_Vector & aScaleVector );
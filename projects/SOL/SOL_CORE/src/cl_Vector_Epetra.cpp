@@ -402,6 +402,123 @@ Vector_Epetra::extract_my_values(
 
 //----------------------------------------------------------------------------------------------
 
+bool
+Vector_Epetra::compute_local_indices(
+        const moris::Matrix< DDSMat >& aGlobalIds,
+        moris::Matrix< DDSMat >&       aLocalIndices )
+{
+    // point maps translate the IDs first, keep using the global IDs
+    if ( mVecBuildWithPointMap )
+    {
+        return false;
+    }
+
+    aLocalIndices.set_size( aGlobalIds.numel(), 1 );
+
+    bool tAllOwned = true;
+
+    for ( moris::uint Ii = 0; Ii < aGlobalIds.numel(); ++Ii )
+    {
+        aLocalIndices( Ii ) = mMap->return_local_ind_of_global_Id( aGlobalIds( Ii ) );
+
+        tAllOwned = tAllOwned && aLocalIndices( Ii ) >= 0;
+    }
+
+    return tAllOwned;
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Epetra::extract_local_values(
+        const moris::Matrix< DDSMat >&          aLocalIndices,
+        moris::Cell< moris::Matrix< DDRMat > >& ExtractedValues )
+{
+    moris::uint tNumIndices = aLocalIndices.numel();
+
+    ExtractedValues.resize( mNumVectors );
+
+    moris::sint tVecLength = this->vec_local_length();
+
+    for ( moris::sint Ik = 0; Ik < mNumVectors; ++Ik )
+    {
+        ExtractedValues( Ik ).set_size( tNumIndices, 1 );
+
+        const moris::real* tValues = mValuesPtr + tVecLength * Ik;
+
+        for ( moris::uint Ii = 0; Ii < tNumIndices; ++Ii )
+        {
+            MORIS_ASSERT( aLocalIndices( Ii ) >= 0 && aLocalIndices( Ii ) < tVecLength,
+                    "Vector_Epetra::extract_local_values: local index out of range" );
+
+            ExtractedValues( Ik )( Ii ) = tValues[ aLocalIndices( Ii ) ];
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Epetra::sum_into_local_values(
+        const moris::Matrix< DDSMat >& aLocalIndices,
+        const moris::Matrix< DDSMat >& aGlobalIds,
+        const moris::Matrix< DDRMat >& aValues,
+        const uint&                    aVectorIndex )
+{
+    if ( mVecBuildWithPointMap )
+    {
+        this->sum_into_global_values( aGlobalIds, aValues, aVectorIndex );
+        return;
+    }
+
+    MORIS_ASSERT( aLocalIndices.numel() == aGlobalIds.numel(),
+            "Vector_Epetra::sum_into_local_values - number of local indices does not match number of IDs" );
+
+    moris::real* tValues = mValuesPtr + this->vec_local_length() * aVectorIndex;
+
+    moris::uint tNumOffProcEntries = 0;
+
+    // sum owned entries directly into the vector
+    for ( moris::uint Ii = 0; Ii < aLocalIndices.numel(); ++Ii )
+    {
+        if ( aLocalIndices( Ii ) < 0 )
+        {
+            tNumOffProcEntries++;
+            continue;
+        }
+
+        MORIS_ASSERT( mMap->get_epetra_map()->GID( aLocalIndices( Ii ) ) == aGlobalIds( Ii ),
+                "Vector_Epetra::sum_into_local_values - local index does not match global ID" );
+
+        tValues[ aLocalIndices( Ii ) ] += aValues( Ii );
+    }
+
+    if ( tNumOffProcEntries == 0 )
+    {
+        return;
+    }
+
+    // remaining entries are communicated during global assembly
+    Matrix< DDSMat > tOffProcIds( tNumOffProcEntries, 1 );
+    Matrix< DDRMat > tOffProcValues( tNumOffProcEntries, 1 );
+
+    moris::uint tCounter = 0;
+
+    for ( moris::uint Ii = 0; Ii < aLocalIndices.numel(); ++Ii )
+    {
+        if ( aLocalIndices( Ii ) < 0 )
+        {
+            tOffProcIds( tCounter )    = aGlobalIds( Ii );
+            tOffProcValues( tCounter ) = aValues( Ii );
+            tCounter++;
+        }
+    }
+
+    this->sum_into_global_values( tOffProcIds, tOffProcValues, aVectorIndex );
+}
+
+//----------------------------------------------------------------------------------------------
+
 void
 Vector_Epetra::print() const
 {
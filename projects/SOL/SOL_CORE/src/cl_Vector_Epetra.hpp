@@ -117,6 +117,20 @@ namespace moris
                 const moris::uint&                      aRowOffsets,
                 moris::Cell< moris::Matrix< DDRMat > >& LHSValues );
 
+        bool compute_local_indices(
+                const moris::Matrix< DDSMat >& aGlobalIds,
+                moris::Matrix< DDSMat >&       aLocalIndices );
+
+        void extract_local_values(
+                const moris::Matrix< DDSMat >&          aLocalIndices,
+                moris::Cell< moris::Matrix< DDRMat > >& LHSValues );
+
+        void sum_into_local_values(
+                const moris::Matrix< DDSMat >& aLocalIndices,
+                const moris::Matrix< DDSMat >& aGlobalIds,
+                const moris::Matrix< DDRMat >& aValues,
+                const uint&                    aVectorIndex = 0 );
+
         void print() const;
 
         void save_vector_to_matrix_market_file( const char* aFilename );
@@ -8,6 +8,10 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
 #include "cl_TSA_Monolithic_Time_Solver.hpp"
 #include "cl_TSA_Time_Solver.hpp"
 #include "cl_SOL_Dist_Vector.hpp"
@@ -26,6 +30,14 @@ using namespace moris;
 using namespace tsa;
 //-------------------------------------------------------------------------------
 
+Monolithic_Time_Solver::~Monolithic_Time_Solver()
+{
+    // checkpoints of a forward solve without adjoint solve are left on disk otherwise
+    this->remove_checkpoint_files();
+}
+
+//-------------------------------------------------------------------------------
+
 void
 Monolithic_Time_Solver::solve_monolithic_time_system( moris::Cell< sol::Dist_Vector* >& aFullVector )
 {
@@ -39,6 +51,41 @@ Monolithic_Time_Solver::solve_monolithic_time_system( moris::Cell< sol::Dist_Vec
     moris::real tTimeFrame      = mParameterListTimeSolver.get< moris::real >( "TSA_Time_Frame" );
     moris::real tTimeIncrements = tTimeFrame / tTimeSteps;
 
+    // get adaptive time stepping parameters
+    bool        tAdaptive    = mParameterListTimeSolver.get< bool >( "TSA_Adaptive_Time_Stepping" );
+    moris::real tTolerance   = mParameterListTimeSolver.get< moris::real >( "TSA_Time_Step_Tolerance" );
+    moris::real tMinTimeStep = mParameterListTimeSolver.get< moris::real >( "TSA_Min_Time_Step" );
+    moris::real tMaxTimeStep = mParameterListTimeSolver.get< moris::real >( "TSA_Max_Time_Step" );
+    sint        tMaxRejected = mParameterListTimeSolver.get< moris::sint >( "TSA_Max_Rejected_Time_Steps" );
+
+    if ( tMaxTimeStep <= 0.0 )
+    {
+        tMaxTimeStep = tTimeFrame;
+    }
+
+    MORIS_ERROR( !tAdaptive or tTolerance > 0.0,
+            "Monolithic_Time_Solver::solve_monolithic_time_system() - Time step tolerance must be positive." );
+
+    MORIS_ERROR( tMinTimeStep <= tMaxTimeStep,
+            "Monolithic_Time_Solver::solve_monolithic_time_system() - Minimal time step exceeds maximal time step." );
+
+    MORIS_ERROR( !tAdaptive or tMaxRejected >= 0,
+            "Monolithic_Time_Solver::solve_monolithic_time_system() - Maximal number of rejected time steps must not be negative." );
+
+    // initialize checkpoints for the adjoint solve, the number of time steps is an estimate for adaptive time stepping
+    // and the checkpoints are re-planned if more time steps are accepted
+    this->initialize_checkpoints( tTimeSteps );
+
+    // solution increment of the last accepted time step and work vector for the error estimate
+    sol::Dist_Vector* tIncrement = nullptr;
+    sol::Dist_Vector* tWorkVec   = nullptr;
+
+    if ( tAdaptive )
+    {
+        tIncrement = mMyTimeSolver->create_full_vector();
+        tWorkVec   = mMyTimeSolver->create_full_vector();
+    }
+
     bool tMaxTimeIterationReached = false;
 
     // get list of time frames
@@ -47,16 +94,32 @@ Monolithic_Time_Solver::solve_monolithic_time_system( moris::Cell< sol::Dist_Vec
     Matrix< DDRMat > tTimeInitial( 2, 1, 0.0 );
     tTimeFrames.push_back( tTimeInitial );
 
-    for ( sint Ik = 0; Ik < tTimeSteps; Ik++ )
+    // number of accepted and rejected time steps
+    mNumTimeSteps = 0;
+
+    uint tNumRejectedSteps = 0;
+
+    // number of consecutive rejections of the current time step
+    sint tNumRejectedInARow = 0;
+
+    moris::real tTimeStep     = tTimeIncrements;
+    moris::real tPrevTimeStep = tTimeIncrements;
+
+    while ( !tMaxTimeIterationReached )
     {
         // get solvec and prev solvec index
-        uint tSolVecIndex     = Ik + 1;
-        uint tPrevSolVecIndex = Ik;
+        uint tSolVecIndex     = mNumTimeSteps + 1;
+        uint tPrevSolVecIndex = mNumTimeSteps;
+
+        // the last time step ends at the end of the time frame
+        if ( tAdaptive and tTime_Scalar + ( 1.0 + 1.0e-6 ) * tTimeStep >= tTimeFrame )
+        {
+            tTimeStep = tTimeFrame - tTime_Scalar;
+        }
 
         // initialize time for time slab
         Matrix< DDRMat > tTime( 2, 1, tTime_Scalar );
-        tTime_Scalar += tTimeIncrements;
-        tTime( 1, 0 ) = tTime_Scalar;
+        tTime( 1, 0 ) = tTime_Scalar + tTimeStep;
 
         tTimeFrames.push_back( tTime );
 
@@ -73,15 +136,66 @@ Monolithic_Time_Solver::solve_monolithic_time_system( moris::Cell< sol::Dist_Vec
         mSolverInterface->set_time( tTimeFrames( tSolVecIndex ) );
 
         // log time slap
-        MORIS_LOG_SPEC( "Forward Solve Time Slab", Ik + 1 );
+        MORIS_LOG_SPEC( "Forward Solve Time Slab", tSolVecIndex );
         MORIS_LOG_SPEC( "Time Slap Start Time", tTimeFrames( tSolVecIndex )( 0, 0 ) );
         MORIS_LOG_SPEC( "Time Slap End Time", tTimeFrames( tSolVecIndex )( 1, 0 ) );
 
-        mNonlinearSolver->set_time_step_iter( Ik );
+        mNonlinearSolver->set_time_step_iter( mNumTimeSteps );
 
         mNonlinearSolver->solve( aFullVector( tSolVecIndex ) );
 
-        if ( Ik == tTimeSteps - 1 )
+        // the error can only be estimated with the increment of a previous time step
+        moris::real tNextTimeStep = tTimeStep;
+
+        if ( tAdaptive and mNumTimeSteps > 0 )
+        {
+            moris::real tError = this->estimate_time_step_error(
+                    aFullVector( tSolVecIndex ),
+                    aFullVector( tPrevSolVecIndex ),
+                    tIncrement,
+                    tWorkVec,
+                    tTimeStep / tPrevTimeStep );
+
+            moris::real tFactor = this->compute_time_step_factor( tError, tTolerance );
+
+            MORIS_LOG_SPEC( "Time Step Error Estimate", tError );
+
+            // reject time step and repeat it with a smaller time step
+            if ( tError > tTolerance and tTimeStep > tMinTimeStep )
+            {
+                MORIS_LOG_INFO( "Rejected time step of size %e", tTimeStep );
+
+                tTimeFrames.pop_back();
+
+                tTimeStep = std::max( tTimeStep * tFactor, tMinTimeStep );
+
+                // reset initial guess to the solution of the previous time step
+                aFullVector( tSolVecIndex )->vec_plus_vec( 1.0, *( aFullVector( tPrevSolVecIndex ) ), 0.0 );
+
+                tNumRejectedSteps++;
+                tNumRejectedInARow++;
+
+                // without a minimal time step the time step could be reduced forever
+                MORIS_ERROR( tNumRejectedInARow <= tMaxRejected,
+                        "Monolithic_Time_Solver::solve_monolithic_time_system() - Time step at time %e rejected %d times, "
+                        "last time step size %e. Increase TSA_Time_Step_Tolerance or set TSA_Min_Time_Step.",
+                        tTime_Scalar,
+                        tNumRejectedInARow,
+                        tTimeStep );
+
+                continue;
+            }
+
+            tNextTimeStep = std::min( std::max( tTimeStep * tFactor, tMinTimeStep ), tMaxTimeStep );
+        }
+
+        // accept time step
+        tTime_Scalar = tTime( 1, 0 );
+        mNumTimeSteps++;
+
+        tNumRejectedInARow = 0;
+
+        if ( tAdaptive ? tTime_Scalar >= tTimeFrame : mNumTimeSteps == (uint)tTimeSteps )
         {
             tMaxTimeIterationReached = true;
         }
@@ -117,8 +231,37 @@ Monolithic_Time_Solver::solve_monolithic_time_system( moris::Cell< sol::Dist_Vec
         // input second time slap value for output
         mMyTimeSolver->check_for_outputs( tTime( 1 ), tMaxTimeIterationReached );
 
+        // store increment of this time step for the error estimate of the next time step
+        if ( tAdaptive )
+        {
+            tIncrement->vec_plus_vec( 1.0, *( aFullVector( tSolVecIndex ) ), 0.0 );
+            tIncrement->vec_plus_vec( -1.0, *( aFullVector( tPrevSolVecIndex ) ), 1.0 );
+
+            tPrevTimeStep = tTimeStep;
+            tTimeStep     = tNextTimeStep;
+        }
+
+        // the solution of the previous time step is not needed anymore by the forward solve.
+        // The last time step is never released, thus its index does not need to be known in advance.
+        if ( !tMaxTimeIterationReached )
+        {
+            // coarsen the checkpoints if more time steps are accepted than estimated
+            this->update_checkpoints( aFullVector, tPrevSolVecIndex );
+
+            this->release_solution_vector( aFullVector, tPrevSolVecIndex, MORIS_UINT_MAX );
+        }
+
         mMyTimeSolver->prepare_sol_vec_for_next_time_step();
     }
+
+    if ( tAdaptive )
+    {
+        MORIS_LOG_SPEC( "Number of Accepted Time Steps", mNumTimeSteps );
+        MORIS_LOG_SPEC( "Number of Rejected Time Steps", tNumRejectedSteps );
+
+        delete tIncrement;
+        delete tWorkVec;
+    }
 }
 
 //-------------------------------------------------------------------------------
@@ -129,7 +272,8 @@ Monolithic_Time_Solver::solve_implicit_DqDs( moris::Cell< sol::Dist_Vector* >& a
     // trace this solve
     Tracer tTracer( "TimeSolver", "Monolithic", "Solve" );
 
-    sint tTimeSteps = mParameterListTimeSolver.get< moris::sint >( "TSA_Num_Time_Steps" );
+    // replay the time steps accepted by the forward solve
+    sint tTimeSteps = mNumTimeSteps;
 
     // initialize time for time slab
     moris::Cell< Matrix< DDRMat > >& tTimeFrames = mMyTimeSolver->get_time_frames();
@@ -138,6 +282,13 @@ Monolithic_Time_Solver::solve_implicit_DqDs( moris::Cell< sol::Dist_Vector* >& a
 
     moris::Cell< sol::Dist_Vector* >& tSolVec = mMyTimeSolver->get_solution_vectors();
 
+    // time frames, solutions and checkpoints are set by the forward solve of this time solver algorithm
+    MORIS_ERROR( mNumTimeSteps > 0 and tTimeFrames.size() > mNumTimeSteps and tSolVec.size() > mNumTimeSteps,
+            "Monolithic_Time_Solver::solve_implicit_DqDs() - The adjoint solve requires a preceding forward solve." );
+
+    // the checkpoints have been set by the forward solve
+    mNumRecomputedTimeSteps = 0;
+
     // Loop over all time iterations backwards
     for ( sint Ik = tTimeSteps; Ik > tStopTimeStepIndex; --Ik )
     {
@@ -145,6 +296,9 @@ Monolithic_Time_Solver::solve_implicit_DqDs( moris::Cell< sol::Dist_Vector* >& a
         uint tSolVecIndex     = Ik;
         uint tPrevSolVecIndex = Ik - 1;
 
+        // restore solutions of this and the previous time step from checkpoints
+        this->restore_solution_vectors( tSolVec, tSolVecIndex, tTimeSteps );
+
         // log number of time steps
         MORIS_LOG_ITERATION();
 
@@ -174,7 +328,18 @@ Monolithic_Time_Solver::solve_implicit_DqDs( moris::Cell< sol::Dist_Vector* >& a
         mSolverInterface->postmultiply_implicit_dQds();
 
         aFullAdjointVector( 1 )->vec_plus_vec( 1.0, *( aFullAdjointVector( 0 ) ), 0.0 );
+
+        // the solution of this time step is not needed anymore by the adjoint solve
+        this->release_solution_vector( tSolVec, tSolVecIndex, tTimeSteps );
+    }
+
+    if ( mCheckpointInterval > 1 )
+    {
+        MORIS_LOG_SPEC( "Number of Recomputed Time Steps", mNumRecomputedTimeSteps );
     }
+
+    // checkpoints on disk are not needed after the adjoint sweep
+    this->remove_checkpoint_files();
 }
 
 //-------------------------------------------------------------------------------
@@ -208,3 +373,321 @@ Monolithic_Time_Solver::get_new_lambda()
 {
     return mLambdaInc;
 }
+
+//-------------------------------------------------------------------------------
+
+moris::real
+Monolithic_Time_Solver::estimate_time_step_error(
+        sol::Dist_Vector* aSolVec,
+        sol::Dist_Vector* aPrevSolVec,
+        sol::Dist_Vector* aPrevIncrement,
+        sol::Dist_Vector* aWorkVec,
+        const real        aTimeStepRatio )
+{
+    // predict solution by linear extrapolation of the previous time steps
+    aWorkVec->vec_plus_vec( 1.0, *aPrevSolVec, 0.0 );
+    aWorkVec->vec_plus_vec( aTimeStepRatio, *aPrevIncrement, 1.0 );
+
+    // difference between computed and predicted solution
+    aWorkVec->vec_plus_vec( 1.0, *aSolVec, -1.0 );
+
+    real tErrorNorm    = aWorkVec->vec_norm2()( 0 );
+    real tSolutionNorm = aSolVec->vec_norm2()( 0 );
+
+    return tErrorNorm / std::max( tSolutionNorm, MORIS_REAL_EPS );
+}
+
+//-------------------------------------------------------------------------------
+
+moris::real
+Monolithic_Time_Solver::compute_time_step_factor(
+        const real aError,
+        const real aTolerance ) const
+{
+    // the extrapolation error is of second order in the time step size
+    real tFactor = 2.0;
+
+    if ( aError > 0.0 )
+    {
+        tFactor = 0.9 * std::sqrt( aTolerance / aError );
+    }
+
+    return std::min( std::max( tFactor, 0.2 ), 2.0 );
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Monolithic_Time_Solver::initialize_checkpoints( const uint aNumTimeSteps )
+{
+    sint tNumCheckpoints = mParameterListTimeSolver.get< moris::sint >( "TSA_Num_Checkpoints" );
+
+    MORIS_ERROR( tNumCheckpoints >= 0,
+            "Monolithic_Time_Solver::initialize_checkpoints() - Number of checkpoints must not be negative." );
+
+    // keep all solutions if no checkpoints are requested or every time step is a checkpoint
+    mCheckpointInterval = 1;
+    mNumCheckpoints     = tNumCheckpoints;
+
+    if ( tNumCheckpoints > 0 and (uint)tNumCheckpoints < aNumTimeSteps )
+    {
+        mCheckpointInterval = ( aNumTimeSteps + tNumCheckpoints - 1 ) / tNumCheckpoints;
+    }
+
+    // checkpoints of a previous forward solve are outdated
+    this->remove_checkpoint_files();
+
+    mCheckpointFile = mParameterListTimeSolver.get< std::string >( "TSA_Checkpoint_File" );
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Monolithic_Time_Solver::update_checkpoints(
+        moris::Cell< sol::Dist_Vector* >& aFullVector,
+        const uint                        aSolVecIndex )
+{
+    // all solutions are kept
+    if ( mNumCheckpoints == 0 )
+    {
+        return;
+    }
+
+    // double the interval until the requested number of checkpoints suffices for the accepted time steps
+    while ( aSolVecIndex / mCheckpointInterval > mNumCheckpoints )
+    {
+        uint tOldInterval = mCheckpointInterval;
+
+        mCheckpointInterval *= 2;
+
+        // release checkpoints before this time step which are not on the coarser grid
+        for ( uint iSolVec = tOldInterval; iSolVec < aSolVecIndex; iSolVec += tOldInterval )
+        {
+            if ( iSolVec <= 1 or iSolVec % mCheckpointInterval == 0 )
+            {
+                continue;
+            }
+
+            if ( mCheckpointFile.size() > 0 )
+            {
+                this->remove_checkpoint_file( iSolVec );
+            }
+            else
+            {
+                delete aFullVector( iSolVec );
+                aFullVector( iSolVec ) = nullptr;
+            }
+        }
+
+        MORIS_LOG_SPEC( "Checkpoint Interval", mCheckpointInterval );
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+bool
+Monolithic_Time_Solver::is_checkpoint(
+        const uint aSolVecIndex,
+        const uint aNumTimeSteps ) const
+{
+    return aSolVecIndex <= 1 or aSolVecIndex == aNumTimeSteps or aSolVecIndex % mCheckpointInterval == 0;
+}
+
+//-------------------------------------------------------------------------------
+
+bool
+Monolithic_Time_Solver::is_stored_on_disk(
+        const uint aSolVecIndex,
+        const uint aNumTimeSteps ) const
+{
+    return mCheckpointFile.size() > 0
+       and aSolVecIndex > 1 and aSolVecIndex < aNumTimeSteps
+       and this->is_checkpoint( aSolVecIndex, aNumTimeSteps );
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Monolithic_Time_Solver::release_solution_vector(
+        moris::Cell< sol::Dist_Vector* >& aFullVector,
+        const uint                        aSolVecIndex,
+        const uint                        aNumTimeSteps )
+{
+    // checkpoints in memory are kept
+    if ( this->is_checkpoint( aSolVecIndex, aNumTimeSteps ) and !this->is_stored_on_disk( aSolVecIndex, aNumTimeSteps ) )
+    {
+        return;
+    }
+
+    // checkpoints are written to disk during the forward solve
+    if ( this->is_stored_on_disk( aSolVecIndex, aNumTimeSteps ) and mMyTimeSolver->get_is_forward_analysis() )
+    {
+        this->save_checkpoint( aFullVector, aSolVecIndex );
+    }
+
+    delete aFullVector( aSolVecIndex );
+    aFullVector( aSolVecIndex ) = nullptr;
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Monolithic_Time_Solver::restore_solution_vectors(
+        moris::Cell< sol::Dist_Vector* >& aFullVector,
+        const uint                        aSolVecIndex,
+        const uint                        aNumTimeSteps )
+{
+    // nothing to restore if both solutions are in memory
+    if ( aFullVector( aSolVecIndex ) != nullptr and aFullVector( aSolVecIndex - 1 ) != nullptr )
+    {
+        return;
+    }
+
+    // last checkpoint before this time step
+    uint tCheckpointIndex = ( ( aSolVecIndex - 1 ) / mCheckpointInterval ) * mCheckpointInterval;
+
+    // time steps are recomputed with the forward problem
+    mSolverInterface->set_is_forward_analysis();
+
+    for ( uint iSolVec = tCheckpointIndex; iSolVec <= aSolVecIndex; iSolVec++ )
+    {
+        if ( aFullVector( iSolVec ) != nullptr )
+        {
+            continue;
+        }
+
+        if ( this->is_stored_on_disk( iSolVec, aNumTimeSteps ) )
+        {
+            this->load_checkpoint( aFullVector, iSolVec );
+        }
+        else
+        {
+            this->recompute_time_step( aFullVector, iSolVec );
+        }
+    }
+
+    // switch back to the adjoint problem
+    mSolverInterface->set_is_sensitivity_analysis();
+
+    mSolverInterface->set_requested_dof_types( mMyTimeSolver->get_dof_type_union() );
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Monolithic_Time_Solver::recompute_time_step(
+        moris::Cell< sol::Dist_Vector* >& aFullVector,
+        const uint                        aSolVecIndex )
+{
+    MORIS_ASSERT( aFullVector( aSolVecIndex - 1 ) != nullptr,
+            "Monolithic_Time_Solver::recompute_time_step() - Solution of previous time step is not available." );
+
+    moris::Cell< Matrix< DDRMat > >& tTimeFrames = mMyTimeSolver->get_time_frames();
+
+    // use the solution of the previous time step as initial guess, as done by the forward solve
+    aFullVector( aSolVecIndex ) = mMyTimeSolver->create_full_vector();
+    aFullVector( aSolVecIndex )->vec_plus_vec( 1.0, *( aFullVector( aSolVecIndex - 1 ) ), 0.0 );
+
+    mSolverInterface->set_solution_vector( aFullVector( aSolVecIndex ) );
+    mSolverInterface->set_solution_vector_prev_time_step( aFullVector( aSolVecIndex - 1 ) );
+
+    mSolverInterface->set_previous_time( tTimeFrames( aSolVecIndex - 1 ) );
+    mSolverInterface->set_time( tTimeFrames( aSolVecIndex ) );
+
+    MORIS_LOG_SPEC( "Recompute Time Slab", aSolVecIndex );
+
+    mNonlinearSolver->set_time_step_iter( aSolVecIndex - 1 );
+
+    mNonlinearSolver->solve( aFullVector( aSolVecIndex ) );
+
+    mNumRecomputedTimeSteps++;
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Monolithic_Time_Solver::save_checkpoint(
+        moris::Cell< sol::Dist_Vector* >& aFullVector,
+        const uint                        aSolVecIndex )
+{
+    // get the local values of the solution vector
+    Matrix< DDRMat > tSolVec;
+    aFullVector( aSolVecIndex )->extract_copy( tSolVec );
+
+    // write to processor local file
+    hid_t  tFileID = create_hdf5_file( this->get_checkpoint_file_name( aSolVecIndex ) );
+    herr_t tStatus = 0;
+    save_matrix_to_hdf5_file( tFileID, "SolVec", tSolVec, tStatus );
+    close_hdf5_file( tFileID );
+
+    mCheckpointFileIndices.insert( aSolVecIndex );
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Monolithic_Time_Solver::load_checkpoint(
+        moris::Cell< sol::Dist_Vector* >& aFullVector,
+        const uint                        aSolVecIndex )
+{
+    MORIS_ERROR( mCheckpointFileIndices.find( aSolVecIndex ) != mCheckpointFileIndices.end(),
+            "Monolithic_Time_Solver::load_checkpoint() - Checkpoint of time step %d does not exist. "
+            "Checkpoints on disk are removed after the adjoint solve, repeat the forward solve.",
+            aSolVecIndex );
+
+    // read from processor local file
+    Matrix< DDRMat > tSolVec;
+    hid_t            tFileID = open_hdf5_file( this->get_checkpoint_file_name( aSolVecIndex ) );
+    herr_t           tStatus = 0;
+    load_matrix_from_hdf5_file( tFileID, "SolVec", tSolVec, tStatus );
+    close_hdf5_file( tFileID );
+
+    aFullVector( aSolVecIndex ) = mMyTimeSolver->create_full_vector();
+
+    MORIS_ERROR( tSolVec.numel() == (uint)( aFullVector( aSolVecIndex )->vec_local_length() * aFullVector( aSolVecIndex )->get_num_vectors() ),
+            "Monolithic_Time_Solver::load_checkpoint() - Checkpoint does not match the solution vector." );
+
+    // copy local values, the layout matches extract_copy()
+    std::copy( tSolVec.data(), tSolVec.data() + tSolVec.numel(), aFullVector( aSolVecIndex )->get_values_pointer() );
+}
+
+//-------------------------------------------------------------------------------
+
+std::string
+Monolithic_Time_Solver::get_checkpoint_file_name( const uint aSolVecIndex ) const
+{
+    // insert the time step index in front of the file extension
+    std::size_t tExtensionPos = mCheckpointFile.find_last_of( "." );
+    std::size_t tDirectoryPos = mCheckpointFile.find_last_of( "/" );
+
+    if ( tExtensionPos == std::string::npos or ( tDirectoryPos != std::string::npos and tExtensionPos < tDirectoryPos ) )
+    {
+        return mCheckpointFile + "." + std::to_string( aSolVecIndex ) + ".hdf5";
+    }
+
+    return mCheckpointFile.substr( 0, tExtensionPos ) + "." + std::to_string( aSolVecIndex ) + mCheckpointFile.substr( tExtensionPos );
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Monolithic_Time_Solver::remove_checkpoint_file( const uint aSolVecIndex )
+{
+    if ( mCheckpointFileIndices.erase( aSolVecIndex ) > 0 )
+    {
+        std::remove( this->get_checkpoint_file_name( aSolVecIndex ).c_str() );
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Monolithic_Time_Solver::remove_checkpoint_files()
+{
+    for ( uint tSolVecIndex : mCheckpointFileIndices )
+    {
+        std::remove( this->get_checkpoint_file_name( tSolVecIndex ).c_str() );
+    }
+
+    mCheckpointFileIndices.clear();
+}
@@ -11,6 +11,8 @@
 #ifndef MORIS_DISTLINALG_CL_TSA_MONOLITHIC_TIME_SOLVER_HPP_
 #define MORIS_DISTLINALG_CL_TSA_MONOLITHIC_TIME_SOLVER_HPP_
 
+#include <set>
+
 #include "cl_TSA_Time_Solver_Algorithm.hpp"
 
 namespace moris
@@ -32,6 +34,181 @@ namespace moris
 
             moris::real mLambdaInc = 0;
 
+            // number of time steps between two checkpoints for the adjoint solve
+            uint mCheckpointInterval = 1;
+
+            // requested number of checkpoints, 0 if all solutions are kept
+            uint mNumCheckpoints = 0;
+
+            // file name for checkpoints stored on disk, empty if checkpoints are kept in memory
+            std::string mCheckpointFile = "";
+
+            // time steps with a checkpoint file on disk
+            std::set< uint > mCheckpointFileIndices;
+
+            // number of time steps recomputed during the adjoint solve
+            uint mNumRecomputedTimeSteps = 0;
+
+            // number of time steps accepted by the forward solve, replayed by the adjoint solve
+            uint mNumTimeSteps = 0;
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief estimates the relative error of a time step by the difference between the computed
+             * solution and its linear extrapolation from the previous time steps
+             *
+             * @param[in] aSolVec           Solution of this time step
+             * @param[in] aPrevSolVec       Solution of the previous time step
+             * @param[in] aPrevIncrement    Solution increment of the previous time step
+             * @param[in] aWorkVec          Work vector
+             * @param[in] aTimeStepRatio    Ratio of this to the previous time step size
+             */
+            real estimate_time_step_error(
+                    sol::Dist_Vector* aSolVec,
+                    sol::Dist_Vector* aPrevSolVec,
+                    sol::Dist_Vector* aPrevIncrement,
+                    sol::Dist_Vector* aWorkVec,
+                    const real        aTimeStepRatio );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief computes the factor for the next time step size from the estimated error
+             *
+             * @param[in] aError        Estimated relative error
+             * @param[in] aTolerance    Tolerance of the relative error
+             */
+            real compute_time_step_factor(
+                    const real aError,
+                    const real aTolerance ) const;
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief reads the checkpointing parameters for a given number of time steps
+             *
+             * @param[in] aNumTimeSteps     Number of time steps
+             */
+            void initialize_checkpoints( const uint aNumTimeSteps );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief doubles the checkpoint interval if more time steps are accepted than the initial estimate
+             * allows for the requested number of checkpoints, e.g. for adaptive time stepping. Checkpoints
+             * before the given time step which are not on the coarser grid are released.
+             *
+             * @param[in] aFullVector       Solution vectors of all time steps
+             * @param[in] aSolVecIndex      Index of the solution vector to be released next
+             */
+            void update_checkpoints(
+                    moris::Cell< sol::Dist_Vector* >& aFullVector,
+                    const uint                        aSolVecIndex );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief checks if the solution of a time step is kept for the adjoint solve, i.e. if it is
+             * a checkpoint or the solution of the initial, first or last time step
+             *
+             * @param[in] aSolVecIndex      Index of the solution vector
+             * @param[in] aNumTimeSteps     Number of time steps
+             */
+            bool is_checkpoint(
+                    const uint aSolVecIndex,
+                    const uint aNumTimeSteps ) const;
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief checks if a checkpoint is stored on disk instead of in memory. The solutions of
+             * the initial, first and last time step always stay in memory.
+             *
+             * @param[in] aSolVecIndex      Index of the solution vector
+             * @param[in] aNumTimeSteps     Number of time steps
+             */
+            bool is_stored_on_disk(
+                    const uint aSolVecIndex,
+                    const uint aNumTimeSteps ) const;
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief releases the solution of a time step which is no longer needed in memory,
+             * checkpoints are written to disk if requested, all other solutions are deleted
+             *
+             * @param[in] aFullVector       Solution vectors of all time steps
+             * @param[in] aSolVecIndex      Index of the solution vector
+             * @param[in] aNumTimeSteps     Number of time steps
+             */
+            void release_solution_vector(
+                    moris::Cell< sol::Dist_Vector* >& aFullVector,
+                    const uint                        aSolVecIndex,
+                    const uint                        aNumTimeSteps );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief restores the solutions of a time step and its previous time step for the adjoint solve
+             * by reading checkpoints from disk and recomputing the time steps after the last checkpoint
+             *
+             * @param[in] aFullVector       Solution vectors of all time steps
+             * @param[in] aSolVecIndex      Index of the solution vector
+             * @param[in] aNumTimeSteps     Number of time steps
+             */
+            void restore_solution_vectors(
+                    moris::Cell< sol::Dist_Vector* >& aFullVector,
+                    const uint                        aSolVecIndex,
+                    const uint                        aNumTimeSteps );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief recomputes the solution of a time step from the solution of the previous time step
+             *
+             * @param[in] aFullVector       Solution vectors of all time steps
+             * @param[in] aSolVecIndex      Index of the solution vector
+             */
+            void recompute_time_step(
+                    moris::Cell< sol::Dist_Vector* >& aFullVector,
+                    const uint                        aSolVecIndex );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief writes a solution vector to a checkpoint file and deletes it
+             *
+             * @param[in] aFullVector       Solution vectors of all time steps
+             * @param[in] aSolVecIndex      Index of the solution vector
+             */
+            void save_checkpoint(
+                    moris::Cell< sol::Dist_Vector* >& aFullVector,
+                    const uint                        aSolVecIndex );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief creates a solution vector from a checkpoint file
+             *
+             * @param[in] aFullVector       Solution vectors of all time steps
+             * @param[in] aSolVecIndex      Index of the solution vector
+             */
+            void load_checkpoint(
+                    moris::Cell< sol::Dist_Vector* >& aFullVector,
+                    const uint                        aSolVecIndex );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief returns the name of the checkpoint file of a time step
+             *
+             * @param[in] aSolVecIndex      Index of the solution vector
+             */
+            std::string get_checkpoint_file_name( const uint aSolVecIndex ) const;
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief removes the checkpoint file of a time step if it exists
+             *
+             * @param[in] aSolVecIndex      Index of the solution vector
+             */
+            void remove_checkpoint_file( const uint aSolVecIndex );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief removes all checkpoint files written by this time solver algorithm
+             */
+            void remove_checkpoint_files();
+
           public:
             //-------------------------------------------------------------------------------
             /**
@@ -52,7 +229,7 @@ namespace moris
 
             //-------------------------------------------------------------------------------
 
-            //        ~Monolithic_Time_Solver(){};
+            ~Monolithic_Time_Solver();
 
             //-------------------------------------------------------------------------------
             /**
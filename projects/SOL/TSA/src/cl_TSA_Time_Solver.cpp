@@ -692,14 +692,8 @@ Time_Solver::prepare_sol_vec_for_next_time_step()
 {
     if ( mIsLeaderTimeSolver )
     {
-        // get num RHS
-        uint tNumRHMS = mSolverInterface->get_num_rhs();
-
-        // create map object
-        sol::Matrix_Vector_Factory tMatFactory( mSolverWarehouse->get_tpl_type() );
-
         // full vector and prev full vector
-        sol::Dist_Vector* tFullVector = tMatFactory.create_vector( mSolverInterface, mFullMap, tNumRHMS );
+        sol::Dist_Vector* tFullVector = this->create_full_vector();
 
         mFullVector.push_back( tFullVector );
 
@@ -712,6 +706,20 @@ Time_Solver::prepare_sol_vec_for_next_time_step()
 
 //--------------------------------------------------------------------------------------------------------------------------
 
+sol::Dist_Vector*
+Time_Solver::create_full_vector()
+{
+    // get num RHS
+    uint tNumRHMS = mSolverInterface->get_num_rhs();
+
+    // create map object
+    sol::Matrix_Vector_Factory tMatFactory( mSolverWarehouse->get_tpl_type() );
+
+    return tMatFactory.create_vector( mSolverInterface, mFullMap, tNumRHMS );
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
 void
 Time_Solver::initialize_time_levels()
 {
@@ -359,6 +359,12 @@ namespace moris
              */
             void prepare_sol_vec_for_next_time_step();
 
+            //--------------------------------------------------------------------------------------------------
+            /**
+             * @brief create a new vector on the full map, e.g. for a recomputed time step solution
+             */
+            sol::Dist_Vector* create_full_vector();
+
             //--------------------------------------------------------------------------------------------------
             /**
              * @brief initialize time levels with parameter list input
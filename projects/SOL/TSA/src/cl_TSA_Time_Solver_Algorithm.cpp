@@ -101,4 +101,23 @@ Time_Solver_Algorithm::set_time_solver_parameters()
 
     // Time Frame
     mParameterListTimeSolver.insert( "TSA_Time_Frame", 1.0 );
+
+    // Number of checkpoints for the adjoint solve, 0: keep all time step solutions
+    mParameterListTimeSolver.insert( "TSA_Num_Checkpoints", 0 );
+
+    // File name for storing checkpoints on disk
+    mParameterListTimeSolver.insert( "TSA_Checkpoint_File", "" );
+
+    // Adaptive time stepping
+    mParameterListTimeSolver.insert( "TSA_Adaptive_Time_Stepping", false );
+
+    // Relative tolerance for the estimated time step error
+    mParameterListTimeSolver.insert( "TSA_Time_Step_Tolerance", 1.0e-3 );
+
+    // Minimal and maximal time step size, 0.0: no limit
+    mParameterListTimeSolver.insert( "TSA_Min_Time_Step", 0.0 );
+    mParameterListTimeSolver.insert( "TSA_Max_Time_Step", 0.0 );
+
+    // Maximal number of consecutive rejections of a time step
+    mParameterListTimeSolver.insert( "TSA_Max_Rejected_Time_Steps", 20 );
 }
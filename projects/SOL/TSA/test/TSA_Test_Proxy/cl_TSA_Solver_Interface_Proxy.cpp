@@ -52,9 +52,17 @@ TSA_Solver_Interface_Proxy::get_equation_object_rhs(
 
     mDeltaT = mT( 1, 0 ) - mT( 0, 0 );
 
-    aElementRHS.resize( 1 );
-    aElementRHS( 0 ).resize( 1, 1 );
-    aElementRHS( 0 )( 0, 0 ) = ( mk + 1.0 / ( mDeltaT ) ) * mMySolVec( 0, 0 ) - mMySolVecPrev( 0, 0 ) / (mDeltaT)-mk * std::cos( mT( 1, 0 ) );
+    // the adjoint problem shares the operator of the forward problem
+    if ( !this->get_is_forward_analysis() )
+    {
+        this->get_adjoint_rhs( aElementRHS );
+    }
+    else
+    {
+        aElementRHS.resize( 1 );
+        aElementRHS( 0 ).resize( 1, 1 );
+        aElementRHS( 0 )( 0, 0 ) = ( mk + 1.0 / ( mDeltaT ) ) * mMySolVec( 0, 0 ) - mMySolVecPrev( 0, 0 ) / (mDeltaT)-mk * std::cos( mT( 1, 0 ) );
+    }
 }
 
 // ----------------------------------------------------------------------------------------------
@@ -69,9 +77,17 @@ TSA_Solver_Interface_Proxy::get_equation_object_rhs(
 
     mDeltaT = mT( 1, 0 ) - mT( 0, 0 );
 
-    aElementRHS.resize( 1 );
-    aElementRHS( 0 ).resize( 1, 1 );
-    aElementRHS( 0 )( 0, 0 ) = ( mk + 1.0 / ( mDeltaT ) ) * mMySolVec( 0, 0 ) - mMySolVecPrev( 0, 0 ) / (mDeltaT)-mk * std::cos( mT( 1, 0 ) );
+    // the adjoint problem shares the operator of the forward problem
+    if ( !this->get_is_forward_analysis() )
+    {
+        this->get_adjoint_rhs( aElementRHS );
+    }
+    else
+    {
+        aElementRHS.resize( 1 );
+        aElementRHS( 0 ).resize( 1, 1 );
+        aElementRHS( 0 )( 0, 0 ) = ( mk + 1.0 / ( mDeltaT ) ) * mMySolVec( 0, 0 ) - mMySolVecPrev( 0, 0 ) / (mDeltaT)-mk * std::cos( mT( 1, 0 ) );
+    }
 }
 
 // ----------------------------------------------------------------------------------------------
@@ -115,9 +131,17 @@ TSA_Solver_Interface_Proxy::get_equation_object_operator_and_rhs(
 
     mDeltaT = mT( 1, 0 ) - mT( 0, 0 );
 
-    aElementRHS.resize( 1 );
-    aElementRHS( 0 ).resize( 1, 1 );
-    aElementRHS( 0 )( 0, 0 ) = ( mk + 1.0 / ( mDeltaT ) ) * mMySolVec( 0, 0 ) - mMySolVecPrev( 0, 0 ) / (mDeltaT)-mk * std::cos( mT( 1, 0 ) );
+    // the adjoint problem shares the operator of the forward problem
+    if ( !this->get_is_forward_analysis() )
+    {
+        this->get_adjoint_rhs( aElementRHS );
+    }
+    else
+    {
+        aElementRHS.resize( 1 );
+        aElementRHS( 0 ).resize( 1, 1 );
+        aElementRHS( 0 )( 0, 0 ) = ( mk + 1.0 / ( mDeltaT ) ) * mMySolVec( 0, 0 ) - mMySolVecPrev( 0, 0 ) / (mDeltaT)-mk * std::cos( mT( 1, 0 ) );
+    }
 
     aElementMatrix.resize( 1, 1 );
     aElementMatrix( 0, 0 ) = ( mk + 1.0 / ( mDeltaT ) );
@@ -136,11 +160,67 @@ TSA_Solver_Interface_Proxy::get_equation_object_operator_and_rhs(
 
     mDeltaT = mT( 1, 0 ) - mT( 0, 0 );
 
-    aElementRHS.resize( 1 );
-    aElementRHS( 0 ).resize( 1, 1 );
-    aElementRHS( 0 )( 0, 0 ) = ( mk + 1.0 / ( mDeltaT ) ) * mMySolVec( 0, 0 ) - mMySolVecPrev( 0, 0 ) / (mDeltaT)-mk * std::cos( mT( 1, 0 ) );
+    // the adjoint problem shares the operator of the forward problem
+    if ( !this->get_is_forward_analysis() )
+    {
+        this->get_adjoint_rhs( aElementRHS );
+    }
+    else
+    {
+        aElementRHS.resize( 1 );
+        aElementRHS( 0 ).resize( 1, 1 );
+        aElementRHS( 0 )( 0, 0 ) = ( mk + 1.0 / ( mDeltaT ) ) * mMySolVec( 0, 0 ) - mMySolVecPrev( 0, 0 ) / (mDeltaT)-mk * std::cos( mT( 1, 0 ) );
+    }
 
     aElementMatrix.resize( 1, 1 );
     aElementMatrix( 0, 0 ) = ( mk + 1.0 / ( mDeltaT ) );
 }
 
+// ----------------------------------------------------------------------------------------------
+
+void
+TSA_Solver_Interface_Proxy::get_adjoint_rhs( Cell< Matrix< DDRMat > >& aElementRHS )
+{
+    // adjoint of the next time step, zero for the last time step
+    Matrix< DDRMat > tPrevAdjoint;
+    mPrevAdjointVector->extract_copy( tPrevAdjoint );
+
+    aElementRHS.resize( 1 );
+    aElementRHS( 0 ).resize( 1, 1 );
+    aElementRHS( 0 )( 0, 0 ) = -1.0 - tPrevAdjoint( 0, 0 ) / mNextDeltaT;
+}
+
+// ----------------------------------------------------------------------------------------------
+
+void
+TSA_Solver_Interface_Proxy::set_previous_adjoint_solution_vector( sol::Dist_Vector* aSolutionVector )
+{
+    mPrevAdjointVector = aSolutionVector;
+}
+
+// ----------------------------------------------------------------------------------------------
+
+void
+TSA_Solver_Interface_Proxy::compute_IQI()
+{
+    mSolutionVector->extract_copy( mMySolVec );
+
+    mQoI += mMySolVec( 0, 0 );
+}
+
+// ----------------------------------------------------------------------------------------------
+
+void
+TSA_Solver_Interface_Proxy::postmultiply_implicit_dQds()
+{
+    // adjoint of this time step
+    Matrix< DDRMat > tAdjoint;
+    mAdjointVector->extract_copy( tAdjoint );
+
+    mSolutionVector->extract_copy( mMySolVec );
+
+    // dQ/dk = - lambda_n * dR_n/dk
+    mSensitivity -= tAdjoint( 0, 0 ) * ( mMySolVec( 0, 0 ) - std::cos( mT( 1, 0 ) ) );
+
+    mNextDeltaT = mT( 1, 0 ) - mT( 0, 0 );
+}
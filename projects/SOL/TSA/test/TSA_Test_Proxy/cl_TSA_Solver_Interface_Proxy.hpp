@@ -57,6 +57,19 @@ namespace moris
             Matrix< DDSMat > mTimeLevelIdsMinus;
             Matrix< DDSMat > mTimeLevelIdsPlus;
 
+            // adjoint of this and of the next time step and its time step size, the adjoint sweep runs backwards in time
+            sol::Dist_Vector* mAdjointVector     = nullptr;
+            sol::Dist_Vector* mPrevAdjointVector = nullptr;
+            moris::real       mNextDeltaT        = 1.0;
+
+            // QoI: sum of the solutions of all time steps, and its sensitivity with respect to mk
+            moris::real mQoI         = 0.0;
+            moris::real mSensitivity = 0.0;
+
+            // ----------------------------------------------------------------------------------------------
+            // rhs of the adjoint problem: -dQ/du_n - dR_n+1/du_n * lambda_n+1
+            void get_adjoint_rhs( Cell< Matrix< DDRMat > >& aElementRHS );
+
           public:
             TSA_Solver_Interface_Proxy();
 
@@ -79,7 +92,41 @@ namespace moris
                 mT = aTime;
             }
 
-            void compute_IQI(){};
+            void compute_IQI();
+
+            // ----------------------------------------------------------------------------------------------
+
+            void
+            set_adjoint_solution_vector( sol::Dist_Vector* aSolutionVector )
+            {
+                mAdjointVector = aSolutionVector;
+            }
+
+            void set_previous_adjoint_solution_vector( sol::Dist_Vector* aSolutionVector );
+
+            void postmultiply_implicit_dQds();
+
+            // ----------------------------------------------------------------------------------------------
+
+            enum fem::Element_Type
+            get_set_type( uint aMyEquSetInd )
+            {
+                return fem::Element_Type::BULK;
+            }
+
+            // ----------------------------------------------------------------------------------------------
+
+            moris::real
+            get_QoI()
+            {
+                return mQoI;
+            }
+
+            moris::real
+            get_sensitivity()
+            {
+                return mSensitivity;
+            }
 
             void
             set_previous_time( const Matrix< DDRMat >& aTime )
@@ -8,6 +8,8 @@
  *
  */
 
+#include <fstream>
+
 #include "catch.hpp"
 #include "fn_equal_to.hpp"
 #include "typedefs.hpp"
@@ -96,6 +98,341 @@ namespace moris
                 delete( tSolverInput );
             }
             }
+
+        TEST_CASE("TimeSolverCheckpoints","[TSA],[TimeSolverCheckpoints]")
+            {
+            if ( par_size() == 1 )
+            {
+                std::shared_ptr< Time_Solver_Algorithm > tTimesolverAlgorithm = std::make_shared< Monolithic_Time_Solver >();
+
+                // Create solver interface
+                Solver_Interface * tSolverInput = new TSA_Solver_Interface_Proxy();
+
+                dla::Solver_Factory  tSolFactory;
+                std::shared_ptr< dla::Linear_Solver_Algorithm > tLinSolverAlgorithm = tSolFactory.create_solver( sol::SolverType::AZTEC_IMPL );
+                tLinSolverAlgorithm->set_param("AZ_diagnostics") = AZ_none;
+                tLinSolverAlgorithm->set_param("AZ_output") = AZ_none;
+                tLinSolverAlgorithm->set_param("AZ_solver") = AZ_gmres;
+                tLinSolverAlgorithm->set_param("AZ_precond") = AZ_dom_decomp;
+
+                dla::Linear_Solver * tLinSolManager = new dla::Linear_Solver();
+                tLinSolManager->set_linear_algorithm( 0, tLinSolverAlgorithm );
+
+                NLA::Nonlinear_Solver_Factory tNonlinFactory;
+                std::shared_ptr< NLA::Nonlinear_Algorithm > tNonlLinSolverAlgorithm = tNonlinFactory.create_nonlinear_solver( NLA::NonlinearSolverType::NEWTON_SOLVER );
+                tNonlLinSolverAlgorithm->set_linear_solver( tLinSolManager );
+
+                NLA::Nonlinear_Solver tNonlinearSolverManager( NLA::NonlinearSolverType::NEWTON_SOLVER );
+                tNonlinearSolverManager.set_nonlinear_algorithm( tNonlLinSolverAlgorithm, 0 );
+
+                moris::Cell< enum MSI::Dof_Type > tDofTypes( 1 );
+                tDofTypes( 0 ) = MSI::Dof_Type::TEMP;
+                tNonlinearSolverManager.set_dof_type_list( tDofTypes );
+
+                tTimesolverAlgorithm->set_nonlinear_solver( & tNonlinearSolverManager );
+
+                tTimesolverAlgorithm->set_param("TSA_Num_Time_Steps")   = 1000;
+                tTimesolverAlgorithm->set_param("TSA_Time_Frame")       = 10.0;
+                tTimesolverAlgorithm->set_param("TSA_Num_Checkpoints")  = 10;
+
+                Time_Solver tTimeSolver;
+
+                tTimeSolver.set_time_solver_algorithm( tTimesolverAlgorithm );
+
+                sol::SOL_Warehouse tSolverWarehouse( tSolverInput );
+
+                tNonlinearSolverManager.set_solver_warehouse( &tSolverWarehouse );
+                tTimeSolver.set_solver_warehouse( &tSolverWarehouse );
+
+                tTimeSolver.set_dof_type_list( tDofTypes );
+
+                tTimeSolver.solve();
+
+                // solution is not affected by checkpointing
+                Matrix< DDRMat > tSol;
+                tTimeSolver.get_full_solution( tSol );
+
+                CHECK( equal_to( tSol( 0, 0 ), -8.869937049794211e-01, 1.0e+08 ) );
+
+                // only checkpoints and the solutions of the first and last time steps are kept
+                moris::Cell< sol::Dist_Vector* > & tSolVecs = tTimeSolver.get_solution_vectors();
+
+                CHECK( tSolVecs( 0 ) != nullptr );
+                CHECK( tSolVecs( 1 ) != nullptr );
+                CHECK( tSolVecs( 2 ) == nullptr );
+                CHECK( tSolVecs( 500 ) != nullptr );
+                CHECK( tSolVecs( 501 ) == nullptr );
+                CHECK( tSolVecs( 1000 ) != nullptr );
+
+                delete( tLinSolManager );
+                delete( tSolverInput );
+            }
+            }
+
+        /**
+         * solves the proxy problem forward and adjoint and returns the sensitivity of the
+         * sum of all time step solutions with respect to the conductivity
+         */
+        static real
+        solve_proxy_sensitivity(
+                const sint         aNumCheckpoints,
+                const std::string& aCheckpointFile,
+                const real         aConductivity,
+                real&              aQoI,
+                uint&              aNumRecomputedTimeSteps )
+        {
+            std::shared_ptr< Time_Solver_Algorithm > tTimesolverAlgorithm = std::make_shared< Monolithic_Time_Solver >();
+
+            // Create solver interface
+            TSA_Solver_Interface_Proxy * tSolverInput = new TSA_Solver_Interface_Proxy();
+            tSolverInput->mk = aConductivity;
+
+            dla::Solver_Factory  tSolFactory;
+            std::shared_ptr< dla::Linear_Solver_Algorithm > tLinSolverAlgorithm = tSolFactory.create_solver( sol::SolverType::AZTEC_IMPL );
+            tLinSolverAlgorithm->set_param("AZ_diagnostics") = AZ_none;
+            tLinSolverAlgorithm->set_param("AZ_output") = AZ_none;
+            tLinSolverAlgorithm->set_param("AZ_solver") = AZ_gmres;
+            tLinSolverAlgorithm->set_param("AZ_precond") = AZ_dom_decomp;
+
+            dla::Linear_Solver * tLinSolManager = new dla::Linear_Solver();
+            tLinSolManager->set_linear_algorithm( 0, tLinSolverAlgorithm );
+
+            NLA::Nonlinear_Solver_Factory tNonlinFactory;
+            std::shared_ptr< NLA::Nonlinear_Algorithm > tNonlLinSolverAlgorithm = tNonlinFactory.create_nonlinear_solver( NLA::NonlinearSolverType::NEWTON_SOLVER );
+            tNonlLinSolverAlgorithm->set_linear_solver( tLinSolManager );
+            tNonlLinSolverAlgorithm->set_linear_solver_for_adjoint_solve( tLinSolManager );
+
+            NLA::Nonlinear_Solver tNonlinearSolverManager( NLA::NonlinearSolverType::NEWTON_SOLVER );
+            tNonlinearSolverManager.set_nonlinear_algorithm( tNonlLinSolverAlgorithm, 0 );
+
+            moris::Cell< enum MSI::Dof_Type > tDofTypes( 1 );
+            tDofTypes( 0 ) = MSI::Dof_Type::TEMP;
+            tNonlinearSolverManager.set_dof_type_list( tDofTypes );
+
+            tTimesolverAlgorithm->set_nonlinear_solver( & tNonlinearSolverManager );
+            tTimesolverAlgorithm->set_nonlinear_solver_for_adjoint_solve( & tNonlinearSolverManager );
+
+            tTimesolverAlgorithm->set_param("TSA_Num_Time_Steps")   = 100;
+            tTimesolverAlgorithm->set_param("TSA_Time_Frame")       = 10.0;
+            tTimesolverAlgorithm->set_param("TSA_Num_Checkpoints")  = aNumCheckpoints;
+            tTimesolverAlgorithm->set_param("TSA_Checkpoint_File")  = aCheckpointFile;
+
+            Time_Solver tTimeSolver;
+
+            tTimeSolver.set_time_solver_algorithm( tTimesolverAlgorithm );
+
+            sol::SOL_Warehouse tSolverWarehouse( tSolverInput );
+
+            tNonlinearSolverManager.set_solver_warehouse( &tSolverWarehouse );
+            tTimeSolver.set_solver_warehouse( &tSolverWarehouse );
+
+            tTimeSolver.set_dof_type_list( tDofTypes );
+
+            tTimeSolver.solve();
+
+            Monolithic_Time_Solver* tMonolithicSolver = static_cast< Monolithic_Time_Solver* >( tTimesolverAlgorithm.get() );
+
+            // checkpoints between the first and the last time step are written to disk by the forward solve
+            if ( aCheckpointFile.size() > 0 )
+            {
+                CHECK( std::ifstream( tMonolithicSolver->get_checkpoint_file_name( 50 ) ).good() );
+            }
+
+            tTimeSolver.solve_sensitivity();
+
+            // and removed after the adjoint sweep
+            if ( aCheckpointFile.size() > 0 )
+            {
+                CHECK( tMonolithicSolver->mCheckpointFileIndices.empty() );
+                CHECK( !std::ifstream( tMonolithicSolver->get_checkpoint_file_name( 50 ) ).good() );
+            }
+
+            aQoI                    = tSolverInput->get_QoI();
+            aNumRecomputedTimeSteps = tMonolithicSolver->mNumRecomputedTimeSteps;
+
+            real tSensitivity = tSolverInput->get_sensitivity();
+
+            delete( tLinSolManager );
+            delete( tSolverInput );
+
+            return tSensitivity;
+        }
+
+        TEST_CASE("TimeSolverCheckpointSensitivities","[TSA],[TimeSolverCheckpoints]")
+            {
+            if ( par_size() == 1 )
+            {
+                real tQoI          = 0.0;
+                real tQoIMemory    = 0.0;
+                real tQoIDisk      = 0.0;
+                uint tNumRecomputed       = 0;
+                uint tNumRecomputedMemory = 0;
+                uint tNumRecomputedDisk   = 0;
+
+                // all solutions kept, checkpoints in memory and checkpoints on disk
+                real tSensitivity       = solve_proxy_sensitivity( 0, "", 2.0, tQoI, tNumRecomputed );
+                real tSensitivityMemory = solve_proxy_sensitivity( 10, "", 2.0, tQoIMemory, tNumRecomputedMemory );
+                real tSensitivityDisk   = solve_proxy_sensitivity( 10, "./TSA_Checkpoint_Test.hdf5", 2.0, tQoIDisk, tNumRecomputedDisk );
+
+                CHECK( tNumRecomputed == 0 );
+                CHECK( tNumRecomputedMemory > 0 );
+                CHECK( tNumRecomputedDisk == tNumRecomputedMemory );
+
+                // checkpointing changes neither the forward nor the adjoint solution
+                CHECK( equal_to( tQoIMemory, tQoI ) );
+                CHECK( equal_to( tQoIDisk, tQoI ) );
+                CHECK( equal_to( tSensitivityMemory, tSensitivity ) );
+                CHECK( equal_to( tSensitivityDisk, tSensitivity ) );
+
+                // adjoint sensitivity matches central finite differences
+                real tQoIPlus  = 0.0;
+                real tQoIMinus = 0.0;
+                real tPerturbation = 1.0e-5;
+
+                solve_proxy_sensitivity( 0, "", 2.0 + tPerturbation, tQoIPlus, tNumRecomputed );
+                solve_proxy_sensitivity( 0, "", 2.0 - tPerturbation, tQoIMinus, tNumRecomputed );
+
+                real tFDSensitivity = ( tQoIPlus - tQoIMinus ) / ( 2.0 * tPerturbation );
+
+                CHECK( std::abs( tSensitivity - tFDSensitivity ) < 1.0e-5 * std::max( std::abs( tFDSensitivity ), 1.0 ) );
+            }
+            }
+
+        TEST_CASE("TimeSolverCheckpointFilesRemoved","[TSA],[TimeSolverCheckpoints]")
+            {
+            if ( par_size() == 1 )
+            {
+                std::string tFileName;
+
+                {
+                    std::shared_ptr< Time_Solver_Algorithm > tTimesolverAlgorithm = std::make_shared< Monolithic_Time_Solver >();
+
+                    // Create solver interface
+                    Solver_Interface * tSolverInput = new TSA_Solver_Interface_Proxy();
+
+                    dla::Solver_Factory  tSolFactory;
+                    std::shared_ptr< dla::Linear_Solver_Algorithm > tLinSolverAlgorithm = tSolFactory.create_solver( sol::SolverType::AZTEC_IMPL );
+                    tLinSolverAlgorithm->set_param("AZ_diagnostics") = AZ_none;
+                    tLinSolverAlgorithm->set_param("AZ_output") = AZ_none;
+                    tLinSolverAlgorithm->set_param("AZ_solver") = AZ_gmres;
+                    tLinSolverAlgorithm->set_param("AZ_precond") = AZ_dom_decomp;
+
+                    dla::Linear_Solver * tLinSolManager = new dla::Linear_Solver();
+                    tLinSolManager->set_linear_algorithm( 0, tLinSolverAlgorithm );
+
+                    NLA::Nonlinear_Solver_Factory tNonlinFactory;
+                    std::shared_ptr< NLA::Nonlinear_Algorithm > tNonlLinSolverAlgorithm = tNonlinFactory.create_nonlinear_solver( NLA::NonlinearSolverType::NEWTON_SOLVER );
+                    tNonlLinSolverAlgorithm->set_linear_solver( tLinSolManager );
+
+                    NLA::Nonlinear_Solver tNonlinearSolverManager( NLA::NonlinearSolverType::NEWTON_SOLVER );
+                    tNonlinearSolverManager.set_nonlinear_algorithm( tNonlLinSolverAlgorithm, 0 );
+
+                    moris::Cell< enum MSI::Dof_Type > tDofTypes( 1 );
+                    tDofTypes( 0 ) = MSI::Dof_Type::TEMP;
+                    tNonlinearSolverManager.set_dof_type_list( tDofTypes );
+
+                    tTimesolverAlgorithm->set_nonlinear_solver( & tNonlinearSolverManager );
+
+                    tTimesolverAlgorithm->set_param("TSA_Num_Time_Steps")   = 100;
+                    tTimesolverAlgorithm->set_param("TSA_Time_Frame")       = 10.0;
+                    tTimesolverAlgorithm->set_param("TSA_Num_Checkpoints")  = 10;
+                    tTimesolverAlgorithm->set_param("TSA_Checkpoint_File")  = std::string( "./TSA_Checkpoint_Forward_Test.hdf5" );
+
+                    Time_Solver tTimeSolver;
+
+                    tTimeSolver.set_time_solver_algorithm( tTimesolverAlgorithm );
+
+                    sol::SOL_Warehouse tSolverWarehouse( tSolverInput );
+
+                    tNonlinearSolverManager.set_solver_warehouse( &tSolverWarehouse );
+                    tTimeSolver.set_solver_warehouse( &tSolverWarehouse );
+
+                    tTimeSolver.set_dof_type_list( tDofTypes );
+
+                    // forward solve only
+                    tTimeSolver.solve();
+
+                    tFileName = static_cast< Monolithic_Time_Solver* >( tTimesolverAlgorithm.get() )->get_checkpoint_file_name( 50 );
+
+                    CHECK( std::ifstream( tFileName ).good() );
+
+                    delete( tLinSolManager );
+                    delete( tSolverInput );
+                }
+
+                // checkpoints are removed by the destructor of the time solver algorithm
+                CHECK( !std::ifstream( tFileName ).good() );
+            }
+            }
+
+        TEST_CASE("TimeSolverAdaptive","[TSA],[TimeSolverAdaptive]")
+            {
+            if ( par_size() == 1 )
+            {
+                std::shared_ptr< Time_Solver_Algorithm > tTimesolverAlgorithm = std::make_shared< Monolithic_Time_Solver >();
+
+                // Create solver interface
+                Solver_Interface * tSolverInput = new TSA_Solver_Interface_Proxy();
+
+                dla::Solver_Factory  tSolFactory;
+                std::shared_ptr< dla::Linear_Solver_Algorithm > tLinSolverAlgorithm = tSolFactory.create_solver( sol::SolverType::AZTEC_IMPL );
+                tLinSolverAlgorithm->set_param("AZ_diagnostics") = AZ_none;
+                tLinSolverAlgorithm->set_param("AZ_output") = AZ_none;
+                tLinSolverAlgorithm->set_param("AZ_solver") = AZ_gmres;
+                tLinSolverAlgorithm->set_param("AZ_precond") = AZ_dom_decomp;
+
+                dla::Linear_Solver * tLinSolManager = new dla::Linear_Solver();
+                tLinSolManager->set_linear_algorithm( 0, tLinSolverAlgorithm );
+
+                NLA::Nonlinear_Solver_Factory tNonlinFactory;
+                std::shared_ptr< NLA::Nonlinear_Algorithm > tNonlLinSolverAlgorithm = tNonlinFactory.create_nonlinear_solver( NLA::NonlinearSolverType::NEWTON_SOLVER );
+                tNonlLinSolverAlgorithm->set_linear_solver( tLinSolManager );
+
+                NLA::Nonlinear_Solver tNonlinearSolverManager( NLA::NonlinearSolverType::NEWTON_SOLVER );
+                tNonlinearSolverManager.set_nonlinear_algorithm( tNonlLinSolverAlgorithm, 0 );
+
+                moris::Cell< enum MSI::Dof_Type > tDofTypes( 1 );
+                tDofTypes( 0 ) = MSI::Dof_Type::TEMP;
+                tNonlinearSolverManager.set_dof_type_list( tDofTypes );
+
+                tTimesolverAlgorithm->set_nonlinear_solver( & tNonlinearSolverManager );
+
+                tTimesolverAlgorithm->set_param("TSA_Num_Time_Steps")          = 100;
+                tTimesolverAlgorithm->set_param("TSA_Time_Frame")              = 10.0;
+                tTimesolverAlgorithm->set_param("TSA_Adaptive_Time_Stepping")  = true;
+                tTimesolverAlgorithm->set_param("TSA_Time_Step_Tolerance")     = 1.0e-2;
+
+                Time_Solver tTimeSolver;
+
+                tTimeSolver.set_time_solver_algorithm( tTimesolverAlgorithm );
+
+                sol::SOL_Warehouse tSolverWarehouse( tSolverInput );
+
+                tNonlinearSolverManager.set_solver_warehouse( &tSolverWarehouse );
+                tTimeSolver.set_solver_warehouse( &tSolverWarehouse );
+
+                tTimeSolver.set_dof_type_list( tDofTypes );
+
+                tTimeSolver.solve();
+
+                // accepted time slabs are contiguous and end at the time frame
+                moris::Cell< Matrix< DDRMat > > & tTimeFrames = tTimeSolver.get_time_frames();
+
+                for ( uint iFrame = 1; iFrame < tTimeFrames.size(); iFrame++ )
+                {
+                    CHECK( equal_to( tTimeFrames( iFrame )( 0, 0 ), tTimeFrames( iFrame - 1 )( 1, 0 ) ) );
+                    CHECK( tTimeFrames( iFrame )( 1, 0 ) > tTimeFrames( iFrame )( 0, 0 ) );
+                }
+
+                CHECK( equal_to( tTimeFrames( tTimeFrames.size() - 1 )( 1, 0 ), 10.0 ) );
+
+                // one solution vector per accepted time step
+                CHECK( tTimeSolver.get_solution_vectors().size() == tTimeFrames.size() + 1 );
+
+                delete( tLinSolManager );
+                delete( tSolverInput );
+            }
+            }
     }
 }
 
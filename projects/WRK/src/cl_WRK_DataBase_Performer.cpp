@@ -18,6 +18,10 @@
 
 #include "cl_MTK_Integration_Mesh_Editor.hpp"
 #include "cl_MTK_Mesh_DataBase_IG.hpp"
+#include "cl_MTK_Vertex_DataBase.hpp"
+#include "cl_MTK_Cell_DataBase.hpp"
+#include "cl_MTK_Cell_Cluster_DataBase.hpp"
+#include "cl_MTK_Side_Cluster_DataBase.hpp"
 
 #include "cl_MIG_Mesh_Editor.hpp"
 #include "cl_Tracer.hpp"
@@ -59,6 +63,13 @@ namespace moris
 
             mIntegrationMesh = mIGMeshEditor->perform();
 
+            // write the raw ip and ig mesh data including the T-matrices if requested
+            if ( !mSnapshotFile.empty() )
+            {
+                mInterpolationMesh->save_to_hdf5( mSnapshotFile );
+                mIntegrationMesh->save_to_hdf5( mSnapshotFile );
+            }
+
             // assign a name to the mesh
             std::string tXTKMeshName = "DataBase_Meshes";
 
@@ -68,6 +79,27 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        void
+        DataBase_Performer::load_snapshot( const std::string& aSnapshotFile )
+        {
+            Tracer tTracer( "DataBase", "No Type", "Load Snapshot" );
+
+            MORIS_ERROR( mMTKOutputPerformer != nullptr,
+                    "DataBase_Performer::load_snapshot() - output performer has not been set" );
+
+            // the interpolation mesh has to exist before the clusters of the integration mesh can be built
+            mInterpolationMesh = new mtk::Interpolation_Mesh_DataBase_IP();
+            mInterpolationMesh->load_from_hdf5( aSnapshotFile );
+
+            mIntegrationMesh = new mtk::Integration_Mesh_DataBase_IG();
+            mIntegrationMesh->load_from_hdf5( aSnapshotFile, mInterpolationMesh );
+
+            // register the mesh pair and grant ownership of the pointers created
+            mMTKOutputPerformer->register_mesh_pair( mInterpolationMesh, mIntegrationMesh, true, "DataBase_Meshes" );
+        }
+
+        //------------------------------------------------------------------------------
+
         void
         DataBase_Performer::set_output_performer( std::shared_ptr< mtk::Mesh_Manager > tMTKOutPerformer )
         {
@@ -79,7 +111,11 @@ namespace moris
         void
         DataBase_Performer::free_memory()
         {
-            mIGMeshEditor->free_memory();
+            // nothing to free if the meshes have been loaded from a snapshot
+            if ( mIGMeshEditor != nullptr )
+            {
+                mIGMeshEditor->free_memory();
+            }
         }
 
     }// namespace wrk
@@ -13,6 +13,7 @@
 #include "cl_WRK_Performer.hpp"
 
 #include <memory>
+#include <string>
 
 namespace moris
 {
@@ -36,13 +37,16 @@ namespace moris
 
             std::shared_ptr< mtk::Mesh_Manager > mMTKOutputPerformer; /*!< Output performer that will hold the meshes database creates */
 
-            mtk::Interpolation_Mesh_DataBase_IP* mInterpolationMesh;
-            mtk::Integration_Mesh_DataBase_IG*   mIntegrationMesh;
-            mtk::Integration_Mesh_Editor*        mIGMeshEditor;
+            mtk::Interpolation_Mesh_DataBase_IP* mInterpolationMesh = nullptr;
+            mtk::Integration_Mesh_DataBase_IG*   mIntegrationMesh   = nullptr;
+            mtk::Integration_Mesh_Editor*        mIGMeshEditor      = nullptr;
 
             // flag allowing the mesh check to be turned on/off for debugging
             bool mCheckMesh = true;
 
+            // path of the ip and ig mesh snapshot written after perform ( empty = no snapshot )
+            std::string mSnapshotFile;
+
           public:
             //------------------------------------------------------------------------------
 
@@ -73,6 +77,17 @@ namespace moris
 
             //------------------------------------------------------------------------------
 
+            /**
+             * @brief builds the data base mesh pair from a snapshot written by perform() on the same number of procs
+             * instead of the meshes of the input performer, the mesh pair is registered on the output performer
+             *
+             * @param aSnapshotFile path of the hdf5 file
+             */
+            void
+            load_snapshot( const std::string& aSnapshotFile );
+
+            //------------------------------------------------------------------------------
+
             /**
              * @brief Set the output performer
              *
@@ -106,6 +121,19 @@ namespace moris
             }
 
             //------------------------------------------------------------------------------
+
+            /**
+             * @brief Set the path of the ip and ig mesh snapshot written after building the mesh data base
+             *
+             * @param aSnapshotFile path of the hdf5 file, empty for no snapshot
+             */
+            void
+            set_snapshot_file( const std::string& aSnapshotFile )
+            {
+                mSnapshotFile = aSnapshotFile;
+            }
+
+            //------------------------------------------------------------------------------
         };
     }// namespace wrk
 }// namespace moris
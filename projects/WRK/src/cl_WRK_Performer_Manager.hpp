@@ -95,6 +95,18 @@ namespace moris
                  * destructor
                  */
                 ~Performer_Manager();
+
+                //------------------------------------------------------------------------------
+                /**
+                 * returns the HMR performer
+                 * @param[ in ] aIndex         index of the HMR performer
+                 */
+                std::shared_ptr< hmr::HMR >
+                get_hmr_performer( uint aIndex = 0 )
+                {
+                    return mHMRPerformer( aIndex );
+                }
+
                 //------------------------------------------------------------------------------
         };
     } /* namespace mdl */
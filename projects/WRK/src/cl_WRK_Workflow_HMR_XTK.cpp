@@ -99,6 +99,34 @@ namespace moris
                     mPerformerManager->mReinitializePerformer( 0 ) = std::make_shared< wrk::Reinitialize_Performer >( mPerformerManager->mLibrary );
                 }
             }
+
+            // the snapshot only contains the meshes of a single design, the design and its shape sensitivities
+            // cannot be evaluated without the HMR mesh and the intersections computed by GEN and XTK
+            ModuleParameterList tXTKParameterList = aPerformerManager->mLibrary->get_parameters_for_module( Parameter_List_Type::XTK );
+
+            mLoadDataBaseSnapshot = tXTKParameterList( 0 )( 0 ).get< bool >( "load_database_snapshot" );
+
+            if ( mLoadDataBaseSnapshot )
+            {
+                ModuleParameterList tOPTParameterList = aPerformerManager->mLibrary->get_parameters_for_module( Parameter_List_Type::OPT );
+                ModuleParameterList tMIGParameterList = aPerformerManager->mLibrary->get_parameters_for_module( Parameter_List_Type::MIG );
+
+                MORIS_ERROR( tXTKParameterList( 0 )( 0 ).get< bool >( "delete_xtk_after_generation" ),
+                        "Workflow_HMR_XTK::Workflow_HMR_XTK() - loading a data base snapshot requires delete_xtk_after_generation to be true." );
+
+                MORIS_ERROR( tOPTParameterList.empty() or not tOPTParameterList( 0 )( 0 ).get< bool >( "is_optimization_problem" ),
+                        "Workflow_HMR_XTK::Workflow_HMR_XTK() - loading a data base snapshot is only supported for a single design, not for an optimization problem." );
+
+                MORIS_ERROR( mPerformerManager->mRemeshingMiniPerformer( 0 ) == nullptr and mPerformerManager->mReinitializePerformer.size() == 0,
+                        "Workflow_HMR_XTK::Workflow_HMR_XTK() - loading a data base snapshot does not support remeshing or reinitialization of the ADVs." );
+
+                MORIS_ERROR( not mPerformerManager->mGENPerformer( 0 )->requires_shape_sensitivities(),
+                        "Workflow_HMR_XTK::Workflow_HMR_XTK() - loading a data base snapshot does not support shape sensitivities, "
+                        "no geometry may depend on ADVs or be discretized." );
+
+                MORIS_ERROR( tMIGParameterList.size() == 0,
+                        "Workflow_HMR_XTK::Workflow_HMR_XTK() - loading a data base snapshot does not support MIG." );
+            }
         }
 
         //--------------------------------------------------------------------------------------------------------------
@@ -114,6 +142,12 @@ namespace moris
 
             mIter = 0;
 
+            // the meshes are loaded from the snapshot in perform(), the HMR mesh and the ADVs are not needed
+            if ( mLoadDataBaseSnapshot )
+            {
+                return;
+            }
+
             moris::Cell< std::shared_ptr< mtk::Field > > tFieldsIn;
             moris::Cell< std::shared_ptr< mtk::Field > > tFieldsOut;
 
@@ -212,54 +246,58 @@ namespace moris
                 return tMat;
             }
 
-            // Stage *: Re-initialization of the adv field
-            if ( mPerformerManager->mReinitializePerformer.size() > 0 )
+            // the design is fixed if the meshes are loaded from a snapshot, HMR and GEN are not used
+            if ( not mLoadDataBaseSnapshot )
             {
-                // decide if the re-initialization would be required
-                sint tReinitFreq = mPerformerManager->mReinitializePerformer( 0 )->get_reinitialization_frequency();
-
-                if ( tOptIter > 0 and tOptIter % tReinitFreq == 0 )
+                // Stage *: Re-initialization of the adv field
+                if ( mPerformerManager->mReinitializePerformer.size() > 0 )
                 {
-                    // Set new advs in GE
-                    Tracer tTracer( "GEN", "Levelset", "Re-InitializeADVs" );
-
-                    mPerformerManager->mGENPerformer( 0 )->distribute_advs(
-                            mPerformerManager->mMTKPerformer( 0 )->get_mesh_pair( 0 ),
-                            mPerformerManager->mReinitializePerformer( 0 )->get_mtk_fields() );
-
-                    // get advs from GE and overwrite them
-                    aNewADVs = mPerformerManager->mGENPerformer( 0 )->get_advs();
+                    // decide if the re-initialization would be required
+                    sint tReinitFreq = mPerformerManager->mReinitializePerformer( 0 )->get_reinitialization_frequency();
+
+                    if ( tOptIter > 0 and tOptIter % tReinitFreq == 0 )
+                    {
+                        // Set new advs in GE
+                        Tracer tTracer( "GEN", "Levelset", "Re-InitializeADVs" );
+
+                        mPerformerManager->mGENPerformer( 0 )->distribute_advs(
+                                mPerformerManager->mMTKPerformer( 0 )->get_mesh_pair( 0 ),
+                                mPerformerManager->mReinitializePerformer( 0 )->get_mtk_fields() );
+
+                        // get advs from GE and overwrite them
+                        aNewADVs = mPerformerManager->mGENPerformer( 0 )->get_advs();
+                    }
+                    else
+                    {
+                        mPerformerManager->mGENPerformer( 0 )->set_advs( aNewADVs );
+                    }
                 }
                 else
                 {
+                    // Set new advs in GE
                     mPerformerManager->mGENPerformer( 0 )->set_advs( aNewADVs );
                 }
-            }
-            else
-            {
-                // Set new advs in GE
-                mPerformerManager->mGENPerformer( 0 )->set_advs( aNewADVs );
-            }
 
-            // Stage 1: HMR refinement
-            if ( mPerformerManager->mRemeshingMiniPerformer( 0 ) )
-            {
-                sint tReinitFreq = mPerformerManager->mRemeshingMiniPerformer( 0 )->get_reinitialization_frequency();
-
-                if ( tOptIter > 0 and tOptIter % tReinitFreq == 0 )
+                // Stage 1: HMR refinement
+                if ( mPerformerManager->mRemeshingMiniPerformer( 0 ) )
                 {
+                    sint tReinitFreq = mPerformerManager->mRemeshingMiniPerformer( 0 )->get_reinitialization_frequency();
 
-                    // allocate auxiliary arrays
-                    Matrix< DDRMat > tADVs;
-                    Matrix< DDRMat > tLowerBounds;
-                    Matrix< DDRMat > tUpperBounds;
-                    Matrix< IdMat >  tIjklIDs;
+                    if ( tOptIter > 0 and tOptIter % tReinitFreq == 0 )
+                    {
 
-                    // initialize HMR and GEN
-                    this->initialize( tADVs, tLowerBounds, tUpperBounds, tIjklIDs );
+                        // allocate auxiliary arrays
+                        Matrix< DDRMat > tADVs;
+                        Matrix< DDRMat > tLowerBounds;
+                        Matrix< DDRMat > tUpperBounds;
+                        Matrix< IdMat >  tIjklIDs;
 
-                    // Set new advs in GE
-                    mPerformerManager->mGENPerformer( 0 )->set_advs( aNewADVs );
+                        // initialize HMR and GEN
+                        this->initialize( tADVs, tLowerBounds, tUpperBounds, tIjklIDs );
+
+                        // Set new advs in GE
+                        mPerformerManager->mGENPerformer( 0 )->set_advs( aNewADVs );
+                    }
                 }
             }
 
@@ -274,18 +312,23 @@ namespace moris
             std::shared_ptr< mtk::Mesh_Manager > tMTKPerformer = std::make_shared< mtk::Mesh_Manager >();
 
             // Set performers
-            tXTKPerformer->set_geometry_engine( mPerformerManager->mGENPerformer( 0 ).get() );
-            tXTKPerformer->set_input_performer( mPerformerManager->mMTKPerformer( 0 ) );
             tXTKPerformer->set_output_performer( tMTKPerformer );
 
-            // Compute level set data in GEN
-            // FIXME: HMR stores mesh with aura on 0
-            mPerformerManager->mGENPerformer( 0 )->reset_mesh_information(
-                    mPerformerManager->mMTKPerformer( 0 )->get_interpolation_mesh( 0 ) );
+            // the xtk performer only provides its parameters if the meshes are loaded from a snapshot
+            if ( not mLoadDataBaseSnapshot )
+            {
+                tXTKPerformer->set_geometry_engine( mPerformerManager->mGENPerformer( 0 ).get() );
+                tXTKPerformer->set_input_performer( mPerformerManager->mMTKPerformer( 0 ) );
+
+                // Compute level set data in GEN
+                // FIXME: HMR stores mesh with aura on 0
+                mPerformerManager->mGENPerformer( 0 )->reset_mesh_information(
+                        mPerformerManager->mMTKPerformer( 0 )->get_interpolation_mesh( 0 ) );
 
-            // Output GEN fields, if requested
-            mPerformerManager->mGENPerformer( 0 )->output_fields(
-                    mPerformerManager->mMTKPerformer( 0 )->get_interpolation_mesh( 0 ) );
+                // Output GEN fields, if requested
+                mPerformerManager->mGENPerformer( 0 )->output_fields(
+                        mPerformerManager->mMTKPerformer( 0 )->get_interpolation_mesh( 0 ) );
+            }
 
             // mtk::Mesh_Checker tMeshCheckerHMR(
             //         0,
@@ -295,52 +338,75 @@ namespace moris
             // tMeshCheckerHMR.print_diagnostics();
 
             bool tDeleteXTK = tXTKPerformer->delete_xtk_after_generation();
-            // XTK perform - decompose - enrich - ghost - multigrid
-            bool tFlag = tXTKPerformer->perform_decomposition();
-
-            if ( not tFlag )
-            {
-                mInitializeOptimizationRestart = true;
-
-                MORIS_ERROR( mNumCriteria != MORIS_UINT_MAX,
-                        "Workflow_HMR_XTK::perform() problem with mNumCriteria. "
-                        "This can happen if the xtk interface interfaces different refinement level in the first optimization iteration" );
-
-                moris::Matrix< DDRMat > tMat( mNumCriteria, 1, std::numeric_limits< real >::quiet_NaN() );
-
-                if ( tDeleteXTK )
-                {
-                    // delete the xtk
-                    delete tXTKPerformer;
-                }
-
-                return tMat;
-            }
 
             // store whether the new ghost has been used
             bool tUseNewGhostSets = tXTKPerformer->uses_SPG_based_enrichment();
 
-            // XTK perform - enrich - ghost - multigrid
-            tXTKPerformer->perform_enrichment();
-
-            if ( tDeleteXTK )
+            // load the data base meshes from the snapshot of a previous run instead of generating them with XTK
+            if ( mLoadDataBaseSnapshot )
             {
-                // construct the data base with the mtk performer from xtk
+                // construct the data base performer, the meshes of the xtk performer are not used
                 mPerformerManager->mDataBasePerformer( 0 ) = std::make_shared< DataBase_Performer >( tMTKPerformer );
 
                 // create the mtk performer that will hold the data base mesh pair and set it
                 std::shared_ptr< mtk::Mesh_Manager > tMTKDataBasePerformer = std::make_shared< mtk::Mesh_Manager >();
                 mPerformerManager->mDataBasePerformer( 0 )->set_output_performer( tMTKDataBasePerformer );
 
-                // turn off the mesh check if no FEM-model will be constructed on the mesh
-                mPerformerManager->mDataBasePerformer( 0 )->set_mesh_check( !tXTKPerformer->kill_workflow_flag() );
-
-                // perform the mtk data base
-                mPerformerManager->mDataBasePerformer( 0 )->perform();
+                // build the ip and ig meshes from the snapshot file
+                mPerformerManager->mDataBasePerformer( 0 )->load_snapshot( tXTKPerformer->get_database_snapshot_file() );
 
                 // set the mtk performer
                 mPerformerManager->mMTKPerformer( 1 ) = tMTKDataBasePerformer;
             }
+            else
+            {
+                // XTK perform - decompose - enrich - ghost - multigrid
+                bool tFlag = tXTKPerformer->perform_decomposition();
+
+                if ( not tFlag )
+                {
+                    mInitializeOptimizationRestart = true;
+
+                    MORIS_ERROR( mNumCriteria != MORIS_UINT_MAX,
+                            "Workflow_HMR_XTK::perform() problem with mNumCriteria. "
+                            "This can happen if the xtk interface interfaces different refinement level in the first optimization iteration" );
+
+                    moris::Matrix< DDRMat > tMat( mNumCriteria, 1, std::numeric_limits< real >::quiet_NaN() );
+
+                    if ( tDeleteXTK )
+                    {
+                        // delete the xtk
+                        delete tXTKPerformer;
+                    }
+
+                    return tMat;
+                }
+
+                // XTK perform - enrich - ghost - multigrid
+                tXTKPerformer->perform_enrichment();
+
+                if ( tDeleteXTK )
+                {
+                    // construct the data base with the mtk performer from xtk
+                    mPerformerManager->mDataBasePerformer( 0 ) = std::make_shared< DataBase_Performer >( tMTKPerformer );
+
+                    // create the mtk performer that will hold the data base mesh pair and set it
+                    std::shared_ptr< mtk::Mesh_Manager > tMTKDataBasePerformer = std::make_shared< mtk::Mesh_Manager >();
+                    mPerformerManager->mDataBasePerformer( 0 )->set_output_performer( tMTKDataBasePerformer );
+
+                    // turn off the mesh check if no FEM-model will be constructed on the mesh
+                    mPerformerManager->mDataBasePerformer( 0 )->set_mesh_check( !tXTKPerformer->kill_workflow_flag() );
+
+                    // write a snapshot of the ip and ig meshes if requested
+                    mPerformerManager->mDataBasePerformer( 0 )->set_snapshot_file( tXTKPerformer->get_database_snapshot_file() );
+
+                    // perform the mtk data base
+                    mPerformerManager->mDataBasePerformer( 0 )->perform();
+
+                    // set the mtk performer
+                    mPerformerManager->mMTKPerformer( 1 ) = tMTKDataBasePerformer;
+                }
+            }
 
             // stop workflow if T-Matrices have been outputted
             if ( tXTKPerformer->only_generate_xtk_temp() )
@@ -352,8 +418,11 @@ namespace moris
                 return tMat;
             }
 
-            // output T-matrices and/or MPCs if requested
-            this->output_T_matrices( tMTKPerformer, tXTKPerformer );
+            // output T-matrices and/or MPCs if requested, the xtk meshes do not exist if the snapshot has been loaded
+            if ( not mLoadDataBaseSnapshot )
+            {
+                this->output_T_matrices( tMTKPerformer, tXTKPerformer );
+            }
 
             // stop workflow if T-Matrices have been outputted
             if ( tXTKPerformer->kill_workflow_flag() )
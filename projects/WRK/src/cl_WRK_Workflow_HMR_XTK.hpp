@@ -59,6 +59,8 @@ namespace moris
         class Workflow_HMR_XTK : public Workflow
         {
           private:
+            // load the data base meshes from a snapshot of a previous run instead of running HMR, GEN and XTK
+            bool mLoadDataBaseSnapshot = false;
 
           public:
             //------------------------------------------------------------------------------
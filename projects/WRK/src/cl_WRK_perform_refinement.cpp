@@ -304,6 +304,10 @@ namespace moris
                 aHMR->get_database()->update_bspline_meshes();
                 aHMR->get_database()->update_lagrange_meshes();
             }
+
+            // No load balancing here: tBGElements are reused for all patterns, and the remeshing
+            // maps the source fields by index onto the copied patterns, which requires the
+            // decomposition of the source mesh. It is inherited through the HMR parameters.
         }
 
         //--------------------------------------------------------------------------------------------------------------
@@ -590,6 +594,9 @@ namespace moris
             }
             aHMR->get_database()->update_bspline_meshes();
             aHMR->get_database()->update_lagrange_meshes();
+
+            // distribute active elements over procs once all patterns are refined
+            aHMR->perform_load_balancing();
         }
 
         //--------------------------------------------------------------------------------------------------------------
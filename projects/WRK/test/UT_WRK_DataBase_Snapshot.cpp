@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * UT_WRK_DataBase_Snapshot.cpp
+ *
+ */
+
+#include "catch.hpp"
+
+#include "cl_Communication_Tools.hpp"
+#include "typedefs.hpp"
+
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+#include "fn_norm.hpp"
+#include "op_minus.hpp"
+
+#include "cl_MTK_Mesh_Manager.hpp"
+#include "cl_MTK_Mesh_Pair.hpp"
+#include "cl_MTK_Interpolation_Mesh.hpp"
+#include "cl_MTK_Integration_Mesh.hpp"
+#include "cl_MTK_Vertex.hpp"
+#include "cl_MTK_Vertex_Interpolation.hpp"
+#include "cl_MTK_Cell.hpp"
+#include "cl_MTK_Cluster.hpp"
+#include "cl_MTK_Set.hpp"
+
+#include "cl_HMR.hpp"
+#include "cl_GEN_Geometry_Engine.hpp"
+#include "cl_XTK_Model.hpp"
+#include "cl_WRK_DataBase_Performer.hpp"
+#include "HDF5_Tools.hpp"
+
+#include "fn_PRM_HMR_Parameters.hpp"
+#include "fn_PRM_GEN_Parameters.hpp"
+#include "fn_PRM_XTK_Parameters.hpp"
+
+using namespace moris;
+
+namespace
+{
+    //------------------------------------------------------------------------------
+
+    void
+    check_cells_match(
+            moris::Cell< mtk::Cell const * > const & aCells,
+            moris::Cell< mtk::Cell const * > const & aLoadedCells )
+    {
+        REQUIRE( aCells.size() == aLoadedCells.size() );
+
+        for ( uint iCell = 0; iCell < aCells.size(); iCell++ )
+        {
+            CHECK( aCells( iCell )->get_id() == aLoadedCells( iCell )->get_id() );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    check_clusters_match(
+            mtk::Cluster const *       aCluster,
+            mtk::Cluster const *       aLoadedCluster,
+            const mtk::Leader_Follower aIsLeader,
+            bool                       aIsSideCluster )
+    {
+        CHECK( aCluster->is_trivial( aIsLeader ) == aLoadedCluster->is_trivial( aIsLeader ) );
+
+        CHECK( aCluster->get_interpolation_cell( aIsLeader ).get_id() == aLoadedCluster->get_interpolation_cell( aIsLeader ).get_id() );
+
+        check_cells_match( aCluster->get_primary_cells_in_cluster( aIsLeader ), aLoadedCluster->get_primary_cells_in_cluster( aIsLeader ) );
+
+        if ( aIsSideCluster )
+        {
+            Matrix< IndexMat > tOrdinals       = aCluster->get_cell_side_ordinals( aIsLeader );
+            Matrix< IndexMat > tLoadedOrdinals = aLoadedCluster->get_cell_side_ordinals( aIsLeader );
+
+            REQUIRE( tOrdinals.numel() == tLoadedOrdinals.numel() );
+
+            for ( uint iOrd = 0; iOrd < tOrdinals.numel(); iOrd++ )
+            {
+                CHECK( tOrdinals( iOrd ) == tLoadedOrdinals( iOrd ) );
+            }
+        }
+
+        moris::Cell< mtk::Vertex const * > tVertices       = aCluster->get_vertices_in_cluster( aIsLeader );
+        moris::Cell< mtk::Vertex const * > tLoadedVertices = aLoadedCluster->get_vertices_in_cluster( aIsLeader );
+
+        REQUIRE( tVertices.size() == tLoadedVertices.size() );
+
+        for ( uint iVertex = 0; iVertex < tVertices.size(); iVertex++ )
+        {
+            CHECK( tVertices( iVertex )->get_id() == tLoadedVertices( iVertex )->get_id() );
+        }
+
+        // local coordinates of non-trivial clusters come from the stored coordinate matrices
+        Matrix< DDRMat > tLocalCoords       = aCluster->get_vertices_local_coordinates_wrt_interp_cell( aIsLeader );
+        Matrix< DDRMat > tLoadedLocalCoords = aLoadedCluster->get_vertices_local_coordinates_wrt_interp_cell( aIsLeader );
+
+        REQUIRE( tLocalCoords.numel() == tLoadedLocalCoords.numel() );
+
+        if ( tLocalCoords.numel() > 0 )
+        {
+            CHECK( norm( tLocalCoords - tLoadedLocalCoords ) < 1e-12 );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+}    // namespace
+
+TEST_CASE( "WRK DataBase Snapshot", "[WRK_DataBase_Snapshot]" )
+{
+    if ( par_size() <= 2 )
+    {
+        std::string tSnapshotFile = "./WRK_DataBase_Snapshot.hdf5";
+
+        // HMR parameters
+        moris::ParameterList tHMRParams = prm::create_hmr_parameter_list();
+        tHMRParams.set( "number_of_elements_per_dimension", std::string( "8, 8" ) );
+        tHMRParams.set( "domain_dimensions", std::string( "2.0, 2.0" ) );
+        tHMRParams.set( "domain_offset", std::string( "-1.0, -1.0" ) );
+        tHMRParams.set( "domain_sidesets", std::string( "1,2,3,4" ) );
+        tHMRParams.set( "lagrange_output_meshes", std::string( "0" ) );
+        tHMRParams.set( "lagrange_orders", std::string( "1" ) );
+        tHMRParams.set( "lagrange_pattern", std::string( "0" ) );
+        tHMRParams.set( "bspline_orders", std::string( "1" ) );
+        tHMRParams.set( "bspline_pattern", std::string( "0" ) );
+        tHMRParams.set( "lagrange_to_bspline", std::string( "0" ) );
+        tHMRParams.set( "truncate_bsplines", 1 );
+        tHMRParams.set( "refinement_buffer", 1 );
+        tHMRParams.set( "staircase_buffer", 1 );
+        tHMRParams.set( "initial_refinement", std::string( "0" ) );
+        tHMRParams.set( "initial_refinement_pattern", std::string( "0" ) );
+        tHMRParams.set( "use_number_aura", 1 );
+        tHMRParams.set( "use_multigrid", 0 );
+        tHMRParams.set( "severity_level", 0 );
+
+        // GEN parameters, a circle cutting through the domain
+        moris::Cell< moris::Cell< moris::ParameterList > > tGENParams( 3 );
+        tGENParams( 0 ).resize( 1 );
+        tGENParams( 1 ).resize( 1 );
+        tGENParams( 0 )( 0 ) = prm::create_gen_parameter_list();
+        tGENParams( 1 )( 0 ) = prm::create_geometry_parameter_list();
+        tGENParams( 1 )( 0 ).set( "type", "circle" );
+        tGENParams( 1 )( 0 ).set( "constant_parameters", "0.0, 0.0, 0.61" );
+
+        // XTK parameters with enrichment and ghost to get all cluster types
+        moris::ParameterList tXTKParams = prm::create_xtk_parameter_list();
+        tXTKParams.set( "decompose", true );
+        tXTKParams.set( "decomposition_type", "conformal" );
+        tXTKParams.set( "enrich", true );
+        tXTKParams.set( "basis_rank", "bspline" );
+        tXTKParams.set( "enrich_mesh_indices", "0" );
+        tXTKParams.set( "ghost_stab", true );
+        tXTKParams.set( "multigrid", false );
+
+        std::shared_ptr< hmr::HMR >            tHMR    = std::make_shared< hmr::HMR >( tHMRParams );
+        std::shared_ptr< ge::Geometry_Engine > tGEN    = std::make_shared< ge::Geometry_Engine >( tGENParams, nullptr );
+        std::shared_ptr< mtk::Mesh_Manager >   tBGMTK  = std::make_shared< mtk::Mesh_Manager >();
+        std::shared_ptr< mtk::Mesh_Manager >   tXTKMTK = std::make_shared< mtk::Mesh_Manager >();
+        std::shared_ptr< xtk::Model >          tXTK    = std::make_shared< xtk::Model >( tXTKParams );
+
+        tHMR->set_performer( tBGMTK );
+
+        tXTK->set_geometry_engine( tGEN.get() );
+        tXTK->set_input_performer( tBGMTK );
+        tXTK->set_output_performer( tXTKMTK );
+
+        tHMR->perform_initial_refinement();
+        tHMR->perform();
+
+        tGEN->distribute_advs( tBGMTK->get_mesh_pair( 0 ), {} );
+
+        tXTK->perform_decomposition();
+        tXTK->perform_enrichment();
+
+        // build the data base meshes and write the snapshot
+        std::shared_ptr< mtk::Mesh_Manager > tDataBaseMTK = std::make_shared< mtk::Mesh_Manager >();
+
+        wrk::DataBase_Performer tDataBasePerformer( tXTKMTK );
+        tDataBasePerformer.set_output_performer( tDataBaseMTK );
+        tDataBasePerformer.set_snapshot_file( tSnapshotFile );
+        tDataBasePerformer.perform();
+
+        // rebuild the data base meshes from the snapshot only
+        std::shared_ptr< mtk::Mesh_Manager > tLoadedMTK = std::make_shared< mtk::Mesh_Manager >();
+
+        wrk::DataBase_Performer tLoadPerformer( nullptr );
+        tLoadPerformer.set_output_performer( tLoadedMTK );
+        tLoadPerformer.load_snapshot( tSnapshotFile );
+
+        // interpolation mesh: vertices, T-matrices and cells
+        mtk::Interpolation_Mesh* tIPMesh       = tDataBaseMTK->get_interpolation_mesh( 0 );
+        mtk::Interpolation_Mesh* tLoadedIPMesh = tLoadedMTK->get_interpolation_mesh( 0 );
+
+        CHECK( tIPMesh->get_spatial_dim() == tLoadedIPMesh->get_spatial_dim() );
+
+        REQUIRE( tIPMesh->get_num_nodes() == tLoadedIPMesh->get_num_nodes() );
+        REQUIRE( tIPMesh->get_num_elems() == tLoadedIPMesh->get_num_elems() );
+
+        for ( uint iVertex = 0; iVertex < tIPMesh->get_num_nodes(); iVertex++ )
+        {
+            mtk::Vertex const & tVertex       = tIPMesh->get_mtk_vertex( iVertex );
+            mtk::Vertex const & tLoadedVertex = tLoadedIPMesh->get_mtk_vertex( iVertex );
+
+            CHECK( tVertex.get_id() == tLoadedVertex.get_id() );
+            CHECK( norm( tVertex.get_coords() - tLoadedVertex.get_coords() ) < 1e-12 );
+
+            Matrix< IdMat > tBasisIds       = tVertex.get_interpolation( 0 )->get_ids();
+            Matrix< IdMat > tLoadedBasisIds = tLoadedVertex.get_interpolation( 0 )->get_ids();
+
+            REQUIRE( tBasisIds.numel() == tLoadedBasisIds.numel() );
+
+            for ( uint iBasis = 0; iBasis < tBasisIds.numel(); iBasis++ )
+            {
+                CHECK( tBasisIds( iBasis ) == tLoadedBasisIds( iBasis ) );
+            }
+
+            CHECK( norm( *tVertex.get_interpolation( 0 )->get_weights() - *tLoadedVertex.get_interpolation( 0 )->get_weights() ) < 1e-12 );
+        }
+
+        for ( uint iCell = 0; iCell < tIPMesh->get_num_elems(); iCell++ )
+        {
+            CHECK( tIPMesh->get_mtk_cell( iCell ).get_id() == tLoadedIPMesh->get_mtk_cell( iCell ).get_id() );
+        }
+
+        // cells loaded from the snapshot have no base cell to take the level from
+        CHECK_THROWS( tLoadedIPMesh->get_mtk_cell( 0 ).get_level() );
+
+        // integration mesh: vertices, cells and all sets with their clusters
+        mtk::Integration_Mesh* tIGMesh       = tDataBaseMTK->get_integration_mesh( 0 );
+        mtk::Integration_Mesh* tLoadedIGMesh = tLoadedMTK->get_integration_mesh( 0 );
+
+        REQUIRE( tIGMesh->get_num_nodes() == tLoadedIGMesh->get_num_nodes() );
+        REQUIRE( tIGMesh->get_num_elems() == tLoadedIGMesh->get_num_elems() );
+
+        for ( uint iVertex = 0; iVertex < tIGMesh->get_num_nodes(); iVertex++ )
+        {
+            CHECK( tIGMesh->get_mtk_vertex( iVertex ).get_id() == tLoadedIGMesh->get_mtk_vertex( iVertex ).get_id() );
+            CHECK( norm( tIGMesh->get_mtk_vertex( iVertex ).get_coords() - tLoadedIGMesh->get_mtk_vertex( iVertex ).get_coords() ) < 1e-12 );
+        }
+
+        for ( uint iCell = 0; iCell < tIGMesh->get_num_elems(); iCell++ )
+        {
+            mtk::Cell const & tCell       = tIGMesh->get_mtk_cell( iCell );
+            mtk::Cell const & tLoadedCell = tLoadedIGMesh->get_mtk_cell( iCell );
+
+            CHECK( tCell.get_id() == tLoadedCell.get_id() );
+            CHECK( tCell.get_owner() == tLoadedCell.get_owner() );
+            CHECK( tCell.get_geometry_type() == tLoadedCell.get_geometry_type() );
+            CHECK( norm( tCell.get_vertex_coords() - tLoadedCell.get_vertex_coords() ) < 1e-12 );
+        }
+
+        REQUIRE( tIGMesh->get_num_sets() == tLoadedIGMesh->get_num_sets() );
+
+        bool tHasDoubleSidedSet = false;
+
+        for ( uint iSet = 0; iSet < tIGMesh->get_num_sets(); iSet++ )
+        {
+            mtk::Set* tSet       = tIGMesh->get_set_by_index( iSet );
+            mtk::Set* tLoadedSet = tLoadedIGMesh->get_set_by_index( iSet );
+
+            CHECK( tSet->get_set_name() == tLoadedSet->get_set_name() );
+            CHECK( tSet->get_set_type() == tLoadedSet->get_set_type() );
+
+            moris::Cell< mtk::Cluster const * > tClusters       = tSet->get_clusters_on_set();
+            moris::Cell< mtk::Cluster const * > tLoadedClusters = tLoadedSet->get_clusters_on_set();
+
+            REQUIRE( tClusters.size() == tLoadedClusters.size() );
+
+            for ( uint iCluster = 0; iCluster < tClusters.size(); iCluster++ )
+            {
+                switch ( tSet->get_set_type() )
+                {
+                    case SetType::BULK:
+                    {
+                        check_clusters_match( tClusters( iCluster ), tLoadedClusters( iCluster ), mtk::Leader_Follower::LEADER, false );
+                        break;
+                    }
+                    case SetType::SIDESET:
+                    {
+                        check_clusters_match( tClusters( iCluster ), tLoadedClusters( iCluster ), mtk::Leader_Follower::LEADER, true );
+                        break;
+                    }
+                    case SetType::DOUBLE_SIDED_SIDESET:
+                    {
+                        tHasDoubleSidedSet = true;
+
+                        check_clusters_match( tClusters( iCluster ), tLoadedClusters( iCluster ), mtk::Leader_Follower::LEADER, true );
+                        check_clusters_match( tClusters( iCluster ), tLoadedClusters( iCluster ), mtk::Leader_Follower::FOLLOWER, true );
+
+                        CHECK( tClusters( iCluster )->get_leader_vertex_pairs().size() == tLoadedClusters( iCluster )->get_leader_vertex_pairs().size() );
+                        break;
+                    }
+                    default:
+                    {
+                        FAIL( "unexpected set type" );
+                    }
+                }
+            }
+        }
+
+        // the interface and ghost sets have to be part of the round trip
+        CHECK( tHasDoubleSidedSet );
+
+        // each processor writes its own snapshot file
+        std::remove( make_path_parallel( tSnapshotFile ).c_str() );
+    }
+}
@@ -20,6 +20,9 @@
 #include "cl_WRK_Workflow_HMR_XTK.hpp"
 #include "cl_Library_Factory.hpp"
 #include "cl_Communication_Tools.hpp"
+#include "cl_HMR.hpp"
+#include "cl_HMR_Database.hpp"
+#include "fn_equal_to.hpp"
 
 using namespace moris;
 
@@ -47,3 +50,53 @@ TEST_CASE( "WRK_sensitivity_test ", "[moris],[WRK_sensitivity_test]" )
     }
 }
 
+TEST_CASE( "WRK_database_snapshot_test", "[moris],[WRK_database_snapshot_test]" )
+{
+    if ( par_size() == 1 )
+    {
+        // runs the workflow of an input file, returns the criteria and whether the HMR mesh has been built
+        auto tRunWorkflow = []( const std::string& aInputFile, bool& aHMRPerformed ) {
+            std::string tInputFilePath = moris::get_moris_bin_dir() + "/lib/" + aInputFile;
+
+            // Load library
+            moris::Library_Factory        tLibraryFactory;
+            std::shared_ptr< Library_IO > tLibrary = tLibraryFactory.create_Library( Library_Type::STANDARD );
+            tLibrary->load_parameter_list( tInputFilePath, File_Type::SO_FILE );
+            tLibrary->finalize();
+
+            wrk::Performer_Manager tPerformerManager( tLibrary );
+            wrk::Workflow_HMR_XTK  tWorkflow( &tPerformerManager );
+
+            Matrix< DDRMat > tADVs( 0, 0 );
+            Matrix< DDRMat > tDummyBounds;
+            Matrix< IdMat >  tDummy1( 1, 1, 0.0 );
+            tWorkflow.initialize( tADVs, tDummyBounds, tDummyBounds, tDummy1 );
+
+            Matrix< DDRMat > tCriteria = tWorkflow.perform( tADVs );
+
+            aHMRPerformed = tPerformerManager.get_hmr_performer()->get_database()->is_finalized();
+
+            return tCriteria;
+        };
+
+        bool tHMRPerformed = false;
+
+        // run HMR, GEN and XTK and write the data base meshes to the snapshot
+        Matrix< DDRMat > tCriteria = tRunWorkflow( "WRK_Input_Snapshot_Write.so", tHMRPerformed );
+
+        CHECK( tHMRPerformed );
+
+        // run the same analysis on the meshes of the snapshot, HMR is not performed
+        Matrix< DDRMat > tLoadedCriteria = tRunWorkflow( "WRK_Input_Snapshot_Load.so", tHMRPerformed );
+
+        CHECK( not tHMRPerformed );
+
+        REQUIRE( tCriteria.numel() > 0 );
+        REQUIRE( tLoadedCriteria.numel() == tCriteria.numel() );
+
+        for ( uint iCriterion = 0; iCriterion < tCriteria.numel(); iCriterion++ )
+        {
+            CHECK( equal_to( tLoadedCriteria( iCriterion ), tCriteria( iCriterion ), 1.0e+08 ) );
+        }
+    }
+}
@@ -309,6 +309,14 @@ namespace moris
         tParameterlist( 0 )( 0 ).set( "ghost_stab", true );
 
         tParameterlist( 0 )( 0 ).set( "multigrid", false );
+
+#ifdef WRK_DATABASE_SNAPSHOT
+        // write the data base meshes to a snapshot or load them from it, see UT_WRK_Workflow.cpp
+        std::string tMorisOutput = std::getenv( "MORISOUTPUT" );
+
+        tParameterlist( 0 )( 0 ).set( "database_snapshot_file", tMorisOutput + "WRK_Workflow_Snapshot.hdf5" );
+        tParameterlist( 0 )( 0 ).set( "load_database_snapshot", WRK_LOAD_DATABASE_SNAPSHOT );
+#endif
     }
 
     void
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_XTK_Bounding_Volume_Hierarchy.cpp
+ *
+ */
+
+#include "cl_XTK_Bounding_Volume_Hierarchy.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "assert.hpp"
+
+namespace xtk
+{
+    // ----------------------------------------------------------------------------------
+
+    Bounding_Volume_Hierarchy::Bounding_Volume_Hierarchy( uint aMaxLeafSize )
+            : mMaxLeafSize( aMaxLeafSize )
+    {
+        MORIS_ERROR( mMaxLeafSize > 0, "Bounding_Volume_Hierarchy() - Leaf size must be positive." );
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void
+    Bounding_Volume_Hierarchy::build(
+            Matrix< DDRMat > const & aBoxMin,
+            Matrix< DDRMat > const & aBoxMax )
+    {
+        MORIS_ERROR( aBoxMin.n_rows() == aBoxMax.n_rows() and aBoxMin.n_cols() == aBoxMax.n_cols(),
+                "Bounding_Volume_Hierarchy::build() - Lower and upper bounds do not match." );
+
+        mSpatialDim = aBoxMin.n_rows();
+
+        mPrimitiveMin = aBoxMin;
+        mPrimitiveMax = aBoxMax;
+
+        uint tNumPrimitives = aBoxMin.n_cols();
+
+        mPrimitives.resize( tNumPrimitives );
+        std::iota( mPrimitives.begin(), mPrimitives.end(), 0 );
+
+        mLeftChild.clear();
+        mRightChild.clear();
+        mFirstPrimitive.clear();
+        mNumPrimitives.clear();
+
+        if ( tNumPrimitives == 0 )
+        {
+            mNodeMin.set_size( mSpatialDim, 0 );
+            mNodeMax.set_size( mSpatialDim, 0 );
+            return;
+        }
+
+        // a binary tree has less than two nodes per primitive
+        uint tMaxNumNodes = 2 * tNumPrimitives - 1;
+
+        mLeftChild.reserve( tMaxNumNodes );
+        mRightChild.reserve( tMaxNumNodes );
+        mFirstPrimitive.reserve( tMaxNumNodes );
+        mNumPrimitives.reserve( tMaxNumNodes );
+
+        mNodeMin.set_size( mSpatialDim, tMaxNumNodes );
+        mNodeMax.set_size( mSpatialDim, tMaxNumNodes );
+
+        this->build_node( aBoxMin, aBoxMax, 0, tNumPrimitives );
+
+        mNodeMin.resize( mSpatialDim, mLeftChild.size() );
+        mNodeMax.resize( mSpatialDim, mLeftChild.size() );
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    moris_index
+    Bounding_Volume_Hierarchy::build_node(
+            Matrix< DDRMat > const & aBoxMin,
+            Matrix< DDRMat > const & aBoxMax,
+            uint                     aBegin,
+            uint                     aEnd )
+    {
+        moris_index tNode = mLeftChild.size();
+
+        mLeftChild.push_back( -1 );
+        mRightChild.push_back( -1 );
+        mFirstPrimitive.push_back( aBegin );
+        mNumPrimitives.push_back( aEnd - aBegin );
+
+        if ( aEnd - aBegin <= mMaxLeafSize )
+        {
+            this->compute_leaf_box( aBoxMin, aBoxMax, tNode );
+
+            return tNode;
+        }
+
+        // bounds of the box centers, twice the centers are used to avoid the division
+        Matrix< DDRMat > tCenterMin( mSpatialDim, 1, MORIS_REAL_MAX );
+        Matrix< DDRMat > tCenterMax( mSpatialDim, 1, -MORIS_REAL_MAX );
+
+        for ( uint iPos = aBegin; iPos < aEnd; iPos++ )
+        {
+            for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+            {
+                real tCenter = aBoxMin( iDim, mPrimitives( iPos ) ) + aBoxMax( iDim, mPrimitives( iPos ) );
+
+                tCenterMin( iDim ) = std::min( tCenterMin( iDim ), tCenter );
+                tCenterMax( iDim ) = std::max( tCenterMax( iDim ), tCenter );
+            }
+        }
+
+        // split along the longest axis
+        uint tSplitDim = 0;
+
+        for ( uint iDim = 1; iDim < mSpatialDim; iDim++ )
+        {
+            if ( tCenterMax( iDim ) - tCenterMin( iDim ) > tCenterMax( tSplitDim ) - tCenterMin( tSplitDim ) )
+            {
+                tSplitDim = iDim;
+            }
+        }
+
+        // median split, the primitives are partitioned in place
+        uint tMid = aBegin + ( aEnd - aBegin ) / 2;
+
+        std::nth_element(
+                mPrimitives.begin() + aBegin,
+                mPrimitives.begin() + tMid,
+                mPrimitives.begin() + aEnd,
+                [ & ]( moris_index aA, moris_index aB ) {
+                    return aBoxMin( tSplitDim, aA ) + aBoxMax( tSplitDim, aA ) < aBoxMin( tSplitDim, aB ) + aBoxMax( tSplitDim, aB );
+                } );
+
+        moris_index tLeft  = this->build_node( aBoxMin, aBoxMax, aBegin, tMid );
+        moris_index tRight = this->build_node( aBoxMin, aBoxMax, tMid, aEnd );
+
+        mLeftChild( tNode )  = tLeft;
+        mRightChild( tNode ) = tRight;
+
+        for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+        {
+            mNodeMin( iDim, tNode ) = std::min( mNodeMin( iDim, tLeft ), mNodeMin( iDim, tRight ) );
+            mNodeMax( iDim, tNode ) = std::max( mNodeMax( iDim, tLeft ), mNodeMax( iDim, tRight ) );
+        }
+
+        return tNode;
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void
+    Bounding_Volume_Hierarchy::compute_leaf_box(
+            Matrix< DDRMat > const & aBoxMin,
+            Matrix< DDRMat > const & aBoxMax,
+            moris_index              aNode )
+    {
+        for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+        {
+            mNodeMin( iDim, aNode ) = MORIS_REAL_MAX;
+            mNodeMax( iDim, aNode ) = -MORIS_REAL_MAX;
+        }
+
+        uint tEnd = mFirstPrimitive( aNode ) + mNumPrimitives( aNode );
+
+        for ( uint iPos = mFirstPrimitive( aNode ); iPos < tEnd; iPos++ )
+        {
+            for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+            {
+                mNodeMin( iDim, aNode ) = std::min( mNodeMin( iDim, aNode ), aBoxMin( iDim, mPrimitives( iPos ) ) );
+                mNodeMax( iDim, aNode ) = std::max( mNodeMax( iDim, aNode ), aBoxMax( iDim, mPrimitives( iPos ) ) );
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void
+    Bounding_Volume_Hierarchy::refit(
+            Matrix< DDRMat > const & aBoxMin,
+            Matrix< DDRMat > const & aBoxMax )
+    {
+        MORIS_ERROR( aBoxMin.n_cols() == mPrimitives.size() and aBoxMax.n_cols() == mPrimitives.size(),
+                "Bounding_Volume_Hierarchy::refit() - Number of boxes does not match the hierarchy." );
+
+        mPrimitiveMin = aBoxMin;
+        mPrimitiveMax = aBoxMax;
+
+        // children are stored after their parent, thus a reverse loop updates the children first
+        for ( sint iNode = (sint)mLeftChild.size() - 1; iNode >= 0; iNode-- )
+        {
+            if ( mLeftChild( iNode ) == -1 )
+            {
+                this->compute_leaf_box( aBoxMin, aBoxMax, iNode );
+
+                continue;
+            }
+
+            moris_index tLeft  = mLeftChild( iNode );
+            moris_index tRight = mRightChild( iNode );
+
+            for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+            {
+                mNodeMin( iDim, iNode ) = std::min( mNodeMin( iDim, tLeft ), mNodeMin( iDim, tRight ) );
+                mNodeMax( iDim, iNode ) = std::max( mNodeMax( iDim, tLeft ), mNodeMax( iDim, tRight ) );
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    bool
+    Bounding_Volume_Hierarchy::overlaps(
+            moris_index              aNode,
+            Matrix< DDRMat > const & aMin,
+            Matrix< DDRMat > const & aMax ) const
+    {
+        for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+        {
+            if ( mNodeMin( iDim, aNode ) > aMax( iDim ) or mNodeMax( iDim, aNode ) < aMin( iDim ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void
+    Bounding_Volume_Hierarchy::query(
+            Matrix< DDRMat > const & aMin,
+            Matrix< DDRMat > const & aMax,
+            Cell< moris_index >&     aCandidates ) const
+    {
+        aCandidates.clear();
+
+        if ( mLeftChild.size() == 0 )
+        {
+            return;
+        }
+
+        MORIS_ASSERT( aMin.numel() == mSpatialDim and aMax.numel() == mSpatialDim,
+                "Bounding_Volume_Hierarchy::query() - Query box does not match spatial dimension." );
+
+        // depth first traversal with an explicit stack
+        Cell< moris_index > tStack;
+        tStack.reserve( 64 );
+        tStack.push_back( 0 );
+
+        while ( tStack.size() > 0 )
+        {
+            moris_index tNode = tStack( tStack.size() - 1 );
+            tStack.pop_back();
+
+            if ( !this->overlaps( tNode, aMin, aMax ) )
+            {
+                continue;
+            }
+
+            if ( mLeftChild( tNode ) == -1 )
+            {
+                uint tEnd = mFirstPrimitive( tNode ) + mNumPrimitives( tNode );
+
+                for ( uint iPos = mFirstPrimitive( tNode ); iPos < tEnd; iPos++ )
+                {
+                    moris_index tPrimitive = mPrimitives( iPos );
+
+                    bool tOverlap = true;
+
+                    // the leaf box may be larger than the box of a single primitive
+                    for ( uint iDim = 0; iDim < mSpatialDim and tOverlap; iDim++ )
+                    {
+                        tOverlap = mPrimitiveMin( iDim, tPrimitive ) <= aMax( iDim ) and mPrimitiveMax( iDim, tPrimitive ) >= aMin( iDim );
+                    }
+
+                    if ( tOverlap )
+                    {
+                        aCandidates.push_back( tPrimitive );
+                    }
+                }
+
+                continue;
+            }
+
+            tStack.push_back( mRightChild( tNode ) );
+            tStack.push_back( mLeftChild( tNode ) );
+        }
+    }
+
+    // ----------------------------------------------------------------------------------
+}    // namespace xtk
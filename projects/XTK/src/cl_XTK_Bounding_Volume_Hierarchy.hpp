@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_XTK_Bounding_Volume_Hierarchy.hpp
+ *
+ */
+
+#ifndef PROJECTS_XTK_SRC_XTK_CL_XTK_BOUNDING_VOLUME_HIERARCHY_HPP_
+#define PROJECTS_XTK_SRC_XTK_CL_XTK_BOUNDING_VOLUME_HIERARCHY_HPP_
+
+#include "typedefs.hpp"
+#include "cl_Cell.hpp"
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+
+using namespace moris;
+
+namespace xtk
+{
+    // ----------------------------------------------------------------------------------
+
+    /**
+     * @brief Bounding volume hierarchy of axis aligned bounding boxes (AABB).
+     * The tree is built top down by median splits along the longest axis of the box centers, such
+     * that building is of O(n log n) and a query for a box is of O(log n + number of overlaps).
+     * If the primitives move, the boxes of the tree can be refitted in O(n) without rebuilding it.
+     */
+    class Bounding_Volume_Hierarchy
+    {
+      private:
+        // spatial dimension
+        uint mSpatialDim = 0;
+
+        // maximal number of primitives in a leaf
+        uint mMaxLeafSize = 4;
+
+        // lower and upper bounds of the primitive boxes, one primitive per column
+        Matrix< DDRMat > mPrimitiveMin;
+        Matrix< DDRMat > mPrimitiveMax;
+
+        // lower and upper bounds of the node boxes, one node per column
+        Matrix< DDRMat > mNodeMin;
+        Matrix< DDRMat > mNodeMax;
+
+        // children of inner nodes, the nodes are stored in pre-order thus children follow their parent
+        Cell< moris_index > mLeftChild;
+        Cell< moris_index > mRightChild;
+
+        // range of the primitives of a leaf in the primitive list
+        Cell< uint > mFirstPrimitive;
+        Cell< uint > mNumPrimitives;
+
+        // primitive indices ordered by leaves
+        Cell< moris_index > mPrimitives;
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief recursively builds the node for a range of the primitive list
+         *
+         * @param[in] aBoxMin   Lower bounds of all primitive boxes
+         * @param[in] aBoxMax   Upper bounds of all primitive boxes
+         * @param[in] aBegin    First position in the primitive list
+         * @param[in] aEnd      Position after the last one in the primitive list
+         * @return Index of the node
+         */
+        moris_index build_node(
+                Matrix< DDRMat > const & aBoxMin,
+                Matrix< DDRMat > const & aBoxMax,
+                uint                     aBegin,
+                uint                     aEnd );
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief sets the box of a leaf to the union of its primitive boxes
+         */
+        void compute_leaf_box(
+                Matrix< DDRMat > const & aBoxMin,
+                Matrix< DDRMat > const & aBoxMax,
+                moris_index              aNode );
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief checks if the box of a node overlaps a given box
+         */
+        bool overlaps(
+                moris_index              aNode,
+                Matrix< DDRMat > const & aMin,
+                Matrix< DDRMat > const & aMax ) const;
+
+        // ----------------------------------------------------------------------------------
+
+      public:
+        Bounding_Volume_Hierarchy( uint aMaxLeafSize = 4 );
+
+        ~Bounding_Volume_Hierarchy() {}
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief builds the hierarchy for a set of boxes
+         *
+         * @param[in] aBoxMin   Lower bounds of the boxes, spatial dimension x number of boxes
+         * @param[in] aBoxMax   Upper bounds of the boxes, spatial dimension x number of boxes
+         */
+        void build(
+                Matrix< DDRMat > const & aBoxMin,
+                Matrix< DDRMat > const & aBoxMax );
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief updates the node boxes for moved primitives, the tree topology is kept
+         *
+         * @param[in] aBoxMin   Lower bounds of the boxes, same primitives as in build()
+         * @param[in] aBoxMax   Upper bounds of the boxes, same primitives as in build()
+         */
+        void refit(
+                Matrix< DDRMat > const & aBoxMin,
+                Matrix< DDRMat > const & aBoxMax );
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief finds all primitives whose box overlaps a given box
+         *
+         * @param[in] aMin          Lower bounds of the query box
+         * @param[in] aMax          Upper bounds of the query box
+         * @param[out] aCandidates  Indices of the overlapping primitives
+         */
+        void query(
+                Matrix< DDRMat > const & aMin,
+                Matrix< DDRMat > const & aMax,
+                Cell< moris_index >&     aCandidates ) const;
+
+        // ----------------------------------------------------------------------------------
+
+        uint
+        get_num_nodes() const
+        {
+            return mLeftChild.size();
+        }
+
+        // ----------------------------------------------------------------------------------
+
+        uint
+        get_num_primitives() const
+        {
+            return mPrimitives.size();
+        }
+    };
+}    // namespace xtk
+
+#endif /* PROJECTS_XTK_SRC_XTK_CL_XTK_BOUNDING_VOLUME_HIERARCHY_HPP_ */
@@ -0,0 +1,687 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_XTK_Contact_Sandbox.cpp
+ *
+ */
+
+#include "cl_XTK_Contact_Sandbox.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "cl_MTK_Integration_Mesh.hpp"
+#include "cl_MTK_Set.hpp"
+#include "cl_MTK_Cluster.hpp"
+#include "cl_MTK_Cell.hpp"
+#include "cl_MTK_Vertex.hpp"
+#include "cl_Communication_Tools.hpp"
+#include "fn_trans.hpp"
+#include "fn_dot.hpp"
+#include "fn_norm.hpp"
+#include "cl_Tracer.hpp"
+
+namespace xtk
+{
+    // ----------------------------------------------------------------------------------
+
+    Contact_Sandbox::Contact_Sandbox(
+            mtk::Integration_Mesh* aIntegrationMesh,
+            std::string            aContactSet0,
+            std::string            aContactSet1,
+            moris::real const &    aSearchDistance,
+            moris::real const &    aBBEpsilon )
+            : mIntegrationMesh( aIntegrationMesh )
+            , mContactSet0( aContactSet0 )
+            , mContactSet1( aContactSet1 )
+            , mSearchDistance( aSearchDistance )
+            , mBBEpsilon( aBBEpsilon )
+    {
+        mSpatialDim = mIntegrationMesh->get_spatial_dim();
+
+        MORIS_ERROR( mSpatialDim == 2 or mSpatialDim == 3,
+                "Contact_Sandbox() - Contact search is only implemented in 2D and 3D." );
+
+        MORIS_ERROR( mSearchDistance >= 0.0 and mBBEpsilon >= 0.0,
+                "Contact_Sandbox() - Search distance and bounding box padding must not be negative." );
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void
+    Contact_Sandbox::perform_global_contact_search(
+            Matrix< DDRMat > const & aCurrentDispVec,
+            Matrix< DDRMat > const & aPredictedDispVec )
+    {
+        Tracer tTracer( "XTK", "Contact Sandbox", "Global Contact Search" );
+
+        // collect the owned facets of both sets
+        this->collect_facets( mIntegrationMesh->get_set_by_name( mContactSet0 ), mFacets0 );
+        this->collect_facets( mIntegrationMesh->get_set_by_name( mContactSet1 ), mFacets1 );
+
+        mNumOwnedFacets1 = mFacets1.size();
+
+        this->update_facet_coords( aCurrentDispVec, aPredictedDispVec, mFacets0.size(), mFacets0 );
+        this->update_facet_coords( aCurrentDispVec, aPredictedDispVec, mNumOwnedFacets1, mFacets1 );
+
+        // boxes of the owned facets, both sets are padded for the motion until the next search and the boxes of the
+        // second set are inflated by the search distance in addition
+        Matrix< DDRMat > tBoxMin0;
+        Matrix< DDRMat > tBoxMax0;
+        this->compute_facet_boxes( mFacets0, mBBEpsilon, tBoxMin0, tBoxMax0 );
+
+        Matrix< DDRMat > tBoxMin1;
+        Matrix< DDRMat > tBoxMax1;
+        this->compute_facet_boxes( mFacets1, mSearchDistance + mBBEpsilon, tBoxMin1, tBoxMax1 );
+
+        Matrix< DDRMat > tSetMin0;
+        Matrix< DDRMat > tSetMax0;
+        this->compute_enclosing_box( tBoxMin0, tBoxMax0, mFacets0.size(), tSetMin0, tSetMax0 );
+
+        // ghost facets of the second set which might be in contact with the first set on this processor
+        this->ghost_candidate_facets( tBoxMin1, tBoxMax1, tSetMin0, tSetMax0 );
+
+        // build hierarchy of owned and ghost facets
+        this->compute_facet_boxes( mFacets1, mSearchDistance + mBBEpsilon, tBoxMin1, tBoxMax1 );
+
+        mBVH.build( tBoxMin1, tBoxMax1 );
+
+        MORIS_LOG_SPEC( "Number of Contact Facets", mFacets0.size() );
+        MORIS_LOG_SPEC( "Number of Candidate Facets", mNumOwnedFacets1 );
+        MORIS_LOG_SPEC( "Number of Ghost Candidate Facets", this->get_num_ghost_facets() );
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void
+    Contact_Sandbox::refit(
+            Matrix< DDRMat > const & aCurrentDispVec,
+            Matrix< DDRMat > const & aPredictedDispVec )
+    {
+        Tracer tTracer( "XTK", "Contact Sandbox", "Refit" );
+
+        this->update_facet_coords( aCurrentDispVec, aPredictedDispVec, mFacets0.size(), mFacets0 );
+        this->update_facet_coords( aCurrentDispVec, aPredictedDispVec, mNumOwnedFacets1, mFacets1 );
+
+        this->communicate_ghost_facet_coords();
+
+        Matrix< DDRMat > tBoxMin1;
+        Matrix< DDRMat > tBoxMax1;
+        this->compute_facet_boxes( mFacets1, mSearchDistance + mBBEpsilon, tBoxMin1, tBoxMax1 );
+
+        mBVH.refit( tBoxMin1, tBoxMax1 );
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    Cell< Contact_Facet_Pair >
+    Contact_Sandbox::compute_facet_pairs( Matrix< DDRMat > const & aIntegWeights ) const
+    {
+        Tracer tTracer( "XTK", "Contact Sandbox", "Compute Facet Pairs" );
+
+        MORIS_ERROR( aIntegWeights.n_rows() == mSpatialDim,
+                "Contact_Sandbox::compute_facet_pairs() - Number of barycentric coordinates does not match the facets." );
+
+        uint tNumPoints = aIntegWeights.n_cols();
+
+        Cell< Contact_Facet_Pair > tPairs;
+
+        // the boxes of the second set in the hierarchy already contain the search distance
+        Matrix< DDRMat > tBoxMin0;
+        Matrix< DDRMat > tBoxMax0;
+        this->compute_facet_boxes( mFacets0, 0.0, tBoxMin0, tBoxMax0 );
+
+        // integration points are evaluated as weighted sums of the vertex coordinates
+        Matrix< DDRMat > tWeights = trans( aIntegWeights );
+
+        Cell< moris_index > tCandidates;
+
+        Matrix< DDRMat > tProjectedPoint;
+        Matrix< DDRMat > tParamCoords;
+
+        for ( uint iFacet = 0; iFacet < mFacets0.size(); iFacet++ )
+        {
+            mBVH.query( tBoxMin0.get_column( iFacet ), tBoxMax0.get_column( iFacet ), tCandidates );
+
+            if ( tCandidates.size() == 0 )
+            {
+                continue;
+            }
+
+            // integration points in the predicted configuration, one point per row
+            Matrix< DDRMat > tIntegPoints = tWeights * mFacets0( iFacet ).mPredictedCoords;
+
+            // closest candidate facet of every integration point
+            Cell< moris_index > tClosestFacet( tNumPoints, gNoIndex );
+            Matrix< DDRMat >    tClosestPoints( tNumPoints, mSpatialDim );
+            Matrix< DDRMat >    tClosestParamCoords( tNumPoints, mSpatialDim );
+            Matrix< DDRMat >    tGaps( tNumPoints, 1, MORIS_REAL_MAX );
+
+            for ( uint iPoint = 0; iPoint < tNumPoints; iPoint++ )
+            {
+                for ( uint iCandidate = 0; iCandidate < tCandidates.size(); iCandidate++ )
+                {
+                    real tGap = this->project_point_on_facet(
+                            tIntegPoints.get_row( iPoint ),
+                            mFacets1( tCandidates( iCandidate ) ).mPredictedCoords,
+                            tProjectedPoint,
+                            tParamCoords );
+
+                    if ( tGap < tGaps( iPoint ) and tGap <= mSearchDistance )
+                    {
+                        tGaps( iPoint )         = tGap;
+                        tClosestFacet( iPoint ) = tCandidates( iCandidate );
+
+                        tClosestPoints.set_row( iPoint, tProjectedPoint );
+                        tClosestParamCoords.set_row( iPoint, tParamCoords );
+                    }
+                }
+            }
+
+            // group the integration points by their closest facet
+            for ( uint iCandidate = 0; iCandidate < tCandidates.size(); iCandidate++ )
+            {
+                uint tNumPairPoints = std::count( tClosestFacet.begin(), tClosestFacet.end(), tCandidates( iCandidate ) );
+
+                if ( tNumPairPoints == 0 )
+                {
+                    continue;
+                }
+
+                Contact_Facet_Pair tPair;
+                tPair.mFacet          = iFacet;
+                tPair.mCandidateFacet = tCandidates( iCandidate );
+
+                tPair.mIntegPoints.set_size( tNumPairPoints, mSpatialDim );
+                tPair.mProjectedPoints.set_size( tNumPairPoints, mSpatialDim );
+                tPair.mProjectedParamCoords.set_size( tNumPairPoints, mSpatialDim );
+                tPair.mGaps.set_size( tNumPairPoints, 1 );
+
+                uint tCounter = 0;
+
+                for ( uint iPoint = 0; iPoint < tNumPoints; iPoint++ )
+                {
+                    if ( tClosestFacet( iPoint ) == tCandidates( iCandidate ) )
+                    {
+                        tPair.mIntegPoints.set_row( tCounter, tIntegPoints.get_row( iPoint ) );
+                        tPair.mProjectedPoints.set_row( tCounter, tClosestPoints.get_row( iPoint ) );
+                        tPair.mProjectedParamCoords.set_row( tCounter, tClosestParamCoords.get_row( iPoint ) );
+                        tPair.mGaps( tCounter ) = tGaps( iPoint );
+
+                        tCounter++;
+                    }
+                }
+
+                tPairs.push_back( tPair );
+            }
+        }
+
+        return tPairs;
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void
+    Contact_Sandbox::collect_facets(
+            moris::mtk::Set*       aSet,
+            Cell< Contact_Facet >& aFacets )
+    {
+        aFacets.clear();
+
+        moris_id tMyRank = par_rank();
+
+        moris::Cell< mtk::Cluster const * > tClusters = aSet->get_clusters_on_set();
+
+        for ( uint iCluster = 0; iCluster < tClusters.size(); iCluster++ )
+        {
+            moris::Cell< moris::mtk::Cell const * > const & tCells = tClusters( iCluster )->get_primary_cells_in_cluster();
+
+            Matrix< IndexMat > tSideOrdinals = tClusters( iCluster )->get_cell_side_ordinals();
+
+            for ( uint iCell = 0; iCell < tCells.size(); iCell++ )
+            {
+                // facets are only collected on the owning processor
+                if ( tCells( iCell )->get_owner() != tMyRank )
+                {
+                    continue;
+                }
+
+                moris::Cell< mtk::Vertex const * > tVertices = tCells( iCell )->get_geometric_vertices_on_side_ordinal( tSideOrdinals( iCell ) );
+
+                MORIS_ERROR( tVertices.size() == mSpatialDim,
+                        "Contact_Sandbox::collect_facets() - Only linear facets are supported, i.e. lines in 2D and triangles in 3D." );
+
+                Contact_Facet tFacet;
+                tFacet.mCellId      = tCells( iCell )->get_id();
+                tFacet.mSideOrdinal = tSideOrdinals( iCell );
+                tFacet.mOwner       = tMyRank;
+
+                tFacet.mVertexIndices.set_size( 1, tVertices.size() );
+
+                for ( uint iVertex = 0; iVertex < tVertices.size(); iVertex++ )
+                {
+                    tFacet.mVertexIndices( iVertex ) = tVertices( iVertex )->get_index();
+                }
+
+                aFacets.push_back( tFacet );
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void
+    Contact_Sandbox::update_facet_coords(
+            Matrix< DDRMat > const & aCurrentDispVec,
+            Matrix< DDRMat > const & aPredictedDispVec,
+            uint                     aNumFacets,
+            Cell< Contact_Facet >&   aFacets )
+    {
+        for ( uint iFacet = 0; iFacet < aNumFacets; iFacet++ )
+        {
+            Contact_Facet& tFacet = aFacets( iFacet );
+
+            uint tNumVertices = tFacet.mVertexIndices.numel();
+
+            tFacet.mCurrentCoords.set_size( tNumVertices, mSpatialDim );
+            tFacet.mPredictedCoords.set_size( tNumVertices, mSpatialDim );
+
+            for ( uint iVertex = 0; iVertex < tNumVertices; iVertex++ )
+            {
+                moris_index tVertexIndex = tFacet.mVertexIndices( iVertex );
+
+                Matrix< DDRMat > tNodeCoord = mIntegrationMesh->get_node_coordinate( tVertexIndex );
+
+                for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+                {
+                    tFacet.mCurrentCoords( iVertex, iDim )   = tNodeCoord( iDim );
+                    tFacet.mPredictedCoords( iVertex, iDim ) = tNodeCoord( iDim );
+
+                    if ( aCurrentDispVec.numel() > 0 )
+                    {
+                        tFacet.mCurrentCoords( iVertex, iDim ) += aCurrentDispVec( tVertexIndex, iDim );
+                    }
+
+                    if ( aPredictedDispVec.numel() > 0 )
+                    {
+                        tFacet.mPredictedCoords( iVertex, iDim ) += aPredictedDispVec( tVertexIndex, iDim );
+                    }
+                }
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void
+    Contact_Sandbox::compute_facet_boxes(
+            Cell< Contact_Facet > const & aFacets,
+            real                          aPadding,
+            Matrix< DDRMat >&             aBoxMin,
+            Matrix< DDRMat >&             aBoxMax ) const
+    {
+        aBoxMin.set_size( mSpatialDim, aFacets.size(), MORIS_REAL_MAX );
+        aBoxMax.set_size( mSpatialDim, aFacets.size(), -MORIS_REAL_MAX );
+
+        for ( uint iFacet = 0; iFacet < aFacets.size(); iFacet++ )
+        {
+            Contact_Facet const & tFacet = aFacets( iFacet );
+
+            // the box encloses the swept facet between the current and the predicted configuration
+            for ( uint iVertex = 0; iVertex < tFacet.mCurrentCoords.n_rows(); iVertex++ )
+            {
+                for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+                {
+                    real tCurrent   = tFacet.mCurrentCoords( iVertex, iDim );
+                    real tPredicted = tFacet.mPredictedCoords( iVertex, iDim );
+
+                    aBoxMin( iDim, iFacet ) = std::min( aBoxMin( iDim, iFacet ), std::min( tCurrent, tPredicted ) );
+                    aBoxMax( iDim, iFacet ) = std::max( aBoxMax( iDim, iFacet ), std::max( tCurrent, tPredicted ) );
+                }
+            }
+
+            for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+            {
+                aBoxMin( iDim, iFacet ) -= aPadding;
+                aBoxMax( iDim, iFacet ) += aPadding;
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void
+    Contact_Sandbox::compute_enclosing_box(
+            Matrix< DDRMat > const & aBoxMin,
+            Matrix< DDRMat > const & aBoxMax,
+            uint                     aNumBoxes,
+            Matrix< DDRMat >&        aSetMin,
+            Matrix< DDRMat >&        aSetMax ) const
+    {
+        // an empty set has an inverted box which does not overlap any other box
+        aSetMin.set_size( mSpatialDim, 1, MORIS_REAL_MAX );
+        aSetMax.set_size( mSpatialDim, 1, -MORIS_REAL_MAX );
+
+        for ( uint iBox = 0; iBox < aNumBoxes; iBox++ )
+        {
+            for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+            {
+                aSetMin( iDim ) = std::min( aSetMin( iDim ), aBoxMin( iDim, iBox ) );
+                aSetMax( iDim ) = std::max( aSetMax( iDim ), aBoxMax( iDim, iBox ) );
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void
+    Contact_Sandbox::ghost_candidate_facets(
+            Matrix< DDRMat > const & aBoxMin1,
+            Matrix< DDRMat > const & aBoxMax1,
+            Matrix< DDRMat > const & aSetMin0,
+            Matrix< DDRMat > const & aSetMax0 )
+    {
+        mCommTable.set_size( 0, 1 );
+        mSendFacets.clear();
+        mReceiveOffsets = { mNumOwnedFacets1 };
+
+        moris_id tParSize = par_size();
+        moris_id tMyRank  = par_rank();
+
+        if ( tParSize == 1 )
+        {
+            return;
+        }
+
+        Matrix< DDRMat > tSetMin1;
+        Matrix< DDRMat > tSetMax1;
+        this->compute_enclosing_box( aBoxMin1, aBoxMax1, mNumOwnedFacets1, tSetMin1, tSetMax1 );
+
+        // gather the set boxes of all processors, rows: lower and upper bounds of the first and the second set
+        Matrix< DDRMat > tSetBounds( 4 * mSpatialDim, tParSize );
+
+        for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+        {
+            Matrix< DDRMat > tGathered;
+
+            comm_gather_and_broadcast( aSetMin0( iDim ), tGathered );
+            tSetBounds.set_row( iDim, trans( tGathered ) );
+
+            comm_gather_and_broadcast( aSetMax0( iDim ), tGathered );
+            tSetBounds.set_row( mSpatialDim + iDim, trans( tGathered ) );
+
+            comm_gather_and_broadcast( tSetMin1( iDim ), tGathered );
+            tSetBounds.set_row( 2 * mSpatialDim + iDim, trans( tGathered ) );
+
+            comm_gather_and_broadcast( tSetMax1( iDim ), tGathered );
+            tSetBounds.set_row( 3 * mSpatialDim + iDim, trans( tGathered ) );
+        }
+
+        // checks if the first set of a processor overlaps the second set of another processor
+        auto tSetsOverlap = [ & ]( moris_id aRank0, moris_id aRank1 ) -> bool
+        {
+            for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+            {
+                if ( tSetBounds( iDim, aRank0 ) > tSetBounds( 3 * mSpatialDim + iDim, aRank1 )
+                        or tSetBounds( mSpatialDim + iDim, aRank0 ) < tSetBounds( 2 * mSpatialDim + iDim, aRank1 ) )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        };
+
+        // both processors of a pair have to communicate if facets are sent in any direction
+        Cell< moris_id > tCommProcs;
+
+        for ( moris_id iProc = 0; iProc < tParSize; iProc++ )
+        {
+            if ( iProc != tMyRank and ( tSetsOverlap( iProc, tMyRank ) or tSetsOverlap( tMyRank, iProc ) ) )
+            {
+                tCommProcs.push_back( iProc );
+            }
+        }
+
+        uint tNumCommProcs = tCommProcs.size();
+
+        mCommTable.set_size( tNumCommProcs, 1 );
+        mSendFacets.resize( tNumCommProcs );
+
+        Cell< Matrix< IdMat > > tSendIds( tNumCommProcs );
+
+        for ( uint iProc = 0; iProc < tNumCommProcs; iProc++ )
+        {
+            moris_id tRank = tCommProcs( iProc );
+
+            mCommTable( iProc ) = tRank;
+
+            // owned facets overlapping the first set of the other processor
+            for ( uint iFacet = 0; iFacet < mNumOwnedFacets1; iFacet++ )
+            {
+                bool tOverlap = true;
+
+                for ( uint iDim = 0; iDim < mSpatialDim and tOverlap; iDim++ )
+                {
+                    tOverlap = aBoxMin1( iDim, iFacet ) <= tSetBounds( mSpatialDim + iDim, tRank )
+                           and aBoxMax1( iDim, iFacet ) >= tSetBounds( iDim, tRank );
+                }
+
+                if ( tOverlap )
+                {
+                    mSendFacets( iProc ).push_back( iFacet );
+                }
+            }
+
+            // cell id and side ordinal of the sent facets
+            tSendIds( iProc ).set_size( 2, mSendFacets( iProc ).size() );
+
+            for ( uint iFacet = 0; iFacet < mSendFacets( iProc ).size(); iFacet++ )
+            {
+                tSendIds( iProc )( 0, iFacet ) = mFacets1( mSendFacets( iProc )( iFacet ) ).mCellId;
+                tSendIds( iProc )( 1, iFacet ) = mFacets1( mSendFacets( iProc )( iFacet ) ).mSideOrdinal;
+            }
+        }
+
+        Cell< Matrix< IdMat > > tReceivedIds;
+        communicate_mats( mCommTable, tSendIds, tReceivedIds );
+
+        // create ghost facets, their coordinates are communicated separately
+        for ( uint iProc = 0; iProc < tNumCommProcs; iProc++ )
+        {
+            uint tNumReceived = tReceivedIds( iProc ).numel() > 0 ? tReceivedIds( iProc ).n_cols() : 0;
+
+            for ( uint iFacet = 0; iFacet < tNumReceived; iFacet++ )
+            {
+                Contact_Facet tFacet;
+                tFacet.mCellId      = tReceivedIds( iProc )( 0, iFacet );
+                tFacet.mSideOrdinal = tReceivedIds( iProc )( 1, iFacet );
+                tFacet.mOwner       = mCommTable( iProc );
+
+                mFacets1.push_back( tFacet );
+            }
+
+            mReceiveOffsets.push_back( mFacets1.size() );
+        }
+
+        this->communicate_ghost_facet_coords();
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void
+    Contact_Sandbox::communicate_ghost_facet_coords()
+    {
+        uint tNumCommProcs = mCommTable.numel();
+
+        if ( tNumCommProcs == 0 )
+        {
+            return;
+        }
+
+        // linear facets have as many vertices as spatial dimensions
+        uint tNumVertices = mSpatialDim;
+        uint tNumCoords   = tNumVertices * mSpatialDim;
+
+        // current coordinates followed by predicted coordinates, one facet per column
+        Cell< Matrix< DDRMat > > tSendCoords( tNumCommProcs );
+
+        for ( uint iProc = 0; iProc < tNumCommProcs; iProc++ )
+        {
+            tSendCoords( iProc ).set_size( 2 * tNumCoords, mSendFacets( iProc ).size() );
+
+            for ( uint iFacet = 0; iFacet < mSendFacets( iProc ).size(); iFacet++ )
+            {
+                Contact_Facet const & tFacet = mFacets1( mSendFacets( iProc )( iFacet ) );
+
+                for ( uint iVertex = 0; iVertex < tNumVertices; iVertex++ )
+                {
+                    for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+                    {
+                        tSendCoords( iProc )( iVertex * mSpatialDim + iDim, iFacet )              = tFacet.mCurrentCoords( iVertex, iDim );
+                        tSendCoords( iProc )( tNumCoords + iVertex * mSpatialDim + iDim, iFacet ) = tFacet.mPredictedCoords( iVertex, iDim );
+                    }
+                }
+            }
+        }
+
+        Cell< Matrix< DDRMat > > tReceivedCoords;
+        communicate_mats( mCommTable, tSendCoords, tReceivedCoords );
+
+        for ( uint iProc = 0; iProc < tNumCommProcs; iProc++ )
+        {
+            MORIS_ASSERT( mReceiveOffsets( iProc + 1 ) - mReceiveOffsets( iProc ) == ( tReceivedCoords( iProc ).numel() > 0 ? tReceivedCoords( iProc ).n_cols() : 0 ),
+                    "Contact_Sandbox::communicate_ghost_facet_coords() - Number of received facets does not match the ghost facets." );
+
+            for ( uint iFacet = mReceiveOffsets( iProc ); iFacet < mReceiveOffsets( iProc + 1 ); iFacet++ )
+            {
+                Contact_Facet& tFacet = mFacets1( iFacet );
+
+                uint tColumn = iFacet - mReceiveOffsets( iProc );
+
+                tFacet.mCurrentCoords.set_size( tNumVertices, mSpatialDim );
+                tFacet.mPredictedCoords.set_size( tNumVertices, mSpatialDim );
+
+                for ( uint iVertex = 0; iVertex < tNumVertices; iVertex++ )
+                {
+                    for ( uint iDim = 0; iDim < mSpatialDim; iDim++ )
+                    {
+                        tFacet.mCurrentCoords( iVertex, iDim )   = tReceivedCoords( iProc )( iVertex * mSpatialDim + iDim, tColumn );
+                        tFacet.mPredictedCoords( iVertex, iDim ) = tReceivedCoords( iProc )( tNumCoords + iVertex * mSpatialDim + iDim, tColumn );
+                    }
+                }
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    real
+    Contact_Sandbox::project_point_on_facet(
+            Matrix< DDRMat > const & aPoint,
+            Matrix< DDRMat > const & aFacetCoords,
+            Matrix< DDRMat >&        aProjectedPoint,
+            Matrix< DDRMat >&        aParamCoords )
+    {
+        uint tSpatialDim = aFacetCoords.n_cols();
+
+        MORIS_ASSERT( aFacetCoords.n_rows() == tSpatialDim,
+                "Contact_Sandbox::project_point_on_facet() - Only linear facets are supported, i.e. lines in 2D and triangles in 3D." );
+
+        aParamCoords.set_size( 1, tSpatialDim, 0.0 );
+
+        Matrix< DDRMat > tA = aFacetCoords.get_row( 0 );
+        Matrix< DDRMat > tB = aFacetCoords.get_row( 1 );
+
+        Matrix< DDRMat > tAB = tB - tA;
+        Matrix< DDRMat > tAP = aPoint - tA;
+
+        if ( tSpatialDim == 2 )
+        {
+            // closest point on a line segment
+            real tLengthSquared = dot( tAB, tAB );
+            real tT             = tLengthSquared > 0.0 ? std::min( std::max( dot( tAP, tAB ) / tLengthSquared, 0.0 ), 1.0 ) : 0.0;
+
+            aParamCoords( 0 ) = 1.0 - tT;
+            aParamCoords( 1 ) = tT;
+        }
+        else
+        {
+            // closest point on a triangle by its Voronoi regions ( Ericson, Real-Time Collision Detection )
+            Matrix< DDRMat > tC = aFacetCoords.get_row( 2 );
+
+            Matrix< DDRMat > tAC = tC - tA;
+
+            real tD1 = dot( tAB, tAP );
+            real tD2 = dot( tAC, tAP );
+
+            Matrix< DDRMat > tBP = aPoint - tB;
+
+            real tD3 = dot( tAB, tBP );
+            real tD4 = dot( tAC, tBP );
+
+            Matrix< DDRMat > tCP = aPoint - tC;
+
+            real tD5 = dot( tAB, tCP );
+            real tD6 = dot( tAC, tCP );
+
+            real tVA = tD3 * tD6 - tD5 * tD4;
+            real tVB = tD5 * tD2 - tD1 * tD6;
+            real tVC = tD1 * tD4 - tD3 * tD2;
+
+            if ( tD1 <= 0.0 and tD2 <= 0.0 )
+            {
+                // vertex A
+                aParamCoords( 0 ) = 1.0;
+            }
+            else if ( tD3 >= 0.0 and tD4 <= tD3 )
+            {
+                // vertex B
+                aParamCoords( 1 ) = 1.0;
+            }
+            else if ( tD6 >= 0.0 and tD5 <= tD6 )
+            {
+                // vertex C
+                aParamCoords( 2 ) = 1.0;
+            }
+            else if ( tVC <= 0.0 and tD1 >= 0.0 and tD3 <= 0.0 )
+            {
+                // edge AB
+                real tV           = tD1 / ( tD1 - tD3 );
+                aParamCoords( 0 ) = 1.0 - tV;
+                aParamCoords( 1 ) = tV;
+            }
+            else if ( tVB <= 0.0 and tD2 >= 0.0 and tD6 <= 0.0 )
+            {
+                // edge AC
+                real tW           = tD2 / ( tD2 - tD6 );
+                aParamCoords( 0 ) = 1.0 - tW;
+                aParamCoords( 2 ) = tW;
+            }
+            else if ( tVA <= 0.0 and ( tD4 - tD3 ) >= 0.0 and ( tD5 - tD6 ) >= 0.0 )
+            {
+                // edge BC
+                real tW           = ( tD4 - tD3 ) / ( ( tD4 - tD3 ) + ( tD5 - tD6 ) );
+                aParamCoords( 1 ) = 1.0 - tW;
+                aParamCoords( 2 ) = tW;
+            }
+            else
+            {
+                // interior of the triangle
+                real tDenominator = 1.0 / ( tVA + tVB + tVC );
+                aParamCoords( 1 ) = tVB * tDenominator;
+                aParamCoords( 2 ) = tVC * tDenominator;
+                aParamCoords( 0 ) = 1.0 - aParamCoords( 1 ) - aParamCoords( 2 );
+            }
+        }
+
+        aProjectedPoint = aParamCoords * aFacetCoords;
+
+        return norm( aPoint - aProjectedPoint );
+    }
+
+    // ----------------------------------------------------------------------------------
+}    // namespace xtk
@@ -8,695 +8,289 @@
  *
  */
 
-// #ifndef SRC_XTK_cl_XTK_Contact_Sandbox_
-// #define SRC_XTK_cl_XTK_Contact_Sandbox_
-
-// #include "cl_MTK_Integration_Mesh.hpp"
-// #include "cl_MTK_Set.hpp"
-// #include "cl_Cell.hpp"
-// #include "typedefs.hpp"
-// #include "cl_Matrix.hpp"
-// #include "linalg_typedefs.hpp"
-// #include "fn_Parsing_Tools.hpp"
-// #include <ArborX.hpp>
-// #include <Kokkos_Core.hpp>
-// #include "cl_Stopwatch.hpp" //CHR/src
-
-// namespace xtk
-// {
-//     using ExecSpace = Kokkos::DefaultExecutionSpace;
-//     using MemSpace = typename ExecSpace::memory_space;
-//     using DeviceType = Kokkos::Device<ExecSpace, MemSpace>;
-
-//     class Bounding_Box
-//     {
-//         private:
-//         ArborX::Box mBox;
-//         moris::uint mSpatialDim;
-
-//         public:
-//         Bounding_Box(moris::uint const & aSpatialDim):
-//         mSpatialDim(aSpatialDim)
-//         {
-
-//         };
-
-//         Bounding_Box():
-//         mSpatialDim(3)
-//         {
-
-//         };
-
-//         void
-//         inflate(moris::real const & aInflateValue)
-//         {
-//             ArborX::Point & tMinPoint = mBox.minCorner();
-//             ArborX::Point & tMaxPoint = mBox.maxCorner();
-
-//             for(moris::uint i = 0; i < mSpatialDim; i++)
-//             {
-//                 tMinPoint[i] += -aInflateValue;
-//                 tMaxPoint[i] +=  aInflateValue;
-//             }
-//         }
-
-//         void
-//         set_bounds(Matrix<DDRMat> const & aBounds)
-//         {
-//             ArborX::Point & tMinPoint = mBox.minCorner();
-//             tMinPoint[0] = aBounds(0,0);
-//             tMinPoint[1] = aBounds(1,0);
-
-//             ArborX::Point & tMaxPoint = mBox.maxCorner();
-//             tMaxPoint[0] = aBounds(0,1);
-//             tMaxPoint[1] = aBounds(1,1);
-
-//             if(mSpatialDim == 2)
-//             {
-//                 tMinPoint[2] = 0.0;
-//                 tMaxPoint[2] = 0.0;
-//             }
-//             else
-//             {
-//                 tMinPoint[2] = aBounds(2,0);
-//                 tMaxPoint[2] = aBounds(2,1);
-//             }
-
-//         }
-
-//         Matrix<DDRMat>
-//         get_bounding_box_as_cell() const
-//         {
-//             ArborX::Point const & tMinPoint = mBox.minCorner();
-//             ArborX::Point const & tMaxPoint = mBox.maxCorner();
-
-//             if(mSpatialDim == 2)
-//             {
-//                 return { { tMinPoint[0], tMinPoint[1]},
-//                          { tMaxPoint[0], tMinPoint[1]},
-//                          { tMaxPoint[0], tMaxPoint[1]},
-//                          { tMinPoint[0], tMaxPoint[1]}};
-//             }
-//             else
-//             {
-//                 return {
-//                          { tMinPoint[0], tMinPoint[1], tMinPoint[2]},
-//                          { tMaxPoint[0], tMinPoint[1], tMinPoint[2]},
-//                          { tMaxPoint[0], tMaxPoint[1], tMinPoint[2]},
-//                          { tMinPoint[0], tMaxPoint[1], tMinPoint[2]},
-//                          { tMinPoint[0], tMinPoint[1], tMaxPoint[2]},
-//                          { tMaxPoint[0], tMinPoint[1], tMaxPoint[2]},
-//                          { tMaxPoint[0], tMaxPoint[1], tMaxPoint[2]},
-//                          { tMinPoint[0], tMaxPoint[1], tMaxPoint[2]} };
-//             }
-//         }
-
-//         ArborX::Box const &
-//         get_arborx_box() const
-//         {
-//             return  mBox;
-//         }
-
-//         ArborX::Box &
-//         get_arborx_box()
-//         {
-//             return  mBox;
-//         }
-
-//         ArborX::Point &
-//         get_max_point()
-//         {
-//             return mBox.maxCorner();
-//         }
-
-//         ArborX::Point &
-//         get_min_point()
-//         {
-//             return mBox.minCorner();
-//         }
-
-//     };
-
-//     // All the sets related to a given mtk side set
-//     struct Mesh_Set_AABBs
-//     {
-//         // B_n = {b_n^1, b_n^2,..., b_n^k }
-//         Bounding_Box mAllVertsAABB;
-//         Cell<Bounding_Box> mIGVertexAABBs;
-
-//         // B_f = {b_f^1, b_f^2,..., b_f^k }
-//         Bounding_Box mAllFacetClusterAABBs;
-//         Cell<Bounding_Box> mFacetClusterAABBs;
-
-//     };
-
-// }
-
-// namespace ArborX
-// {
-// namespace Traits
-// {
-// template <>
-// struct Access<moris::Cell<xtk::Bounding_Box>, PrimitivesTag>
-// {
-//   inline static std::size_t size(moris::Cell<xtk::Bounding_Box> const &boxes) { return boxes.size(); }
-//   KOKKOS_FUNCTION static ArborX::Box const &  get(moris::Cell<xtk::Bounding_Box>  const & boxes, std::size_t i)
-//   {
-//       return boxes(i).get_arborx_box();
-//   }
-//   using memory_space = Kokkos::HostSpace;
-// };
-
-// template <>
-// struct Access<moris::Cell<xtk::Bounding_Box>, PredicatesTag>
-// {
-//   inline static std::size_t size(moris::Cell<xtk::Bounding_Box> const &boxes) { return boxes.size(); }
-
-//   KOKKOS_INLINE_FUNCTION static auto get(moris::Cell<xtk::Bounding_Box> const &boxes, std::size_t i)
-//   {
-//     return intersects(boxes(i).get_arborx_box());
-//   }
-//   using memory_space = Kokkos::HostSpace;
-// };
-// }
-// }
-// namespace xtk
-// {
-
-//     class Contact_Sandbox
-//     {
-//     private:
-//         mtk::Integration_Mesh * mIntegrationMesh;
-//         Matrix<IndexMat> mContactPhasesPairs;
-//         moris::real mBBEpsilon;
-//         std::string mContactSet0;
-//         std::string mContactSet1;
-//     public:
-//         /*!
-//          *
-//          */
-//         Contact_Sandbox(mtk::Integration_Mesh  * aIntegrationMesh,
-//                         std::string              aContactSet0,
-//                         std::string              aContactSet1,
-//                         moris::real      const & aBBEpsilon):
-//                         mIntegrationMesh(aIntegrationMesh),
-//                         mContactSet0(aContactSet0),
-//                         mContactSet1(aContactSet1),
-//                         mBBEpsilon(aBBEpsilon)
-//                         {};
-
-//         ~Contact_Sandbox(){};
-
-//         void
-//         perform_global_contact_search( Matrix<DDRMat> const & aCurrentDispVec,
-//                                        Matrix<DDRMat> const & aPredictedDispVec)
-//         {
-//                         // This global search detects which bounding boxes of set 1 intersect bounding boxes of set 2
-//             // Based on Ghosting for contact global search (hansen et al)
-//             // Bounding boxes on proc
-
-//             // get the sets from the mesh
-//             moris::mtk::Set* tSet0 = mIntegrationMesh->get_set_by_name(mContactSet0);
-//             moris::mtk::Set* tSet1 = mIntegrationMesh->get_set_by_name(mContactSet1);
-
-//             // bounding boxes for mtk sets
-//             Mesh_Set_AABBs tMeshSet0AABBs;
-//             this->construct_set_AABB(tSet0,aCurrentDispVec,aPredictedDispVec,tMeshSet0AABBs);
-
-//             // inflate the bounding boxes
-//             this->inflate_set_AABBS(mBBEpsilon,tMeshSet0AABBs);
-
-//             // visualize
-//             this->viz_mtk_set_AABBs(mContactSet0,tMeshSet0AABBs);
-
-//             Mesh_Set_AABBs tMeshSet1AABBs;
-//             this->construct_set_AABB(tSet1,aCurrentDispVec,aPredictedDispVec,tMeshSet1AABBs);
-
-//             // inflate the bounding boxes
-//             this->inflate_set_AABBS(mBBEpsilon,tMeshSet1AABBs);
-
-//             // visualize
-//             this->viz_mtk_set_AABBs(mContactSet1,tMeshSet1AABBs);
-
-//             // Compute communication partners and ghosting candidates
-//             // TODO:
-
-//             tic tTimer2;
-//             // construct the BVH for vertices
-//             ArborX::BVH<DeviceType> tBVH0(tMeshSet0AABBs.mFacetClusterAABBs);
-//             ArborX::BVH<DeviceType> tBVH1(tMeshSet1AABBs.mIGVertexAABBs);
-
-//             Kokkos::View<int*, DeviceType> tIndices("indices",0);
-//             Kokkos::View<int*, DeviceType> tOffset("offset",0);
-
-//             tBVH0.query(tMeshSet1AABBs.mIGVertexAABBs, tIndices, tOffset);
-
-//             std::string tOverlapFile = "overlap_viz.vtk";
-//             this->viz_overlap(tOverlapFile, tMeshSet0AABBs.mFacetClusterAABBs, tMeshSet1AABBs.mIGVertexAABBs, tIndices, tOffset);
-
-//                             // print output
-//                             // stop timer
-//             real tElapsedTime = tTimer2.toc<moris::chronos::milliseconds>().wall;
-//             std::cout<<"Contact Search Time: "<<( double ) tElapsedTime / 1000<<std::endl;
-//             // MORIS_LOG_INFO( "Global contact search:",           ( double ) tElapsedTime / 1000 );
-
-//         }
-
-//         /*!
-//         * Construct axis aligned bounding box (AABB) for the set provided
-//         * @param[in] aSet Set to construct AABB for
-//         * @param[in] aCurrentDispVec Current displacement vector( u_n )
-//         * @param[in] aPredictedDispVec Current displacement vector( u_n+1 )
-//         * @param[out] aSetAABBs MTK set relevant bounding boxes
-//         */
-//             void
-//             construct_set_AABB(moris::mtk::Set *const &aSet,
-//                                Matrix<DDRMat> const &aCurrentDispVec,
-//                                Matrix<DDRMat> const &aPredictedDispVec,
-//                                Mesh_Set_AABBs &aSetAABBs)
-//             {
-//                 // construct the vertex bounding boxes
-//                 this->construct_set_ig_vertex_AABBs(aSet, aCurrentDispVec, aPredictedDispVec, aSetAABBs.mIGVertexAABBs);
-
-//                 // construct the side cluster bounding boxes
-//                 this->construct_side_cluster_AABB(aSet, aCurrentDispVec, aPredictedDispVec, aSetAABBs.mFacetClusterAABBs);
-
-//                 // all vertex bounding box is just the bounding box of all the vertex bounding boxes
-//                 aSetAABBs.mAllVertsAABB = this->bounding_box_of_bounding_box(aSetAABBs.mIGVertexAABBs);
-
-//                 // all facet cluster bounding box is just the bounding box of all the facet cluster bounding boxes
-//                 aSetAABBs.mAllFacetClusterAABBs = this->bounding_box_of_bounding_box(aSetAABBs.mFacetClusterAABBs);
-//         }
-
-//         void
-//         construct_side_cluster_AABB(
-//                     moris::mtk::Set*   const & aSet,
-//                     Matrix<DDRMat>     const & aCurrentDispVec,
-//                     Matrix<DDRMat>     const & aPredictedDispVec,
-//                     Cell<Bounding_Box>       & aSideClusterBBs)
-//         {
-//             // number of clusters
-//             moris::uint tNumClusters = aSet->get_num_clusters_on_set();
-
-//             // size the number of clusters
-//             aSideClusterBBs.resize(tNumClusters, mIntegrationMesh->get_spatial_dim());
-
-//             // get the set clusters
-//             moris::Cell<mtk::Cluster const *> tClusters = aSet->get_clusters_on_set();
-
-//             for(moris::uint i = 0; i < tNumClusters; i++)
-//             {
-//                   moris::Matrix<moris::IndexMat> tVerticesInCluster = tClusters(i)->get_primary_vertices_inds_in_cluster();\
-
-//                   this->construct_AABB_from_vertices(tVerticesInCluster,aCurrentDispVec,aPredictedDispVec,aSideClusterBBs(i));
-//             }
-//         }
-
-//         void
-//         construct_set_ig_vertex_AABBs(
-//                     moris::mtk::Set*   const & aSet,
-//                     Matrix<DDRMat>     const & aCurrentDispVec,
-//                     Matrix<DDRMat>     const & aPredictedDispVec,
-//                     Cell<Bounding_Box>       & aVertexBBs)
-//         {
-//             // get the set clusters
-//             moris::Matrix< IndexMat > tSetIgVerts = aSet->get_ig_vertices_inds_on_block(true);
-
-//             // number of clusters
-//             moris::uint tNumVerts  = tSetIgVerts.numel();
-
-//             // size the number of clusters
-//             aVertexBBs.resize(tNumVerts, mIntegrationMesh->get_spatial_dim());
-
-//             for(moris::uint i = 0; i < tNumVerts; i++)
-//             {
-//                   this->construct_single_vertex_AABB(tSetIgVerts(i),aCurrentDispVec,aPredictedDispVec,aVertexBBs(i));
-//             }
-//         }
-
-//         /*!
-//         * Construct axis aligned bounding box (AABB) for the point cloud provided
-//         * @param[in] aVerticesForBB Vertices to construct BB
-//         * @param[in] aCurrentDispVec Current displacement vector( u_n )
-//         * @param[in] aPredictedDispVec Current displacement vector( u_n+1 )
-//         * @param[out] aVertexSetBB Bounding box for the provided vertices
-//         */
-//         void
-//         construct_AABB_from_vertices(Matrix<IndexMat> const & aVerticesForBB,
-//                                      Matrix<DDRMat> const & aCurrentDispVec,
-//                                      Matrix<DDRMat> const & aPredictedDispVec,
-//                                      Bounding_Box         & aVertexSetBB)
-//         {
-//             moris::uint tSpatialDim = mIntegrationMesh->get_spatial_dim();
-
-//             moris::uint tNumNodes = aVerticesForBB.numel();
-
-//             // figure out bounding box
-//             Cell<real> tMins(tSpatialDim,MORIS_REAL_MAX);
-//             Cell<real> tMaxs(tSpatialDim,-MORIS_REAL_MAX);
-
-//             moris::real tCurrentLoc = 0.0;
-//             moris::real tPredictedLoc = 0.0;
-
-//             for(moris::moris_index i = 0; i <(moris::moris_index)tNumNodes; i++)
-//             {
-//                 moris::Matrix< moris::DDRMat > tNodeCoord =  mIntegrationMesh->get_node_coordinate(aVerticesForBB(i));
-
-//                 for(moris::uint iSpatial = 0; iSpatial<tSpatialDim; iSpatial++)
-//                 {
-//                     tCurrentLoc   = tNodeCoord(iSpatial) + aCurrentDispVec(aVerticesForBB(i),iSpatial);
-//                     tPredictedLoc = tNodeCoord(iSpatial) + aPredictedDispVec(aVerticesForBB(i),iSpatial);
-
-//                     if(tCurrentLoc >= tPredictedLoc)
-//                     {
-//                         if(tCurrentLoc > tMaxs(iSpatial))
-//                         {
-//                             tMaxs(iSpatial) = tCurrentLoc;
-//                         }
-//                         if(tPredictedLoc < tMins(iSpatial))
-//                         {
-//                             tMins(iSpatial) = tPredictedLoc;
-//                         }
-//                     }
-//                     // case where predicted is higher than the current
-//                     else
-//                     {
-//                         if(tPredictedLoc > tMaxs(iSpatial))
-//                         {
-//                             tMaxs(iSpatial) = tPredictedLoc;
-//                         }
-//                         if(tCurrentLoc < tMins(iSpatial))
-//                         {
-//                             tMins(iSpatial) = tCurrentLoc;
-//                         }
-//                     }
-//                 }
-//             }
-
-//             // Place in matrix and set bounding box
-//             Matrix<DDRMat> tBounds(tSpatialDim,2);
-//             for(moris::uint i = 0; i < tSpatialDim; i++)
-//             {
-//                 tBounds(i,0) = tMins(i);
-//                 tBounds(i,1) = tMaxs(i);
-//             }
-
-//             aVertexSetBB.set_bounds(tBounds);
-
-//         }
-
-//         void
-//         construct_single_vertex_AABB(moris_index    const & aVertexIndex,
-//                                      Matrix<DDRMat> const & aCurrentDispVec,
-//                                      Matrix<DDRMat> const & aPredictedDispVec,
-//                                      Bounding_Box         & aVertexSetBB)
-//             {
-//                 moris::uint tSpatialDim = mIntegrationMesh->get_spatial_dim();
-//                 moris::Matrix< moris::DDRMat > tNodeCoord =  mIntegrationMesh->get_node_coordinate(aVertexIndex);
-
-//                 // allocate bounds
-//                 Matrix<DDRMat> tBounds(tSpatialDim,2);
-
-//                 moris::real tCurrentLoc   = 0;
-//                 moris::real tPredictedLoc = 0;
-
-//                 for(moris::uint iSpatial = 0; iSpatial<tSpatialDim; iSpatial++)
-//                 {
-//                     tCurrentLoc   = tNodeCoord(iSpatial) + aCurrentDispVec(aVertexIndex,iSpatial);
-//                     tPredictedLoc = tNodeCoord(iSpatial) + aPredictedDispVec(aVertexIndex,iSpatial);
-
-//                     if(tCurrentLoc >= tPredictedLoc)
-//                     {
-//                         tBounds(iSpatial,0) = tPredictedLoc;
-//                         tBounds(iSpatial,1) = tCurrentLoc;
-//                     }
-//                     else
-//                     {
-//                         tBounds(iSpatial,0) = tCurrentLoc;
-//                         tBounds(iSpatial,1) = tPredictedLoc;
-//                     }
-//                 }
-
-//                 aVertexSetBB.set_bounds(tBounds);
-//         }
-//         void
-//         inflate_set_AABBS(moris::real const & aInflateVal,
-//                           Mesh_Set_AABBs & aMeshSetAABBs)
-//         {
-
-//             aMeshSetAABBs.mAllVertsAABB.inflate(aInflateVal);
-//             this->inflate_aabbs(aInflateVal,aMeshSetAABBs.mIGVertexAABBs);
-
-//             aMeshSetAABBs.mAllFacetClusterAABBs.inflate(aInflateVal);
-//             this->inflate_aabbs(aInflateVal,aMeshSetAABBs.mFacetClusterAABBs);
-//         }
-
-//         void
-//         inflate_aabbs( moris::real const & aInflateVal,
-//                        Cell<Bounding_Box> & aAABBs)
-//         {
-//             for(moris::uint i = 0; i < aAABBs.size(); i++)
-//             {
-//                 aAABBs(i).inflate(aInflateVal);
-//             }
-//         }
-
-//         Bounding_Box
-//         bounding_box_of_bounding_box(Cell<Bounding_Box> & aBoundingBoxes)
-//         {
-
-//             moris::uint tSpatialDim = mIntegrationMesh->get_spatial_dim();
-//             Bounding_Box tBoundingBox( tSpatialDim );
-//             ArborX::Point & tMinPoint = tBoundingBox.get_min_point();
-//             ArborX::Point & tMaxPoint = tBoundingBox.get_max_point();
-
-//             for(moris::uint iSpatial = 0; iSpatial<tSpatialDim; iSpatial++)
-//             {
-//                 tMaxPoint[iSpatial] = -MORIS_REAL_MAX;
-//                 tMinPoint[iSpatial] =  MORIS_REAL_MAX;
-//             }
-
-//             if(tSpatialDim == 2)
-//             {
-//                 tMinPoint[2] = 0.0;
-//                 tMaxPoint[2] = 0.0;
-//             }
-
-//             for(moris::uint iBB =0; iBB< aBoundingBoxes.size(); iBB++)
-//             {
-//                 for(moris::uint iSpatial = 0; iSpatial<tSpatialDim; iSpatial++)
-//                 {
-//                     if(aBoundingBoxes(iBB).get_min_point()[iSpatial] < tMinPoint[iSpatial])
-//                     {
-//                         tMinPoint[iSpatial] = aBoundingBoxes(iBB).get_min_point()[iSpatial];
-//                     }
-//                     if(aBoundingBoxes(iBB).get_max_point()[iSpatial] > tMaxPoint[iSpatial] )
-//                     {
-//                         tMaxPoint[iSpatial] = aBoundingBoxes(iBB).get_max_point()[iSpatial];
-//                     }
-//                 }
-//             }
-
-//             return tBoundingBox;
-//         }
-
-//         void
-//         viz_mtk_set_AABBs(const std::string & aFileBase,
-//                           Mesh_Set_AABBs & aSetAABBs)
-//         {
-//             std::string tAllVertexName  = aFileBase + "_all_vert_AABB.vtk";
-//             std::string tVertexName     = aFileBase + "_vert_AABB.vtk";
-//             std::string tAllClusterName = aFileBase + "_all_clust_AABB.vtk";
-//             std::string tClusterName    = aFileBase + "_clust_AABB.vtk";
-
-//             Cell<Bounding_Box const *> tAllVertsBB(1);
-//             tAllVertsBB(0) = &aSetAABBs.mAllVertsAABB;
-
-//             Cell<Bounding_Box const *> tAllClusterBB(1);
-//             tAllClusterBB(0) =  &aSetAABBs.mAllFacetClusterAABBs;
-
-//             Cell<Bounding_Box const *> tIGVertexAABBs(aSetAABBs.mIGVertexAABBs.size());
-//             for(moris::uint i = 0; i < aSetAABBs.mIGVertexAABBs.size() ; i++)
-//             {
-//                 tIGVertexAABBs(i) = &aSetAABBs.mIGVertexAABBs(i);
-//             }
-
-//             Cell<Bounding_Box const *> tFacetClusterAABBs(aSetAABBs.mFacetClusterAABBs.size());
-//             for(moris::uint i = 0; i < aSetAABBs.mFacetClusterAABBs.size() ; i++)
-//             {
-//                 tFacetClusterAABBs(i) = &aSetAABBs.mFacetClusterAABBs(i);
-//             }
-
-//             this->save_to_vtk( tAllVertexName,tAllVertsBB );
-//             this->save_to_vtk( tVertexName, tIGVertexAABBs);
-//             this->save_to_vtk( tAllClusterName, tAllClusterBB);
-//             this->save_to_vtk( tClusterName, tFacetClusterAABBs);
-//         }
-
-//         void
-//         viz_overlap(
-//                 const std::string  & aFilePath,
-//                 Cell<Bounding_Box> & aBVHBoxes,
-//                 Cell<Bounding_Box> & aQueryBoxes,
-//                 Kokkos::View<int*, DeviceType> & aIndices,
-//                 Kokkos::View<int*, DeviceType> & aOffset)
-//         {
-//             Cell<Bounding_Box const *> tBoxToViz;
-
-//             // create kokkos::view around std::vector
-//             auto tHostViewIndices = Kokkos::create_mirror_view(aIndices);
-//             auto tHostViewOffsets = Kokkos::create_mirror_view(aOffset);
-
-//             for(uint iQB = 0; iQB < aQueryBoxes.size(); iQB++)
-//             {
-//                 if(tHostViewOffsets(iQB+1) - tHostViewOffsets(iQB) > 0)
-//                 {
-//                     std::cout<<"Found one"<<std::endl;
-//                     tBoxToViz.push_back(&aQueryBoxes(iQB));
-//                 }
-//              }
-
-//             this->save_to_vtk(aFilePath,tBoxToViz);
-//         }
-//         /*
-//         * Save the cell of bounding boxes to a VTK file
-//         */
-//         void
-//         save_to_vtk(const std::string   & aFilePath,
-//                     Cell<Bounding_Box const *> & aBoxesToViz)
-//         {
-//             // modify filename
-//             std::string tFilePath = parallelize_path( aFilePath );
-
-//             // open the file
-//             std::ofstream tFile(tFilePath, std::ios::binary);
-
-//             // containers
-//             float tFChar = 0;
-//             int   tIChar = 0;
-
-//             tFile << "# vtk DataFile Version 3.0" << std::endl;
-//             tFile << "GO BUFFS!" << std::endl;
-//             tFile << "BINARY" << std::endl;
-
-//             // initialize element counter
-//             luint tNumberOfElements = aBoxesToViz.size();
-
-//             // number of nodes per element
-//             uint tNumberOfNodesPerElement = std::pow( 2, mIntegrationMesh->get_spatial_dim() );
-
-//             // count number of nodes
-//             uint tNumberOfNodes = tNumberOfNodesPerElement*tNumberOfElements;
-
-//             // write node data
-//             tFile << "DATASET UNSTRUCTURED_GRID" << std::endl;
-
-//             tFile << "POINTS " << tNumberOfNodes << " float"  << std::endl;
-
-//             // temporary matrix containing corder nodes
-//             Matrix< DDRMat > tNodes( mIntegrationMesh->get_spatial_dim(), tNumberOfNodesPerElement );
-
-//             std::cout<<"tNumberOfNodesPerElement = "<<tNumberOfNodesPerElement<<std::endl;
-
-//             // VTK cell type
-//             int tCellType = 0;
-
-//             if ( mIntegrationMesh->get_spatial_dim() == 2 )
-//             {
-//                 // loop over all elements
-//                 for( auto tElement: aBoxesToViz )
-//                 {
-//                         // ask background mesh for corner nodes
-//                         Matrix<DDRMat> tBoundCoord = tElement->get_bounding_box_as_cell();
-
-//                         // write node coordinates to file
-//                         for( uint k=0; k<tNumberOfNodesPerElement; ++k )
-//                         {
-//                             tFChar = swap_byte_endian( (float) tBoundCoord( k, 0) );
-//                             tFile.write( (char*) &tFChar, sizeof(float));
-//                             tFChar = swap_byte_endian( (float) tBoundCoord( k, 1 )  );
-//                             tFile.write( (char*) &tFChar, sizeof(float));
-//                             tFChar = swap_byte_endian( (float) 0 );
-//                             tFile.write( (char*) &tFChar, sizeof(float));
-//                         }
-//                 }
-
-//                 // VTK celltype for Quad4
-//                 tCellType = 9;
-//             }
-//             else if ( mIntegrationMesh->get_spatial_dim() == 3 )
-//             {
-//                // loop over all elements
-//                 for( auto tElement: aBoxesToViz )
-//                 {
-//                         // ask background mesh for corner nodes
-//                         Matrix<DDRMat> tBoundCoord = tElement->get_bounding_box_as_cell();
-
-//                         // write node coordinates to file
-//                         for( uint k=0; k<tNumberOfNodesPerElement; ++k )
-//                         {
-//                              tFChar = swap_byte_endian( (float) tBoundCoord( k, 0 ) );
-//                             tFile.write( (char*) &tFChar, sizeof(float));
-//                             tFChar = swap_byte_endian( (float) tBoundCoord( k, 1 ) );
-//                             tFile.write( (char*) &tFChar, sizeof(float));
-//                             tFChar = swap_byte_endian( (float)tBoundCoord( k, 2 ) );
-//                             tFile.write( (char*) &tFChar, sizeof(float));
-//                         }
-//                 }
-
-//                 // VTK celltype for Hex8
-//                 tCellType = 12;
-//             }
-
-//             // create new line
-//             tFile << std::endl;
-
-//             // can only write element data if vtk map exists
-//             if ( tCellType != 0 )
-//             {
-//                 // value to write in VTK file
-//                 int tNumberOfNodesVTK = swap_byte_endian( (int) tNumberOfNodesPerElement );
-
-//                 // reset node counter
-//                 int tCount = 0;
-
-//                 // write header for cells
-//                 tFile << "CELLS " << tNumberOfElements << " "
-//                         << ( tNumberOfNodesPerElement + 1 )*tNumberOfElements  << std::endl;
-
-//                 // loop over all elements
-//                 for( uint iBB = 0 ; iBB<aBoxesToViz.size(); iBB++ )
-//                 {
-
-//                         tFile.write( (char*) &tNumberOfNodesVTK, sizeof(int) );
-
-//                         // loop over all nodes of this element
-//                         for( uint k=0; k<tNumberOfNodesPerElement; ++k )
-//                         {
-//                             // write node to mesh file
-//                             tIChar = swap_byte_endian( tCount++ );
-//                             tFile.write((char *) &tIChar, sizeof(int));
-//                         }
-
-//                 }
-
-//                 // write cell types
-//                 tFile << "CELL_TYPES " << tNumberOfElements << std::endl;
-//                 tIChar = swap_byte_endian( tCellType );
-//                 for ( luint k = 0; k < tNumberOfElements; ++k)
-//                 {
-//                     tFile.write( (char*) &tIChar, sizeof(int));
-//                 }
-
-//                 // close the output file
-//                 tFile.close();
-
-//             }
-
-//         }
-
-//     };
-
-// }
-
-// #endif
+#ifndef SRC_XTK_cl_XTK_Contact_Sandbox_
+#define SRC_XTK_cl_XTK_Contact_Sandbox_
+
+#include <string>
+
+#include "typedefs.hpp"
+#include "cl_Cell.hpp"
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+#include "cl_XTK_Bounding_Volume_Hierarchy.hpp"
+
+using namespace moris;
+
+namespace moris
+{
+    namespace mtk
+    {
+        class Integration_Mesh;
+        class Set;
+    }    // namespace mtk
+}    // namespace moris
+
+namespace xtk
+{
+    // ----------------------------------------------------------------------------------
+
+    /**
+     * @brief Facet of a contact side set, i.e. the side of an integration cell
+     */
+    struct Contact_Facet
+    {
+        moris_id           mCellId      = gNoID;       // id of the integration cell
+        moris_index        mSideOrdinal = gNoIndex;    // side ordinal of the facet wrt. the integration cell
+        moris_id           mOwner       = gNoID;       // rank of the processor the facet is stored on
+        Matrix< IndexMat > mVertexIndices;             // proc local indices of the facet vertices, empty for ghost facets
+        Matrix< DDRMat >   mCurrentCoords;             // vertex coordinates in the current configuration, one vertex per row
+        Matrix< DDRMat >   mPredictedCoords;           // vertex coordinates in the predicted configuration, one vertex per row
+    };
+
+    // ----------------------------------------------------------------------------------
+
+    /**
+     * @brief Integration points of a facet of the first contact set projected onto a facet of the second set
+     */
+    struct Contact_Facet_Pair
+    {
+        moris_index      mFacet          = gNoIndex;    // index of the facet of the first set
+        moris_index      mCandidateFacet = gNoIndex;    // index of the facet of the second set, local and ghost facets
+        Matrix< DDRMat > mIntegPoints;                  // integration points on the facet of the first set, one point per row
+        Matrix< DDRMat > mProjectedPoints;              // closest points on the facet of the second set, one point per row
+        Matrix< DDRMat > mProjectedParamCoords;         // barycentric coordinates of the projected points, one point per row
+        Matrix< DDRMat > mGaps;                         // distances between integration points and projected points
+    };
+
+    // ----------------------------------------------------------------------------------
+
+    /**
+     * @brief Contact search between the facets of two side sets of an integration mesh.
+     * The facets of the second set are stored in a bounding volume hierarchy which is queried with the facet boxes
+     * of the first set. Facet boxes enclose the facet in the current and the predicted configuration and are inflated
+     * by the search distance, i.e. the largest gap for which integration points are paired, and a padding. Facets of the
+     * second set overlapping the first set of another processor are ghosted to it. Once the search has been performed,
+     * the hierarchy and the ghost facets can be refitted to moved nodes as long as the nodes do not move further than
+     * the padding.
+     */
+    class Contact_Sandbox
+    {
+      private:
+        mtk::Integration_Mesh* mIntegrationMesh;
+
+        std::string mContactSet0;
+        std::string mContactSet1;
+
+        // largest gap between an integration point and its projection onto a facet of the second set
+        moris::real mSearchDistance;
+
+        // padding of the facet boxes, nodes can move by this distance before a new search is needed
+        moris::real mBBEpsilon;
+
+        // spatial dimension
+        uint mSpatialDim = 0;
+
+        // owned facets of the first set
+        Cell< Contact_Facet > mFacets0;
+
+        // owned facets of the second set followed by the ghost facets
+        Cell< Contact_Facet > mFacets1;
+        uint                  mNumOwnedFacets1 = 0;
+
+        // bounding volume hierarchy of the facets of the second set
+        Bounding_Volume_Hierarchy mBVH;
+
+        // processors exchanging ghost facets
+        Matrix< IdMat > mCommTable;
+
+        // owned facets of the second set sent to every processor in the communication table
+        Cell< Cell< moris_index > > mSendFacets;
+
+        // first ghost facet received from every processor in the communication table, one entry more than processors
+        Cell< uint > mReceiveOffsets;
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief collects the owned facets of a side set
+         *
+         * @param[in] aSet      Side set
+         * @param[out] aFacets  Facets of the side set
+         */
+        void collect_facets(
+                moris::mtk::Set*       aSet,
+                Cell< Contact_Facet >& aFacets );
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief updates the coordinates of owned facets from the vertex coordinates and displacements
+         *
+         * @param[in] aCurrentDispVec   Current displacements ( u_n ), one vertex per row, empty for no displacement
+         * @param[in] aPredictedDispVec Predicted displacements ( u_n+1 ), one vertex per row, empty for no displacement
+         * @param[in] aNumFacets        Number of owned facets
+         * @param[in,out] aFacets       Facets
+         */
+        void update_facet_coords(
+                Matrix< DDRMat > const & aCurrentDispVec,
+                Matrix< DDRMat > const & aPredictedDispVec,
+                uint                     aNumFacets,
+                Cell< Contact_Facet >&   aFacets );
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief computes the inflated boxes enclosing the facets in the current and predicted configuration
+         *
+         * @param[in] aFacets   Facets
+         * @param[in] aPadding  Distance the boxes are inflated by
+         * @param[out] aBoxMin  Lower bounds, one facet per column
+         * @param[out] aBoxMax  Upper bounds, one facet per column
+         */
+        void compute_facet_boxes(
+                Cell< Contact_Facet > const & aFacets,
+                real                          aPadding,
+                Matrix< DDRMat >&             aBoxMin,
+                Matrix< DDRMat >&             aBoxMax ) const;
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief computes the box enclosing the first boxes of a list
+         *
+         * @param[in] aBoxMin   Lower bounds, one box per column
+         * @param[in] aBoxMax   Upper bounds, one box per column
+         * @param[in] aNumBoxes Number of boxes to consider
+         * @param[out] aSetMin  Lower bounds of the enclosing box
+         * @param[out] aSetMax  Upper bounds of the enclosing box
+         */
+        void compute_enclosing_box(
+                Matrix< DDRMat > const & aBoxMin,
+                Matrix< DDRMat > const & aBoxMax,
+                uint                     aNumBoxes,
+                Matrix< DDRMat >&        aSetMin,
+                Matrix< DDRMat >&        aSetMax ) const;
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief determines the processors exchanging ghost facets and ghosts the facets of the second set
+         * whose boxes overlap the box of the first set of another processor
+         *
+         * @param[in] aBoxMin1  Lower bounds of the owned facets of the second set
+         * @param[in] aBoxMax1  Upper bounds of the owned facets of the second set
+         * @param[in] aSetMin0  Lower bounds of the first set on this processor
+         * @param[in] aSetMax0  Upper bounds of the first set on this processor
+         */
+        void ghost_candidate_facets(
+                Matrix< DDRMat > const & aBoxMin1,
+                Matrix< DDRMat > const & aBoxMax1,
+                Matrix< DDRMat > const & aSetMin0,
+                Matrix< DDRMat > const & aSetMax0 );
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief sends the coordinates of the ghosted facets and updates the received ghost facets
+         */
+        void communicate_ghost_facet_coords();
+
+        // ----------------------------------------------------------------------------------
+
+      public:
+        /**
+         * @brief constructor
+         *
+         * @param[in] aIntegrationMesh  Integration mesh
+         * @param[in] aContactSet0      Name of the side set whose integration points are projected
+         * @param[in] aContactSet1      Name of the side set the integration points are projected onto
+         * @param[in] aSearchDistance   Largest gap for which integration points are paired
+         * @param[in] aBBEpsilon        Padding of the facet boxes, i.e. distance nodes can move between searches
+         */
+        Contact_Sandbox(
+                mtk::Integration_Mesh* aIntegrationMesh,
+                std::string            aContactSet0,
+                std::string            aContactSet1,
+                moris::real const &    aSearchDistance,
+                moris::real const &    aBBEpsilon );
+
+        ~Contact_Sandbox() {}
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief collects the facets of both sets, ghosts candidate facets and builds the bounding volume hierarchy
+         *
+         * @param[in] aCurrentDispVec   Current displacements ( u_n ), one vertex per row, empty for no displacement
+         * @param[in] aPredictedDispVec Predicted displacements ( u_n+1 ), one vertex per row, empty for no displacement
+         */
+        void perform_global_contact_search(
+                Matrix< DDRMat > const & aCurrentDispVec,
+                Matrix< DDRMat > const & aPredictedDispVec );
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief updates facets and hierarchy for moved nodes without a new search, e.g. within Newton iterations.
+         * The pairing is only complete if the nodes moved less than the padding since the last search.
+         *
+         * @param[in] aCurrentDispVec   Current displacements ( u_n ), one vertex per row, empty for no displacement
+         * @param[in] aPredictedDispVec Predicted displacements ( u_n+1 ), one vertex per row, empty for no displacement
+         */
+        void refit(
+                Matrix< DDRMat > const & aCurrentDispVec,
+                Matrix< DDRMat > const & aPredictedDispVec );
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief projects the integration points of the facets of the first set onto the closest facet of the
+         * second set in the predicted configuration
+         *
+         * @param[in] aIntegWeights     Barycentric coordinates of the integration points on a facet,
+         *                              one point per column
+         * @return Facet pairs, every integration point within the search distance is part of the pair with its closest facet
+         */
+        Cell< Contact_Facet_Pair > compute_facet_pairs( Matrix< DDRMat > const & aIntegWeights ) const;
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief computes the closest point on a linear facet, i.e. a line in 2D or a triangle in 3D
+         *
+         * @param[in] aPoint            Point, row vector
+         * @param[in] aFacetCoords      Vertex coordinates of the facet, one vertex per row
+         * @param[out] aProjectedPoint  Closest point on the facet, row vector
+         * @param[out] aParamCoords     Barycentric coordinates of the closest point, row vector
+         * @return Distance between point and closest point
+         */
+        static real project_point_on_facet(
+                Matrix< DDRMat > const & aPoint,
+                Matrix< DDRMat > const & aFacetCoords,
+                Matrix< DDRMat >&        aProjectedPoint,
+                Matrix< DDRMat >&        aParamCoords );
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief returns the facets of a contact set
+         *
+         * @param[in] aSetIndex     0 for the owned facets of the first set, 1 for the owned and ghost facets of the second set
+         */
+        Cell< Contact_Facet > const &
+        get_facets( uint aSetIndex ) const
+        {
+            return aSetIndex == 0 ? mFacets0 : mFacets1;
+        }
+
+        // ----------------------------------------------------------------------------------
+
+        uint
+        get_num_ghost_facets() const
+        {
+            return mFacets1.size() - mNumOwnedFacets1;
+        }
+    };
+}    // namespace xtk
+
+#endif /* SRC_XTK_cl_XTK_Contact_Sandbox_ */
@@ -359,7 +359,7 @@ namespace xtk
             mIntegrationCells( iCell ) = &mBackgroundMesh->get_mtk_cell( (moris_index)iCell );
 
             // verify that we are not doubling up vertices in the id map
-            MORIS_ERROR( mIntegrationCellIdToIndexMap.find( mIntegrationCells( iCell )->get_id() ) == mIntegrationCellIdToIndexMap.end(), "Provided Cell Id is already in the integration vertex map: Vertex Id =%uon process %u", mIntegrationCells( iCell )->get_id(), par_rank() );
+            MORIS_ERROR( not mIntegrationCellIdToIndexMap.key_exists( mIntegrationCells( iCell )->get_id() ), "Provided Cell Id is already in the integration vertex map: Vertex Id =%uon process %u", mIntegrationCells( iCell )->get_id(), par_rank() );
 
             // add the vertex to id to index map
             mIntegrationCellIdToIndexMap[ mIntegrationCells( iCell )->get_id() ] = (moris_index)iCell;
@@ -392,7 +392,7 @@ namespace xtk
             mVertexCoordinates( mIntegrationVertices( iV )->get_index() ) = std::make_shared< moris::Matrix< DDRMat > >( mIntegrationVertices( iV )->get_coords() );
 
             // verify that we are not doubling up vertices in the id map
-            MORIS_ERROR( mIntegrationVertexIdToIndexMap.find( mIntegrationVertices( iV )->get_id() ) == mIntegrationVertexIdToIndexMap.end(), "Provided Vertex Id is already in the integration vertex map: Vertex Id =%uon process %u", mIntegrationVertices( iV )->get_id(), par_rank() );
+            MORIS_ERROR( not mIntegrationVertexIdToIndexMap.key_exists( mIntegrationVertices( iV )->get_id() ), "Provided Vertex Id is already in the integration vertex map: Vertex Id =%uon process %u", mIntegrationVertices( iV )->get_id(), par_rank() );
 
             // add the vertex to id to index map
             mIntegrationVertexIdToIndexMap[ mIntegrationVertices( iV )->get_id() ] = (moris_index)iV;
@@ -628,27 +628,23 @@ namespace xtk
 
         if ( aEntityRank == EntityRank::NODE )
         {
-            auto tIter = mIntegrationVertexIdToIndexMap.find( aEntityId );
-
-            MORIS_ERROR( tIter != mIntegrationVertexIdToIndexMap.end(),
+            MORIS_ERROR( mIntegrationVertexIdToIndexMap.key_exists( aEntityId ),
                     "Cut_Integration_Mesh::get_loc_entity_ind_from_entity_glb_id() - "
                     "Provided Entity Id is not in the map, Has the map been initialized?: aEntityId =%u EntityRank = %u on process %u",
                     aEntityId,
                     (uint)aEntityRank,
                     par_rank() );
-            return tIter->second;
+            return mIntegrationVertexIdToIndexMap.find( aEntityId );
         }
         else if ( aEntityRank == EntityRank::ELEMENT )
         {
-            auto tIter = mIntegrationCellIdToIndexMap.find( aEntityId );
-
-            MORIS_ERROR( tIter != mIntegrationCellIdToIndexMap.end(),
+            MORIS_ERROR( mIntegrationCellIdToIndexMap.key_exists( aEntityId ),
                     "Cut_Integration_Mesh::get_loc_entity_ind_from_entity_glb_id() - "
                     "Provided Entity Id is not in the map, Has the map been initialized?: aEntityId =%u EntityRank = %u on process %u",
                     aEntityId,
                     (uint)aEntityRank,
                     par_rank() );
-            return tIter->second;
+            return mIntegrationCellIdToIndexMap.find( aEntityId );
         }
 
         else
@@ -887,7 +883,15 @@ namespace xtk
     std::unordered_map< moris_id, moris_index >
     Cut_Integration_Mesh::get_vertex_glb_id_to_loc_vertex_ind_map() const
     {
-        return mIntegrationVertexIdToIndexMap;
+        std::unordered_map< moris_id, moris_index > tVertexIdToIndexMap;
+        tVertexIdToIndexMap.reserve( mIntegrationVertexIdToIndexMap.size() );
+
+        for ( auto const & iEntry : mIntegrationVertexIdToIndexMap )
+        {
+            tVertexIdToIndexMap[ iEntry.first ] = iEntry.second;
+        }
+
+        return tVertexIdToIndexMap;
     }
 
     // ----------------------------------------------------------------------------------
@@ -895,7 +899,7 @@ namespace xtk
     bool
     Cut_Integration_Mesh::vertex_exists( moris_index tId ) const
     {
-        return mIntegrationVertexIdToIndexMap.find( tId ) != mIntegrationVertexIdToIndexMap.end();
+        return mIntegrationVertexIdToIndexMap.key_exists( tId );
     }
 
     // ----------------------------------------------------------------------------------
@@ -2364,7 +2368,7 @@ namespace xtk
                         "Cut_Integration_Mesh::assign_controlled_ig_cell_ids() - "
                         "ID reported by IG cell different from ID just assigned to corresponding controlled IG cell." );
                 MORIS_ASSERT(
-                        mIntegrationCellIdToIndexMap.find( tIgCell->get_id() ) == mIntegrationCellIdToIndexMap.end(),
+                        not mIntegrationCellIdToIndexMap.key_exists( tIgCell->get_id() ),
                         "Cut_Integration_Mesh::assign_controlled_ig_cell_ids() - "
                         "IG cell's ID already in the map, i.e. it has already been assigned before." );
 
@@ -2583,7 +2587,7 @@ namespace xtk
                     mControlledIgCells( tControlledIndex )->set_id( tIgCellId );
 
                     // check that this ID has not already been assigned to another IG cell
-                    MORIS_ASSERT( mIntegrationCellIdToIndexMap.find( tIgCellId ) == mIntegrationCellIdToIndexMap.end(),
+                    MORIS_ASSERT( not mIntegrationCellIdToIndexMap.key_exists( tIgCellId ),
                             "Cut_Integration_Mesh::handle_requested_IG_cell_ID_answers() - "
                             "Proc #%i: IG cell ID %i has already been assigned to another IG cell on this processor.",
                             par_rank(),
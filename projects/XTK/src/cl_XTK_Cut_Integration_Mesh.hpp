@@ -12,6 +12,7 @@
 #define MORIS_cl_XTK_Cut_Integration_Mesh_HPP_
 
 #include "cl_Cell.hpp"
+#include "cl_Hash_Map.hpp"
 #include "cl_MTK_Cell.hpp"
 #include "cl_MTK_Vertex.hpp"
 #include "cl_MTK_Writer_Exodus.hpp"
@@ -166,12 +167,83 @@ namespace xtk
 
     // ----------------------------------------------------------------------------------
 
+    /**
+     * @brief edge connectivity of a list of cells stored in flat arrays. Every edge has two vertices, every cell
+     * has the same number of edges, the cells attached to edge i are stored at positions mEdgeToCellOffsets( i )
+     * to mEdgeToCellOffsets( i + 1 ) - 1 (compressed row storage).
+     */
     struct Edge_Based_Connectivity
     {
-        moris::Cell< moris::Cell< moris::mtk::Vertex* > > mEdgeVertices;             // input: edge || output: list of vertices on edge
-        moris::Cell< moris::Cell< moris::mtk::Cell* > >   mEdgeToCell;               // input: edge || output: list of cells attached to edge
-        moris::Cell< moris::Cell< moris_index > >         mEdgeToCellEdgeOrdinal;    // input: edge || output: ?
-        moris::Cell< moris::Cell< moris_index > >         mCellToEdge;               // input: cell || output: list of edge indices on cell
+        moris::Cell< moris::mtk::Vertex* > mEdgeVertices;             // input: 2 * edge + vertex ordinal || output: vertex on edge
+        moris::Cell< moris::uint >         mEdgeToCellOffsets;        // input: edge || output: offset of first cell attached to edge
+        moris::Cell< moris::mtk::Cell* >   mEdgeToCell;               // input: offset + i || output: i-th cell attached to edge
+        moris::Cell< moris_index >         mEdgeToCellEdgeOrdinal;    // input: offset + i || output: edge ordinal wrt. i-th cell attached to edge
+        moris::Cell< moris_index >         mCellToEdge;               // input: cell * num edges per cell + edge ordinal || output: edge index
+        moris::uint                        mNumEdgesPerCell = 0;
+
+        moris::uint
+        get_num_edges() const
+        {
+            return mEdgeVertices.size() / 2;
+        }
+
+        moris::mtk::Vertex*
+        get_edge_vertex(
+                moris::uint aEdgeIndex,
+                moris::uint aVertexOrdinal ) const
+        {
+            MORIS_ASSERT( aVertexOrdinal < 2, "Edge_Based_Connectivity::get_edge_vertex() - edges have two vertices" );
+            return mEdgeVertices( 2 * aEdgeIndex + aVertexOrdinal );
+        }
+
+        moris::Cell< moris::mtk::Vertex* >
+        get_edge_vertices( moris::uint aEdgeIndex ) const
+        {
+            return { mEdgeVertices( 2 * aEdgeIndex ), mEdgeVertices( 2 * aEdgeIndex + 1 ) };
+        }
+
+        moris::uint
+        get_num_cells_on_edge( moris::uint aEdgeIndex ) const
+        {
+            return mEdgeToCellOffsets( aEdgeIndex + 1 ) - mEdgeToCellOffsets( aEdgeIndex );
+        }
+
+        moris::mtk::Cell*
+        get_cell_on_edge(
+                moris::uint aEdgeIndex,
+                moris::uint aCellOrdinal ) const
+        {
+            MORIS_ASSERT( aCellOrdinal < this->get_num_cells_on_edge( aEdgeIndex ), "Edge_Based_Connectivity::get_cell_on_edge() - cell ordinal out of bounds" );
+            return mEdgeToCell( mEdgeToCellOffsets( aEdgeIndex ) + aCellOrdinal );
+        }
+
+        moris_index
+        get_edge_ordinal_on_cell(
+                moris::uint aEdgeIndex,
+                moris::uint aCellOrdinal ) const
+        {
+            MORIS_ASSERT( aCellOrdinal < this->get_num_cells_on_edge( aEdgeIndex ), "Edge_Based_Connectivity::get_edge_ordinal_on_cell() - cell ordinal out of bounds" );
+            return mEdgeToCellEdgeOrdinal( mEdgeToCellOffsets( aEdgeIndex ) + aCellOrdinal );
+        }
+
+        moris_index
+        get_cell_edge(
+                moris::uint aCellOrdinal,
+                moris::uint aEdgeOrdinal ) const
+        {
+            MORIS_ASSERT( aEdgeOrdinal < mNumEdgesPerCell, "Edge_Based_Connectivity::get_cell_edge() - edge ordinal out of bounds" );
+            return mCellToEdge( aCellOrdinal * mNumEdgesPerCell + aEdgeOrdinal );
+        }
+
+        std::size_t
+        get_memory_usage() const
+        {
+            return mEdgeVertices.capacity() * sizeof( moris::mtk::Vertex* )
+                 + mEdgeToCellOffsets.capacity() * sizeof( moris::uint )
+                 + mEdgeToCell.capacity() * sizeof( moris::mtk::Cell* )
+                 + mEdgeToCellEdgeOrdinal.capacity() * sizeof( moris_index )
+                 + mCellToEdge.capacity() * sizeof( moris_index );
+        }
     };
 
     // ----------------------------------------------------------------------------------
@@ -214,6 +286,11 @@ namespace xtk
 
     // ----------------------------------------------------------------------------------
 
+    /**
+     * @brief facet connectivity of a list of cells. Unlike Edge_Based_Connectivity the relations are kept as nested
+     * lists: Integration_Mesh_Cleanup merges facets and vertices in place (merge_facets(), merge_vertices()), which
+     * removes and appends entries row by row. Only the vertex to facet lookup used while building is flat.
+     */
     struct Facet_Based_Connectivity
     {
         // in: index of facet || out: list of vertices (pointers) living on facet with the inputted index
@@ -883,8 +960,9 @@ namespace xtk
         moris_index mGlobalMaxVertexId;
         moris_index mGlobalMaxCellId;
 
-        std::unordered_map< moris_id, moris_index > mIntegrationCellIdToIndexMap;
-        std::unordered_map< moris_id, moris_index > mIntegrationVertexIdToIndexMap;
+        // id to index maps of the integration cells and vertices, queried for every entity in the id based lookups
+        Hash_Map< moris_id, moris_index > mIntegrationCellIdToIndexMap;
+        Hash_Map< moris_id, moris_index > mIntegrationVertexIdToIndexMap;
 
         moris::Cell< moris_index > mIntegrationCellIndexToId;
         moris::Cell< moris_index > mIntegrationVertexIndexToId;
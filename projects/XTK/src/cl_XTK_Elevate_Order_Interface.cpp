@@ -262,14 +262,14 @@ Elevate_Order_Interface::make_vertex_requests(
         uint tNumNewVerticesPerEdge = mElevateOrderTemplate->num_new_vertices_per_entity( EntityRank::EDGE );
 
         // iterate through the edges in aEdgeConnectivity ask the geometry engine if we are intersected
-        for ( moris::uint iEdge = 0; iEdge < aEdgeConnectivity->mEdgeVertices.size(); iEdge++ )
+        for ( moris::uint iEdge = 0; iEdge < aEdgeConnectivity->get_num_edges(); iEdge++ )
         {
             // get edge parent entity index and rank
             moris_index tParentIndex = aIgEdgeAncestry->mEdgeParentEntityIndex( iEdge );
             moris_index tParentRank  = aIgEdgeAncestry->mEdgeParentEntityRank( iEdge );
 
             // get unique edge id based on two end vertices of edge
-            moris_index tSecondaryId = this->hash_edge( aEdgeConnectivity->mEdgeVertices( iEdge ) );
+            moris_index tSecondaryId = this->hash_edge( aEdgeConnectivity->get_edge_vertices( iEdge ) );
 
             // initialize variable holding possible new node index
             moris_index tNewNodeIndexInDecompData = MORIS_INDEX_MAX;
@@ -296,7 +296,7 @@ Elevate_Order_Interface::make_vertex_requests(
                     // compute global coordinates for new node
                     Matrix< DDRMat > tNewVertexCoords =
                             this->compute_edge_vertex_global_coordinates(
-                                aEdgeConnectivity->mEdgeVertices( iEdge ),
+                                aEdgeConnectivity->get_edge_vertices( iEdge ),
                                 mElevateOrderTemplate->get_new_vertex_parametric_coords_wrt_entity( EntityRank::EDGE )( iVert )  );
 
                     // fixme: can two nodes be requested with the same secondary ID?
@@ -317,17 +317,17 @@ Elevate_Order_Interface::make_vertex_requests(
                 } // end: loop over all new vertices on edge
 
                 // get index of edge vertices on proc
-                moris_index tFirstVertexIndex  = aEdgeConnectivity->mEdgeVertices( iEdge )( 0 )->get_index();
-                moris_index tSecondVertexIndex = aEdgeConnectivity->mEdgeVertices( iEdge )( 1 )->get_index();
+                moris_index tFirstVertexIndex  = aEdgeConnectivity->get_edge_vertex( iEdge, 0 )->get_index();
+                moris_index tSecondVertexIndex = aEdgeConnectivity->get_edge_vertex( iEdge, 1 )->get_index();
 
                 // get number of cells attached to edge, to register new vertices to these cells
-                uint tNumCellsAttachedToEdge = aEdgeConnectivity->mEdgeToCell( iEdge ).size();
+                uint tNumCellsAttachedToEdge = aEdgeConnectivity->get_num_cells_on_edge( iEdge );
 
                 // go over cells attached to edge and register decomp data vertex indices for local vertices
                 for ( uint iCellAttachedToEdge = 0; iCellAttachedToEdge < tNumCellsAttachedToEdge; iCellAttachedToEdge++)
                 {
                     // get Cell's index on proc
-                    moris_index tCellIndex = aEdgeConnectivity->mEdgeToCell( iEdge )( iCellAttachedToEdge )->get_index();
+                    moris_index tCellIndex = aEdgeConnectivity->get_cell_on_edge( iEdge, iCellAttachedToEdge )->get_index();
 
                     // get the element local indices of the edge start and end vertices
                     uint tFirstVertLocalIndex  = tVertIndicesOnCell( tCellIndex ).find( tFirstVertexIndex  )->second;
@@ -452,16 +452,16 @@ Elevate_Order_Interface::associate_new_vertices_with_cell_groups(
     tCellGroups.reserve( 20 );
 
     // iterate through the edges
-    for ( moris::uint iEdge = 0; iEdge < aEdgeConnectivity->mEdgeVertices.size(); iEdge++ )
+    for ( moris::uint iEdge = 0; iEdge < aEdgeConnectivity->get_num_edges(); iEdge++ )
     {
         moris_index tEdgeIndex = (moris_index) iEdge;
 
         // iterate through elements attached to this edge and collect the cell groups
         tCellGroups.clear();
-        for ( moris::uint iCell = 0; iCell < aEdgeConnectivity->mEdgeToCell( tEdgeIndex ).size(); iCell++ )
+        for ( moris::uint iCell = 0; iCell < aEdgeConnectivity->get_num_cells_on_edge( tEdgeIndex ); iCell++ )
         {
             // integration cell just grab the first
-            moris::mtk::Cell* tCell = aEdgeConnectivity->mEdgeToCell( tEdgeIndex )( iCell );
+            moris::mtk::Cell* tCell = aEdgeConnectivity->get_cell_on_edge( tEdgeIndex, iCell );
 
             // fill list of Cell groups the edge is related to
             tCellGroups.push_back( mCutIntegrationMesh->get_ig_cell_group_memberships( tCell->get_index() )( 0 ) );
@@ -474,7 +474,7 @@ Elevate_Order_Interface::associate_new_vertices_with_cell_groups(
         for ( moris::uint iUCG = 0; iUCG < tCellGroups.size(); iUCG++ )
         {
             // get the background cell group associated with this cell
-            MORIS_ERROR( aEdgeConnectivity->mEdgeToCell( tEdgeIndex ).size() > 0, "Edge not connected to any cells..." );
+            MORIS_ERROR( aEdgeConnectivity->get_num_cells_on_edge( tEdgeIndex ) > 0, "Edge not connected to any cells..." );
 
             // cell group membership
             moris_index tCellGroupMembershipIndex = tCellGroups( iUCG );
@@ -483,8 +483,8 @@ Elevate_Order_Interface::associate_new_vertices_with_cell_groups(
             std::shared_ptr< IG_Vertex_Group > tVertGroup = mCutIntegrationMesh->get_vertex_group( tCellGroupMembershipIndex );
 
             // get the parametric coord wrt this parent cell
-            std::shared_ptr< Matrix< DDRMat > > tVertex0LocalCoords = tVertGroup->get_vertex_local_coords( aEdgeConnectivity->mEdgeVertices( tEdgeIndex )( 0 )->get_index() );
-            std::shared_ptr< Matrix< DDRMat > > tVertex1LocalCoords = tVertGroup->get_vertex_local_coords( aEdgeConnectivity->mEdgeVertices( tEdgeIndex )( 1 )->get_index() );
+            std::shared_ptr< Matrix< DDRMat > > tVertex0LocalCoords = tVertGroup->get_vertex_local_coords( aEdgeConnectivity->get_edge_vertex( tEdgeIndex, 0 )->get_index() );
+            std::shared_ptr< Matrix< DDRMat > > tVertex1LocalCoords = tVertGroup->get_vertex_local_coords( aEdgeConnectivity->get_edge_vertex( tEdgeIndex, 1 )->get_index() );
 
             // initialize variables to store coords of new vertex
             tEdgeNodeParamCoordinates.set_row( 0, *tVertex0LocalCoords );
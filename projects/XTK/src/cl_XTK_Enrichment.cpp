@@ -14,6 +14,7 @@
 #include <iostream>
 #include <string>
 #include <set>
+#include <thread>
 
 #include "cl_Communication_Tools.hpp"
 #include "linalg_typedefs.hpp"
@@ -68,6 +69,15 @@ namespace xtk
         mIgMeshTools      = new Integration_Mesh_Generator();
         mBsplineMeshInfos = mCutIgMesh->get_bspline_mesh_info();
 
+        if ( mXTKModelPtr->mParameterList.get< bool >( "has_parameter_list" ) )
+        {
+            sint tNumThreads = mXTKModelPtr->mParameterList.get< sint >( "enrichment_threads" );
+
+            MORIS_ERROR( tNumThreads > 0, "Enrichment::Enrichment() - enrichment_threads needs to be at least 1." );
+
+            mNumEnrichmentThreads = (uint)tNumThreads;
+        }
+
         // FIXME: this needs to go once the SPG based enrichment is validated
         // reinitialize the enrichment data for SPGs if needed
         if ( aUseSpgBasedEnrichment )
@@ -306,54 +316,66 @@ namespace xtk
             Cell< Matrix< IndexMat > > tSubphaseClusterIndicesInSupport( tNumBasisFunctions );
             Cell< moris_index >        tMaxEnrichmentLevel( tNumBasisFunctions, 0 );
 
+            // Get elements in support of all basis functions (these are interpolation cells)
+            Cell< Matrix< IndexMat > > tParentElementsInSupport( tNumBasisFunctions );
+
             for ( moris::size_t iBasisFunction = 0; iBasisFunction < tNumBasisFunctions; iBasisFunction++ )
             {
-                // Get elements in support of basis (these are interpolation cells)
-                Matrix< IndexMat > tParentElementsInSupport;
-
-                mBackgroundMeshPtr->get_elements_in_support_of_basis( tMeshIndex, iBasisFunction, tParentElementsInSupport );
-
-                // get subphase clusters in support (separated by phase)
-                tSubphaseClusterIndicesInSupport( iBasisFunction ) = this->get_subphase_clusters_in_support( tParentElementsInSupport );
-
-                // construct subphase in support map
-                IndexMap tSubPhaseIndexToSupportIndex;
-
-                this->construct_subphase_in_support_map( tSubphaseClusterIndicesInSupport( iBasisFunction ), tSubPhaseIndexToSupportIndex );
-
-                // prune the subphase to remove subphases outside of basis support
-                Matrix< IndexMat > tPrunedSubphaseNeighborhood;
-
-                this->generate_pruned_subphase_graph_in_basis_support(
-                        tSubphaseClusterIndicesInSupport( iBasisFunction ),
-                        tSubPhaseIndexToSupportIndex,
-                        tPrunedSubphaseNeighborhood );
+                mBackgroundMeshPtr->get_elements_in_support_of_basis( tMeshIndex, iBasisFunction, tParentElementsInSupport( iBasisFunction ) );
+            }
 
-                // Assign enrichment levels to subphases
-                this->assign_subphase_bin_enrichment_levels_in_basis_support(
-                        tSubphaseClusterIndicesInSupport( iBasisFunction ),
-                        tSubPhaseIndexToSupportIndex,
-                        tPrunedSubphaseNeighborhood,
-                        tSubPhaseBinEnrichment( iBasisFunction ),
-                        tMaxEnrichmentLevel( iBasisFunction ) );
+            // the enrichment levels of different basis functions are independent of each other
+            this->process_basis_functions_in_parallel(
+                    tNumBasisFunctions,
+                    [ & ]( moris::size_t aFirst, moris::size_t aLast ) {
+                        // scratch data reused for all basis functions of this range
+                        IndexMap           tSubPhaseIndexToSupportIndex;
+                        Matrix< IndexMat > tPrunedSubphaseNeighborhood;
 
-                // Sort enrichment levels
-                if ( mSortBasisEnrichmentLevels )
-                {
-                    this->sort_enrichment_levels_in_basis_support(
-                            tSubphaseClusterIndicesInSupport( iBasisFunction ),
-                            tSubPhaseBinEnrichment( iBasisFunction ),
-                            tMaxEnrichmentLevel( iBasisFunction ) );
-                }
+                        for ( moris::size_t iBasisFunction = aFirst; iBasisFunction < aLast; iBasisFunction++ )
+                        {
+                            // get subphase clusters in support (separated by phase)
+                            tSubphaseClusterIndicesInSupport( iBasisFunction ) = this->get_subphase_clusters_in_support( tParentElementsInSupport( iBasisFunction ) );
+
+                            // construct subphase in support map
+                            tSubPhaseIndexToSupportIndex.clear();
+
+                            this->construct_subphase_in_support_map( tSubphaseClusterIndicesInSupport( iBasisFunction ), tSubPhaseIndexToSupportIndex );
+
+                            // prune the subphase to remove subphases outside of basis support
+                            this->generate_pruned_subphase_graph_in_basis_support(
+                                    tSubphaseClusterIndicesInSupport( iBasisFunction ),
+                                    tSubPhaseIndexToSupportIndex,
+                                    tPrunedSubphaseNeighborhood );
+
+                            // Assign enrichment levels to subphases
+                            this->assign_subphase_bin_enrichment_levels_in_basis_support(
+                                    tSubphaseClusterIndicesInSupport( iBasisFunction ),
+                                    tSubPhaseIndexToSupportIndex,
+                                    tPrunedSubphaseNeighborhood,
+                                    tSubPhaseBinEnrichment( iBasisFunction ),
+                                    tMaxEnrichmentLevel( iBasisFunction ) );
+
+                            // Sort enrichment levels
+                            if ( mSortBasisEnrichmentLevels )
+                            {
+                                this->sort_enrichment_levels_in_basis_support(
+                                        tSubphaseClusterIndicesInSupport( iBasisFunction ),
+                                        tSubPhaseBinEnrichment( iBasisFunction ),
+                                        tMaxEnrichmentLevel( iBasisFunction ) );
+                            }
+                        }
+                    } );
 
-                // Extract element enrichment levels from assigned sub-phase bin enrichment levels and store these as a member variable
+            // Extract element enrichment levels from assigned sub-phase bin enrichment levels and store these as a member variable
+            // this is done in order of the basis functions as the subphase to basis lists are shared
+            for ( moris::size_t iBasisFunction = 0; iBasisFunction < tNumBasisFunctions; iBasisFunction++ )
+            {
                 this->unzip_subphase_bin_enrichment_into_element_enrichment(
                         tMeshIndex,
                         iBasisFunction,
-                        tParentElementsInSupport,
+                        tParentElementsInSupport( iBasisFunction ),
                         tSubphaseClusterIndicesInSupport( iBasisFunction ),
-                        tSubPhaseIndexToSupportIndex,
-                        tPrunedSubphaseNeighborhood,
                         tSubPhaseBinEnrichment( iBasisFunction ) );
             }
 
@@ -412,52 +434,60 @@ namespace xtk
             Cell< Matrix< IndexMat > > tSpgIndicesInSupport( tNumBasisFunctions );
             Cell< moris_index >        tMaxEnrichmentLevel( tNumBasisFunctions, 0 );
 
-            for ( moris::size_t iBasisFunction = 0; iBasisFunction < tNumBasisFunctions; iBasisFunction++ )
-            {
-                // Get elements in support of basis (these are interpolation cells)
-                Matrix< IndexMat > tParentElementsInSupport;
-
-                mBackgroundMeshPtr->get_elements_in_support_of_basis( tMeshIndex, iBasisFunction, tParentElementsInSupport );
+            // Sort enrichment levels
+            // FIXME: sort_enrichment_levels_in_basis_support() doesn't work for SPGs yet
+            MORIS_ERROR( !mSortBasisEnrichmentLevels, "Enrichment::perform_basis_cluster_enrichment_new() - function: sort_enrichment_levels_in_basis_support() not supported yet with new SPG based enrichment" );
 
-                // collect Subphase group indices in support
-                IndexMap tSpgIndexToSupportIndex;
-                this->get_subphase_groups_in_support(
-                        iMeshIndex,
-                        tParentElementsInSupport,
-                        tSpgIndicesInSupport( iBasisFunction ),
-                        tSpgIndexToSupportIndex );
+            // Get elements in support of all basis functions (these are interpolation cells)
+            Cell< Matrix< IndexMat > > tParentElementsInSupport( tNumBasisFunctions );
 
-                // prune the subphase to remove subphases outside of basis support
-                Matrix< IndexMat > tPrunedSpgNeighborhood;
-                this->generate_pruned_subphase_group_graph_in_basis_support(
-                        iMeshIndex,
-                        tSpgIndicesInSupport( iBasisFunction ),
-                        tSpgIndexToSupportIndex,
-                        tPrunedSpgNeighborhood );
+            for ( moris::size_t iBasisFunction = 0; iBasisFunction < tNumBasisFunctions; iBasisFunction++ )
+            {
+                mBackgroundMeshPtr->get_elements_in_support_of_basis( tMeshIndex, iBasisFunction, tParentElementsInSupport( iBasisFunction ) );
+            }
 
-                // Assign enrichment levels to subphases
-                this->assign_subphase_group_bin_enrichment_levels_in_basis_support(
-                        tSpgIndicesInSupport( iBasisFunction ),
-                        tPrunedSpgNeighborhood,
-                        tSpgBinEnrichment( iBasisFunction ),
-                        tMaxEnrichmentLevel( iBasisFunction ) );
+            // the enrichment levels of different basis functions are independent of each other
+            this->process_basis_functions_in_parallel(
+                    tNumBasisFunctions,
+                    [ & ]( moris::size_t aFirst, moris::size_t aLast ) {
+                        // scratch data reused for all basis functions of this range
+                        IndexMap           tSpgIndexToSupportIndex;
+                        Matrix< IndexMat > tPrunedSpgNeighborhood;
 
-                // Sort enrichment levels
-                if ( mSortBasisEnrichmentLevels )
-                {
-                    MORIS_ERROR( false, "Enrichment::perform_basis_cluster_enrichment_new() - function: sort_enrichment_levels_in_basis_support() not supported yet with new SPG based enrichment" );
-                    // FIXME: this function doesn't work for SPGs yet
-                    this->sort_enrichment_levels_in_basis_support(
-                            tSpgIndicesInSupport( iBasisFunction ),
-                            tSpgBinEnrichment( iBasisFunction ),
-                            tMaxEnrichmentLevel( iBasisFunction ) );
-                }
+                        for ( moris::size_t iBasisFunction = aFirst; iBasisFunction < aLast; iBasisFunction++ )
+                        {
+                            // collect Subphase group indices in support
+                            tSpgIndexToSupportIndex.clear();
+                            this->get_subphase_groups_in_support(
+                                    iMeshIndex,
+                                    tParentElementsInSupport( iBasisFunction ),
+                                    tSpgIndicesInSupport( iBasisFunction ),
+                                    tSpgIndexToSupportIndex );
+
+                            // prune the subphase to remove subphases outside of basis support
+                            this->generate_pruned_subphase_group_graph_in_basis_support(
+                                    iMeshIndex,
+                                    tSpgIndicesInSupport( iBasisFunction ),
+                                    tSpgIndexToSupportIndex,
+                                    tPrunedSpgNeighborhood );
+
+                            // Assign enrichment levels to subphases
+                            this->assign_subphase_group_bin_enrichment_levels_in_basis_support(
+                                    tSpgIndicesInSupport( iBasisFunction ),
+                                    tPrunedSpgNeighborhood,
+                                    tSpgBinEnrichment( iBasisFunction ),
+                                    tMaxEnrichmentLevel( iBasisFunction ) );
+                        }
+                    } );
 
-                // Extract element enrichment levels from assigned sub-phase bin enrichment levels and store these as a member variable
+            // Extract element enrichment levels from assigned sub-phase bin enrichment levels and store these as a member variable
+            // this is done in order of the basis functions as the SPG to basis lists are shared
+            for ( moris::size_t iBasisFunction = 0; iBasisFunction < tNumBasisFunctions; iBasisFunction++ )
+            {
                 this->unzip_subphase_group_bin_enrichment_into_element_enrichment(
                         tMeshIndex,
                         iBasisFunction,
-                        tParentElementsInSupport,
+                        tParentElementsInSupport( iBasisFunction ),
                         tSpgIndicesInSupport( iBasisFunction ),
                         tSpgBinEnrichment( iBasisFunction ) );
             }
@@ -532,6 +562,43 @@ namespace xtk
 
     //-------------------------------------------------------------------------------------
 
+    void
+    Enrichment::process_basis_functions_in_parallel(
+            moris::size_t                                                             aNumBasisFunctions,
+            std::function< void( moris::size_t aFirst, moris::size_t aLast ) > const & aProcessRange )
+    {
+        moris::size_t tNumThreads = std::min( (moris::size_t)mNumEnrichmentThreads, std::max( aNumBasisFunctions, (moris::size_t)1 ) );
+
+        if ( tNumThreads == 1 )
+        {
+            aProcessRange( 0, aNumBasisFunctions );
+            return;
+        }
+
+        moris::size_t tChunkSize = ( aNumBasisFunctions + tNumThreads - 1 ) / tNumThreads;
+
+        std::vector< std::thread > tThreads;
+        tThreads.reserve( tNumThreads - 1 );
+
+        // the calling thread takes the first range
+        for ( moris::size_t iThread = 1; iThread < tNumThreads; iThread++ )
+        {
+            moris::size_t tFirst = std::min( iThread * tChunkSize, aNumBasisFunctions );
+            moris::size_t tLast  = std::min( tFirst + tChunkSize, aNumBasisFunctions );
+
+            tThreads.emplace_back( aProcessRange, tFirst, tLast );
+        }
+
+        aProcessRange( 0, std::min( tChunkSize, aNumBasisFunctions ) );
+
+        for ( auto& iThread : tThreads )
+        {
+            iThread.join();
+        }
+    }
+
+    //-------------------------------------------------------------------------------------
+
     void
     Enrichment::construct_neighborhoods()
     {
@@ -961,8 +1028,6 @@ namespace xtk
             moris_index const &        aBasisIndex,
             Matrix< IndexMat > const & aParentElementsInSupport,
             Matrix< IndexMat > const & aSubphasesInSupport,
-            IndexMap&                  aSubPhaseIndexToSupportIndex,
-            Matrix< IndexMat > const & aPrunedSubPhaseToSubphase,
             Matrix< IndexMat >&        aSubPhaseBinEnrichmentVals )
     {
         // resize member data
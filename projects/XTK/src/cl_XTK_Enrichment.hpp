@@ -17,6 +17,7 @@
 
 // Std includes
 #include <limits>
+#include <functional>
 #include <unordered_set>
 
 // XTK: XTK Includes
@@ -184,6 +185,9 @@ namespace xtk
         // flag whether to sort basis enrichment levels
         bool mSortBasisEnrichmentLevels;
 
+        // number of threads used for the computations local to a basis support
+        uint mNumEnrichmentThreads = 1;
+
         // quick access to the Cut integration mesh's Bspline Mesh Infos (the Bspline to Lagrange mesh relationships)
         moris::Cell< Bspline_Mesh_Info* > mBsplineMeshInfos;
 
@@ -566,8 +570,6 @@ namespace xtk
          * @param aBasisIndex
          * @param aParentElementsInSupport
          * @param aSubphasesInSupport
-         * @param aSubPhaseIndexToSupportIndex
-         * @param aPrunedSubPhaseToSubphase
          * @param aSubPhaseBinEnrichmentVals
          */
         void
@@ -576,12 +578,25 @@ namespace xtk
                 moris_index const &                      aBasisIndex,
                 moris::Matrix< moris::IndexMat > const & aParentElementsInSupport,
                 moris::Matrix< moris::IndexMat > const & aSubphasesInSupport,
-                IndexMap&                                aSubPhaseIndexToSupportIndex,
-                moris::Matrix< moris::IndexMat > const & aPrunedSubPhaseToSubphase,
                 moris::Matrix< moris::IndexMat >&        aSubPhaseBinEnrichmentVals );
 
         // ----------------------------------------------------------------------------------
 
+        /**
+         * @brief splits the basis functions into contiguous ranges and processes them on mNumEnrichmentThreads threads.
+         * Every range is processed by one call of aProcessRange, such that scratch data declared inside aProcessRange
+         * is reused for all basis functions of a thread. aProcessRange may only write data of the basis functions in its range.
+         *
+         * @param aNumBasisFunctions number of basis functions
+         * @param aProcessRange function processing the basis functions [ aFirst, aLast )
+         */
+        void
+        process_basis_functions_in_parallel(
+                moris::size_t                                                             aNumBasisFunctions,
+                std::function< void( moris::size_t aFirst, moris::size_t aLast ) > const & aProcessRange );
+
+        // ----------------------------------------------------------------------------------
+
         /**
          * @brief go through all SPGs in the support of a given basis function and save the
          * current BFs's index to them, and which enrichment level of this given BF is active
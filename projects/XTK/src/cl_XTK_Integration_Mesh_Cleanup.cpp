@@ -1170,18 +1170,10 @@ namespace xtk
         }
 
 
-        // adjust vertex id to index map
-        for ( auto it = mInputMesh->mIntegrationVertexIdToIndexMap.begin(); it != mInputMesh->mIntegrationVertexIdToIndexMap.end(); )
-        {
-            if ( it->second == MORIS_INDEX_MAX )
-            {
-                mInputMesh->mIntegrationVertexIdToIndexMap.erase( it++ );
-            }
-            else { ++it; }
-        }
-
+        // rebuild vertex id to index map without the merged vertices
+        mInputMesh->mIntegrationVertexIdToIndexMap.clear();
+        mInputMesh->mIntegrationVertexIdToIndexMap.reserve( mInputMesh->mIntegrationVertices.size() );
 
-        MORIS_ASSERT( mInputMesh->mIntegrationVertexIdToIndexMap.size() == mInputMesh->mIntegrationVertices.size(), "Error size" );
         for ( moris_index iV = 0; (uint)iV < mInputMesh->mIntegrationVertices.size(); iV++ )
         {
             mInputMesh->mIntegrationVertexIdToIndexMap[ mInputMesh->mIntegrationVertices( iV )->get_id() ] = (moris_index)iV;
@@ -1584,9 +1576,9 @@ namespace xtk
                     for ( moris_index iC = 0; (uint)iC < tReceivedNotOwnedCellIds( iProc ).numel(); iC++ )
                     {
                         // if received cell id is in current processor, compare vertex ids
-                        if ( mInputMesh->mIntegrationCellIdToIndexMap.find( tReceivedNotOwnedCellIds( iProc )( iC ) ) != mInputMesh->mIntegrationCellIdToIndexMap.end() )
+                        if ( mInputMesh->mIntegrationCellIdToIndexMap.key_exists( tReceivedNotOwnedCellIds( iProc )( iC ) ) )
                         {
-                            moris_index CellInd = mInputMesh->mIntegrationCellIdToIndexMap[ tReceivedNotOwnedCellIds( iProc )( iC ) ];
+                            moris_index CellInd = mInputMesh->mIntegrationCellIdToIndexMap.find( tReceivedNotOwnedCellIds( iProc )( iC ) );
 
                             for ( int iDim = 0; iDim <= dim; iDim++ )
                             {
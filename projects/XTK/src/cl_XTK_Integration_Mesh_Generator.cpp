@@ -9,6 +9,9 @@
  */
 
 #include <unordered_map>
+#include <thread>
+#include <exception>
+#include <algorithm>
 #include "cl_XTK_Integration_Mesh_Generator.hpp"
 #include "cl_XTK_Decomposition_Algorithm_Factory.hpp"
 #include "cl_XTK_Decomposition_Algorithm.hpp"
@@ -41,6 +44,12 @@ namespace xtk
         if ( mXTKModel->mParameterList.get< bool >( "has_parameter_list" ) )
         {
             mOutputCutIgMesh = mXTKModel->mParameterList.get< bool >( "output_cut_ig_mesh" );
+
+            sint tNumThreads = mXTKModel->mParameterList.get< sint >( "flood_fill_threads" );
+
+            MORIS_ERROR( tNumThreads > 0, "Integration_Mesh_Generator() - flood_fill_threads needs to be at least 1." );
+
+            mNumFloodFillThreads = (uint)tNumThreads;
         }
     }
     // ----------------------------------------------------------------------------------
@@ -1145,7 +1154,11 @@ namespace xtk
         // proc local subphase index
         moris::moris_index tSubPhaseIndex = tTotalNumBgCells;
 
-        moris_index tMaxSubPhase = 0;
+        // flood fill the IG cell groups of all cut IP cells
+        moris::Cell< moris::Matrix< moris::IndexMat > > tLocalFloodFills;
+        moris::Cell< moris_index >                      tMaxSubPhases;
+
+        this->flood_fill_intersected_ig_cell_groups( aMeshGenerationData, aCutIntegrationMesh, aCutNeighborhood, tLocalFloodFills, tMaxSubPhases );
 
         // subphase groupings
         moris::uint tReserveSize = 2 * tNumChildMeshes + tTotalNumBgCells;
@@ -1166,9 +1179,11 @@ namespace xtk
         moris::Cell< moris_index > tSubphaseIndices;
         tSubphaseIndices.reserve( 10 );
 
-        // iterate over cut IP cells and perform local flood-fill
-        for ( auto& iCell : aMeshGenerationData->mAllIntersectedBgCellInds )
+        // iterate over cut IP cells and collect the subphases of the local flood-fills
+        for ( moris::uint iCutCell = 0; iCutCell < aMeshGenerationData->mAllIntersectedBgCellInds.size(); iCutCell++ )
         {
+            moris_index iCell = aMeshGenerationData->mAllIntersectedBgCellInds( iCutCell );
+
             // get pointer to IG-Cell-Group to currently treated child mesh
             std::shared_ptr< IG_Cell_Group > tIgCellGroup = aCutIntegrationMesh->get_ig_cell_group( iCell );
 
@@ -1178,9 +1193,9 @@ namespace xtk
             // make sure assumption that intersected Bg-Cell index is equal to child mesh index holds true
             MORIS_ASSERT( tParentCell->get_index() == iCell, "Index mismatch parent index should align with parent cell index" );
 
-            // flood fill this group using the bulk phases
-            moris::Matrix< moris::IndexMat > tLocalFloodFill =
-                    this->flood_fill_ig_cell_group( aCutIntegrationMesh, aCutNeighborhood, tIgCellGroup, tMaxSubPhase );
+            // flood fill of this group using the bulk phases
+            moris::Matrix< moris::IndexMat > const & tLocalFloodFill = tLocalFloodFills( iCutCell );
+            moris_index                              tMaxSubPhase    = tMaxSubPhases( iCutCell );
 
             // put first subphase in spot of parent cell (indices for bg-cells are reserved for first subphase within bg-cells)
             aCutIntegrationMesh->mSubPhaseCellGroups( tParentCell->get_index() ) = std::make_shared< IG_Cell_Group >();
@@ -2490,6 +2505,87 @@ namespace xtk
 
     // ----------------------------------------------------------------------------------
 
+    void
+    Integration_Mesh_Generator::flood_fill_intersected_ig_cell_groups(
+            Integration_Mesh_Generation_Data*                 aMeshGenerationData,
+            Cut_Integration_Mesh*                             aCutIntegrationMesh,
+            std::shared_ptr< Cell_Neighborhood_Connectivity > aCutNeighborhood,
+            moris::Cell< moris::Matrix< moris::IndexMat > >&  aLocalFloodFills,
+            moris::Cell< moris_index >&                       aMaxSubphases )
+    {
+        moris::uint tNumCutCells = aMeshGenerationData->mAllIntersectedBgCellInds.size();
+
+        // one result per cut cell, every thread only writes the entries of its own chunk
+        aLocalFloodFills.resize( tNumCutCells );
+        aMaxSubphases.resize( tNumCutCells, 0 );
+
+        // flood fill a contiguous range of cut cells
+        auto tFloodFillChunk = [ & ]( moris::uint aFirst, moris::uint aLast ) {
+            for ( moris::uint iCutCell = aFirst; iCutCell < aLast; iCutCell++ )
+            {
+                std::shared_ptr< IG_Cell_Group > tIgCellGroup =
+                        aCutIntegrationMesh->get_ig_cell_group( aMeshGenerationData->mAllIntersectedBgCellInds( iCutCell ) );
+
+                aLocalFloodFills( iCutCell ) =
+                        this->flood_fill_ig_cell_group( aCutIntegrationMesh, aCutNeighborhood, tIgCellGroup, aMaxSubphases( iCutCell ) );
+            }
+        };
+
+        moris::uint tNumThreads = std::min( mNumFloodFillThreads, std::max( tNumCutCells, 1u ) );
+
+        if ( tNumThreads == 1 )
+        {
+            tFloodFillChunk( 0, tNumCutCells );
+            return;
+        }
+
+        moris::uint tChunkSize = ( tNumCutCells + tNumThreads - 1 ) / tNumThreads;
+
+        // an exception escaping a std::thread terminates the program, it is stored per thread and rethrown after all threads joined
+        std::vector< std::exception_ptr > tExceptions( tNumThreads, nullptr );
+
+        auto tFloodFillThread = [ & ]( moris::uint aThread, moris::uint aFirst, moris::uint aLast ) {
+            try
+            {
+                tFloodFillChunk( aFirst, aLast );
+            }
+            catch ( ... )
+            {
+                tExceptions[ aThread ] = std::current_exception();
+            }
+        };
+
+        std::vector< std::thread > tThreads;
+        tThreads.reserve( tNumThreads - 1 );
+
+        // the calling thread takes the first chunk
+        for ( moris::uint iThread = 1; iThread < tNumThreads; iThread++ )
+        {
+            moris::uint tFirst = std::min( iThread * tChunkSize, tNumCutCells );
+            moris::uint tLast  = std::min( tFirst + tChunkSize, tNumCutCells );
+
+            tThreads.emplace_back( tFloodFillThread, iThread, tFirst, tLast );
+        }
+
+        tFloodFillThread( 0, 0, std::min( tChunkSize, tNumCutCells ) );
+
+        for ( auto& iThread : tThreads )
+        {
+            iThread.join();
+        }
+
+        // rethrow the exception of the first failed chunk
+        for ( std::exception_ptr const & tException : tExceptions )
+        {
+            if ( tException )
+            {
+                std::rethrow_exception( tException );
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------
+
     void
     Integration_Mesh_Generator::construct_bulk_phase_to_bulk_phase_interface(
             Cut_Integration_Mesh*                                                aCutIntegrationMesh,
@@ -2742,13 +2838,12 @@ namespace xtk
 
     moris_index
     Integration_Mesh_Generator::edge_exists(
-            moris::Cell< moris::mtk::Vertex* >&                aVerticesOnEdge,
-            std::unordered_map< moris_index, moris_index >&    aLocaLVertexMap,
-            moris::Cell< moris::Cell< uint > >&                aVertexToEdge,
-            moris::Cell< moris::Cell< moris::mtk::Vertex* > >& aFullEdgeVertices )
+            moris::Cell< moris::mtk::Vertex* >&             aVerticesOnEdge,
+            std::unordered_map< moris_index, moris_index >& aLocaLVertexMap,
+            moris::Cell< moris_index > const &              aVertexFirstEdge,
+            moris::Cell< moris_index > const &              aNextEdge,
+            moris::Cell< moris::mtk::Vertex* > const &      aFullEdgeVertices )
     {
-        moris_index tEdgeIndex = MORIS_INDEX_MAX;
-
         // get them in order based on id
         std::sort( aVerticesOnEdge.data().begin(), aVerticesOnEdge.data().end(), moris::comparePtrToVertexIdBased );
 
@@ -2760,36 +2855,30 @@ namespace xtk
         moris_index tLocalVertexIndex = tIter->second;
 
         // iterate through edges attached to the first vertex (depend on ascending order)
-        for ( moris::uint iEdge = 0; iEdge < aVertexToEdge( tLocalVertexIndex ).size(); iEdge++ )
+        for ( moris_index tEdgeIndex = aVertexFirstEdge( tLocalVertexIndex ); tEdgeIndex != MORIS_INDEX_MAX; tEdgeIndex = aNextEdge( tEdgeIndex ) )
         {
-            moris_index tEdgeIndex = aVertexToEdge( tLocalVertexIndex )( iEdge );
-
-            MORIS_ASSERT( aFullEdgeVertices( tEdgeIndex )( 0 )->get_index() == aVerticesOnEdge( 0 )->get_index(),
+            MORIS_ASSERT( aFullEdgeVertices( 2 * tEdgeIndex )->get_index() == aVerticesOnEdge( 0 )->get_index(),
                     "Numbering issues, edges should be in ascending order based on vertex id" );
 
             // check the second vertex on the edge
-            if ( aFullEdgeVertices( tEdgeIndex )( 1 )->get_index() == aVerticesOnEdge( 1 )->get_index() )
+            if ( aFullEdgeVertices( 2 * tEdgeIndex + 1 )->get_index() == aVerticesOnEdge( 1 )->get_index() )
             {
                 return tEdgeIndex;
             }
         }
-        return tEdgeIndex;
+        return MORIS_INDEX_MAX;
     }
 
     // ----------------------------------------------------------------------------------
 
     moris_index
     Integration_Mesh_Generator::facet_exists(
-            moris::Cell< moris::mtk::Vertex* >&                aVerticesOnFacet,
-            std::unordered_map< moris_index, moris_index >&    aLocaLVertexMap,
-            moris::Cell< moris::Cell< uint > >&                aVertexToFacet,
-            moris::Cell< moris::Cell< moris::mtk::Vertex* > >& aFullFacetVertices )
+            moris::Cell< moris::mtk::Vertex* >&                       aVerticesOnFacet,
+            std::unordered_map< moris_index, moris_index >&           aLocaLVertexMap,
+            moris::Cell< moris_index > const &                        aVertexFirstFacet,
+            moris::Cell< moris_index > const &                        aNextFacet,
+            moris::Cell< moris::Cell< moris::mtk::Vertex* > > const & aFullFacetVertices )
     {
-        moris_index tFacetIndex = MORIS_INDEX_MAX;
-
-        // number of vertices per facet
-        // moris::uint tNumVerticesPerFacet = aVerticesOnFacet.size();
-
         // get them in order based on id
         std::sort( aVerticesOnFacet.data().begin(), aVerticesOnFacet.data().end(), moris::comparePtrToVertexIdBased );
 
@@ -2799,28 +2888,15 @@ namespace xtk
 
         moris_index tLocalVertexIndex = tIter->second;
 
-        // iterate through edges attached to the first vertex (depend on ascending order)
-        for ( moris::uint iFacet = 0; iFacet < aVertexToFacet( tLocalVertexIndex ).size(); iFacet++ )
+        // iterate through facets attached to the first vertex (depend on ascending order)
+        for ( moris_index tFacetIndex = aVertexFirstFacet( tLocalVertexIndex ); tFacetIndex != MORIS_INDEX_MAX; tFacetIndex = aNextFacet( tFacetIndex ) )
         {
-            tFacetIndex = aVertexToFacet( tLocalVertexIndex )( iFacet );
-
             MORIS_ASSERT( aFullFacetVertices( tFacetIndex )( 0 )->get_index() == aVerticesOnFacet( 0 )->get_index(), "Numbering issue" );
 
-            // figure out if this is the same vertex
-            bool tFoundFacet = std::equal( aFullFacetVertices( tFacetIndex ).begin(), aFullFacetVertices( tFacetIndex ).end(), aVerticesOnFacet.begin() );
-
-            // for(moris::uint iV =1; iV<tNumVerticesPerFacet; iV++)
-            // {
-            //     if(aFullFacetVertices(tFacetIndex)(iV)->get_index() != aVerticesOnFacet(iV)->get_index())
-            //     {
-            //         tFoundFacet = false;
-            //     }
-            // }
-
-            if ( tFoundFacet )
+            // figure out if this is the same facet
+            if ( std::equal( aFullFacetVertices( tFacetIndex ).begin(), aFullFacetVertices( tFacetIndex ).end(), aVerticesOnFacet.begin() ) )
             {
                 return tFacetIndex;
-                break;
             }
         }
         return MORIS_INDEX_MAX;
@@ -2924,8 +3000,10 @@ namespace xtk
             aFaceConnectivity->mFacetToCellEdgeOrdinal.reserve( tIncNumFacets );
             aFaceConnectivity->mFacetVertices.reserve( tIncNumFacets );
 
-            // define local list
-            moris::Cell< moris::Cell< uint > > tVertexToFacetIndex( tNumNodes );
+            // first facet starting at a vertex and next facet starting at the same vertex (linked list through the facets)
+            moris::Cell< moris_index > tVertexFirstFacet( tNumNodes, MORIS_INDEX_MAX );
+            moris::Cell< moris_index > tNextFacet;
+
             moris::Cell< moris::mtk::Vertex* > tVerticesOnFacet( tNumNodesPerFacet, nullptr );
 
             // go through all IG cells on mesh
@@ -2957,7 +3035,8 @@ namespace xtk
                     moris_index tFacetIndex = this->facet_exists(
                             tVerticesOnFacet,
                             tVertexIndexToLocalIndexMap,
-                            tVertexToFacetIndex,
+                            tVertexFirstFacet,
+                            tNextFacet,
                             aFaceConnectivity->mFacetVertices );
 
                     // add new facet if it doesn't exist already
@@ -2985,7 +3064,9 @@ namespace xtk
                                 "Invalid vertex detected." );
                         moris_index tLocalVertexIndex = tIter->second;
 
-                        tVertexToFacetIndex( tLocalVertexIndex ).push_back( tFacetIndex );
+                        // prepend facet to the list of facets starting at this vertex
+                        tNextFacet.push_back( tVertexFirstFacet( tLocalVertexIndex ), tIncNumFacets );
+                        tVertexFirstFacet( tLocalVertexIndex ) = tFacetIndex;
                     }
 
                     // store facet index on cell
@@ -3135,8 +3216,15 @@ namespace xtk
                 }
             }
 
-            // Set size for cell to edge map
-            aEdgeConnectivity->mCellToEdge.resize( aCells.size() );
+            // start clean
+            aEdgeConnectivity->mEdgeVertices.clear();
+            aEdgeConnectivity->mEdgeToCellOffsets.clear();
+            aEdgeConnectivity->mEdgeToCell.clear();
+            aEdgeConnectivity->mEdgeToCellEdgeOrdinal.clear();
+
+            // Set size for cell to edge map, all cells have the same number of edges
+            aEdgeConnectivity->mNumEdgesPerCell = tNumEdgePerElem;
+            aEdgeConnectivity->mCellToEdge.resize( tNumElements * tNumEdgePerElem, MORIS_INDEX_MAX );
 
             // Maximum number of edges
             uint tMaxNumEdges = tNumElements * tNumEdgePerElem;
@@ -3144,26 +3232,23 @@ namespace xtk
             // Define by which the capacity of edge-based cells is increased
             uint tIncNumEdges = tMaxNumEdges * tNumNodesPerEdge / 10;
 
-            // Reserve memory of edge-based cells
-            aEdgeConnectivity->mEdgeToCell.reserve( tIncNumEdges );
-            aEdgeConnectivity->mEdgeToCellEdgeOrdinal.reserve( tIncNumEdges );
-            aEdgeConnectivity->mEdgeVertices.reserve( tIncNumEdges );
+            // first edge starting at a vertex and next edge starting at the same vertex (linked list through the edges)
+            moris::Cell< moris_index > tVertexFirstEdge( tNumNodes, MORIS_INDEX_MAX );
+            moris::Cell< moris_index > tNextEdge;
 
-            // Set size of cell storing edges connected to node
-            moris::Cell< moris::Cell< uint > > tVertexToEdgeIndex( tNumNodes );
+            // number of cells attached to each edge, shifted by one for the offsets
+            moris::Cell< moris::uint >& tEdgeToCellOffsets = aEdgeConnectivity->mEdgeToCellOffsets;
+            tEdgeToCellOffsets.push_back( 0 );
 
             // Set size of auxiliary cell with vertex pointers
             moris::Cell< moris::mtk::Vertex* > tVerticesOnEdge( tNumNodesPerEdge, nullptr );
 
-            // loop over all cells and their edges
+            // first pass: loop over all cells and their edges, find the unique edges and count the cells attached to them
             for ( moris::uint i = 0; i < aCells.size(); i++ )
             {
                 // get pointers to vertices of cell
                 moris::Cell< moris::mtk::Vertex* > tCellVerts = aCells( i )->get_vertex_pointers();
 
-                // reserve memory for storing edges on cell
-                aEdgeConnectivity->mCellToEdge( i ).reserve( tNumEdgePerElem );
-
                 // iterate through facets of cell
                 for ( moris::uint iEdge = 0; iEdge < tElementEdgeToNodeMap.n_rows(); iEdge++ )
                 {
@@ -3177,26 +3262,22 @@ namespace xtk
                     moris_index tEdgeIndex = this->edge_exists(
                             tVerticesOnEdge,
                             tVertexIndexToLocalIndexMap,
-                            tVertexToEdgeIndex,
+                            tVertexFirstEdge,
+                            tNextEdge,
                             aEdgeConnectivity->mEdgeVertices );
 
                     // add new edge new if it doesn't exist already
                     if ( tEdgeIndex == MORIS_INDEX_MAX )
                     {
                         // set edge index
-                        tEdgeIndex = aEdgeConnectivity->mEdgeVertices.size();
+                        tEdgeIndex = aEdgeConnectivity->get_num_edges();
 
                         // store pointers of vertices on edge
-                        aEdgeConnectivity->mEdgeVertices.push_back( tVerticesOnEdge, tIncNumEdges );
+                        aEdgeConnectivity->mEdgeVertices.push_back( tVerticesOnEdge( 0 ), tIncNumEdges );
+                        aEdgeConnectivity->mEdgeVertices.push_back( tVerticesOnEdge( 1 ), tIncNumEdges );
 
-                        // for current edge initialize list to store connected cell and side ordinal
-                        aEdgeConnectivity->mEdgeToCell.push_back( moris::Cell< moris::mtk::Cell* >(), tIncNumEdges );
-                        aEdgeConnectivity->mEdgeToCellEdgeOrdinal.push_back( moris::Cell< moris::moris_index >(), tIncNumEdges );
-
-                        // reserve memory for list storing cells and their side ordinal connected to edge
-                        // guess of cell size: number of edges per element
-                        aEdgeConnectivity->mEdgeToCell.back().reserve( tNumEdgePerElem );
-                        aEdgeConnectivity->mEdgeToCellEdgeOrdinal.back().reserve( tNumEdgePerElem );
+                        // initialize cell counter of this edge
+                        tEdgeToCellOffsets.push_back( 0, tIncNumEdges );
 
                         // store edge with vertex
                         auto tIter = tVertexIndexToLocalIndexMap.find( tVerticesOnEdge( 0 )->get_index() );
@@ -3205,24 +3286,56 @@ namespace xtk
 
                         moris_index tLocalVertexIndex = tIter->second;
 
-                        // store edge index for vertex; if needed increase cell capacity by increments of 10
-                        tVertexToEdgeIndex( tLocalVertexIndex ).push_back( tEdgeIndex, 10 );
+                        // prepend edge to the list of edges starting at this vertex
+                        tNextEdge.push_back( tVertexFirstEdge( tLocalVertexIndex ), tIncNumEdges );
+                        tVertexFirstEdge( tLocalVertexIndex ) = tEdgeIndex;
                     }
 
                     // add edge index to cell
-                    aEdgeConnectivity->mCellToEdge( i ).push_back( tEdgeIndex );
+                    aEdgeConnectivity->mCellToEdge( i * tNumEdgePerElem + iEdge ) = tEdgeIndex;
 
-                    // add cell pointer and side ordinal to edge
-                    // if needed increase cell capacity by increments of number of edges per element
-                    aEdgeConnectivity->mEdgeToCell( tEdgeIndex ).push_back( aCells( i ), tNumEdgePerElem );
-                    aEdgeConnectivity->mEdgeToCellEdgeOrdinal( tEdgeIndex ).push_back( iEdge, tNumEdgePerElem );
+                    // count cell attached to edge
+                    tEdgeToCellOffsets( tEdgeIndex + 1 )++;
                 }
             }
 
-            // trim outer and inner cells
-            shrink_to_fit_all( aEdgeConnectivity->mEdgeVertices );
-            shrink_to_fit_all( aEdgeConnectivity->mEdgeToCell );
-            shrink_to_fit_all( aEdgeConnectivity->mEdgeToCellEdgeOrdinal );
+            // turn counters into offsets
+            moris::uint tNumEdges = aEdgeConnectivity->get_num_edges();
+
+            for ( moris::uint iEdge = 0; iEdge < tNumEdges; iEdge++ )
+            {
+                tEdgeToCellOffsets( iEdge + 1 ) += tEdgeToCellOffsets( iEdge );
+            }
+
+            // second pass: store cell pointer and edge ordinal of all cells attached to the edges
+            aEdgeConnectivity->mEdgeToCell.resize( tEdgeToCellOffsets( tNumEdges ), nullptr );
+            aEdgeConnectivity->mEdgeToCellEdgeOrdinal.resize( tEdgeToCellOffsets( tNumEdges ), MORIS_INDEX_MAX );
+
+            moris::Cell< moris::uint > tFillPosition( tNumEdges );
+
+            for ( moris::uint iEdge = 0; iEdge < tNumEdges; iEdge++ )
+            {
+                tFillPosition( iEdge ) = tEdgeToCellOffsets( iEdge );
+            }
+
+            for ( moris::uint i = 0; i < aCells.size(); i++ )
+            {
+                for ( moris::uint iEdge = 0; iEdge < tNumEdgePerElem; iEdge++ )
+                {
+                    moris_index tEdgeIndex = aEdgeConnectivity->mCellToEdge( i * tNumEdgePerElem + iEdge );
+
+                    moris::uint tPosition = tFillPosition( tEdgeIndex )++;
+
+                    aEdgeConnectivity->mEdgeToCell( tPosition )            = aCells( i );
+                    aEdgeConnectivity->mEdgeToCellEdgeOrdinal( tPosition ) = iEdge;
+                }
+            }
+
+            // trim over allocated arrays
+            aEdgeConnectivity->mEdgeVertices.shrink_to_fit();
+            tEdgeToCellOffsets.shrink_to_fit();
+
+            MORIS_LOG_SPEC( "Edge connectivity memory (bytes)", aEdgeConnectivity->get_memory_usage() );
         }
     }
 
@@ -3427,7 +3540,7 @@ namespace xtk
         aIgEdgeAncestry->mEdgeParentEntityOrdinalWrtBackgroundCell.clear();
 
         // number of edges in the edge connectivity
-        moris::uint tNumEdges = aIgCellGroupEdgeConnectivity->mEdgeVertices.size();
+        moris::uint tNumEdges = aIgCellGroupEdgeConnectivity->get_num_edges();
 
         MORIS_ERROR( aParentCellForDeduction.size() == tNumEdges, "One representative parent cell is needed for each edge, to ensure all edges parents can be deduced." );
 
@@ -3442,7 +3555,7 @@ namespace xtk
         for ( moris::uint iEdge = 0; iEdge < tNumEdges; iEdge++ )
         {
             // vertices of the edge
-            moris::Cell< moris::mtk::Vertex* > const & tEdgeVertices = aIgCellGroupEdgeConnectivity->mEdgeVertices( iEdge );
+            moris::Cell< moris::mtk::Vertex* > const & tEdgeVertices = aIgCellGroupEdgeConnectivity->get_edge_vertices( iEdge );
 
             // get the parent of these vertices from the mesh
             moris::Cell< moris::moris_index > tEdgeVertexParentInds( tEdgeVertices.size() );
@@ -3688,9 +3801,7 @@ namespace xtk
             tControlledVertexIndex++;
 
             // add to the map
-            MORIS_ASSERT( aCutIntegrationMesh->mIntegrationVertexIdToIndexMap.find(
-                                  aDecompositionData->tNewNodeId( iV ) )
-                                  == aCutIntegrationMesh->mIntegrationVertexIdToIndexMap.end(),
+            MORIS_ASSERT( not aCutIntegrationMesh->mIntegrationVertexIdToIndexMap.key_exists( aDecompositionData->tNewNodeId( iV ) ),
                     "Id already in the map" );
             aCutIntegrationMesh->mIntegrationVertexIdToIndexMap[ aDecompositionData->tNewNodeId( iV ) ] = aDecompositionData->tNewNodeIndex( iV );
 
@@ -3757,7 +3868,7 @@ namespace xtk
     {
         Tracer tTracer( "XTK", "Decomposition_Algorithm", "Select BG Cell for Edge", mXTKModel->mVerboseLevel, 1 );
         // number of edges
-        moris::uint tNumEdges = aEdgeBasedConnectivity->mEdgeVertices.size();
+        moris::uint tNumEdges = aEdgeBasedConnectivity->get_num_edges();
 
         aBackgroundCellForEdge.resize( tNumEdges );
 
@@ -3765,10 +3876,10 @@ namespace xtk
         for ( moris::uint iEdge = 0; iEdge < tNumEdges; iEdge++ )
         {
             // get the first cell attached to the edge
-            MORIS_ERROR( aEdgeBasedConnectivity->mEdgeToCell( iEdge ).size() > 0, "Edge not connected to any cells..." );
+            MORIS_ERROR( aEdgeBasedConnectivity->get_num_cells_on_edge( iEdge ) > 0, "Edge not connected to any cells..." );
 
             // integration cell just grab the first
-            moris::mtk::Cell* tCell = aEdgeBasedConnectivity->mEdgeToCell( iEdge )( 0 );
+            moris::mtk::Cell* tCell = aEdgeBasedConnectivity->get_cell_on_edge( iEdge, 0 );
 
             // cell group membership
             moris_index tCellGroupMembershipIndex = aCutIntegrationMesh->get_ig_cell_group_memberships( tCell->get_index() )( 0 );
@@ -141,8 +141,8 @@ namespace xtk
         {
             mCurrentEdgeIndex = aCurrentIndex;
             mQueryEntityToVertices.resize( 1, 2 );
-            mQueryEntityToVertices( 0 ) = mEdgeConnectivity->mEdgeVertices( mCurrentEdgeIndex )( 0 )->get_index();
-            mQueryEntityToVertices( 1 ) = mEdgeConnectivity->mEdgeVertices( mCurrentEdgeIndex )( 1 )->get_index();
+            mQueryEntityToVertices( 0 ) = mEdgeConnectivity->get_edge_vertex( mCurrentEdgeIndex, 0 )->get_index();
+            mQueryEntityToVertices( 1 ) = mEdgeConnectivity->get_edge_vertex( mCurrentEdgeIndex, 1 )->get_index();
         }
 
         void
@@ -267,6 +267,10 @@ namespace xtk
 
         bool mOutputCutIgMesh = false;
 
+        // number of threads for the local flood fills of the intersected background cells, all other
+        // decomposition steps are serial as they add vertices, cells and facets to the shared cut mesh
+        uint mNumFloodFillThreads = 1;
+
       public:
         // ----------------------------------------------------------------------------------
 
@@ -438,24 +442,27 @@ namespace xtk
         // ----------------------------------------------------------------------------------
 
         /**
-         * this function checks if first vertex in first map (first input)
-         * exists in last two inputs and returns MORIS_MAX_INDEX if not
+         * this function checks if the edge given by its two vertices (first input) already exists
+         * in the flat edge vertex list (last input) and returns MORIS_MAX_INDEX if not. The edges starting
+         * at a vertex are found through the linked list given by aVertexFirstEdge and aNextEdge.
          */
         moris_index
         edge_exists(
-                moris::Cell< moris::mtk::Vertex* >&                aVerticesOnEdge,
-                std::unordered_map< moris_index, moris_index >&    aLocaLVertexMap,
-                moris::Cell< moris::Cell< uint > >&                aVertexToEdge,
-                moris::Cell< moris::Cell< moris::mtk::Vertex* > >& aFullEdgeVertices );
+                moris::Cell< moris::mtk::Vertex* >&             aVerticesOnEdge,
+                std::unordered_map< moris_index, moris_index >& aLocaLVertexMap,
+                moris::Cell< moris_index > const &              aVertexFirstEdge,
+                moris::Cell< moris_index > const &              aNextEdge,
+                moris::Cell< moris::mtk::Vertex* > const &      aFullEdgeVertices );
 
         // ----------------------------------------------------------------------------------
 
         moris_index
         facet_exists(
-                moris::Cell< moris::mtk::Vertex* >&                aVerticesOnFacet,
-                std::unordered_map< moris_index, moris_index >&    aLocaLVertexMap,
-                moris::Cell< moris::Cell< uint > >&                aVertexToFacet,
-                moris::Cell< moris::Cell< moris::mtk::Vertex* > >& aFullFacetVertices );
+                moris::Cell< moris::mtk::Vertex* >&                       aVerticesOnFacet,
+                std::unordered_map< moris_index, moris_index >&           aLocaLVertexMap,
+                moris::Cell< moris_index > const &                        aVertexFirstFacet,
+                moris::Cell< moris_index > const &                        aNextFacet,
+                moris::Cell< moris::Cell< moris::mtk::Vertex* > > const & aFullFacetVertices );
 
         // ----------------------------------------------------------------------------------
 
@@ -788,6 +795,29 @@ namespace xtk
 
         // ----------------------------------------------------------------------------------
 
+        /**
+         * @brief flood fill the IG cell groups of all intersected background cells. The cells are split into
+         * contiguous chunks which are processed by different threads, the results are stored in the order of
+         * the intersected background cells such that the subsequent merge does not depend on the number of threads.
+         * Only the flood fill is threaded, the subdivision, node hierarchy, edge and facet ancestry steps run serially.
+         * An exception thrown by one of the threads is rethrown after all threads are joined.
+         *
+         * @param aMeshGenerationData pointer to the mesh generation data containing the intersected background cells
+         * @param aCutIntegrationMesh pointer to XTK Cut_Integration_Mesh
+         * @param aCutNeighborhood Cell_Neighborhood_Connectivity of proc local mesh
+         * @param aLocalFloodFills (output) subphase index of every IG cell for every intersected background cell
+         * @param aMaxSubphases (output) max bg-cell local subphase index for every intersected background cell
+         */
+        void
+        flood_fill_intersected_ig_cell_groups(
+                Integration_Mesh_Generation_Data*                 aMeshGenerationData,
+                Cut_Integration_Mesh*                             aCutIntegrationMesh,
+                std::shared_ptr< Cell_Neighborhood_Connectivity > aCutNeighborhood,
+                moris::Cell< moris::Matrix< moris::IndexMat > >&  aLocalFloodFills,
+                moris::Cell< moris_index >&                       aMaxSubphases );
+
+        // ----------------------------------------------------------------------------------
+
         void
         extract_cells_from_cell_groups(
                 moris::Cell< std::shared_ptr< IG_Cell_Group > > const & aCellGroups,
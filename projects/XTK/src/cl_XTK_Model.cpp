@@ -1439,4 +1439,12 @@ namespace xtk
         return mParameterList.get< bool >( "delete_xtk_after_generation" );
     }
 
+    //------------------------------------------------------------------------------
+
+    std::string
+    Model::get_database_snapshot_file()
+    {
+        return mParameterList.get< std::string >( "database_snapshot_file" );
+    }
+
 }    // namespace xtk
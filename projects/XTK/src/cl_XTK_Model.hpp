@@ -632,6 +632,14 @@ namespace xtk
         bool
         delete_xtk_after_generation(); 
 
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief returns the path of the data base mesh snapshot, empty if no snapshot is requested
+         */
+        std::string
+        get_database_snapshot_file();
+
         // Private Functions
 
       private:
@@ -171,107 +171,113 @@ Node_Hierarchy_Interface::determine_intersected_edges_and_make_requests(
 
     // initialize intersection information
     aIntersectedEdges.clear();
-    aIntersectedEdges.reserve( aEdgeConnectivity->mEdgeVertices.size() );
+    aIntersectedEdges.reserve( aEdgeConnectivity->get_num_edges() );
     aEdgeLocalCoordinate.clear();
-    aEdgeLocalCoordinate.reserve( aEdgeConnectivity->mEdgeVertices.size() );
-
-    // the query interface
-    // Initialize geometric query
-    // (object which holds/collects all information needed to determine an intersection
-    // (e.g. data of an edge and its relation to its Child Mesh and BG Cell))
-    Geometric_Query_XTK tGeometricQuery;
-
-    // setup the query data (fixed parts for this function)
-    tGeometricQuery.set_query_type( moris::ge::Query_Type::INTERSECTION_LOCATION );
-    tGeometricQuery.set_coordinates_matrix( mCutIntegrationMesh->get_all_vertex_coordinates_loc_inds() );
-    tGeometricQuery.set_cut_integration_mesh( mCutIntegrationMesh );
-    tGeometricQuery.set_query_entity_rank( EntityRank::EDGE );
-    tGeometricQuery.set_edge_connectivity( aEdgeConnectivity );
-    tGeometricQuery.set_edge_associated_background_cell( aBackgroundCellForEdge );
-    tGeometricQuery.set_associated_vertex_group( aVertexGroups );
-    tGeometricQuery.set_geometric_index( mCurrentGeomIndex );
+    aEdgeLocalCoordinate.reserve( aEdgeConnectivity->get_num_edges() );
 
-    mDecompositionData->mHasSecondaryIdentifier = true;
+    // collect the edge data for the geometry engine
+    moris::uint tNumEdges = aEdgeConnectivity->get_num_edges();
+
+    Matrix< IndexMat >                          tEdgeVertices( tNumEdges, 2 );
+    Cell< std::shared_ptr< Matrix< DDRMat > > > tEdgeVertexLocalCoords( 2 * tNumEdges );
 
-    //iterate through the edges in aEdgeConnectivity ask the geometry engine if we are intersected
-    for ( moris::uint iEdge = 0; iEdge < aEdgeConnectivity->mEdgeVertices.size(); iEdge++ )
+    for ( moris::uint iEdge = 0; iEdge < tNumEdges; iEdge++ )
     {
-        // initialize matrix storing intersection point on edge in parametric coords of BG cell
-        if ( iEdge == 0 )
+        for ( moris::uint iVertex = 0; iVertex < 2; iVertex++ )
         {
-            tGeometricQuery.set_parametric_coordinate_size( ( *aBackgroundCellForEdge )( iEdge )->get_cell_info()->get_loc_coord_dim() );
+            moris_index tVertexIndex = aEdgeConnectivity->get_edge_vertex( iEdge, iVertex )->get_index();
+
+            tEdgeVertices( iEdge, iVertex ) = tVertexIndex;
+
+            // local coordinates of the vertex wrt. the background cell of the edge
+            tEdgeVertexLocalCoords( 2 * iEdge + iVertex ) = ( *aVertexGroups )( iEdge )->get_vertex_local_coords( tVertexIndex );
         }
+    }
 
-        // update the current edge index treated
-        tGeometricQuery.set_current_edge_index( iEdge );
+    // intersect all edges with the current geometry at once
+    moris::ge::Edge_Intersections tEdgeIntersections = mGeometryEngine->compute_edge_intersections(
+            mCurrentGeomIndex,
+            tEdgeVertices,
+            *aBackgroundCellForEdge,
+            tEdgeVertexLocalCoords,
+            *mCutIntegrationMesh->get_all_vertex_coordinates_loc_inds() );
 
-        // update parent cell to BG cell of treated edge
-        tGeometricQuery.set_parent_cell( ( *aBackgroundCellForEdge )( iEdge ) );
+    mDecompositionData->mHasSecondaryIdentifier = true;
 
-        // see if the edge is intersected using the geometry engine
-        bool tIsIntersected = mGeometryEngine->geometric_query( &tGeometricQuery );
+    // edges and node indices of the new intersection nodes, admitted to GEN after all requests have been made
+    Cell< moris_index > tAdmittedEdges;
+    Cell< moris_index > tAdmittedNodeIndices;
 
-        // for intersected edges, invoke intersection procedure
-        if ( tIsIntersected )
+    // iterate through the edges and make node requests for the intersected ones
+    for ( moris::uint iEdge = 0; iEdge < tNumEdges; iEdge++ )
+    {
+        // skip edges which are not intersected
+        if ( !tEdgeIntersections.mIsIntersected( iEdge ) )
         {
-            // check if both end vertices of edge are on the interface, if so, skip intersection procedure
-            if ( !mGeometryEngine->queued_intersection_first_parent_on_interface() && !mGeometryEngine->queued_intersection_second_parent_on_interface() )
-            {
-                // add index and intersection position to list of intersected edges
-                aIntersectedEdges.push_back( (moris_index)iEdge );
-                aEdgeLocalCoordinate.push_back( mGeometryEngine->get_queued_intersection_local_coordinate() );
+            continue;
+        }
+
+        // check if both end vertices of edge are on the interface, if so, skip intersection procedure
+        if ( !tEdgeIntersections.mFirstParentOnInterface( iEdge ) && !tEdgeIntersections.mSecondParentOnInterface( iEdge ) )
+        {
+            // add index and intersection position to list of intersected edges
+            aIntersectedEdges.push_back( (moris_index)iEdge );
+            aEdgeLocalCoordinate.push_back( tEdgeIntersections.mLocalCoordinates( iEdge ) );
+
+            // get edge parent entity index and rank
+            moris_index tParentIndex = aIgEdgeAncestry->mEdgeParentEntityIndex( iEdge );
+            moris_index tParentRank  = aIgEdgeAncestry->mEdgeParentEntityRank( iEdge );
+
+            // get unique edge id based on two end vertices of edge
+            moris_index tSecondaryId = this->hash_edge( aEdgeConnectivity->get_edge_vertices( iEdge ) );
 
-                // get edge parent entity index and rank
-                moris_index tParentIndex = aIgEdgeAncestry->mEdgeParentEntityIndex( iEdge );
-                moris_index tParentRank  = aIgEdgeAncestry->mEdgeParentEntityRank( iEdge );
+            // initialize variable holding possible new node index
+            moris_index tNewNodeIndexInSubdivision = MORIS_INDEX_MAX;
 
-                // get unique edge id based on two end vertices of edge
-                moris_index tSecondaryId = this->hash_edge( aEdgeConnectivity->mEdgeVertices( iEdge ) );
+            // check if new node for current edge has already been requested ...
+            bool tRequestExist = mDecompositionData->request_exists(
+                    tParentIndex,
+                    tSecondaryId,
+                    (enum EntityRank)tParentRank,
+                    tNewNodeIndexInSubdivision );
 
-                // initialize variable holding possible new node index
-                moris_index tNewNodeIndexInSubdivision = MORIS_INDEX_MAX;
+            // ... if not request it
+            if ( !tRequestExist )
+            {
+                // find out which processor owns parent entity of currently treated edge
+                moris::moris_index tOwningProc = mBackgroundMesh->get_entity_owner( tParentIndex, (enum EntityRank)tParentRank );
 
-                // check if new node for current edge has already been requested ...
-                bool tRequestExist = mDecompositionData->request_exists(
+                // Register new node request
+                tNewNodeIndexInSubdivision = mDecompositionData->register_new_request(
                         tParentIndex,
                         tSecondaryId,
+                        tOwningProc,
                         (enum EntityRank)tParentRank,
-                        tNewNodeIndexInSubdivision );
+                        tEdgeIntersections.mGlobalCoordinates( iEdge ) );
 
-                // ... if not request it
-                if ( !tRequestExist )
-                {
-                    // find out which processor owns parent entity of currently treated edge
-                    moris::moris_index tOwningProc = mBackgroundMesh->get_entity_owner( tParentIndex, (enum EntityRank)tParentRank );
-
-                    // Register new node request
-                    tNewNodeIndexInSubdivision = mDecompositionData->register_new_request(
-                            tParentIndex,
-                            tSecondaryId,
-                            tOwningProc,
-                            (enum EntityRank)tParentRank,
-                            mGeometryEngine->get_queued_intersection_global_coordinates() );
-
-                    // create new node in GEN
-                    mGeometryEngine->admit_queued_intersection( tNewNodeIndex );
-
-                    // count number of new nodes created
-                    tNewNodeIndex++;
-                }
-            }
-            else if(mGeometryEngine->queued_intersection_first_parent_on_interface())
-            {
-                moris_index tVertexIndex = aEdgeConnectivity->mEdgeVertices(iEdge)(0)->get_index();
-                mGeometryEngine->induce_as_interface_vertex_on_active_geometry(tVertexIndex);
-            }
-            else if(mGeometryEngine->queued_intersection_second_parent_on_interface())
-            {
-                moris_index tVertexIndex = aEdgeConnectivity->mEdgeVertices(iEdge)(1)->get_index();
-                mGeometryEngine->induce_as_interface_vertex_on_active_geometry(tVertexIndex);
+                // remember the node to be created in GEN
+                tAdmittedEdges.push_back( (moris_index)iEdge );
+                tAdmittedNodeIndices.push_back( tNewNodeIndex );
+
+                // count number of new nodes created
+                tNewNodeIndex++;
             }
         }
+        else if ( tEdgeIntersections.mFirstParentOnInterface( iEdge ) )
+        {
+            moris_index tVertexIndex = aEdgeConnectivity->get_edge_vertex( iEdge, 0 )->get_index();
+            mGeometryEngine->induce_as_interface_vertex_on_active_geometry( tVertexIndex );
+        }
+        else if ( tEdgeIntersections.mSecondParentOnInterface( iEdge ) )
+        {
+            moris_index tVertexIndex = aEdgeConnectivity->get_edge_vertex( iEdge, 1 )->get_index();
+            mGeometryEngine->induce_as_interface_vertex_on_active_geometry( tVertexIndex );
+        }
     }
 
+    // create the new nodes in GEN
+    mGeometryEngine->admit_edge_intersections( tEdgeIntersections, tAdmittedEdges, tAdmittedNodeIndices );
+
     // return success if finished
     return true;
 }
@@ -317,10 +323,10 @@ Node_Hierarchy_Interface::associate_new_vertices_with_cell_groups(
 
         // iterate through elements attached to this edge and collect the cell groups
         tCellGroups.clear();
-        for ( moris::uint iCell = 0; iCell < aEdgeConnectivity->mEdgeToCell( tEdgeIndex ).size(); iCell++ )
+        for ( moris::uint iCell = 0; iCell < aEdgeConnectivity->get_num_cells_on_edge( tEdgeIndex ); iCell++ )
         {
             // integration cell just grab the first
-            moris::mtk::Cell* tCell = aEdgeConnectivity->mEdgeToCell( tEdgeIndex )( iCell );
+            moris::mtk::Cell* tCell = aEdgeConnectivity->get_cell_on_edge( tEdgeIndex, iCell );
 
             // fill list of Cell groups the edge is related to
             tCellGroups.push_back( mCutIntegrationMesh->get_ig_cell_group_memberships( tCell->get_index() )( 0 ) );
@@ -333,7 +339,7 @@ Node_Hierarchy_Interface::associate_new_vertices_with_cell_groups(
         for ( moris::uint iUCG = 0; iUCG < tCellGroups.size(); iUCG++ )
         {
             // get the background cell group associated with this cell
-            MORIS_ERROR( aEdgeConnectivity->mEdgeToCell( tEdgeIndex ).size() > 0, "Edge not connected to any cells..." );
+            MORIS_ERROR( aEdgeConnectivity->get_num_cells_on_edge( tEdgeIndex ) > 0, "Edge not connected to any cells..." );
 
             // cell group membership
             moris_index tCellGroupMembershipIndex = tCellGroups( iUCG );
@@ -342,8 +348,8 @@ Node_Hierarchy_Interface::associate_new_vertices_with_cell_groups(
             std::shared_ptr< IG_Vertex_Group > tVertGroup = mCutIntegrationMesh->get_vertex_group( tCellGroupMembershipIndex );
 
             // get the parametric coord wrt this parent cell
-            std::shared_ptr< Matrix< DDRMat > > tVertex0LocalCoords = tVertGroup->get_vertex_local_coords( aEdgeConnectivity->mEdgeVertices( tEdgeIndex )( 0 )->get_index() );
-            std::shared_ptr< Matrix< DDRMat > > tVertex1LocalCoords = tVertGroup->get_vertex_local_coords( aEdgeConnectivity->mEdgeVertices( tEdgeIndex )( 1 )->get_index() );
+            std::shared_ptr< Matrix< DDRMat > > tVertex0LocalCoords = tVertGroup->get_vertex_local_coords( aEdgeConnectivity->get_edge_vertex( tEdgeIndex, 0 )->get_index() );
+            std::shared_ptr< Matrix< DDRMat > > tVertex1LocalCoords = tVertGroup->get_vertex_local_coords( aEdgeConnectivity->get_edge_vertex( tEdgeIndex, 1 )->get_index() );
 
             // initialize variables to store coords of new vertex
             tEdgeNodeParamCoordinates.set_row( 0, *tVertex0LocalCoords );
@@ -566,13 +572,13 @@ Node_Hierarchy_Interface::determine_intersected_cell_information(
         moris::mtk::Vertex* tVertexOnEdge = mCutIntegrationMesh->get_mtk_vertex_pointer( mDecompositionData->tNewNodeIndex( iEdge ) );
 
         // go through cells attached to current edge
-        for ( moris::uint iCell = 0; iCell < aEdgeConnectivity->mEdgeToCell( tEdgeIndex ).size(); iCell++ )
+        for ( moris::uint iCell = 0; iCell < aEdgeConnectivity->get_num_cells_on_edge( tEdgeIndex ); iCell++ )
         {
             // integration cell with this edge
-            moris::mtk::Cell* tCell = aEdgeConnectivity->mEdgeToCell( tEdgeIndex )( iCell );
+            moris::mtk::Cell* tCell = aEdgeConnectivity->get_cell_on_edge( tEdgeIndex, iCell );
 
             // integration cell edge ordinal
-            moris_index tSideOrdinal = aEdgeConnectivity->mEdgeToCellEdgeOrdinal( tEdgeIndex )( iCell );
+            moris_index tSideOrdinal = aEdgeConnectivity->get_edge_ordinal_on_cell( tEdgeIndex, iCell );
 
             if ( ( *aCellIndexIntersectedEdgeOrdinals )( tCell->get_index() ) == nullptr )
             {
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * UT_XTK_Bounding_Volume_Hierarchy.cpp
+ *
+ */
+
+#include "catch.hpp"
+
+#include <algorithm>
+#include <random>
+
+#include "cl_XTK_Bounding_Volume_Hierarchy.hpp"
+
+namespace xtk
+{
+    // brute force search for comparison
+    static Cell< moris_index >
+    find_overlapping_boxes(
+            Matrix< DDRMat > const & aBoxMin,
+            Matrix< DDRMat > const & aBoxMax,
+            Matrix< DDRMat > const & aMin,
+            Matrix< DDRMat > const & aMax )
+    {
+        Cell< moris_index > tOverlaps;
+
+        for ( uint iBox = 0; iBox < aBoxMin.n_cols(); iBox++ )
+        {
+            bool tOverlap = true;
+
+            for ( uint iDim = 0; iDim < aBoxMin.n_rows(); iDim++ )
+            {
+                tOverlap = tOverlap and aBoxMin( iDim, iBox ) <= aMax( iDim ) and aBoxMax( iDim, iBox ) >= aMin( iDim );
+            }
+
+            if ( tOverlap )
+            {
+                tOverlaps.push_back( iBox );
+            }
+        }
+
+        return tOverlaps;
+    }
+
+    TEST_CASE( "Bounding Volume Hierarchy", "[XTK],[BVH]" )
+    {
+        std::mt19937                       tGenerator( 17 );
+        std::uniform_real_distribution<>   tPosition( 0.0, 10.0 );
+        std::uniform_real_distribution<>   tSize( 0.0, 0.5 );
+
+        uint tSpatialDim = 3;
+        uint tNumBoxes   = 1000;
+
+        Matrix< DDRMat > tBoxMin( tSpatialDim, tNumBoxes );
+        Matrix< DDRMat > tBoxMax( tSpatialDim, tNumBoxes );
+
+        for ( uint iBox = 0; iBox < tNumBoxes; iBox++ )
+        {
+            for ( uint iDim = 0; iDim < tSpatialDim; iDim++ )
+            {
+                tBoxMin( iDim, iBox ) = tPosition( tGenerator );
+                tBoxMax( iDim, iBox ) = tBoxMin( iDim, iBox ) + tSize( tGenerator );
+            }
+        }
+
+        Bounding_Volume_Hierarchy tBVH;
+        tBVH.build( tBoxMin, tBoxMax );
+
+        CHECK( tBVH.get_num_primitives() == tNumBoxes );
+        CHECK( tBVH.get_num_nodes() < 2 * tNumBoxes );
+
+        // queries return the same boxes as the brute force search
+        auto tCheckQueries = [ & ]()
+        {
+            for ( uint iQuery = 0; iQuery < 100; iQuery++ )
+            {
+                Matrix< DDRMat > tMin( tSpatialDim, 1 );
+                Matrix< DDRMat > tMax( tSpatialDim, 1 );
+
+                for ( uint iDim = 0; iDim < tSpatialDim; iDim++ )
+                {
+                    tMin( iDim ) = tPosition( tGenerator );
+                    tMax( iDim ) = tMin( iDim ) + 4.0 * tSize( tGenerator );
+                }
+
+                Cell< moris_index > tCandidates;
+                tBVH.query( tMin, tMax, tCandidates );
+
+                std::sort( tCandidates.begin(), tCandidates.end() );
+
+                CHECK( tCandidates.data() == find_overlapping_boxes( tBoxMin, tBoxMax, tMin, tMax ).data() );
+            }
+        };
+
+        tCheckQueries();
+
+        // move boxes and refit the hierarchy
+        for ( uint iBox = 0; iBox < tNumBoxes; iBox++ )
+        {
+            for ( uint iDim = 0; iDim < tSpatialDim; iDim++ )
+            {
+                real tShift = 0.1 * tSize( tGenerator ) * ( iBox % 2 == 0 ? 1.0 : -1.0 );
+
+                tBoxMin( iDim, iBox ) += tShift;
+                tBoxMax( iDim, iBox ) += tShift;
+            }
+        }
+
+        tBVH.refit( tBoxMin, tBoxMax );
+
+        tCheckQueries();
+    }
+}    // namespace xtk
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * UT_XTK_Contact_Sandbox.cpp
+ *
+ */
+
+#include "catch.hpp"
+#include <string>
+#include "cl_Cell.hpp"
+
+#include "cl_XTK_Contact_Sandbox.hpp"
+#include "cl_XTK_Model.hpp"
+#include "cl_XTK_Enriched_Integration_Mesh.hpp"
+#include "cl_HMR.hpp"
+#include "cl_GEN_Geometry_Engine.hpp"
+#include "cl_Communication_Tools.hpp"
+
+#include "fn_norm.hpp"
+#include "op_minus.hpp"
+#include "op_plus.hpp"
+#include "op_times.hpp"
+
+#include "fn_PRM_HMR_Parameters.hpp"
+#include "fn_PRM_GEN_Parameters.hpp"
+#include "fn_PRM_XTK_Parameters.hpp"
+#include "cl_Param_List.hpp"
+
+namespace xtk
+{
+    namespace
+    {
+        // keeps the performers alive as long as the integration mesh is used
+        struct Contact_Setup
+        {
+            std::shared_ptr< hmr::HMR >            mHMR;
+            std::shared_ptr< ge::Geometry_Engine > mGEN;
+            std::shared_ptr< mtk::Mesh_Manager >   mBGMTK;
+            std::shared_ptr< mtk::Mesh_Manager >   mOutputMTK;
+            std::shared_ptr< xtk::Model >          mXTK;
+        };
+
+        /**
+         * two vertical planes at x = -0.05 and x = 0.05 split the domain into the bulk phases 0 ( left ), 2 ( middle )
+         * and 3 ( right ). The interface side sets of the left and the right block face each other with a gap of 0.1.
+         */
+        void
+        create_two_block_mesh( Contact_Setup& aSetup )
+        {
+            moris::ParameterList tXTKParams = prm::create_xtk_parameter_list();
+            tXTKParams.set( "decompose", true );
+            tXTKParams.set( "decomposition_type", "conformal" );
+            tXTKParams.set( "enrich", true );
+            tXTKParams.set( "basis_rank", "bspline" );
+            tXTKParams.set( "enrich_mesh_indices", "0" );
+            tXTKParams.set( "ghost_stab", false );
+            tXTKParams.set( "multigrid", false );
+
+            moris::Cell< moris::Cell< moris::ParameterList > > tGENParams( 3 );
+            tGENParams( 0 ).resize( 1 );
+            tGENParams( 1 ).resize( 2 );
+            tGENParams( 0 )( 0 ) = prm::create_gen_parameter_list();
+            tGENParams( 1 )( 0 ) = prm::create_geometry_parameter_list();
+            tGENParams( 1 )( 0 ).set( "type", "plane" );
+            tGENParams( 1 )( 0 ).set( "constant_parameters", "-0.05, 0.0, 1.0, 0.0" );
+            tGENParams( 1 )( 1 ) = prm::create_geometry_parameter_list();
+            tGENParams( 1 )( 1 ).set( "type", "plane" );
+            tGENParams( 1 )( 1 ).set( "constant_parameters", "0.05, 0.0, 1.0, 0.0" );
+
+            moris::ParameterList tHMRParams = prm::create_hmr_parameter_list();
+            tHMRParams.set( "number_of_elements_per_dimension", std::string( "10, 10" ) );
+            tHMRParams.set( "domain_dimensions", std::string( "2.0, 2.0" ) );
+            tHMRParams.set( "domain_offset", std::string( "-1.0, -1.0" ) );
+            tHMRParams.set( "domain_sidesets", std::string( "1,2,3,4" ) );
+            tHMRParams.set( "lagrange_output_meshes", std::string( "0" ) );
+            tHMRParams.set( "lagrange_orders", std::string( "1" ) );
+            tHMRParams.set( "lagrange_pattern", std::string( "0" ) );
+            tHMRParams.set( "bspline_orders", std::string( "1" ) );
+            tHMRParams.set( "bspline_pattern", std::string( "0" ) );
+            tHMRParams.set( "lagrange_to_bspline", std::string( "0" ) );
+            tHMRParams.set( "truncate_bsplines", 1 );
+            tHMRParams.set( "refinement_buffer", 1 );
+            tHMRParams.set( "staircase_buffer", 1 );
+            tHMRParams.set( "initial_refinement", std::string( "0" ) );
+            tHMRParams.set( "initial_refinement_pattern", std::string( "0" ) );
+            tHMRParams.set( "use_number_aura", 1 );
+            tHMRParams.set( "use_multigrid", 0 );
+            tHMRParams.set( "severity_level", 0 );
+
+            aSetup.mHMR       = std::make_shared< hmr::HMR >( tHMRParams );
+            aSetup.mGEN       = std::make_shared< ge::Geometry_Engine >( tGENParams, nullptr );
+            aSetup.mBGMTK     = std::make_shared< mtk::Mesh_Manager >();
+            aSetup.mOutputMTK = std::make_shared< mtk::Mesh_Manager >();
+            aSetup.mXTK       = std::make_shared< xtk::Model >( tXTKParams );
+
+            aSetup.mHMR->set_performer( aSetup.mBGMTK );
+
+            aSetup.mXTK->set_geometry_engine( aSetup.mGEN.get() );
+            aSetup.mXTK->set_input_performer( aSetup.mBGMTK );
+            aSetup.mXTK->set_output_performer( aSetup.mOutputMTK );
+
+            aSetup.mHMR->perform_initial_refinement();
+            aSetup.mHMR->perform();
+
+            aSetup.mGEN->distribute_advs( aSetup.mBGMTK->get_mesh_pair( 0 ), {} );
+
+            aSetup.mXTK->perform_decomposition();
+            aSetup.mXTK->perform_enrichment();
+        }
+
+        // total length of the facets summed over all processors
+        real
+        compute_facet_length(
+                Cell< Contact_Facet > const & aFacets,
+                uint                          aNumFacets )
+        {
+            real tLength = 0.0;
+
+            for ( uint iFacet = 0; iFacet < aNumFacets; iFacet++ )
+            {
+                tLength += norm( aFacets( iFacet ).mCurrentCoords.get_row( 1 ) - aFacets( iFacet ).mCurrentCoords.get_row( 0 ) );
+            }
+
+            return sum_all( tLength );
+        }
+
+        // checks that all integration points are paired and projected straight across the gap
+        void
+        check_facet_pairs(
+                Contact_Sandbox const &            aSandbox,
+                Cell< Contact_Facet_Pair > const & aPairs,
+                uint                               aNumPointsPerFacet,
+                real                               aGap )
+        {
+            Cell< Contact_Facet > const & tFacets0 = aSandbox.get_facets( 0 );
+            Cell< Contact_Facet > const & tFacets1 = aSandbox.get_facets( 1 );
+
+            uint tNumPairedPoints = 0;
+
+            for ( uint iPair = 0; iPair < aPairs.size(); iPair++ )
+            {
+                Contact_Facet_Pair const & tPair = aPairs( iPair );
+
+                REQUIRE( tPair.mFacet < (moris_index)tFacets0.size() );
+                REQUIRE( tPair.mCandidateFacet < (moris_index)tFacets1.size() );
+
+                Matrix< DDRMat > const & tCandidateCoords = tFacets1( tPair.mCandidateFacet ).mPredictedCoords;
+
+                for ( uint iPoint = 0; iPoint < tPair.mGaps.numel(); iPoint++ )
+                {
+                    Matrix< DDRMat > tExpectedPoint = tPair.mIntegPoints.get_row( iPoint );
+                    tExpectedPoint( 0 ) += aGap;
+
+                    CHECK( std::abs( tPair.mGaps( iPoint ) - aGap ) < 1e-12 );
+                    CHECK( norm( tPair.mProjectedPoints.get_row( iPoint ) - tExpectedPoint ) < 1e-12 );
+
+                    // projected points are the weighted vertices of the candidate facet
+                    Matrix< DDRMat > tParamCoords = tPair.mProjectedParamCoords.get_row( iPoint );
+
+                    CHECK( std::abs( tParamCoords( 0 ) + tParamCoords( 1 ) - 1.0 ) < 1e-12 );
+                    CHECK( norm( tParamCoords * tCandidateCoords - tExpectedPoint ) < 1e-12 );
+                }
+
+                tNumPairedPoints += tPair.mGaps.numel();
+            }
+
+            CHECK( sum_all( tNumPairedPoints ) == sum_all( (uint)tFacets0.size() ) * aNumPointsPerFacet );
+        }
+    }    // namespace
+
+    TEST_CASE( "Contact Sandbox Project Point On Facet", "[XTK],[XTK_Contact_Sandbox]" )
+    {
+        Matrix< DDRMat > tProjectedPoint;
+        Matrix< DDRMat > tParamCoords;
+
+        auto tCheckProjection = [ & ](
+                                        Matrix< DDRMat > const & aPoint,
+                                        Matrix< DDRMat > const & aFacetCoords,
+                                        Matrix< DDRMat > const & aExpectedPoint,
+                                        Matrix< DDRMat > const & aExpectedParamCoords )
+        {
+            real tDistance = Contact_Sandbox::project_point_on_facet( aPoint, aFacetCoords, tProjectedPoint, tParamCoords );
+
+            CHECK( norm( tProjectedPoint - aExpectedPoint ) < 1e-12 );
+            CHECK( norm( tParamCoords - aExpectedParamCoords ) < 1e-12 );
+            CHECK( std::abs( tDistance - norm( aPoint - aExpectedPoint ) ) < 1e-12 );
+        };
+
+        SECTION( "Line" )
+        {
+            Matrix< DDRMat > tLine = { { 0.0, 0.0 }, { 2.0, 0.0 } };
+
+            // interior and both end points
+            tCheckProjection( { { 0.5, 1.0 } }, tLine, { { 0.5, 0.0 } }, { { 0.75, 0.25 } } );
+            tCheckProjection( { { -1.0, 1.0 } }, tLine, { { 0.0, 0.0 } }, { { 1.0, 0.0 } } );
+            tCheckProjection( { { 3.0, -1.0 } }, tLine, { { 2.0, 0.0 } }, { { 0.0, 1.0 } } );
+        }
+
+        SECTION( "Triangle" )
+        {
+            Matrix< DDRMat > tTriangle = { { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } };
+
+            // vertex regions
+            tCheckProjection( { { -1.0, -1.0, 0.5 } }, tTriangle, { { 0.0, 0.0, 0.0 } }, { { 1.0, 0.0, 0.0 } } );
+            tCheckProjection( { { 2.0, -0.5, 0.0 } }, tTriangle, { { 1.0, 0.0, 0.0 } }, { { 0.0, 1.0, 0.0 } } );
+            tCheckProjection( { { -0.5, 2.0, 0.0 } }, tTriangle, { { 0.0, 1.0, 0.0 } }, { { 0.0, 0.0, 1.0 } } );
+
+            // edge regions
+            tCheckProjection( { { 0.25, -1.0, 0.5 } }, tTriangle, { { 0.25, 0.0, 0.0 } }, { { 0.75, 0.25, 0.0 } } );
+            tCheckProjection( { { -1.0, 0.5, 0.0 } }, tTriangle, { { 0.0, 0.5, 0.0 } }, { { 0.5, 0.0, 0.5 } } );
+            tCheckProjection( { { 1.0, 1.0, 0.3 } }, tTriangle, { { 0.5, 0.5, 0.0 } }, { { 0.0, 0.5, 0.5 } } );
+
+            // face region
+            tCheckProjection( { { 0.25, 0.25, -2.0 } }, tTriangle, { { 0.25, 0.25, 0.0 } }, { { 0.5, 0.25, 0.25 } } );
+        }
+    }
+
+    TEST_CASE( "Contact Sandbox Two Blocks", "[XTK],[XTK_Contact_Sandbox]" )
+    {
+        if ( par_size() == 1 or par_size() == 2 )
+        {
+            Contact_Setup tSetup;
+            create_two_block_mesh( tSetup );
+
+            Enriched_Integration_Mesh& tIgMesh = tSetup.mXTK->get_enriched_integ_mesh();
+
+            std::string tContactSet0 = "iside_b0_0_b1_2";
+            std::string tContactSet1 = "iside_b0_3_b1_2";
+
+            // two integration points per facet
+            Matrix< DDRMat > tIntegWeights = { { 0.75, 0.25 }, { 0.25, 0.75 } };
+
+            // no displacements in the reference configuration
+            Matrix< DDRMat > tNoDisp;
+
+            Contact_Sandbox tSandbox( &tIgMesh, tContactSet0, tContactSet1, 0.15, 0.05 );
+
+            tSandbox.perform_global_contact_search( tNoDisp, tNoDisp );
+
+            // facet collection: owned facets cover both interfaces exactly once
+            Cell< Contact_Facet > const & tFacets0 = tSandbox.get_facets( 0 );
+            Cell< Contact_Facet > const & tFacets1 = tSandbox.get_facets( 1 );
+
+            uint tNumOwnedFacets1 = tFacets1.size() - tSandbox.get_num_ghost_facets();
+
+            CHECK( std::abs( compute_facet_length( tFacets0, tFacets0.size() ) - 2.0 ) < 1e-12 );
+            CHECK( std::abs( compute_facet_length( tFacets1, tNumOwnedFacets1 ) - 2.0 ) < 1e-12 );
+
+            for ( uint iFacet = 0; iFacet < tFacets0.size(); iFacet++ )
+            {
+                CHECK( tFacets0( iFacet ).mOwner == par_rank() );
+                CHECK( std::abs( tFacets0( iFacet ).mCurrentCoords( 0, 0 ) + 0.05 ) < 1e-12 );
+                CHECK( std::abs( tFacets0( iFacet ).mCurrentCoords( 1, 0 ) + 0.05 ) < 1e-12 );
+            }
+
+            // ghost facets carry the coordinates of their owner but no local vertices
+            for ( uint iFacet = 0; iFacet < tFacets1.size(); iFacet++ )
+            {
+                bool tIsGhost = iFacet >= tNumOwnedFacets1;
+
+                CHECK( ( tFacets1( iFacet ).mOwner != par_rank() ) == tIsGhost );
+                CHECK( ( tFacets1( iFacet ).mVertexIndices.numel() == 0 ) == tIsGhost );
+                CHECK( std::abs( tFacets1( iFacet ).mCurrentCoords( 0, 0 ) - 0.05 ) < 1e-12 );
+                CHECK( std::abs( tFacets1( iFacet ).mCurrentCoords( 1, 0 ) - 0.05 ) < 1e-12 );
+            }
+
+            if ( par_size() == 1 )
+            {
+                CHECK( tSandbox.get_num_ghost_facets() == 0 );
+            }
+            else
+            {
+                // facets of the second set next to the processor boundary are ghosted
+                CHECK( sum_all( tSandbox.get_num_ghost_facets() ) > 0 );
+            }
+
+            // facet pairs across the gap
+            Cell< Contact_Facet_Pair > tPairs = tSandbox.compute_facet_pairs( tIntegWeights );
+
+            check_facet_pairs( tSandbox, tPairs, tIntegWeights.n_cols(), 0.1 );
+
+            // move the right block towards the left block by less than the padding and refit
+            Matrix< DDRMat > tPredictedDisp( tIgMesh.get_num_nodes(), 2, 0.0 );
+
+            for ( uint iNode = 0; iNode < tIgMesh.get_num_nodes(); iNode++ )
+            {
+                if ( tIgMesh.get_node_coordinate( iNode )( 0 ) > 0.0 )
+                {
+                    tPredictedDisp( iNode, 0 ) = -0.02;
+                }
+            }
+
+            tSandbox.refit( tNoDisp, tPredictedDisp );
+
+            for ( uint iFacet = 0; iFacet < tFacets1.size(); iFacet++ )
+            {
+                CHECK( std::abs( tFacets1( iFacet ).mCurrentCoords( 0, 0 ) - 0.05 ) < 1e-12 );
+                CHECK( std::abs( tFacets1( iFacet ).mPredictedCoords( 0, 0 ) - 0.03 ) < 1e-12 );
+                CHECK( std::abs( tFacets1( iFacet ).mPredictedCoords( 1, 0 ) - 0.03 ) < 1e-12 );
+            }
+
+            tPairs = tSandbox.compute_facet_pairs( tIntegWeights );
+
+            check_facet_pairs( tSandbox, tPairs, tIntegWeights.n_cols(), 0.08 );
+
+            // gaps larger than the search distance are not paired, independent of the box padding
+            Contact_Sandbox tShortSandbox( &tIgMesh, tContactSet0, tContactSet1, 0.05, 0.2 );
+
+            tShortSandbox.perform_global_contact_search( tNoDisp, tNoDisp );
+
+            tPairs = tShortSandbox.compute_facet_pairs( tIntegWeights );
+
+            CHECK( sum_all( (uint)tPairs.size() ) == 0 );
+        }
+    }
+}    // namespace xtk
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * UT_XTK_Decomposition_Threads.cpp
+ *
+ */
+
+#include "catch.hpp"
+#include <string>
+#include "cl_Cell.hpp"
+
+#include "cl_XTK_Model.hpp"
+#include "cl_XTK_Cut_Integration_Mesh.hpp"
+#include "cl_HMR.hpp"
+#include "cl_GEN_Geometry_Engine.hpp"
+
+#include "fn_norm.hpp"
+#include "op_minus.hpp"
+
+#include "fn_PRM_HMR_Parameters.hpp"
+#include "fn_PRM_GEN_Parameters.hpp"
+#include "fn_PRM_XTK_Parameters.hpp"
+#include "cl_Param_List.hpp"
+
+namespace xtk
+{
+    namespace
+    {
+        // keeps the performers alive as long as the cut mesh is compared
+        struct Decomposition_Setup
+        {
+            std::shared_ptr< hmr::HMR >            mHMR;
+            std::shared_ptr< ge::Geometry_Engine > mGEN;
+            std::shared_ptr< mtk::Mesh_Manager >   mBGMTK;
+            std::shared_ptr< mtk::Mesh_Manager >   mOutputMTK;
+            std::shared_ptr< xtk::Model >          mXTK;
+        };
+
+        void
+        decompose( Decomposition_Setup& aSetup, sint aNumThreads )
+        {
+            moris::ParameterList tXTKParams = prm::create_xtk_parameter_list();
+            tXTKParams.set( "decompose", true );
+            tXTKParams.set( "decomposition_type", "conformal" );
+            tXTKParams.set( "enrich", false );
+            tXTKParams.set( "ghost_stab", false );
+            tXTKParams.set( "multigrid", false );
+            tXTKParams.set( "flood_fill_threads", aNumThreads );
+
+            // two circles to get several subphases in some of the background cells
+            moris::Cell< moris::Cell< moris::ParameterList > > tGENParams( 3 );
+            tGENParams( 0 ).resize( 1 );
+            tGENParams( 1 ).resize( 2 );
+            tGENParams( 0 )( 0 ) = prm::create_gen_parameter_list();
+            tGENParams( 1 )( 0 ) = prm::create_geometry_parameter_list();
+            tGENParams( 1 )( 0 ).set( "type", "circle" );
+            tGENParams( 1 )( 0 ).set( "constant_parameters", "-0.21, 0.0, 0.43" );
+            tGENParams( 1 )( 1 ) = prm::create_geometry_parameter_list();
+            tGENParams( 1 )( 1 ).set( "type", "circle" );
+            tGENParams( 1 )( 1 ).set( "constant_parameters", "0.23, 0.11, 0.37" );
+
+            moris::ParameterList tHMRParams = prm::create_hmr_parameter_list();
+            tHMRParams.set( "number_of_elements_per_dimension", std::string( "10, 10" ) );
+            tHMRParams.set( "domain_dimensions", std::string( "2.0, 2.0" ) );
+            tHMRParams.set( "domain_offset", std::string( "-1.0, -1.0" ) );
+            tHMRParams.set( "domain_sidesets", std::string( "1,2,3,4" ) );
+            tHMRParams.set( "lagrange_output_meshes", std::string( "0" ) );
+            tHMRParams.set( "lagrange_orders", std::string( "1" ) );
+            tHMRParams.set( "lagrange_pattern", std::string( "0" ) );
+            tHMRParams.set( "bspline_orders", std::string( "1" ) );
+            tHMRParams.set( "bspline_pattern", std::string( "0" ) );
+            tHMRParams.set( "lagrange_to_bspline", std::string( "0" ) );
+            tHMRParams.set( "truncate_bsplines", 1 );
+            tHMRParams.set( "refinement_buffer", 1 );
+            tHMRParams.set( "staircase_buffer", 1 );
+            tHMRParams.set( "initial_refinement", std::string( "0" ) );
+            tHMRParams.set( "initial_refinement_pattern", std::string( "0" ) );
+            tHMRParams.set( "use_number_aura", 1 );
+            tHMRParams.set( "use_multigrid", 0 );
+            tHMRParams.set( "severity_level", 0 );
+
+            aSetup.mHMR       = std::make_shared< hmr::HMR >( tHMRParams );
+            aSetup.mGEN       = std::make_shared< ge::Geometry_Engine >( tGENParams, nullptr );
+            aSetup.mBGMTK     = std::make_shared< mtk::Mesh_Manager >();
+            aSetup.mOutputMTK = std::make_shared< mtk::Mesh_Manager >();
+            aSetup.mXTK       = std::make_shared< xtk::Model >( tXTKParams );
+
+            aSetup.mHMR->set_performer( aSetup.mBGMTK );
+
+            aSetup.mXTK->set_geometry_engine( aSetup.mGEN.get() );
+            aSetup.mXTK->set_input_performer( aSetup.mBGMTK );
+            aSetup.mXTK->set_output_performer( aSetup.mOutputMTK );
+
+            aSetup.mHMR->perform_initial_refinement();
+            aSetup.mHMR->perform();
+
+            aSetup.mGEN->distribute_advs( aSetup.mBGMTK->get_mesh_pair( 0 ), {} );
+
+            aSetup.mXTK->perform_decomposition();
+        }
+    }    // namespace
+
+    TEST_CASE( "Threaded Subphase Flood Fill", "[XTK_Decomposition_Threads]" )
+    {
+        if ( par_size() == 1 )
+        {
+            Decomposition_Setup tSerial;
+            Decomposition_Setup tThreaded;
+
+            decompose( tSerial, 1 );
+            decompose( tThreaded, 4 );
+
+            Cut_Integration_Mesh* tSerialMesh   = tSerial.mXTK->get_cut_integration_mesh();
+            Cut_Integration_Mesh* tThreadedMesh = tThreaded.mXTK->get_cut_integration_mesh();
+
+            // vertices
+            REQUIRE( tSerialMesh->get_num_nodes() == tThreadedMesh->get_num_nodes() );
+
+            for ( uint iVertex = 0; iVertex < tSerialMesh->get_num_nodes(); iVertex++ )
+            {
+                mtk::Vertex const & tVertex         = tSerialMesh->get_mtk_vertex( iVertex );
+                mtk::Vertex const & tThreadedVertex = tThreadedMesh->get_mtk_vertex( iVertex );
+
+                CHECK( tVertex.get_id() == tThreadedVertex.get_id() );
+                CHECK( norm( tVertex.get_coords() - tThreadedVertex.get_coords() ) == 0.0 );
+            }
+
+            // cells and their connectivity
+            REQUIRE( tSerialMesh->get_num_elems() == tThreadedMesh->get_num_elems() );
+
+            for ( uint iCell = 0; iCell < tSerialMesh->get_num_elems(); iCell++ )
+            {
+                Matrix< IdMat > tVertexIds         = tSerialMesh->get_mtk_cell( iCell ).get_vertex_ids();
+                Matrix< IdMat > tThreadedVertexIds = tThreadedMesh->get_mtk_cell( iCell ).get_vertex_ids();
+
+                CHECK( tSerialMesh->get_mtk_cell( iCell ).get_id() == tThreadedMesh->get_mtk_cell( iCell ).get_id() );
+
+                REQUIRE( tVertexIds.numel() == tThreadedVertexIds.numel() );
+
+                for ( uint iVertex = 0; iVertex < tVertexIds.numel(); iVertex++ )
+                {
+                    CHECK( tVertexIds( iVertex ) == tThreadedVertexIds( iVertex ) );
+                }
+            }
+
+            // subphases built from the threaded flood fills
+            REQUIRE( tSerialMesh->get_num_subphases() == tThreadedMesh->get_num_subphases() );
+
+            for ( uint iSubphase = 0; iSubphase < tSerialMesh->get_num_subphases(); iSubphase++ )
+            {
+                CHECK( tSerialMesh->get_subphase_id( iSubphase ) == tThreadedMesh->get_subphase_id( iSubphase ) );
+                CHECK( tSerialMesh->get_subphase_bulk_phase( iSubphase ) == tThreadedMesh->get_subphase_bulk_phase( iSubphase ) );
+
+                moris::Cell< moris::mtk::Cell* > const & tCells         = tSerialMesh->get_subphase_ig_cells( iSubphase )->mIgCellGroup;
+                moris::Cell< moris::mtk::Cell* > const & tThreadedCells = tThreadedMesh->get_subphase_ig_cells( iSubphase )->mIgCellGroup;
+
+                REQUIRE( tCells.size() == tThreadedCells.size() );
+
+                for ( uint iCell = 0; iCell < tCells.size(); iCell++ )
+                {
+                    CHECK( tCells( iCell )->get_id() == tThreadedCells( iCell )->get_id() );
+                }
+            }
+        }
+    }
+}    // namespace xtk
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * UT_XTK_Enrichment_Threads.cpp
+ *
+ */
+
+#include "catch.hpp"
+#include <string>
+#include "cl_Cell.hpp"
+
+#include "cl_XTK_Model.hpp"
+#include "cl_XTK_Enrichment.hpp"
+#include "cl_XTK_Enriched_Interpolation_Mesh.hpp"
+#include "cl_HMR.hpp"
+#include "cl_GEN_Geometry_Engine.hpp"
+#include "cl_MTK_Vertex_Interpolation.hpp"
+
+#include "fn_PRM_HMR_Parameters.hpp"
+#include "fn_PRM_GEN_Parameters.hpp"
+#include "fn_PRM_XTK_Parameters.hpp"
+#include "cl_Param_List.hpp"
+
+namespace xtk
+{
+    namespace
+    {
+        // keeps the performers alive as long as the enrichment is compared
+        struct Enrichment_Setup
+        {
+            std::shared_ptr< hmr::HMR >            mHMR;
+            std::shared_ptr< ge::Geometry_Engine > mGEN;
+            std::shared_ptr< mtk::Mesh_Manager >   mBGMTK;
+            std::shared_ptr< mtk::Mesh_Manager >   mOutputMTK;
+            std::shared_ptr< xtk::Model >          mXTK;
+        };
+
+        void
+        enrich( Enrichment_Setup& aSetup, sint aNumThreads )
+        {
+            moris::ParameterList tXTKParams = prm::create_xtk_parameter_list();
+            tXTKParams.set( "decompose", true );
+            tXTKParams.set( "decomposition_type", "conformal" );
+            tXTKParams.set( "enrich", true );
+            tXTKParams.set( "basis_rank", "bspline" );
+            tXTKParams.set( "enrich_mesh_indices", "0" );
+            tXTKParams.set( "ghost_stab", false );
+            tXTKParams.set( "multigrid", false );
+            tXTKParams.set( "enrichment_threads", aNumThreads );
+
+            // two circles close to each other to get several enrichment levels in some basis supports
+            moris::Cell< moris::Cell< moris::ParameterList > > tGENParams( 3 );
+            tGENParams( 0 ).resize( 1 );
+            tGENParams( 1 ).resize( 2 );
+            tGENParams( 0 )( 0 ) = prm::create_gen_parameter_list();
+            tGENParams( 1 )( 0 ) = prm::create_geometry_parameter_list();
+            tGENParams( 1 )( 0 ).set( "type", "circle" );
+            tGENParams( 1 )( 0 ).set( "constant_parameters", "-0.31, 0.02, 0.27" );
+            tGENParams( 1 )( 1 ) = prm::create_geometry_parameter_list();
+            tGENParams( 1 )( 1 ).set( "type", "circle" );
+            tGENParams( 1 )( 1 ).set( "constant_parameters", "0.29, -0.03, 0.28" );
+
+            moris::ParameterList tHMRParams = prm::create_hmr_parameter_list();
+            tHMRParams.set( "number_of_elements_per_dimension", std::string( "12, 12" ) );
+            tHMRParams.set( "domain_dimensions", std::string( "2.0, 2.0" ) );
+            tHMRParams.set( "domain_offset", std::string( "-1.0, -1.0" ) );
+            tHMRParams.set( "domain_sidesets", std::string( "1,2,3,4" ) );
+            tHMRParams.set( "lagrange_output_meshes", std::string( "0" ) );
+            tHMRParams.set( "lagrange_orders", std::string( "1" ) );
+            tHMRParams.set( "lagrange_pattern", std::string( "0" ) );
+            tHMRParams.set( "bspline_orders", std::string( "1" ) );
+            tHMRParams.set( "bspline_pattern", std::string( "0" ) );
+            tHMRParams.set( "lagrange_to_bspline", std::string( "0" ) );
+            tHMRParams.set( "truncate_bsplines", 1 );
+            tHMRParams.set( "refinement_buffer", 1 );
+            tHMRParams.set( "staircase_buffer", 1 );
+            tHMRParams.set( "initial_refinement", std::string( "0" ) );
+            tHMRParams.set( "initial_refinement_pattern", std::string( "0" ) );
+            tHMRParams.set( "use_number_aura", 1 );
+            tHMRParams.set( "use_multigrid", 0 );
+            tHMRParams.set( "severity_level", 0 );
+
+            aSetup.mHMR       = std::make_shared< hmr::HMR >( tHMRParams );
+            aSetup.mGEN       = std::make_shared< ge::Geometry_Engine >( tGENParams, nullptr );
+            aSetup.mBGMTK     = std::make_shared< mtk::Mesh_Manager >();
+            aSetup.mOutputMTK = std::make_shared< mtk::Mesh_Manager >();
+            aSetup.mXTK       = std::make_shared< xtk::Model >( tXTKParams );
+
+            aSetup.mHMR->set_performer( aSetup.mBGMTK );
+
+            aSetup.mXTK->set_geometry_engine( aSetup.mGEN.get() );
+            aSetup.mXTK->set_input_performer( aSetup.mBGMTK );
+            aSetup.mXTK->set_output_performer( aSetup.mOutputMTK );
+
+            aSetup.mHMR->perform_initial_refinement();
+            aSetup.mHMR->perform();
+
+            aSetup.mGEN->distribute_advs( aSetup.mBGMTK->get_mesh_pair( 0 ), {} );
+
+            aSetup.mXTK->perform_decomposition();
+            aSetup.mXTK->perform_enrichment();
+        }
+
+        template< typename MatrixType >
+        void
+        check_rows_match(
+                moris::Cell< Matrix< MatrixType > > const & aRows,
+                moris::Cell< Matrix< MatrixType > > const & aThreadedRows )
+        {
+            REQUIRE( aRows.size() == aThreadedRows.size() );
+
+            for ( uint iRow = 0; iRow < aRows.size(); iRow++ )
+            {
+                REQUIRE( aRows( iRow ).numel() == aThreadedRows( iRow ).numel() );
+
+                for ( uint iEntry = 0; iEntry < aRows( iRow ).numel(); iEntry++ )
+                {
+                    CHECK( aRows( iRow )( iEntry ) == aThreadedRows( iRow )( iEntry ) );
+                }
+            }
+        }
+    }    // namespace
+
+    TEST_CASE( "Threaded Enrichment", "[XTK_Enrichment_Threads]" )
+    {
+        if ( par_size() == 1 )
+        {
+            Enrichment_Setup tSerial;
+            Enrichment_Setup tThreaded;
+
+            enrich( tSerial, 1 );
+            enrich( tThreaded, 4 );
+
+            Enrichment const & tSerialEnrichment   = tSerial.mXTK->get_basis_enrichment();
+            Enrichment const & tThreadedEnrichment = tThreaded.mXTK->get_basis_enrichment();
+
+            // element and subphase enrichment of every basis function
+            check_rows_match( tSerialEnrichment.get_element_inds_in_basis_support(), tThreadedEnrichment.get_element_inds_in_basis_support() );
+            check_rows_match( tSerialEnrichment.get_element_enrichment_levels_in_basis_support(), tThreadedEnrichment.get_element_enrichment_levels_in_basis_support() );
+            check_rows_match( tSerialEnrichment.get_subphases_loc_inds_in_enriched_basis(), tThreadedEnrichment.get_subphases_loc_inds_in_enriched_basis() );
+
+            // enriched interpolation mesh built from the enrichment
+            Enriched_Interpolation_Mesh& tSerialMesh   = tSerial.mXTK->get_enriched_interp_mesh();
+            Enriched_Interpolation_Mesh& tThreadedMesh = tThreaded.mXTK->get_enriched_interp_mesh();
+
+            REQUIRE( tSerialMesh.get_num_nodes() == tThreadedMesh.get_num_nodes() );
+            REQUIRE( tSerialMesh.get_num_elems() == tThreadedMesh.get_num_elems() );
+
+            for ( uint iVertex = 0; iVertex < tSerialMesh.get_num_nodes(); iVertex++ )
+            {
+                Matrix< IdMat > tBasisIds         = tSerialMesh.get_mtk_vertex( iVertex ).get_interpolation( 0 )->get_ids();
+                Matrix< IdMat > tThreadedBasisIds = tThreadedMesh.get_mtk_vertex( iVertex ).get_interpolation( 0 )->get_ids();
+
+                CHECK( tSerialMesh.get_mtk_vertex( iVertex ).get_id() == tThreadedMesh.get_mtk_vertex( iVertex ).get_id() );
+
+                REQUIRE( tBasisIds.numel() == tThreadedBasisIds.numel() );
+
+                for ( uint iBasis = 0; iBasis < tBasisIds.numel(); iBasis++ )
+                {
+                    CHECK( tBasisIds( iBasis ) == tThreadedBasisIds( iBasis ) );
+                }
+            }
+        }
+    }
+}    // namespace xtk